@@ -81,6 +81,13 @@ namespace Plato
             * \returns Plato::ScalarVector of coordinates: {x0, y0, z0, x1, y1, z1, ..., zN}
             **********************************************************************************/
             virtual void SetCoordinates(Plato::ScalarVector) = 0;
+
+            /******************************************************************************//**
+            * \brief Returns a counter that is incremented each time the coordinates are set.
+            *        Data computed from the coordinates, e.g., cached geometric factors, is
+            *        stale if its version differs.
+            **********************************************************************************/
+            Plato::OrdinalType CoordinatesVersion() const { return mCoordinatesVersion; }
         
             /******************************************************************************//**
             * \brief Returns connectvity for all elements
@@ -196,6 +203,8 @@ namespace Plato
             virtual
             Plato::OrdinalVectorT<const Plato::OrdinalType>
             GetSideSetLocalNodesComplement( std::vector<std::string> aExcludeNames) = 0;
-        
+
+        protected:
+            Plato::OrdinalType mCoordinatesVersion = 0;
     };
 }
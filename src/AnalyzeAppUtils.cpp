@@ -178,5 +178,23 @@ size_t read_num_time_steps_from_pvd_file
 }
 // function read_num_time_steps_from_pvd_file
 
+std::uint64_t
+fingerprint
+(const Plato::ScalarVector & aVector)
+{
+    auto tHostVector = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), aVector);
+    auto tBytes = reinterpret_cast<const unsigned char*>(tHostVector.data());
+    auto tNumBytes = tHostVector.extent(0) * sizeof(Plato::Scalar);
+
+    std::uint64_t tHash = 14695981039346656037ull;
+    for(std::size_t tIndex = 0; tIndex < tNumBytes; tIndex++)
+    {
+        tHash ^= tBytes[tIndex];
+        tHash *= 1099511628211ull;
+    }
+    return tHash;
+}
+// function fingerprint
+
 }
 // namespace Plato
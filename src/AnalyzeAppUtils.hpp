@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <cstdint>
+#include <type_traits>
+
 #include <Teuchos_ParameterList.hpp>
 
 #include "Solutions.hpp"
@@ -147,6 +150,29 @@ extract_solution
 size_t read_num_time_steps_from_pvd_file
 (const std::string & aOutputDirectory,
  const std::string & aFindKeyword);
+
+/******************************************************************************//**
+ * \fn fingerprint
+ * \brief Return a hash of the contents of a scalar vector.  Vectors with equal
+ *        values have equal fingerprints.
+ *
+ * \param [in] aVector scalar vector
+ *
+ * \return 64-bit FNV-1a hash of the vector values
+**********************************************************************************/
+std::uint64_t
+fingerprint
+(const Plato::ScalarVector & aVector);
+
+/******************************************************************************//**
+ * \brief True if the shared data type exposes its host storage through hostData(),
+ *        in which case fields are copied directly between that storage and Analyze.
+**********************************************************************************/
+template<typename SharedDataT, typename = void>
+struct has_host_data : std::false_type {};
+
+template<typename SharedDataT>
+struct has_host_data<SharedDataT, std::void_t<decltype(std::declval<const SharedDataT&>().hostData())>> : std::true_type {};
  
 }
 // namespace Plato
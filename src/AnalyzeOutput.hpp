@@ -2,10 +2,13 @@
 #define PLATO_OUTPUT_HPP
 
 #include <string>
+#include <memory>
+#include <algorithm>
 
 #include <Teuchos_ParameterList.hpp>
 
 #include "Solutions.hpp"
+#include "ParseTools.hpp"
 #include "PlatoUtilities.hpp"
 
 namespace Plato
@@ -81,7 +84,7 @@ namespace Plato
         auto tNumTimeSteps = aSolutionsOutput.getNumTimeSteps();
         auto tNumStates = aStateDataMap.stateDataMaps.size();
 
-        bool tWriteStates = (tNumStates == tNumTimeSteps);
+        bool tWriteStates = (aStateDataMap.numStateSteps() == tNumTimeSteps) && (tNumStates > 0);
         if (!tWriteStates)
         {
             REPORT("State data not provided by physics so not written to output file.");
@@ -106,14 +109,84 @@ namespace Plato
                 }
             }
 
-            if (tWriteStates)
+            auto tStateIndex = aStateDataMap.stateIndex(tStepIndex);
+            if (tWriteStates && tStateIndex >= 0)
             {
-                AddStateData(tWriter, aStateDataMap.getState(tStepIndex), aMesh->NumDimensions());
+                AddStateData(tWriter, aStateDataMap.getState(tStateIndex), aMesh->NumDimensions());
             }
 
             tWriter->Write(/*time_index*/ tStepIndex, /*current_time=*/(Plato::Scalar)tStepIndex);
         }
     }
+
+    /******************************************************************************/ /**
+    * \brief Return a sink that writes each state passed to it to a visualization file.
+    *   The file is (re)created when the first state of a forward solve is written.
+    * \param [in] aOutputFilePath output viz file path
+    * \param [in] aMesh           mesh database
+    **********************************************************************************/
+    inline std::function<void(Plato::OrdinalType, Plato::Scalar, const Plato::DataMap &)>
+    state_output_stream(
+        const std::string & aOutputFilePath,
+              Plato::Mesh   aMesh)
+    {
+        auto tWriter = std::make_shared<Plato::MeshIO>();
+        return [=](Plato::OrdinalType aPlotIndex, Plato::Scalar aTime, const Plato::DataMap & aState)
+        {
+            if (aPlotIndex == 0)
+            {
+                tWriter->reset();
+                *tWriter = Plato::MeshIOFactory::create(aOutputFilePath, aMesh, "Write");
+            }
+            AddStateData(*tWriter, aState, aMesh->NumDimensions());
+            (*tWriter)->Write(aPlotIndex, aTime);
+        };
+    }
+
+    /******************************************************************************/ /**
+    * \brief Parse the 'State Output' sublist, which selects the fields and time steps
+    *   of the saved states.  Without the sublist every field of every step is kept.
+    * \param [in] aProblemParams input problem parameters
+    * \param [in] aMesh          mesh database
+    **********************************************************************************/
+    inline Plato::StateOutputPlan
+    parse_state_output_plan(
+        Teuchos::ParameterList & aProblemParams,
+        Plato::Mesh              aMesh)
+    {
+        Plato::StateOutputPlan tPlan;
+        if (aProblemParams.isSublist("State Output") == false)
+        {
+            return tPlan;
+        }
+        auto & tParams = aProblemParams.sublist("State Output");
+
+        if (tParams.isType<Teuchos::Array<std::string>>("Fields"))
+        {
+            auto tFields = tParams.get<Teuchos::Array<std::string>>("Fields");
+            tPlan.mFields.insert(tFields.begin(), tFields.end());
+        }
+        if (tParams.isType<Teuchos::Array<Plato::Scalar>>("Times"))
+        {
+            auto tTimes = tParams.get<Teuchos::Array<Plato::Scalar>>("Times");
+            tPlan.mTimes.assign(tTimes.begin(), tTimes.end());
+            std::sort(tPlan.mTimes.begin(), tPlan.mTimes.end());
+        }
+        // listed times replace the default stride
+        auto tDefaultStride = tPlan.mTimes.empty() ? 1 : 0;
+        tPlan.mStride = Plato::ParseTools::getParam<Plato::OrdinalType>(tParams, "Stride", tDefaultStride);
+        tPlan.mKeepLast = Plato::ParseTools::getParam<Plato::OrdinalType>(tParams, "Keep Last", 0);
+        if (tPlan.mStride < 0 || tPlan.mKeepLast < 0)
+        {
+            ANALYZE_THROWERR("'State Output': 'Stride' and 'Keep Last' must be non-negative.");
+        }
+
+        if (tParams.isType<std::string>("Streaming File"))
+        {
+            tPlan.mSink = Plato::state_output_stream(tParams.get<std::string>("Streaming File"), aMesh);
+        }
+        return tPlan;
+    }
 }
 // namespace Plato
 
@@ -282,6 +282,7 @@ createProblem(ProblemDefinition& aDefinition)
   mProblem = tProblemFactory.create(mMesh, aDefinition.params, mMachine);
 
   aDefinition.modified = false;
+  mProblemVersion++;
 }
 
 /******************************************************************************/
@@ -295,6 +296,7 @@ void MPMD_App::resetProblemMetaData()
   {
     Kokkos::resize(mControl, tNumLocalVals);
     Kokkos::deep_copy(mControl, 1.0);
+    this->updateControlVersion();
   }
 
   for(auto tGradZ : mCriterionGradientsZ)
@@ -308,6 +310,53 @@ void MPMD_App::resetProblemMetaData()
   }
 }
 
+/******************************************************************************/
+void MPMD_App::updateControlVersion()
+/******************************************************************************/
+{
+  auto tFingerprint = Plato::fingerprint(mControl);
+  if(tFingerprint != mControlFingerprint)
+  {
+    mControlFingerprint = tFingerprint;
+    mControlVersion++;
+  }
+}
+
+/******************************************************************************/
+void MPMD_App::invalidateSolution()
+/******************************************************************************/
+{
+  mProblemVersion++;
+}
+
+/******************************************************************************/
+void MPMD_App::updateSolution()
+/******************************************************************************/
+{
+  std::pair<Plato::OrdinalType, Plato::OrdinalType> tVersion(mProblemVersion, mControlVersion);
+  if(mSolutionVersion == tVersion)
+  {
+    if(mDebugAnalyzeApp == true)
+    {
+      REPORT("Analyze Application: Controls unchanged, reusing the global solution.\n");
+    }
+    return;
+  }
+  mGlobalSolution = mProblem->solution(mControl);
+  mSolutionVersion = tVersion;
+  mNumSolutions++;
+}
+
+/******************************************************************************/
+bool MPMD_App::isCurrent(
+  const std::map<std::string, std::pair<Plato::OrdinalType, Plato::OrdinalType>> & aVersions,
+  const std::string & aCriterion) const
+/******************************************************************************/
+{
+  auto tIterator = aVersions.find(aCriterion);
+  return tIterator != aVersions.end() && tIterator->second == std::make_pair(mProblemVersion, mControlVersion);
+}
+
 /******************************************************************************/
 void MPMD_App::initialize()
 /******************************************************************************/
@@ -321,6 +370,7 @@ void MPMD_App::initialize()
 
   mControl    = Plato::ScalarVector("control", tNumLocalVals);
   Kokkos::deep_copy(mControl, 1.0);
+  this->updateControlVersion();
 
   // parse problem definitions
   //
@@ -712,7 +762,7 @@ void MPMD_App::ComputeCriterion::operator()()
 
     if ( mMyApp->mProblem->criterionIsLinear(mStrCriterion) == false )
     {
-        mMyApp->mGlobalSolution = mMyApp->mProblem->solution(tControl);
+        mMyApp->updateSolution();
     }
 
     tValue = mMyApp->mProblem->criterionValue(tControl, mMyApp->mGlobalSolution, mStrCriterion);
@@ -721,6 +771,7 @@ void MPMD_App::ComputeCriterion::operator()()
     tValue -= mTarget;
     std::cout << "Criterion value minus target:  " << tValue << "\n";
     tGradZ = mMyApp->mProblem->criterionGradient(tControl, mMyApp->mGlobalSolution, mStrCriterion);
+    mMyApp->mGradientZVersions[mStrCriterion] = {mMyApp->mProblemVersion, mMyApp->mControlVersion};
 
     if(mMyApp->mDebugAnalyzeApp == true)
     {
@@ -776,12 +827,13 @@ void MPMD_App::ComputeCriterionX::operator()()
 
     if ( mMyApp->mProblem->criterionIsLinear(mStrCriterion) == false )
     {
-        mMyApp->mGlobalSolution = mMyApp->mProblem->solution(tControl);
+        mMyApp->updateSolution();
     }
     tValue = mMyApp->mProblem->criterionValue(tControl, mMyApp->mGlobalSolution, mStrCriterion);
     std::cout << "Criterion with name '" << mStrCriterion << "' has a value of '" << tValue << "'.\n";
     tValue -= mTarget;
     tGradX = mMyApp->mProblem->criterionGradientX(tControl, mMyApp->mGlobalSolution, mStrCriterion);
+    mMyApp->mGradientXVersions[mStrCriterion] = {mMyApp->mProblemVersion, mMyApp->mControlVersion};
     if(!mOutputFile.empty())
     {
         // create file
@@ -862,7 +914,7 @@ void MPMD_App::ComputeCriterionP::operator()()
     }
 
 #ifdef PLATO_ESP
-    mMyApp->mGlobalSolution = mMyApp->mProblem->solution(mMyApp->mControl);
+    mMyApp->updateSolution();
 
     auto& tGradP = mMyApp->mCriterionVectors[mStrCriterion];
 
@@ -924,7 +976,7 @@ void MPMD_App::ComputeCriterionValue::operator()()
 
     if ( mMyApp->mProblem->criterionIsLinear(mStrCriterion) == false )
     {
-        mMyApp->mGlobalSolution = mMyApp->mProblem->solution(tControl);
+        mMyApp->updateSolution();
     }
     tValue = mMyApp->mProblem->criterionValue(tControl, mMyApp->mGlobalSolution, mStrCriterion);
     std::cout << "Criterion with name '" << mStrCriterion << "' has a value of '" << tValue << "'.\n";
@@ -973,7 +1025,11 @@ void MPMD_App::ComputeCriterionGradient::operator()()
 
     auto tControl = mMyApp->mControl;
     auto& tGradZ  = mMyApp->mCriterionGradientsZ[mStrCriterion];
-    tGradZ = mMyApp->mProblem->criterionGradient(tControl, mMyApp->mGlobalSolution, mStrCriterion);
+    if( mMyApp->isCurrent(mMyApp->mGradientZVersions, mStrCriterion) == false )
+    {
+        tGradZ = mMyApp->mProblem->criterionGradient(tControl, mMyApp->mGlobalSolution, mStrCriterion);
+        mMyApp->mGradientZVersions[mStrCriterion] = {mMyApp->mProblemVersion, mMyApp->mControlVersion};
+    }
 
     if(mMyApp->mDebugAnalyzeApp == true)
     {
@@ -1014,7 +1070,11 @@ void MPMD_App::ComputeCriterionGradientX::operator()()
 
     auto tControl = mMyApp->mControl;
     auto& tGradX  = mMyApp->mCriterionGradientsX[mStrCriterion];
-    tGradX = mMyApp->mProblem->criterionGradientX(tControl, mMyApp->mGlobalSolution, mStrCriterion);
+    if( mMyApp->isCurrent(mMyApp->mGradientXVersions, mStrCriterion) == false )
+    {
+        tGradX = mMyApp->mProblem->criterionGradientX(tControl, mMyApp->mGlobalSolution, mStrCriterion);
+        mMyApp->mGradientXVersions[mStrCriterion] = {mMyApp->mProblemVersion, mMyApp->mControlVersion};
+    }
 
     if(mMyApp->mDebugAnalyzeApp == true)
     {
@@ -1157,7 +1217,7 @@ void MPMD_App::ComputeSolution::operator()()
         REPORT("Analyze Application: Compute Solution Operation.\n");
     }
 
-    mMyApp->mGlobalSolution = mMyApp->mProblem->solution(mMyApp->mControl);
+    mMyApp->updateSolution();
 
     if(mMyApp->mDebugAnalyzeApp == true)
     {
@@ -1288,6 +1348,7 @@ void MPMD_App::UpdateProblem::operator()()
         REPORT("Analyze Application: Update Problem Operation.\n");
     }
     mMyApp->mProblem->updateProblem(mMyApp->mControl, mMyApp->mGlobalSolution);
+    mMyApp->invalidateSolution();
 }
 
 /******************************************************************************/
@@ -1485,10 +1546,11 @@ void MPMD_App::ApplyHelmholtz::operator()()
         REPORT("Analyze Application: Apply Helmholtz Operation.\n");
     }
 
-    mMyApp->mGlobalSolution = mMyApp->mProblem->solution(mMyApp->mControl);
+    mMyApp->updateSolution();
 
     Plato::ScalarVector tFilteredControl = Kokkos::subview(mMyApp->mGlobalSolution.get("State"), 0, Kokkos::ALL());
     Kokkos::deep_copy(mMyApp->mControl, tFilteredControl);
+    mMyApp->updateControlVersion();
 
     if(mMyApp->mDebugAnalyzeApp == true)
     {
@@ -1535,6 +1597,7 @@ void MPMD_App::ApplyHelmholtzGradient::operator()()
 
     std::string tDummyString = "Helmholtz gradient";
     mMyApp->mControl = mMyApp->mProblem->criterionGradient(mMyApp->mControl,tDummyString);
+    mMyApp->updateControlVersion();
 
     if(mMyApp->mDebugAnalyzeApp == true)
     {
@@ -211,6 +211,7 @@ public:
                 apply(mMeshMap, mControl, tMappedControl);
                 Kokkos::deep_copy(mControl, tMappedControl);
             }
+            this->updateControlVersion();
         }
         else if(aName == "Solution")
         {
@@ -219,6 +220,7 @@ public:
             const Plato::OrdinalType tTIME_STEP_INDEX = 0;
             auto tStatesSubView = Kokkos::subview(tState, tTIME_STEP_INDEX, Kokkos::ALL());
             this->copyFieldIntoAnalyze(tStatesSubView, aSharedField);
+            this->invalidateSolution();
         }
     }
 
@@ -432,6 +434,7 @@ public:
                 Plato::ScalarVector tCriterionGradientZ("unmapped", tCriter.extent(0));
                 applyT(mMeshMap, tCriter, tCriterionGradientZ);
                 Kokkos::deep_copy(tCriter, tCriterionGradientZ);
+                mGradientZVersions.erase(tStrCriterion); // mapped in place, no longer cached
             }
             this->copyFieldFromAnalyze(tCriter, aSharedField);
         }
@@ -491,6 +494,12 @@ public:
     **********************************************************************************/
     Plato::ScalarMultiVector getCoords();
 
+    /******************************************************************************//**
+     * \brief Return the number of forward solves, i.e., solves not served by the cache
+     * \return number of forward solves
+    **********************************************************************************/
+    Plato::OrdinalType getNumSolutions() const { return mNumSolutions; }
+
 private:
     // functions
     //
@@ -530,22 +539,63 @@ private:
     **********************************************************************************/
     void resetProblemMetaData();
 
+    /******************************************************************************//**
+     * \fn updateControlVersion
+     * \brief Fingerprint the controls and increment the control version if they
+     * changed.  Call after the controls are imported or modified.
+    **********************************************************************************/
+    void updateControlVersion();
+
+    /******************************************************************************//**
+     * \fn invalidateSolution
+     * \brief Invalidate the cached solution and criterion gradients, e.g., after the
+     * problem is updated or the global solution is imported.
+    **********************************************************************************/
+    void invalidateSolution();
+
+    /******************************************************************************//**
+     * \fn updateSolution
+     * \brief Solve the forward problem unless the global solution was computed with
+     * the current problem and controls.
+    **********************************************************************************/
+    void updateSolution();
+
+    /******************************************************************************//**
+     * \fn isCurrent
+     * \brief Return true if the criterion gradient in the map was computed with the
+     * current problem and controls.
+     * \param [in] aVersions    criterion gradient versions
+     * \param [in] aCriterion   criterion name
+    **********************************************************************************/
+    bool isCurrent(const std::map<std::string, std::pair<Plato::OrdinalType, Plato::OrdinalType>> & aVersions,
+                   const std::string & aCriterion) const;
+
     /******************************************************************************/
     template<typename VectorT, typename SharedDataT>
     void copyFieldIntoAnalyze(VectorT & aDeviceData, const SharedDataT& aSharedField)
     /******************************************************************************/
     {
-        // get data from data layer
-        std::vector<Plato::Scalar> tHostData(aSharedField.size());
-        aSharedField.getData(tHostData);
-        if(mDebugAnalyzeApp == true)
+        // get data from data layer, shared data with host storage is read in place
+        std::vector<Plato::Scalar> tHostData;
+        const Plato::Scalar* tHostPointer = nullptr;
+        if constexpr (Plato::has_host_data<SharedDataT>::value)
+        {
+            tHostPointer = aSharedField.hostData();
+        }
+        else
+        {
+            tHostData.resize(aSharedField.size());
+            aSharedField.getData(tHostData);
+            tHostPointer = tHostData.data();
+        }
+        if(mDebugAnalyzeApp == true && !tHostData.empty())
         {
             REPORT("Analyze Application: Copy Field Into Analyze.\n");
             Plato::print_standard_vector_1D(tHostData, "host data");
         }
 
         // push data from host to device
-        Kokkos::View<Plato::Scalar*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged> tHostView(tHostData.data(), tHostData.size());
+        Kokkos::View<const Plato::Scalar*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged> tHostView(tHostPointer, aSharedField.size());
 
         auto tDeviceView = Kokkos::create_mirror_view(aDeviceData);
         Kokkos::deep_copy(tDeviceView, tHostView);
@@ -568,8 +618,16 @@ private:
             REPORT("Analyze Application: Copy Field From Analyze.\n");
             Plato::print(aDeviceData, "device data");
         }
-        // create kokkos::view around std::vector
+        // shared data with host storage is written in place
         auto tLength = aSharedField.size();
+        if constexpr (Plato::has_host_data<SharedDataT>::value)
+        {
+            Kokkos::View<Plato::Scalar*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged> tDataHostView(aSharedField.hostData(), tLength);
+            Kokkos::deep_copy(tDataHostView, aDeviceData);
+            return;
+        }
+
+        // create kokkos::view around std::vector
         std::vector<Plato::Scalar> tHostData(tLength);
         Kokkos::View<Plato::Scalar*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged> tDataHostView(tHostData.data(), tLength);
 
@@ -620,6 +678,17 @@ private:
     Plato::ScalarVector      mControl;
     Plato::ScalarMultiVector mCoords;
 
+    // solution cache.  Versions are (problem version, control version) pairs.  The
+    // control version increments when the control fingerprint changes and the problem
+    // version increments when the problem is created or updated.
+    std::uint64_t      mControlFingerprint = 0;
+    Plato::OrdinalType mControlVersion = 0;
+    Plato::OrdinalType mProblemVersion = 0;
+    std::pair<Plato::OrdinalType, Plato::OrdinalType> mSolutionVersion = {-1, -1};
+    Plato::OrdinalType mNumSolutions = 0;
+    std::map<std::string, std::pair<Plato::OrdinalType, Plato::OrdinalType>> mGradientZVersions;
+    std::map<std::string, std::pair<Plato::OrdinalType, Plato::OrdinalType>> mGradientXVersions;
+
     std::map<std::string, Plato::Scalar>              mCriterionValues;
     std::map<std::string, std::vector<Plato::Scalar>> mCriterionVectors;
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "SpatialModel.hpp"
+#include "ElementColoring.hpp"
 
 namespace Plato
 {
@@ -1578,4 +1579,148 @@ assemble_transpose_jacobian(
 }
 // function assemble_transpose_jacobian
 
+/***************************************************************************//**
+* \brief Assemble residual vector without atomics.  Cells are processed one color
+*        at a time; cells with the same color share no node, so no two threads
+*        write to the same entry.
+*
+* \tparam NumNodesPerCell    number of nodes per cell
+* \tparam NumDofsPerCell     number of state degree of freedom per cell
+* \tparam StateEntryOrdinal  global-to-local index state map class
+* \tparam Residual           input residual class
+* \tparam ReturnVal          output residual class
+*
+* \param [in]     aColoredCells       workset cells grouped by color
+* \param [in]     aStateEntryOrdinal  global-to-local index state map
+* \param [in]     aResidual           input residual vector
+* \param [in/out] aReturnValue        output residual vector
+*
+*******************************************************************************/
+template<Plato::OrdinalType NumNodesPerCell, Plato::OrdinalType NumDofsPerNode, class StateEntryOrdinal, class Residual, class ReturnVal>
+inline void
+assemble_residual_colored(
+    const Plato::ColoredCells  & aColoredCells,
+    const StateEntryOrdinal    & aStateEntryOrdinal,
+    const Residual             & aResidual,
+          ReturnVal            & aReturnValue)
+{
+    auto tWorksetCells = aColoredCells.mWorksetCells;
+    auto tMeshCells = aColoredCells.mMeshCells;
+    for(Plato::OrdinalType tColor = 0; tColor < aColoredCells.numColors(); tColor++)
+    {
+        auto tBegin = aColoredCells.mColorOffsets[tColor];
+        auto tEnd = aColoredCells.mColorOffsets[tColor+1];
+        Kokkos::parallel_for(Kokkos::RangePolicy<Plato::OrdinalType>(tBegin,tEnd), KOKKOS_LAMBDA(const Plato::OrdinalType & aIndex)
+        {
+            auto tWorksetCell = tWorksetCells(aIndex);
+            auto tCellOrdinal = tMeshCells(aIndex);
+            for(Plato::OrdinalType tNodeIndex = 0; tNodeIndex < NumNodesPerCell; tNodeIndex++)
+            {
+                for(Plato::OrdinalType tDofIndex = 0; tDofIndex < NumDofsPerNode; tDofIndex++)
+                {
+                    Plato::OrdinalType tEntryOrdinal = aStateEntryOrdinal(tCellOrdinal, tNodeIndex, tDofIndex);
+                    aReturnValue(tEntryOrdinal) += aResidual(tWorksetCell,tNodeIndex*NumDofsPerNode+tDofIndex);
+                }
+            }
+        }, "assemble_residual_colored");
+    }
+}
+// function assemble_residual_colored
+
+/***************************************************************************//**
+* \brief Assemble Jacobian matrix without atomics (see assemble_residual_colored)
+*
+* \tparam MatrixEntriesOrdinal  matrix entries index map class
+* \tparam Jacobian              input Jacobian workset forward automatic differentiation (FAD) class
+* \tparam ReturnVal             output Jacobian FAD class
+*
+* \param [in]     aColoredCells        workset cells grouped by color
+* \param [in]     aNumRowsPerCell      number of rows
+* \param [in]     aNumColumnsPerCell   number of columns
+* \param [in]     aMatrixEntryOrdinal  matrix entries index map
+* \param [in]     aJacobianWorkset     jacobian workset, i.e. jacobian for each element/cell
+* \param [in/out] aReturnValue         assembled Jacobian
+*
+*******************************************************************************/
+template<class MatrixEntriesOrdinal, class Jacobian, class ReturnVal>
+inline void
+assemble_jacobian_fad_colored(
+    const Plato::ColoredCells  & aColoredCells,
+          Plato::OrdinalType     aNumRowsPerCell,
+          Plato::OrdinalType     aNumColumnsPerCell,
+    const MatrixEntriesOrdinal & aMatrixEntryOrdinal,
+    const Jacobian             & aJacobianWorkset,
+          ReturnVal            & aReturnValue)
+{
+    auto tWorksetCells = aColoredCells.mWorksetCells;
+    auto tMeshCells = aColoredCells.mMeshCells;
+    for(Plato::OrdinalType tColor = 0; tColor < aColoredCells.numColors(); tColor++)
+    {
+        auto tBegin = aColoredCells.mColorOffsets[tColor];
+        auto tEnd = aColoredCells.mColorOffsets[tColor+1];
+        Kokkos::parallel_for(Kokkos::RangePolicy<Plato::OrdinalType>(tBegin,tEnd), KOKKOS_LAMBDA(const Plato::OrdinalType & aIndex)
+        {
+            auto tWorksetCell = tWorksetCells(aIndex);
+            auto tCellOrdinal = tMeshCells(aIndex);
+            for(Plato::OrdinalType tRowIndex = 0; tRowIndex < aNumRowsPerCell; tRowIndex++)
+            {
+                for(Plato::OrdinalType tColumnIndex = 0; tColumnIndex < aNumColumnsPerCell; tColumnIndex++)
+                {
+                    Plato::OrdinalType tEntryOrdinal = aMatrixEntryOrdinal(tCellOrdinal, tRowIndex, tColumnIndex);
+                    aReturnValue(tEntryOrdinal) += aJacobianWorkset(tWorksetCell,tRowIndex).dx(tColumnIndex);
+                }
+            }
+        }, "assemble jacobian fad colored");
+    }
+}
+// function assemble_jacobian_fad_colored
+
+/***************************************************************************//**
+* \brief Assemble transpose of Jacobian matrix without atomics (see assemble_residual_colored)
+*
+* \tparam MatrixEntriesOrdinal  matrix entries index map class
+* \tparam Jacobian              input Jacobian workset forward automatic differentiation (FAD) class
+* \tparam ReturnVal             output Jacobian FAD class
+*
+* \param [in]     aColoredCells        workset cells grouped by color
+* \param [in]     aNumRowsPerCell      number of rows
+* \param [in]     aNumColumnsPerCell   number of columns
+* \param [in]     aMatrixEntryOrdinal  matrix entries index map
+* \param [in]     aJacobianWorkset     jacobian workset, i.e. jacobian for each element/cell
+* \param [in/out] aReturnValue         assembled transpose of Jacobian
+*
+*******************************************************************************/
+template<class MatrixEntriesOrdinal, class Jacobian, class ReturnVal>
+inline void
+assemble_transpose_jacobian_colored(
+    const Plato::ColoredCells  & aColoredCells,
+          Plato::OrdinalType     aNumRowsPerCell,
+          Plato::OrdinalType     aNumColumnsPerCell,
+    const MatrixEntriesOrdinal & aMatrixEntryOrdinal,
+    const Jacobian             & aJacobianWorkset,
+          ReturnVal            & aReturnValue)
+{
+    auto tWorksetCells = aColoredCells.mWorksetCells;
+    auto tMeshCells = aColoredCells.mMeshCells;
+    for(Plato::OrdinalType tColor = 0; tColor < aColoredCells.numColors(); tColor++)
+    {
+        auto tBegin = aColoredCells.mColorOffsets[tColor];
+        auto tEnd = aColoredCells.mColorOffsets[tColor+1];
+        Kokkos::parallel_for(Kokkos::RangePolicy<Plato::OrdinalType>(tBegin,tEnd), KOKKOS_LAMBDA(const Plato::OrdinalType & aIndex)
+        {
+            auto tWorksetCell = tWorksetCells(aIndex);
+            auto tCellOrdinal = tMeshCells(aIndex);
+            for(Plato::OrdinalType tRowIndex = 0; tRowIndex < aNumRowsPerCell; tRowIndex++)
+            {
+                for(Plato::OrdinalType tColumnIndex = 0; tColumnIndex < aNumColumnsPerCell; tColumnIndex++)
+                {
+                    Plato::OrdinalType tEntryOrdinal = aMatrixEntryOrdinal(tCellOrdinal, tColumnIndex, tRowIndex);
+                    aReturnValue(tEntryOrdinal) += aJacobianWorkset(tWorksetCell,tRowIndex).dx(tColumnIndex);
+                }
+            }
+        }, "assemble_transpose_jacobian_colored");
+    }
+}
+// function assemble_transpose_jacobian_colored
+
 } // namespace Plato
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+#include "PlatoStaticsTypes.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************//**
+* \brief Return the number of time steps that can be reversed with a number of
+*        free checkpoints and a number of repetitions of each forward step, i.e.,
+*        the binomial coefficient (aNumCheckpoints + aNumRepetitions choose aNumCheckpoints).
+*        The value is capped at aCap to avoid overflow.
+**********************************************************************************/
+inline Plato::OrdinalType
+binomial_checkpoint_capacity(
+    Plato::OrdinalType aNumCheckpoints,
+    Plato::OrdinalType aNumRepetitions,
+    Plato::OrdinalType aCap)
+{
+    double tCapacity = 1.0;
+    for(Plato::OrdinalType tIndex = 1; tIndex <= aNumCheckpoints; tIndex++)
+    {
+        tCapacity = tCapacity * (aNumRepetitions + tIndex) / tIndex;
+        if(tCapacity >= aCap) { return aCap; }
+    }
+    return static_cast<Plato::OrdinalType>(tCapacity + 0.5);
+}
+
+/******************************************************************************//**
+* \brief Return the number of steps to advance from the start of a segment before
+*        taking the next checkpoint in a binomial (revolve) checkpointing schedule.
+*
+* A segment of aNumSteps steps, whose first state is stored, is reversed by
+* advancing to the returned offset, storing that state in one of the
+* aNumFreeCheckpoints free checkpoints, reversing the trailing sub-segment with
+* one checkpoint less, then reversing the leading sub-segment with all free
+* checkpoints.  The offset minimizes the number of times a forward step is
+* repeated (Griewank and Walther, Algorithm 799: revolve).
+*
+* \param [in] aNumSteps           number of steps in the segment (greater than one)
+* \param [in] aNumFreeCheckpoints number of free checkpoints (greater than zero)
+**********************************************************************************/
+inline Plato::OrdinalType
+binomial_checkpoint_offset(
+    Plato::OrdinalType aNumSteps,
+    Plato::OrdinalType aNumFreeCheckpoints)
+{
+    // smallest number of repetitions for which the segment can be reversed
+    Plato::OrdinalType tNumRepetitions = 0;
+    while(Plato::binomial_checkpoint_capacity(aNumFreeCheckpoints, tNumRepetitions, aNumSteps) < aNumSteps)
+    {
+        tNumRepetitions++;
+    }
+
+    // the trailing sub-segment takes as many steps as it can reverse with one checkpoint less
+    auto tTrailing = Plato::binomial_checkpoint_capacity(aNumFreeCheckpoints-1, tNumRepetitions, aNumSteps);
+    return std::min(std::max(aNumSteps - tTrailing, Plato::OrdinalType(1)), aNumSteps - 1);
+}
+
+/******************************************************************************//**
+* \brief Return the steps checkpointed during the initial forward sweep of a
+*        binomial checkpointing schedule, i.e., the checkpoints taken before the
+*        reverse sweep processes the last step.  The initial state (step zero)
+*        is not included.
+* \param [in] aNumSteps       number of time steps, including the initial state
+* \param [in] aNumCheckpoints number of checkpoints, including the initial state
+**********************************************************************************/
+inline std::vector<Plato::OrdinalType>
+binomial_checkpoint_chain(
+    Plato::OrdinalType aNumSteps,
+    Plato::OrdinalType aNumCheckpoints)
+{
+    std::vector<Plato::OrdinalType> tChain;
+    Plato::OrdinalType tBegin = 0;
+    for(Plato::OrdinalType tNumFree = aNumCheckpoints - 1; tNumFree > 0 && aNumSteps - tBegin > 1; tNumFree--)
+    {
+        tBegin += Plato::binomial_checkpoint_offset(aNumSteps - tBegin, tNumFree);
+        tChain.push_back(tBegin);
+    }
+    return tChain;
+}
+
+/******************************************************************************//**
+* \brief Reverse steps aEnd-1 down to aBegin of a segment, step zero excluded, on
+*        a binomial checkpointing schedule.  Checkpoint aSlot stores step aBegin
+*        and the checkpoints after it are free.
+* \param [in] aBegin           first step of the segment
+* \param [in] aEnd             one past the last step of the segment
+* \param [in] aSlot            checkpoint that stores step aBegin
+* \param [in] aCheckpointSteps step stored in each checkpoint, -1 if none
+* \param [in] aCheckpoint      recompute step aStep from checkpoint aSlot and store it in checkpoint aSlot+1
+* \param [in] aReverseStep     recompute step aStep from checkpoint aSlot and reverse it
+**********************************************************************************/
+inline void
+binomial_reverse_segment(
+          Plato::OrdinalType                aBegin,
+          Plato::OrdinalType                aEnd,
+          Plato::OrdinalType                aSlot,
+    const std::vector<Plato::OrdinalType> & aCheckpointSteps,
+    const std::function<void(Plato::OrdinalType aSlot, Plato::OrdinalType aStep)> & aCheckpoint,
+    const std::function<void(Plato::OrdinalType aSlot, Plato::OrdinalType aStep)> & aReverseStep)
+{
+    Plato::OrdinalType tNumFree = static_cast<Plato::OrdinalType>(aCheckpointSteps.size()) - 1 - aSlot;
+    if(aEnd - aBegin == 1 || tNumFree == 0)
+    {
+        for(Plato::OrdinalType tStep = aEnd - 1; tStep >= aBegin && tStep > 0; tStep--)
+        {
+            aReverseStep(aSlot, tStep);
+        }
+        return;
+    }
+
+    // the checkpoint may have been taken by the forward sweep or a previous reverse sweep
+    auto tMid = aBegin + Plato::binomial_checkpoint_offset(aEnd - aBegin, tNumFree);
+    if(aCheckpointSteps[aSlot+1] != tMid)
+    {
+        aCheckpoint(aSlot, tMid);
+    }
+    Plato::binomial_reverse_segment(tMid, aEnd, aSlot+1, aCheckpointSteps, aCheckpoint, aReverseStep);
+    Plato::binomial_reverse_segment(aBegin, tMid, aSlot, aCheckpointSteps, aCheckpoint, aReverseStep);
+}
+
+} // namespace Plato
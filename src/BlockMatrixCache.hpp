@@ -0,0 +1,159 @@
+#pragma once
+
+#include <map>
+#include <vector>
+#include <utility>
+
+#include "PlatoMesh.hpp"
+#include "PlatoStaticsTypes.hpp"
+#include "ImplicitFunctors.hpp"
+
+#include <Teuchos_RCP.hpp>
+
+namespace Plato
+{
+
+/******************************************************************************//**
+* \brief Persistent block sparsity graph and matrix pool for a mesh.
+*
+* The node-node graph (row map and column indices) is built once, on first
+* request, and shared by every block matrix handed out by the cache regardless
+* of its block size.  Matrices are recycled: a pooled matrix is handed out again
+* once no one outside the cache holds a reference to it, in which case only its
+* entries are zeroed.  A matrix still referenced by a caller (e.g., a Jacobian
+* stored by a problem) is never reused, so callers see the same semantics as
+* with Plato::CreateBlockMatrix.
+*
+* Optionally, the cache also holds an element-to-CSR scatter table (see
+* Plato::CreateBlockMatrixScatterMap) so that assembly writes directly into the
+* matrix entries instead of searching each matrix row.
+**********************************************************************************/
+class BlockMatrixCache
+{
+private:
+    using RowMapT  = typename Plato::CrsMatrixType::RowMapVectorT;
+    using OrdinalT = typename Plato::CrsMatrixType::OrdinalVectorT;
+    using ScalarT  = typename Plato::CrsMatrixType::ScalarVectorT;
+
+    /// @brief pooled matrix and the views it was created with
+    struct PoolEntry
+    {
+        Teuchos::RCP<Plato::CrsMatrixType> mMatrix;
+        ScalarT mEntries;
+    };
+
+    Plato::Mesh mMesh;       /*!< mesh the graph is built on */
+    RowMapT     mRowMap;     /*!< cached block row map */
+    OrdinalT    mColumnIndices; /*!< cached block column indices */
+    bool        mHasGraph;   /*!< true once the graph is built */
+
+    bool                 mUseScatterMap; /*!< build and hand out the element-to-CSR scatter table */
+    Plato::OrdinalVector mScatterMap;    /*!< (cell, node I, node J) to block entry ordinal table */
+
+    Plato::OrdinalType mMaxPoolSize; /*!< maximum number of matrices retained per block shape */
+    std::map<std::pair<Plato::OrdinalType,Plato::OrdinalType>, std::vector<PoolEntry>> mPools;
+
+public:
+    /******************************************************************************//**
+    * \brief Constructor
+    * \param [in] aMesh        Plato abstract mesh
+    * \param [in] aMaxPoolSize maximum number of matrices retained per block shape
+    **********************************************************************************/
+    explicit BlockMatrixCache(Plato::Mesh aMesh, Plato::OrdinalType aMaxPoolSize = 4) :
+        mMesh(aMesh),
+        mHasGraph(false),
+        mUseScatterMap(false),
+        mMaxPoolSize(aMaxPoolSize)
+    {}
+
+    /******************************************************************************//**
+    * \brief Enable/disable the element-to-CSR scatter table.  The table costs
+    *        NumCells X NodesPerCell^2 ordinals of device memory.
+    * \param [in] aUseScatterMap flag
+    **********************************************************************************/
+    void useScatterMap(bool aUseScatterMap)
+    {
+        mUseScatterMap = aUseScatterMap;
+        if(!mUseScatterMap) { mScatterMap = Plato::OrdinalVector(); }
+    }
+
+    /******************************************************************************//**
+    * \brief Return the element-to-CSR scatter table.  The table is built on first
+    *        request.  Returns an empty view if the scatter table is disabled, in
+    *        which case Plato::BlockMatrixEntryOrdinal falls back to a row search.
+    **********************************************************************************/
+    template<Plato::OrdinalType NodesPerCell>
+    Plato::OrdinalVector
+    scatterMap()
+    {
+        if(!mUseScatterMap) { return Plato::OrdinalVector(); }
+        if(mScatterMap.extent(0) == 0)
+        {
+            this->buildGraph();
+            mScatterMap = Plato::CreateBlockMatrixScatterMap<Plato::CrsMatrixType, NodesPerCell>(mMesh, mRowMap, mColumnIndices);
+        }
+        return mScatterMap;
+    }
+
+    /******************************************************************************//**
+    * \brief Return a zeroed block matrix with block size DofsPerNode_I X DofsPerNode_J
+    *        built on the cached graph.
+    **********************************************************************************/
+    template<Plato::OrdinalType DofsPerNode_I, Plato::OrdinalType DofsPerNode_J=DofsPerNode_I>
+    Teuchos::RCP<Plato::CrsMatrixType>
+    matrix()
+    {
+        this->buildGraph();
+
+        auto& tPool = mPools[std::make_pair(DofsPerNode_I, DofsPerNode_J)];
+        for(auto& tEntry : tPool)
+        {
+            if(tEntry.mMatrix.strong_count() == 1)
+            {
+                // views may have been replaced by in-place operations (e.g., condensation)
+                tEntry.mMatrix->setRowMap(mRowMap);
+                tEntry.mMatrix->setColumnIndices(mColumnIndices);
+                tEntry.mMatrix->setEntries(tEntry.mEntries);
+                Kokkos::deep_copy(tEntry.mEntries, 0.0);
+                return tEntry.mMatrix;
+            }
+        }
+
+        constexpr Plato::OrdinalType tNumBlockDofs = DofsPerNode_I*DofsPerNode_J;
+        Plato::OrdinalType tNumRows = mRowMap.extent(0) - 1;
+        ScalarT tEntries("matrix entries", mColumnIndices.extent(0)*tNumBlockDofs);
+        auto tMatrix = Teuchos::rcp(
+          new Plato::CrsMatrixType( mRowMap, mColumnIndices, tEntries,
+                                    tNumRows*DofsPerNode_I, tNumRows*DofsPerNode_J,
+                                    DofsPerNode_I, DofsPerNode_J )
+        );
+        if(static_cast<Plato::OrdinalType>(tPool.size()) < mMaxPoolSize)
+        {
+            tPool.push_back(PoolEntry{tMatrix, tEntries});
+        }
+        return tMatrix;
+    }
+
+    /******************************************************************************//**
+    * \brief Release all pooled matrices and the cached graph.
+    **********************************************************************************/
+    void clear()
+    {
+        mPools.clear();
+        mRowMap = RowMapT();
+        mColumnIndices = OrdinalT();
+        mScatterMap = Plato::OrdinalVector();
+        mHasGraph = false;
+    }
+
+private:
+    void buildGraph()
+    {
+        if(mHasGraph) { return; }
+        Plato::CreateBlockMatrixGraph<Plato::CrsMatrixType>(mMesh, mRowMap, mColumnIndices);
+        mHasGraph = true;
+    }
+};
+// class BlockMatrixCache
+
+} // namespace Plato
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <map>
+#include <tuple>
+#include <cassert>
+#include <vector>
+
+#include "PlatoMesh.hpp"
+#include "SpatialModel.hpp"
+#include "PlatoStaticsTypes.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************//**
+* \brief Cells of a workset grouped by color.  Cells with the same color share no
+*        node, so they can scatter into global containers without atomics.
+**********************************************************************************/
+struct ColoredCells
+{
+    std::vector<Plato::OrdinalType> mColorOffsets; /*!< host offsets into the cell lists, size = number of colors + 1 */
+    Plato::OrdinalVector mWorksetCells;            /*!< workset-local cell indices grouped by color */
+    Plato::OrdinalVector mMeshCells;               /*!< mesh-local cell ordinals grouped by color */
+
+    /******************************************************************************//**
+    * \brief Return number of colors
+    **********************************************************************************/
+    Plato::OrdinalType numColors() const
+    {
+        return mColorOffsets.empty() ? 0 : mColorOffsets.size() - 1;
+    }
+};
+
+/******************************************************************************//**
+* \brief Element coloring of a mesh.
+*
+* The coloring is computed once, on the host, with a greedy first-fit pass over
+* the elements in mesh order using the node-element graph.  Two elements have
+* different colors if they share a node.  The coloring is deterministic, hence
+* so is the order in which colored assembly accumulates element contributions.
+**********************************************************************************/
+class ElementColoring
+{
+private:
+    std::vector<Plato::OrdinalType> mCellColors; /*!< color of each mesh cell */
+    Plato::OrdinalType mNumColors;               /*!< number of colors */
+
+    ColoredCells mMeshColoredCells; /*!< all mesh cells grouped by color */
+
+    /// @brief cached domain groupings, keyed on the domain cell list.  A domain
+    ///        evaluated in cell batches holds one entry per batch.
+    struct DomainEntry
+    {
+        Plato::OrdinalVector mCellOrdinals;
+        ColoredCells mColoredCells;
+    };
+    using DomainKey = std::tuple<std::string, const Plato::OrdinalType*, std::size_t>;
+    std::map<DomainKey, DomainEntry> mDomainColoredCells;
+
+public:
+    /******************************************************************************//**
+    * \brief Constructor
+    * \param [in] aMesh Plato abstract mesh
+    **********************************************************************************/
+    explicit ElementColoring(Plato::Mesh aMesh) :
+        mNumColors(0)
+    {
+        this->colorElements(aMesh);
+
+        auto tNumCells = aMesh->NumElements();
+        std::vector<Plato::OrdinalType> tMeshCells(tNumCells);
+        for(Plato::OrdinalType tCell = 0; tCell < tNumCells; tCell++) { tMeshCells[tCell] = tCell; }
+        mMeshColoredCells = this->groupByColor(tMeshCells);
+    }
+
+    /******************************************************************************//**
+    * \brief Return number of colors
+    **********************************************************************************/
+    Plato::OrdinalType numColors() const { return mNumColors; }
+
+    /******************************************************************************//**
+    * \brief Return color of each mesh cell
+    **********************************************************************************/
+    const std::vector<Plato::OrdinalType> & cellColors() const { return mCellColors; }
+
+    /******************************************************************************//**
+    * \brief Return all mesh cells grouped by color
+    **********************************************************************************/
+    const ColoredCells & cells() const { return mMeshColoredCells; }
+
+    /******************************************************************************//**
+    * \brief Return the cells of a spatial domain grouped by color.  The grouping is
+    *        cached and rebuilt only if the domain cell list changes, e.g., after a mask
+    *        is applied.
+    * \param [in] aDomain spatial domain
+    **********************************************************************************/
+    const ColoredCells & cells(const Plato::SpatialDomain & aDomain)
+    {
+        const auto & tCellOrdinals = aDomain.cellOrdinals();
+        DomainKey tKey(aDomain.getDomainName(), tCellOrdinals.data(), tCellOrdinals.extent(0));
+        auto tItr = mDomainColoredCells.find(tKey);
+        if( tItr != mDomainColoredCells.end() )
+        {
+            return tItr->second.mColoredCells;
+        }
+
+        auto tHostCellOrdinals = Kokkos::create_mirror_view(tCellOrdinals);
+        Kokkos::deep_copy(tHostCellOrdinals, tCellOrdinals);
+        std::vector<Plato::OrdinalType> tMeshCells(tHostCellOrdinals.extent(0));
+        for(std::size_t tIndex = 0; tIndex < tMeshCells.size(); tIndex++) { tMeshCells[tIndex] = tHostCellOrdinals(tIndex); }
+
+        auto & tEntry = mDomainColoredCells[tKey];
+        tEntry.mCellOrdinals = tCellOrdinals;
+        tEntry.mColoredCells = this->groupByColor(tMeshCells);
+        return tEntry.mColoredCells;
+    }
+
+private:
+    void colorElements(Plato::Mesh aMesh)
+    {
+        auto tNumCells = aMesh->NumElements();
+        auto tNumNodes = aMesh->NumNodes();
+        auto tNodesPerCell = aMesh->NumNodesPerElement();
+
+        Plato::OrdinalVectorT<const Plato::OrdinalType> tOffsets;
+        Plato::OrdinalVectorT<const Plato::OrdinalType> tElementOrds;
+        aMesh->NodeElementGraph(tOffsets, tElementOrds);
+
+        auto tHostOffsets = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tOffsets);
+        auto tHostElementOrds = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tElementOrds);
+        auto tHostConnectivity = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), aMesh->Connectivity());
+
+        mCellColors.assign(tNumCells, -1);
+        std::vector<Plato::OrdinalType> tForbidden; // last cell that forbade each color
+        for(Plato::OrdinalType tCell = 0; tCell < tNumCells; tCell++)
+        {
+            for(Plato::OrdinalType tLocalNode = 0; tLocalNode < tNodesPerCell; tLocalNode++)
+            {
+                auto tNode = tHostConnectivity(tCell*tNodesPerCell + tLocalNode);
+                assert(tNode < tNumNodes);
+                for(auto tOffset = tHostOffsets(tNode); tOffset < tHostOffsets(tNode+1); tOffset++)
+                {
+                    auto tColor = mCellColors[tHostElementOrds(tOffset)];
+                    if(tColor >= 0) { tForbidden[tColor] = tCell; }
+                }
+            }
+            Plato::OrdinalType tColor = 0;
+            while(tColor < mNumColors && tForbidden[tColor] == tCell) { tColor++; }
+            if(tColor == mNumColors)
+            {
+                mNumColors++;
+                tForbidden.push_back(-1);
+            }
+            mCellColors[tCell] = tColor;
+        }
+    }
+
+    ColoredCells groupByColor(const std::vector<Plato::OrdinalType> & aMeshCells) const
+    {
+        ColoredCells tColoredCells;
+        tColoredCells.mColorOffsets.assign(mNumColors+1, 0);
+        for(auto tCell : aMeshCells) { tColoredCells.mColorOffsets[mCellColors[tCell]+1]++; }
+        for(Plato::OrdinalType tColor = 0; tColor < mNumColors; tColor++)
+        {
+            tColoredCells.mColorOffsets[tColor+1] += tColoredCells.mColorOffsets[tColor];
+        }
+
+        auto tNumCells = aMeshCells.size();
+        Plato::OrdinalVector tWorksetCells("workset cells by color", tNumCells);
+        Plato::OrdinalVector tMeshCells("mesh cells by color", tNumCells);
+        auto tHostWorksetCells = Kokkos::create_mirror_view(tWorksetCells);
+        auto tHostMeshCells = Kokkos::create_mirror_view(tMeshCells);
+        std::vector<Plato::OrdinalType> tCursor(tColoredCells.mColorOffsets.begin(), tColoredCells.mColorOffsets.end()-1);
+        for(std::size_t tWorksetCell = 0; tWorksetCell < tNumCells; tWorksetCell++)
+        {
+            auto tMeshCell = aMeshCells[tWorksetCell];
+            auto tIndex = tCursor[mCellColors[tMeshCell]]++;
+            tHostWorksetCells(tIndex) = tWorksetCell;
+            tHostMeshCells(tIndex) = tMeshCell;
+        }
+        Kokkos::deep_copy(tWorksetCells, tHostWorksetCells);
+        Kokkos::deep_copy(tMeshCells, tHostMeshCells);
+        tColoredCells.mWorksetCells = tWorksetCells;
+        tColoredCells.mMeshCells = tMeshCells;
+        return tColoredCells;
+    }
+};
+// class ElementColoring
+
+} // namespace Plato
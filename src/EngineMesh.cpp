@@ -521,6 +521,7 @@ namespace Plato
             throw std::runtime_error("Dimension mismatch.  Failed to set coordinates");
         }
         Kokkos::deep_copy(mCoordinates, aCoordinates);
+        mCoordinatesVersion++;
     }
 
     Plato::OrdinalVectorT<const Plato::OrdinalType>
@@ -8,6 +8,11 @@
 namespace Plato
 {
     class EngineMeshIO;
+
+    /******************************************************************************//**
+     * \brief Mesh read from an exodus file.  Every rank reads the full mesh, partitioned
+     *        (nemesis) meshes and ghost layers aren't supported.
+    **********************************************************************************/
     class EngineMesh : public AbstractMesh
     {
         friend EngineMeshIO;
@@ -15,8 +15,9 @@
 
 #include <Sacado.hpp>
 
+#include <map>
 #include <cmath>
-#include <deque>
+#include <tuple>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -25,9 +26,6 @@
 namespace Plato
 {
 
-#define USE_POST_ORDER true
-#define USE_RECURSION false
-
 // ************************************************************************* //
 // Note: It is assumed that the ResultType, StateType, and VectorType
 // are of type Kokkos::View so to properly handle the view of views
@@ -51,12 +49,15 @@ public:
   KOKKOS_INLINE_FUNCTION
   void evaluate_expression( const Plato::OrdinalType thread,
                                   ResultType const & result ) const;
+  void evaluate_expression(       ResultType const & result ) const;
   void   delete_expression();
   void    print_expression(       std::ostream &os,
                             const bool print_val = false ) const;
 
   const std::vector< std::string > & get_variables() const;
 
+  Plato::OrdinalType get_num_instructions() const;
+
   void     setup_storage( const Plato::OrdinalType nThreads,
                           const Plato::OrdinalType nValues );
 
@@ -168,17 +169,39 @@ public:
     Plato::OrdinalType i_right { (Plato::OrdinalType) -1 };
     Plato::OrdinalType i_parent{ (Plato::OrdinalType) -1 };
 
-    // Index into the memory array for storing the intermediate
-    // results.
-    Plato::OrdinalType i_memory { (Plato::OrdinalType) -1 };
-
   } Node;
 
+// ************************************************************************* //
+  // Instruction structure for the compiled expression. The expression
+  // tree is compiled into a sequence of register instructions, each
+  // register is a chunk of temporary memory holding the values of all
+  // threads. During compilation the left and right indexes refer to
+  // other instructions, after compilation they refer to registers.
+  typedef struct _Instruction {
+    NodeID ID{ NodeID::EMPTY_NODE };     // Arithmetic operation
+
+    Plato::Scalar number{ 0 };           // Scalar value
+
+    // Index into the variable list.
+    Plato::OrdinalType i_variable{ (Plato::OrdinalType) -1 };
+
+    // Registers holding the operands and the result. A result
+    // register of -1 is the memory given by the user.
+    Plato::OrdinalType i_left  { (Plato::OrdinalType) -1 };
+    Plato::OrdinalType i_right { (Plato::OrdinalType) -1 };
+    Plato::OrdinalType i_result{ (Plato::OrdinalType) -1 };
+
+  } Instruction;
+
+  // Key used to find common subexpressions during compilation.
+  typedef std::tuple< NodeID, Plato::OrdinalType, Plato::OrdinalType,
+                      Plato::OrdinalType, Plato::Scalar > InstructionKey;
+
 // ************************************************************************* //
   // All theses methods are support methods.
   void commute_expression();
 
-  void traverse_expression();
+  void compile_expression();
 
   Plato::OrdinalType  insertNode(       Plato::OrdinalType i_current,
                                   const Plato::OrdinalType i_new,
@@ -189,13 +212,21 @@ public:
 
   Plato::OrdinalType commuteNode( const Plato::OrdinalType i_node );
 
-  void   traverseNode( const Plato::OrdinalType i_node,
-                       const Plato::OrdinalType depth );
+  Plato::OrdinalType compileNode( const Plato::OrdinalType i_node,
+                                  std::vector< Instruction > & instructions,
+                                  std::map< InstructionKey, Plato::OrdinalType > & table ) const;
+
+  Plato::Scalar foldNumbers( const NodeID ID,
+                             const Plato::Scalar left,
+                             const Plato::Scalar right ) const;
 
   KOKKOS_INLINE_FUNCTION
-  bool   evaluateNode( const Plato::OrdinalType thread,
-                       const Plato::OrdinalType i_node,
-                             ResultType const & result ) const;
+  void   evaluateInstruction( const Plato::OrdinalType thread,
+                              const Instruction & instruction,
+                                    ResultType const & result ) const;
+
+  void   evaluateInstruction( const Instruction & instruction,
+                                    ResultType const & result ) const;
 
   void      clearNode( const Plato::OrdinalType i_node );
   void     deleteNode( const Plato::OrdinalType i_node );
@@ -236,20 +267,17 @@ public:
   Plato::OrdinalType mNodesUsed{ 0 };
   Kokkos::View< Node *, Plato::UVMSpace > mNodes;
 
-  // Total number of nodes in the expression tree and the post order
-  // evaluation.  The array of nodes is constructed on the host and
-  // used on the device.
-  Plato::OrdinalType mNodeCount{ 0 };
-  Kokkos::View< Plato::OrdinalType *, Plato::UVMSpace > mNodeOrder;
+  // Total number of instructions in the compiled expression. The
+  // array of instructions is constructed on the host and used on the
+  // device.
+  Plato::OrdinalType mNumInstructions{ 0 };
+  Kokkos::View< Instruction *, Plato::UVMSpace > mProgram;
 
-  // The maximum number of chunks of temporary memory needed.
+  // The number of chunks of temporary memory (registers) needed.
   Plato::OrdinalType mNumMemoryChunks{ (Plato::OrdinalType) 0 };
 
-  // A queue to hold indexes to the chunks of temporary memory.
-  std::deque<Plato::OrdinalType> mMemQueue;
-
-  // Array holding the results for the nodes. The space is reused
-  // based on the on post order evaluation.
+  // Array holding the results for the registers. The space is reused
+  // once the values of a register are no longer needed.
   Kokkos::View< ResultType *, Plato::UVMSpace > mResults;
 
   // A mapping of the variable names to their coresponding data in the
@@ -640,6 +668,20 @@ get_variables() const
   return mVariableList;
 }
 
+/******************************************************************************//**
+ * \brief get_num_instructions - returns the number of instructions
+ * in the compiled expression.
+ * \return Plato::OrdinalType - the number of instructions
+ **********************************************************************************/
+template< typename ResultType, typename StateType,
+          typename VectorType, typename ScalarType >
+Plato::OrdinalType
+ExpressionEvaluator<ResultType, StateType, VectorType, ScalarType>::
+get_num_instructions() const
+{
+  return mNumInstructions;
+}
+
 /******************************************************************************//**
  * \brief set_variable - Sets auxillary variables that are indexed.
                           and may change depending on the thread.
@@ -995,7 +1037,8 @@ valid_expression( const bool checkVariables ) const
 }
 
 /******************************************************************************//**
- * \brief evaluate_expression - Evaluate the expression tree - public function.
+ * \brief evaluate_expression - Evaluate the compiled expression for
+ * a single thread - public function.
  * \param [in]  thread - thread being evaluated.
  * \param [out] result - resulting data.
  **********************************************************************************/
@@ -1007,19 +1050,45 @@ ExpressionEvaluator<ResultType, StateType, VectorType, ScalarType>::
 evaluate_expression( const Plato::OrdinalType thread,
                            ResultType const & result ) const
 {
-#if USE_POST_ORDER
-  // Post order evaluation of the nodes. Note the last node is the top
-  // node which is evaluated separtately with the results going into
-  // the return results instead of temporary results
-  for( Plato::OrdinalType i=0; i<mNodeCount-1; ++i )
+  // The instructions are in evaluation order. The last instruction
+  // puts its results into the return results instead of a register.
+  for( Plato::OrdinalType i=0; i<mNumInstructions; ++i )
   {
-    Plato::OrdinalType i_node = mNodeOrder[i];
+    const Instruction & instruction = mProgram[i];
 
-    evaluateNode( thread, i_node, mResults[ mNodes[i_node].i_memory ] );
+    if( instruction.i_result == (Plato::OrdinalType) -1 )
+      evaluateInstruction( thread, instruction, result );
+    else
+      evaluateInstruction( thread, instruction, mResults[ instruction.i_result ] );
   }
-#endif
+}
 
-  evaluateNode( thread, mTreeRootNode, result );
+/******************************************************************************//**
+ * \brief evaluate_expression - Evaluate the compiled expression for
+ * all threads - public function. Each instruction is applied to the
+ * values of all threads before the next instruction, so must be
+ * called from the host after the variables of all threads are set.
+ * \param [out] result - resulting data.
+ **********************************************************************************/
+template< typename ResultType, typename StateType,
+          typename VectorType, typename ScalarType >
+void
+ExpressionEvaluator<ResultType, StateType, VectorType, ScalarType>::
+evaluate_expression( ResultType const & result ) const
+{
+  Kokkos::Profiling::pushRegion("ExpressionEvaluator::evaluate_expression");
+
+  for( Plato::OrdinalType i=0; i<mNumInstructions; ++i )
+  {
+    const Instruction & instruction = mProgram[i];
+
+    if( instruction.i_result == (Plato::OrdinalType) -1 )
+      evaluateInstruction( instruction, result );
+    else
+      evaluateInstruction( instruction, mResults[ instruction.i_result ] );
+  }
+
+  Kokkos::Profiling::popRegion();
 }
 
 /******************************************************************************//**
@@ -1066,75 +1135,125 @@ commute_expression()
 }
 
 /******************************************************************************//**
- * \brief traverse_expression - traverse the expression to get the
- * total node count and the post order evaluation and the number of
- * chunks of temporary memory required - private function.
+ * \brief compile_expression - compile the expression tree into a
+ * sequence of register instructions - private function.
+ *
+ * Subexpressions of numbers only are folded into a single number and
+ * identical subexpressions are evaluated once. Registers (chunks of
+ * temporary memory) are reused once their values are no longer needed.
  **********************************************************************************/
 template< typename ResultType, typename StateType,
           typename VectorType, typename ScalarType >
 void
 ExpressionEvaluator<ResultType, StateType, VectorType, ScalarType>::
-traverse_expression()
+compile_expression()
 {
-  // Before traversing the tree commute the expression so to have a
-  // left weighted tree which requires less memory when evaluated
-  // without recursion.
+  // Before compiling the tree commute the expression so to have a
+  // left weighted tree which requires fewer registers.
   commute_expression();
 
-  Kokkos::Profiling::pushRegion("ExpressionEvaluator::traverse_expression");
-
-  // Get the post order node evaluation order and the maximum number
-  // of temporary memory chunks needed.
-  mNodeOrder = Kokkos::View< Plato::OrdinalType *,
-                             Plato::UVMSpace >( "ExpEval NodeOrder", mNodesUsed );
-
-  mNodeCount = 0;
-
-  // Initialize the memory queue which are a series of indexes that
-  // point to chunks of memory that is reused. Thus minimizing the
-  // amount of temporary memory needed. The maximum number chunks of
-  // temporary memory required is the depth of the epresssion tree
-  // plus one. It gets filled in as needed.
-
-  // Example if the depth of tree is 3, the post order evaluation is
-  // ACBEGFD. Where node A used memory chunk 0, node C used memory
-  // chunk 1, the result (node B) goes into memory chunk 2. At which
-  // point memory chunks 0 and 1 can be reused by nodes E and G. Their
-  // result (node F) goes into memory chunck 3. At which point memory
-  // chunck 0 can be reused again by node D. Though in actuality that
-  // result goes into the memory given by the user.
-  //
-  //           (D0)
-  //     (B2)        (F3)
-  //  (A0)  (C1)  (E0)  (G1)
-
-  mMemQueue.clear();
-  mMemQueue.push_back(0);
-  traverseNode( mTreeRootNode, 1 );
-
-  // Take a subview so to reduce the memory footprint of the node order.
-  mNodeOrder = subview(mNodeOrder, std::make_pair(0, mNodeCount-1));
-
-  // When complete the mMemQueue.size() is the tree depth and there
-  // should only be one index missing from the list which would
-  // normally be used by the top level node. But it is not used as
-  // those results go into the memory provided by the user.
-
-  // The worst case maximum number of chunks of temporary memory
-  // needed is the expression tree depth plus one. But depending on
-  // the shape of the tree it may not all be needed. So find the
-  // maximum index.  The total needed will be the maximum index plus
-  // one.
+  Kokkos::Profiling::pushRegion("ExpressionEvaluator::compile_expression");
+
+  // Post order compilation of the tree. The operands of the
+  // instructions refer to other instructions at this point.
+  std::vector< Instruction > tInstructions;
+  std::map< InstructionKey, Plato::OrdinalType > tTable;
+
+  const Plato::OrdinalType tRoot = compileNode( mTreeRootNode, tInstructions, tTable );
+
+  // Folded and common subexpressions leave instructions that are not
+  // needed. The operands of an instruction always come before it so
+  // a single reverse sweep finds the instructions needed by the root.
+  std::vector< bool > tNeeded( tInstructions.size(), false );
+  tNeeded[tRoot] = true;
+
+  for( Plato::OrdinalType i=tRoot; i>=0; --i )
+  {
+    if( tNeeded[i] == false )
+      continue;
+
+    if( tInstructions[i].i_left != (Plato::OrdinalType) -1 )
+      tNeeded[tInstructions[i].i_left] = true;
+    if( tInstructions[i].i_right != (Plato::OrdinalType) -1 )
+      tNeeded[tInstructions[i].i_right] = true;
+  }
+
+  // The last instruction using the results of each instruction.
+  std::vector< Plato::OrdinalType > tLastUse( tInstructions.size(), -1 );
+
+  for( Plato::OrdinalType i=0; i<=tRoot; ++i )
+  {
+    if( tNeeded[i] == false )
+      continue;
+
+    if( tInstructions[i].i_left != (Plato::OrdinalType) -1 )
+      tLastUse[tInstructions[i].i_left] = i;
+    if( tInstructions[i].i_right != (Plato::OrdinalType) -1 )
+      tLastUse[tInstructions[i].i_right] = i;
+  }
+
+  // Assign the registers. The register of an operand is released
+  // before the result register is taken so an instruction may write
+  // over one of its operands, which is safe as the values are
+  // processed one at a time. The root writes into the memory given
+  // by the user.
+  std::vector< Plato::OrdinalType > tRegisters( tInstructions.size(), -1 );
+  std::vector< Plato::OrdinalType > tFreeRegisters;
+  std::vector< Instruction > tProgram;
+
   mNumMemoryChunks = 0;
 
-  // Note do not check the last node which is the top level node and
-  // temporary memory is not needed for it.
-  for( Plato::OrdinalType i=0; i<mNodeCount-1; ++i)
+  for( Plato::OrdinalType i=0; i<=tRoot; ++i )
   {
-    if( mNumMemoryChunks < mNodes[mNodeOrder[i]].i_memory+1 )
-      mNumMemoryChunks = mNodes[mNodeOrder[i]].i_memory+1;
+    if( tNeeded[i] == false )
+      continue;
+
+    Instruction tInstruction = tInstructions[i];
+
+    const Plato::OrdinalType tLeft  = tInstruction.i_left;
+    const Plato::OrdinalType tRight = tInstruction.i_right;
+
+    if( tLeft != (Plato::OrdinalType) -1 )
+    {
+      tInstruction.i_left = tRegisters[tLeft];
+      if( tLastUse[tLeft] == i )
+        tFreeRegisters.push_back( tRegisters[tLeft] );
+    }
+
+    if( tRight != (Plato::OrdinalType) -1 )
+    {
+      tInstruction.i_right = tRegisters[tRight];
+      if( tLastUse[tRight] == i && tRight != tLeft )
+        tFreeRegisters.push_back( tRegisters[tRight] );
+    }
+
+    if( i == tRoot )
+    {
+      tInstruction.i_result = (Plato::OrdinalType) -1;
+    }
+    else if( tFreeRegisters.empty() )
+    {
+      tInstruction.i_result = mNumMemoryChunks++;
+    }
+    else
+    {
+      tInstruction.i_result = tFreeRegisters.back();
+      tFreeRegisters.pop_back();
+    }
+
+    tRegisters[i] = tInstruction.i_result;
+    tProgram.push_back( tInstruction );
   }
 
+  // Copy the program to memory used on the device.
+  mNumInstructions = tProgram.size();
+
+  mProgram = Kokkos::View< Instruction *,
+                           Plato::UVMSpace >( "ExpEval Program", mNumInstructions );
+
+  for( Plato::OrdinalType i=0; i<mNumInstructions; ++i )
+    mProgram[i] = tProgram[i];
+
   Kokkos::Profiling::popRegion();
 }
 
@@ -1827,9 +1946,9 @@ parse_expression( const char* expression )
 
   Kokkos::Profiling::popRegion();
 
-  // Traverse the resulting tree to obtain ancillary information for
-  // post order evaluation and memory.
-  traverse_expression();
+  // Compile the resulting tree into the instructions and registers
+  // used for the evaluation.
+  compile_expression();
  }
 
 /******************************************************************************//**
@@ -2313,79 +2432,158 @@ validateNode( const Plato::OrdinalType i_node,
 }
 
 /******************************************************************************//**
- * \brief traverseNode - Post order traversal of the nodes - protected function.
+ * \brief compileNode - Post order compilation of the nodes - protected function.
  * \param [in] i_node - index of the node.
- * \param [in] depth  - depth of the node being evaluated.
+ * \param [in,out] instructions - the instructions compiled so far.
+ * \param [in,out] table - map of the instructions compiled so far, used to
+ *                         find common subexpressions.
+ * \return index - index of the instruction holding the node's results.
  **********************************************************************************/
 template< typename ResultType, typename StateType,
           typename VectorType, typename ScalarType >
-void
+Plato::OrdinalType
 ExpressionEvaluator<ResultType, StateType, VectorType, ScalarType>::
-traverseNode( const Plato::OrdinalType i_node,
-              const Plato::OrdinalType depth )
+compileNode( const Plato::OrdinalType i_node,
+                   std::vector< Instruction > & instructions,
+                   std::map< InstructionKey, Plato::OrdinalType > & table ) const
 {
   // This error should never happen, if it does it is a developer error.
   if( i_node == (Plato::OrdinalType) -1 )
   {
     std::stringstream errorMsg;
-    errorMsg << "Invalid call to traverseNode - "
+    errorMsg << "Invalid call to compileNode - "
              << "node index is -1";
     ANALYZE_THROWERR( errorMsg.str() );
   }
 
-  Node & node = mNodes[i_node];
+  const Node & node = mNodes[i_node];
 
   // Empty node. This should never happen as checks are made not to
-  // evaluate empty nodes.
+  // compile empty nodes.
   if( node.ID == NodeID::EMPTY_NODE )
   {
     std::stringstream errorMsg;
-    errorMsg << "Invalid call to traverseNode - "
+    errorMsg << "Invalid call to compileNode - "
              << "empty node index is " << i_node;
     ANALYZE_THROWERR( errorMsg.str() );
   }
 
-  // Add additional index(s) to the queue based on the depth of the node.
-  while( mMemQueue.back() < depth )
-    mMemQueue.push_back( mMemQueue.back()+1 );
-
-  // Index to the chunk of temporary used by the left node.
-  Plato::OrdinalType left_mem = -1;
+  Instruction instruction;
+  instruction.ID = node.ID;
 
   if( node.i_left != (Plato::OrdinalType) -1 )
+    instruction.i_left = compileNode( node.i_left, instructions, table );
+
+  if( node.i_right != (Plato::OrdinalType) -1 )
+    instruction.i_right = compileNode( node.i_right, instructions, table );
+
+  if( node.ID == NodeID::NUMBER )
   {
-    traverseNode( node.i_left, depth+1 );
-    left_mem = mNodes[node.i_left].i_memory;
+    instruction.number = node.number;
   }
+  else if( node.ID == NodeID::VARIABLE )
+  {
+    // Resolve the variable name now so it is not searched for when
+    // evaluating.
+    for( Plato::OrdinalType i=0; i<mVariableList.size(); ++i )
+    {
+      if( mVariableList[i] == node.variable )
+      {
+        instruction.i_variable = i;
+        break;
+      }
+    }
+  }
+  else
+  {
+    // Fold the operation if all of its operands are numbers.
+    const bool tLeftNumber = ( instruction.i_left == (Plato::OrdinalType) -1 ||
+                               instructions[instruction.i_left].ID == NodeID::NUMBER );
+    const bool tRightNumber = ( instruction.i_right == (Plato::OrdinalType) -1 ||
+                                instructions[instruction.i_right].ID == NodeID::NUMBER );
 
-  // Index to the chunk of temporary used by the right node.
-  Plato::OrdinalType right_mem = -1;
+    if( tLeftNumber && tRightNumber )
+    {
+      const Plato::Scalar tLeft = ( instruction.i_left == (Plato::OrdinalType) -1 ) ?
+        0 : instructions[instruction.i_left].number;
+      const Plato::Scalar tRight = ( instruction.i_right == (Plato::OrdinalType) -1 ) ?
+        0 : instructions[instruction.i_right].number;
 
-  if( node.i_right != (Plato::OrdinalType) -1 )
-  {
-    traverseNode( node.i_right, depth+1 );
-    right_mem = mNodes[node.i_right].i_memory;
+      const Plato::Scalar tValue = foldNumbers( node.ID, tLeft, tRight );
+
+      // Numbers that are not finite are left for the evaluation.
+      if( std::isfinite( tValue ) )
+      {
+        instruction = Instruction();
+        instruction.ID = NodeID::NUMBER;
+        instruction.number = tValue;
+      }
+    }
+
+    // Order the operands of commutative operations so to find more
+    // common subexpressions.
+    if( ( instruction.ID == NodeID::ADDITION ||
+          instruction.ID == NodeID::MULTIPLICATION ) &&
+        instruction.i_left > instruction.i_right )
+    {
+      std::swap( instruction.i_left, instruction.i_right );
+    }
   }
 
-  // Set the index of where the results will go using the first unused
-  // index.
-  node.i_memory = mMemQueue.front();
-  mMemQueue.pop_front();
-
-  // If data from the right node was used is can be now reused so push
-  // the index to the front of the queue. Push right first as it was
-  // last used.
-  if( right_mem != (Plato::OrdinalType) -1 )
-    mMemQueue.push_front( right_mem );
-
-  // If data from the left node was used is can be now reused so push
-  // the index to the front of the queue. Push left last as it was
-  // first used.
-  if( left_mem != (Plato::OrdinalType) -1 )
-    mMemQueue.push_front( left_mem );
-
-  // Add the node index to the post order evaluation order.
-  mNodeOrder[mNodeCount++] = i_node;
+  // Reuse the identical instruction if already compiled.
+  const InstructionKey tKey( instruction.ID,
+                             instruction.i_left,
+                             instruction.i_right,
+                             instruction.i_variable,
+                             instruction.number );
+
+  auto tIter = table.find( tKey );
+
+  if( tIter != table.end() )
+    return tIter->second;
+
+  const Plato::OrdinalType i_instruction = instructions.size();
+
+  instructions.push_back( instruction );
+  table[tKey] = i_instruction;
+
+  return i_instruction;
+}
+
+/******************************************************************************//**
+ * \brief foldNumbers - Evaluate an operation on numbers - protected function.
+ * \param [in] ID - the arithmetic operation.
+ * \param [in] left - the left operand.
+ * \param [in] right - the right operand.
+ * \return number - the operation result.
+ **********************************************************************************/
+template< typename ResultType, typename StateType,
+          typename VectorType, typename ScalarType >
+Plato::Scalar
+ExpressionEvaluator<ResultType, StateType, VectorType, ScalarType>::
+foldNumbers( const NodeID ID,
+             const Plato::Scalar left,
+             const Plato::Scalar right ) const
+{
+  // Same operations as in evaluateInstruction.
+  switch( ID )
+  {
+    case NodeID::POSITIVE:       return +right;
+    case NodeID::NEGATIVE:       return -right;
+    case NodeID::ADDITION:       return left + right;
+    case NodeID::SUBTRACTION_:   return left - right;
+    case NodeID::MULTIPLICATION: return left * right;
+    case NodeID::DIVISION:       return ( right == 0 ) ? 0 : left / right;
+    case NodeID::EXPONENTIAL:    return std::exp(right);
+    case NodeID::LOG:            return std::log(right);
+    case NodeID::POWER:          return std::pow(left, right);
+    case NodeID::SQRT:           return std::sqrt(right);
+    case NodeID::ABS:            return std::abs(right);
+    case NodeID::SIN:            return std::sin(right);
+    case NodeID::COS:            return std::cos(right);
+    case NodeID::TAN:            return std::tan(right);
+    default:                     return 0;
+  }
 }
 
 /******************************************************************************//**
@@ -2414,90 +2612,35 @@ factorial( ResultType n ) const
 */
 
 /******************************************************************************//**
- * \brief evaluateNode - Evaluate the current node - protected function.
+ * \brief evaluateInstruction - Evaluate an instruction for a single
+ * thread - protected function.
  * \param [in] thread - thread being evaluated.
- * \param [in] i_node - index of the node.
- * \param [out] result - the expresion result.
- * \return evaluated - true if the node was evaluated.
+ * \param [in] instruction - the instruction.
+ * \param [out] result - the instruction result.
  **********************************************************************************/
 template< typename ResultType, typename StateType,
           typename VectorType, typename ScalarType >
 KOKKOS_INLINE_FUNCTION
-bool
+void
 ExpressionEvaluator<ResultType, StateType, VectorType, ScalarType>::
-evaluateNode( const Plato::OrdinalType thread,
-              const Plato::OrdinalType i_node,
-                    ResultType const & result ) const
+evaluateInstruction( const Plato::OrdinalType thread,
+                     const Instruction & instruction,
+                           ResultType const & result ) const
 {
-  // printf( "%d %d %d %d \n", __LINE__, thread, mNumValues, i_node );
-
   // At this point no error checks are needed as the tree has been
   // validated as part of the parsing of the expression.
 
-  // This error should never happen, if it does happen it is a
-  // developer error. A similar check is made in traverseNode which
-  // throws an error. Thus commented out.
-  // if( i_node == (Plato::OrdinalType) -1 )
-  // {
-  //   GPU_WARNING( "Invalid call to evaluateNode - "
-  //                  "node index is -1", "" );
-
-  //   return false;
-  // }
-  const Node & node = mNodes[i_node];
-
-  // Empty node. This should never happen as checks are made not to
-  // evaluate empty nodes. A similar check is made in traverseNode
-  // which throws an error. Thus commented out.
-  // if( node.ID == NodeID::EMPTY_NODE )
-  // {
-  //   GPU_WARNING( "Invalid call to evaluateNode - "
-  //                  "node index is -1", itoa(i_ode) );
-
-  //   return false;
-  // }
-
-  // Get the left side of the tree.
+  // Get the operands.
   ResultType left;
-  if( node.i_left != (Plato::OrdinalType) -1 )
-  {
-    left = mResults[ mNodes[node.i_left].i_memory];
+  if( instruction.i_left != (Plato::OrdinalType) -1 )
+    left = mResults[ instruction.i_left ];
 
-#if USE_RECURSION
-    // Recursion - not used because it creates lots of warnings and
-    // recursions blows the stack on the GPU.
-    evaluateNode( thread, node.i_left, left );
-#endif
-  }
-
-  // Get the right side of the tree.
   ResultType right;
-  if( node.i_right != (Plato::OrdinalType) -1 )
-  {
-    right = mResults[ mNodes[node.i_right].i_memory ];
-
-#if USE_RECURSION
-    // Recursion - not used because it creates lots of
-    // warnings and recursions blows the stack on the GPU.
-    evaluateNode( thread, node.i_right, right );
-#endif
-  }
-
-  // Divide by zero check.
-  // if( node.ID == DIVISION )
-   // {
-  //   for( Plato::OrdinalType i = 0; i < mNumValues; ++ i )
-  //   {
-  //     if( right(thread,i) == 0 )
-  //     {
-  //       PRINTERR("Warning: Divide by zero.");
-  //       result(thread,i) = 0;
-  //     }
-  //   }
-  // }
+  if( instruction.i_right != (Plato::OrdinalType) -1 )
+    right = mResults[ instruction.i_right ];
 
   // Do the operation
-  switch( node.ID )
+  switch( instruction.ID )
   {
     case NodeID::POSITIVE:
       for( Plato::OrdinalType i=0; i<mNumValues; ++i )
@@ -2548,10 +2691,6 @@ evaluateNode( const Plato::OrdinalType thread,
       for( Plato::OrdinalType i=0; i<mNumValues; ++i )
         result(thread,i) = std::abs(right(thread,i));
       break;
-    // case NodeID::FACTORIAL:
-      // for( Plato::OrdinalType i=0; i<mNumValues; ++i )
-      //        result(thread,i) = factorial(left(thread,i));
-      // break;
     case NodeID::SIN:
       for( Plato::OrdinalType i=0; i<mNumValues; ++i )
         result(thread,i) = std::sin(right(thread,i));
@@ -2567,7 +2706,7 @@ evaluateNode( const Plato::OrdinalType thread,
 
     case NodeID::NUMBER:
     {
-      const Plato::Scalar value = node.number;
+      const Plato::Scalar value = instruction.number;
 
       for( Plato::OrdinalType i=0; i<mNumValues; ++i )
         result(thread,i) = value;
@@ -2577,35 +2716,23 @@ evaluateNode( const Plato::OrdinalType thread,
 
     case NodeID::VARIABLE:
     {
-      Plato::OrdinalType type  = (Plato::OrdinalType) -1;
-      Plato::OrdinalType index = (Plato::OrdinalType) -1;
+      // The variable was resolved when compiling so the map entry is
+      // known. Decode the value, the type indicates the storage
+      // container. There are three. The index gives the location into
+      // the storage container being used.
+      const Plato::OrdinalType mapValue = mVariableMap(thread, instruction.i_variable).value;
 
-      for( Plato::OrdinalType i=0; i<mNumVariables; ++i )
+      if( mapValue == (Plato::OrdinalType) -1 )
       {
-        if( STRCMP( mVariableMap(thread,i).key, node.variable ) == 0 )
-        {
-          if( mVariableMap(thread,i).value != (Plato::OrdinalType) -1 )
-          {
-            // Decode the value The type indicated the storage
-            // container. There are three. The index gives the location
-            // into the storage container being used.
-            type  = mVariableMap(thread,i).value / MAX_DATA_SOURCE;
-            index = mVariableMap(thread,i).value % MAX_DATA_SOURCE;
-          }
-          else
-          {
-            // std::stringstream errorMsg;
-            // errorMsg << "Invalid call to evaluateNode - "
-            //       << "can not find values for variable: " << node.variable;
-            // ANALYZE_THROWERR( errorMsg.str() );
-
-            GPU_WARNING( "Invalid call to evaluateNode - "
-                         "can not find values for variable: ",
-                         node.variable );
-          }
-        }
+        GPU_WARNING( "Invalid call to evaluateInstruction - "
+                     "can not find values for variable: ",
+                     mVariableMap(thread, instruction.i_variable).key );
+        break;
       }
 
+      const Plato::OrdinalType type  = mapValue / MAX_DATA_SOURCE;
+      const Plato::OrdinalType index = mapValue % MAX_DATA_SOURCE;
+
       // Get the data from the storage container.
       if( type == SCALAR_DATA_SOURCE )
       {
@@ -2637,18 +2764,6 @@ evaluateNode( const Plato::OrdinalType thread,
         for( Plato::OrdinalType i=0; i<mNumValues; ++i )
           result(thread,i) = values(thread,i);
       }
-      // This error should never happen, if it does it is a developer error.
-      else
-      {
-        // std::stringstream errorMsg;
-        // errorMsg << "Invalid call to evaluateNode - "
-        //       << "can not find storage container for variable: " << variable;
-        // ANALYZE_THROWERR( errorMsg.str() );
-
-        GPU_WARNING( "Invalid call to evaluateNode - "
-                     "can not find storage container for variable:",
-                     node.variable );
-      }
 
       break;
     }
@@ -2658,8 +2773,179 @@ evaluateNode( const Plato::OrdinalType thread,
         result(thread,i) = 0;
       break;
   }
+}
+
+/******************************************************************************//**
+ * \brief evaluateInstruction - Evaluate an instruction for all
+ * threads - protected function. The operation is selected on the
+ * host so each kernel is a plain loop over the threads and values.
+ * \param [in] instruction - the instruction.
+ * \param [out] result - the instruction result.
+ **********************************************************************************/
+template< typename ResultType, typename StateType,
+          typename VectorType, typename ScalarType >
+void
+ExpressionEvaluator<ResultType, StateType, VectorType, ScalarType>::
+evaluateInstruction( const Instruction & instruction,
+                           ResultType const & result ) const
+{
+  // A lambda inside a member function captures the "this" pointer
+  // not the actual members as such local copies are needed.
+  ResultType tResult = result;
+
+  ResultType tLeft;
+  if( instruction.i_left != (Plato::OrdinalType) -1 )
+    tLeft = mResults[ instruction.i_left ];
+
+  ResultType tRight;
+  if( instruction.i_right != (Plato::OrdinalType) -1 )
+    tRight = mResults[ instruction.i_right ];
+
+  Kokkos::MDRangePolicy<Kokkos::Rank<2>> tPolicy({0, 0}, {mNumThreads, mNumValues});
+
+  switch( instruction.ID )
+  {
+    case NodeID::POSITIVE:
+      Kokkos::parallel_for("ExpEval positive", tPolicy,
+      KOKKOS_LAMBDA(const Plato::OrdinalType t, const Plato::OrdinalType i)
+      { tResult(t,i) = +tRight(t,i); });
+      break;
+    case NodeID::NEGATIVE:
+      Kokkos::parallel_for("ExpEval negative", tPolicy,
+      KOKKOS_LAMBDA(const Plato::OrdinalType t, const Plato::OrdinalType i)
+      { tResult(t,i) = -tRight(t,i); });
+      break;
+
+    case NodeID::ADDITION:
+      Kokkos::parallel_for("ExpEval addition", tPolicy,
+      KOKKOS_LAMBDA(const Plato::OrdinalType t, const Plato::OrdinalType i)
+      { tResult(t,i) = tLeft(t,i) + tRight(t,i); });
+      break;
+    case NodeID::SUBTRACTION_:
+      Kokkos::parallel_for("ExpEval subtraction", tPolicy,
+      KOKKOS_LAMBDA(const Plato::OrdinalType t, const Plato::OrdinalType i)
+      { tResult(t,i) = tLeft(t,i) - tRight(t,i); });
+      break;
+    case NodeID::MULTIPLICATION:
+      Kokkos::parallel_for("ExpEval multiplication", tPolicy,
+      KOKKOS_LAMBDA(const Plato::OrdinalType t, const Plato::OrdinalType i)
+      { tResult(t,i) = tLeft(t,i) * tRight(t,i); });
+      break;
+    case NodeID::DIVISION:
+      Kokkos::parallel_for("ExpEval division", tPolicy,
+      KOKKOS_LAMBDA(const Plato::OrdinalType t, const Plato::OrdinalType i)
+      {
+        if( tRight(t,i) == 0 )
+          tResult(t,i) = 0;
+        else
+          tResult(t,i) = tLeft(t,i) / tRight(t,i);
+      });
+      break;
+
+    case NodeID::EXPONENTIAL:
+      Kokkos::parallel_for("ExpEval exponential", tPolicy,
+      KOKKOS_LAMBDA(const Plato::OrdinalType t, const Plato::OrdinalType i)
+      { tResult(t,i) = std::exp(tRight(t,i)); });
+      break;
+    case NodeID::LOG:
+      Kokkos::parallel_for("ExpEval log", tPolicy,
+      KOKKOS_LAMBDA(const Plato::OrdinalType t, const Plato::OrdinalType i)
+      { tResult(t,i) = std::log(tRight(t,i)); });
+      break;
+    case NodeID::POWER:
+      Kokkos::parallel_for("ExpEval power", tPolicy,
+      KOKKOS_LAMBDA(const Plato::OrdinalType t, const Plato::OrdinalType i)
+      { tResult(t,i) = std::pow(tLeft(t,i), tRight(t,i)); });
+      break;
+    case NodeID::SQRT:
+      Kokkos::parallel_for("ExpEval sqrt", tPolicy,
+      KOKKOS_LAMBDA(const Plato::OrdinalType t, const Plato::OrdinalType i)
+      { tResult(t,i) = std::sqrt(tRight(t,i)); });
+      break;
+    case NodeID::ABS:
+      Kokkos::parallel_for("ExpEval abs", tPolicy,
+      KOKKOS_LAMBDA(const Plato::OrdinalType t, const Plato::OrdinalType i)
+      { tResult(t,i) = std::abs(tRight(t,i)); });
+      break;
+    case NodeID::SIN:
+      Kokkos::parallel_for("ExpEval sin", tPolicy,
+      KOKKOS_LAMBDA(const Plato::OrdinalType t, const Plato::OrdinalType i)
+      { tResult(t,i) = std::sin(tRight(t,i)); });
+      break;
+    case NodeID::COS:
+      Kokkos::parallel_for("ExpEval cos", tPolicy,
+      KOKKOS_LAMBDA(const Plato::OrdinalType t, const Plato::OrdinalType i)
+      { tResult(t,i) = std::cos(tRight(t,i)); });
+      break;
+    case NodeID::TAN:
+      Kokkos::parallel_for("ExpEval tan", tPolicy,
+      KOKKOS_LAMBDA(const Plato::OrdinalType t, const Plato::OrdinalType i)
+      { tResult(t,i) = std::tan(tRight(t,i)); });
+      break;
 
-  return true;
+    case NodeID::NUMBER:
+    {
+      const Plato::Scalar tValue = instruction.number;
+
+      Kokkos::parallel_for("ExpEval number", tPolicy,
+      KOKKOS_LAMBDA(const Plato::OrdinalType t, const Plato::OrdinalType i)
+      { tResult(t,i) = tValue; });
+      break;
+    }
+
+    case NodeID::VARIABLE:
+    {
+      const Plato::OrdinalType tVariable = instruction.i_variable;
+
+      for( Plato::OrdinalType t=0; t<mNumThreads; ++t )
+      {
+        if( mVariableMap(t, tVariable).value == (Plato::OrdinalType) -1 )
+        {
+          std::stringstream errorMsg;
+          errorMsg << "Invalid call to evaluate_expression - "
+                   << "can not find values for variable: " << mVariableMap(t, tVariable).key;
+          ANALYZE_THROWERR( errorMsg.str() );
+        }
+      }
+
+      auto tVariableMap = mVariableMap;
+      auto tScalarValues = mVariableScalarValues;
+      auto tVectorValues = mVariableVectorValues;
+      auto tStateValues = mVariableStateValues;
+      auto tNumValues = mNumValues;
+
+      Kokkos::parallel_for("ExpEval variable", tPolicy,
+      KOKKOS_LAMBDA(const Plato::OrdinalType t, const Plato::OrdinalType i)
+      {
+        const Plato::OrdinalType tType  = tVariableMap(t, tVariable).value / MAX_DATA_SOURCE;
+        const Plato::OrdinalType tIndex = tVariableMap(t, tVariable).value % MAX_DATA_SOURCE;
+
+        if( tType == SCALAR_DATA_SOURCE )
+        {
+          tResult(t,i) = tScalarValues(t, tIndex);
+        }
+        else if( tType == VECTOR_DATA_SOURCE )
+        {
+          // When the number of values is one index based on the thread
+          if( tNumValues == 1 )
+            tResult(t,i) = tVectorValues(t, tIndex)[t];
+          else
+            tResult(t,i) = tVectorValues(t, tIndex)[i];
+        }
+        else if( tType == STATE_DATA_SOURCE )
+        {
+          tResult(t,i) = tStateValues(tIndex)(t,i);
+        }
+      });
+      break;
+    }
+
+    default:
+      Kokkos::parallel_for("ExpEval zero", tPolicy,
+      KOKKOS_LAMBDA(const Plato::OrdinalType t, const Plato::OrdinalType i)
+      { tResult(t,i) = 0; });
+      break;
+  }
 }
 
 /******************************************************************************//**
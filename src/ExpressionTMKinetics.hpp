@@ -135,13 +135,7 @@ public:
         });
 
         tExpEval.set_variable("tElementDensity", tElementDensity);
-        Kokkos::parallel_for("compute youngs modulus", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {aNumCells, tNumPoints}),
-        KOKKOS_LAMBDA(const Plato::OrdinalType iCellOrdinal, const Plato::OrdinalType iGpOrdinal)
-        {
-            auto tEntryOrdinal = iCellOrdinal*tNumPoints + iGpOrdinal;
-
-            tExpEval.evaluate_expression( tEntryOrdinal, aElementYoungsModulusValues );
-        });
+        tExpEval.evaluate_expression( aElementYoungsModulusValues );
         Kokkos::fence();
         tExpEval.clear_storage();
     }
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <type_traits>
+
+#include "SpatialModel.hpp"
+#include "GradientMatrix.hpp"
+#include "PlatoStaticsTypes.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************//**
+* \brief Basis function gradients and weighted Jacobian determinant (detJ times the
+*        cubature weight) functor.
+*
+* If the spatial domain caches its geometric factors and the configuration is not
+* differentiated, i.e., the configuration scalar type is Plato::Scalar, the factors
+* are read from the domain cache, which is (re)computed here if it is stale.
+* Otherwise the factors are computed from the configuration workset at each call.
+**********************************************************************************/
+template<typename ElementType>
+class GeometricFactors : public ElementType
+{
+private:
+    using CubWeightsType = decltype(ElementType::getCubWeights());
+
+    Plato::ComputeGradientMatrix<ElementType> mComputeGradient;
+    CubWeightsType mCubWeights;
+
+    Plato::ScalarArray4D mGradients;
+    Plato::ScalarMultiVector mWeightedVolumes;
+    bool mIsCached;
+
+public:
+    /******************************************************************************//**
+    * \brief Constructor
+    * \param [in] aSpatialDomain spatial domain of the configuration workset
+    * \param [in] aConfig        configuration workset
+    **********************************************************************************/
+    template<typename ConfigScalarType>
+    GeometricFactors(
+        const Plato::SpatialDomain                    & aSpatialDomain,
+        const Plato::ScalarArray3DT<ConfigScalarType> & aConfig
+    ) :
+        mCubWeights(ElementType::getCubWeights()),
+        mIsCached(false)
+    {
+        if constexpr (std::is_same<ConfigScalarType, Plato::Scalar>::value)
+        {
+            auto & tCache = aSpatialDomain.geometricFactors();
+            if( tCache.enabled() )
+            {
+                auto & tEntry = tCache.entry(aSpatialDomain.cellOrdinals(), ElementType::mNumGaussPoints);
+                auto tVersion = aSpatialDomain.Mesh->CoordinatesVersion();
+                if( tEntry.mCoordinatesVersion != tVersion )
+                {
+                    this->computeFactors(aConfig, tEntry);
+                    tEntry.mCoordinatesVersion = tVersion;
+                }
+                mGradients = tEntry.mGradients;
+                mWeightedVolumes = tEntry.mWeightedVolumes;
+                mIsCached = true;
+            }
+        }
+    }
+
+    /******************************************************************************//**
+    * \brief Return true if the factors are read from the domain cache
+    **********************************************************************************/
+    bool isCached() const { return mIsCached; }
+
+    /******************************************************************************//**
+    * \brief Return basis function gradients and weighted Jacobian determinant
+    * \param [in]  aCellOrdinal   workset cell ordinal
+    * \param [in]  aGpOrdinal     cubature point ordinal
+    * \param [in]  aCubPoint      cubature point
+    * \param [in]  aConfig        configuration workset
+    * \param [out] aGradient      basis function gradients
+    * \param [out] aWeightedVolume Jacobian determinant times cubature weight
+    **********************************************************************************/
+    template<typename ScalarType>
+    KOKKOS_INLINE_FUNCTION void
+    operator()(
+              Plato::OrdinalType aCellOrdinal,
+              Plato::OrdinalType aGpOrdinal,
+        const Plato::Array<ElementType::mNumSpatialDims> & aCubPoint,
+              Plato::ScalarArray3DT<ScalarType>    aConfig,
+              Plato::Matrix<ElementType::mNumNodesPerCell,ElementType::mNumSpatialDims,ScalarType> & aGradient,
+              ScalarType&     aWeightedVolume
+    ) const
+    {
+        if( mIsCached )
+        {
+            for(Plato::OrdinalType tNode = 0; tNode < ElementType::mNumNodesPerCell; tNode++)
+            {
+                for(Plato::OrdinalType tDim = 0; tDim < ElementType::mNumSpatialDims; tDim++)
+                {
+                    aGradient(tNode, tDim) = mGradients(aCellOrdinal, aGpOrdinal, tNode, tDim);
+                }
+            }
+            aWeightedVolume = mWeightedVolumes(aCellOrdinal, aGpOrdinal);
+        }
+        else
+        {
+            mComputeGradient(aCellOrdinal, aCubPoint, aConfig, aGradient, aWeightedVolume);
+            aWeightedVolume *= mCubWeights(aGpOrdinal);
+        }
+    }
+
+private:
+    void computeFactors(
+        const Plato::ScalarArray3D               & aConfig,
+              Plato::GeometricFactorsCache::Entry & aEntry
+    ) const
+    {
+        Plato::OrdinalType tNumCells = aConfig.extent(0);
+        Plato::OrdinalType tNumPoints = ElementType::mNumGaussPoints;
+        if( aEntry.mGradients.extent(0) != static_cast<std::size_t>(tNumCells) )
+        {
+            aEntry.mGradients = Plato::ScalarArray4D("basis gradients", tNumCells, tNumPoints,
+                ElementType::mNumNodesPerCell, ElementType::mNumSpatialDims);
+            aEntry.mWeightedVolumes = Plato::ScalarMultiVector("weighted volumes", tNumCells, tNumPoints);
+        }
+
+        auto tGradients = aEntry.mGradients;
+        auto tWeightedVolumes = aEntry.mWeightedVolumes;
+        auto tCubPoints = ElementType::getCubPoints();
+        auto tCubWeights = mCubWeights;
+        auto tComputeGradient = mComputeGradient;
+        Kokkos::parallel_for("compute geometric factors",
+          Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {tNumCells, tNumPoints}),
+          KOKKOS_LAMBDA(const Plato::OrdinalType iCellOrdinal, const Plato::OrdinalType iGpOrdinal)
+        {
+            tComputeGradient(iCellOrdinal, iGpOrdinal, tCubPoints(iGpOrdinal), aConfig, tGradients, tWeightedVolumes);
+            tWeightedVolumes(iCellOrdinal, iGpOrdinal) *= tCubWeights(iGpOrdinal);
+        });
+    }
+};
+// class GeometricFactors
+
+} // namespace Plato
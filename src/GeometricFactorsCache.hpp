@@ -0,0 +1,70 @@
+#pragma once
+
+#include <map>
+#include <tuple>
+
+#include "PlatoStaticsTypes.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************//**
+* \brief Storage for the geometric factors of a spatial domain, i.e., the basis
+*        function gradients and the weighted Jacobian determinants (detJ times the
+*        cubature weight) at the cubature points of each cell.
+*
+* Entries are keyed on the cell list of the domain (a domain evaluated in cell
+* batches holds one entry per batch) and the number of cubature points.  Each
+* entry records the mesh coordinates version it was computed with, so entries
+* are recomputed after the mesh coordinates are set.  The factors are computed
+* and read by Plato::GeometricFactors.
+**********************************************************************************/
+class GeometricFactorsCache
+{
+public:
+    struct Entry
+    {
+        Plato::ScalarArray4D mGradients;             /*!< (cell, point, node, dim) basis function gradients */
+        Plato::ScalarMultiVector mWeightedVolumes;   /*!< (cell, point) detJ times cubature weight */
+        Plato::OrdinalType mCoordinatesVersion = -1; /*!< mesh coordinates version of the factors */
+    };
+
+private:
+    bool mEnabled = false;
+
+    using Key = std::tuple<const Plato::OrdinalType*, std::size_t, Plato::OrdinalType>;
+    std::map<Key, Entry> mEntries;
+
+public:
+    /******************************************************************************//**
+    * \brief Return true if the geometric factors of the domain are cached
+    **********************************************************************************/
+    bool enabled() const { return mEnabled; }
+
+    /******************************************************************************//**
+    * \brief Enable or disable the cache.  Disabling the cache releases its entries.
+    **********************************************************************************/
+    void enable(bool aEnabled)
+    {
+        mEnabled = aEnabled;
+        if(!mEnabled) { this->clear(); }
+    }
+
+    /******************************************************************************//**
+    * \brief Release all entries, e.g., after the cell list of the domain changes
+    **********************************************************************************/
+    void clear() { mEntries.clear(); }
+
+    /******************************************************************************//**
+    * \brief Return the entry of a cell list.  A new entry is empty.
+    * \param [in] aCellOrdinals cell list of the domain
+    * \param [in] aNumPoints    number of cubature points per cell
+    **********************************************************************************/
+    Entry & entry(const Plato::OrdinalVector & aCellOrdinals, Plato::OrdinalType aNumPoints)
+    {
+        return mEntries[Key(aCellOrdinals.data(), aCellOrdinals.extent(0), aNumPoints)];
+    }
+};
+// class GeometricFactorsCache
+
+} // namespace Plato
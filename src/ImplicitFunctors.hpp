@@ -258,6 +258,7 @@ class BlockMatrixEntryOrdinal
     const typename CrsMatrixType::RowMapVectorT mRowMap;
     const typename CrsMatrixType::OrdinalVectorT mColumnIndices;
     const Plato::OrdinalVectorT<const Plato::OrdinalType> mCells2nodes;
+    const Plato::OrdinalVectorT<const Plato::OrdinalType> mScatterMap;
 
   public:
     BlockMatrixEntryOrdinal(Teuchos::RCP<Plato::CrsMatrixType> matrix, Plato::Mesh mesh ) :
@@ -265,6 +266,24 @@ class BlockMatrixEntryOrdinal
       mColumnIndices(matrix->columnIndices()),
       mCells2nodes(mesh->Connectivity()) { }
 
+    /******************************************************************************//**
+    * \brief Constructor
+    * \param [in] matrix     block matrix
+    * \param [in] mesh       Plato abstract mesh
+    * \param [in] scatterMap (cell, local node I, local node J) to block entry ordinal
+    *                        table, see Plato::CreateBlockMatrixScatterMap. If empty,
+    *                        entry ordinals are found by searching the matrix row.
+    **********************************************************************************/
+    BlockMatrixEntryOrdinal(
+      Teuchos::RCP<Plato::CrsMatrixType>                    matrix,
+      Plato::Mesh                                           mesh,
+      Plato::OrdinalVectorT<const Plato::OrdinalType>       scatterMap
+    ) :
+      mRowMap(matrix->rowMap()),
+      mColumnIndices(matrix->columnIndices()),
+      mCells2nodes(mesh->Connectivity()),
+      mScatterMap(scatterMap) { }
+
     KOKKOS_INLINE_FUNCTION
     Plato::OrdinalType
     operator()(Plato::OrdinalType cellOrdinal, Plato::OrdinalType icellDof, Plato::OrdinalType jcellDof) const
@@ -273,6 +292,11 @@ class BlockMatrixEntryOrdinal
         auto iDof  = icellDof % DofsPerNode_I;
         auto jNode = jcellDof / DofsPerNode_J;
         auto jDof  = jcellDof % DofsPerNode_J;
+        if (mScatterMap.extent(0) != 0)
+        {
+          Plato::OrdinalType entryOrdinal = mScatterMap((cellOrdinal * NodesPerCell + iNode) * NodesPerCell + jNode);
+          return entryOrdinal*DofsPerNode_I*DofsPerNode_J+iDof*DofsPerNode_J+jDof;
+        }
         Plato::OrdinalType iLocalOrdinal = mCells2nodes(cellOrdinal * NodesPerCell + iNode);
         Plato::OrdinalType jLocalOrdinal = mCells2nodes(cellOrdinal * NodesPerCell + jNode);
         Plato::OrdinalType rowStart = mRowMap(iLocalOrdinal);
@@ -406,16 +430,22 @@ CreateLocalByGlobalBlockMatrix( Plato::Mesh aMesh )
 
 /******************************************************************************/
 /*!
-  \brief Create a matrix of type MatrixType
+  \brief Create the node-node sparsity graph of a block matrix
 
-  \param mesh Plato abstract mesh on which the matrix is based.  
+  \param [in]  aMesh          Plato abstract mesh on which the graph is based.
+  \param [out] aRowMap        block row map (number of nodes + 1)
+  \param [out] aColumnIndices block column indices, diagonals included
 
-  Create a block matrix from connectivity in mesh with block size
-  DofsPerNode_I X DofsPerNode_J.
+  The graph depends only on the mesh connectivity, i.e., it is independent of
+  the block size.  See Plato::BlockMatrixCache for reuse across assemblies.
 */
-template <typename MatrixType, Plato::OrdinalType DofsPerNode_I, Plato::OrdinalType DofsPerNode_J=DofsPerNode_I>
-Teuchos::RCP<MatrixType>
-CreateBlockMatrix( Plato::Mesh aMesh )
+template <typename MatrixType>
+void
+CreateBlockMatrixGraph(
+  Plato::Mesh                           aMesh,
+  typename MatrixType::RowMapVectorT  & aRowMap,
+  typename MatrixType::OrdinalVectorT & aColumnIndices
+)
 /******************************************************************************/
 {
     Plato::OrdinalVectorT<const Plato::OrdinalType> tOffsetMap;
@@ -429,11 +459,7 @@ CreateBlockMatrix( Plato::Mesh aMesh )
     // add 1 to each rowMap entry after the first
     auto nnz = tNodeOrds.size() + numRows;
 
-    // account for num dofs per node
-    constexpr Plato::OrdinalType numBlockDofs = DofsPerNode_I*DofsPerNode_J;
-
     typename MatrixType::RowMapVectorT  rowMap("row map", numRows+1);
-    typename MatrixType::ScalarVectorT  entries("matrix entries", nnz*numBlockDofs);
     typename MatrixType::OrdinalVectorT columnIndices("column indices", nnz);
 
     // The compressed row storage format in omega_h doesn't include diagonals.  This
@@ -480,6 +506,91 @@ CreateBlockMatrix( Plato::Mesh aMesh )
       }
     });
 
+    aRowMap = rowMap;
+    aColumnIndices = columnIndices;
+}
+
+/******************************************************************************/
+/*!
+  \brief Create an element-to-CSR scatter table for block matrices
+
+  \param [in] aMesh          Plato abstract mesh on which the graph is based.
+  \param [in] aRowMap        block row map, see Plato::CreateBlockMatrixGraph
+  \param [in] aColumnIndices block column indices
+
+  Returns a table of size NumCells X NodesPerCell X NodesPerCell, where entry
+  (cell, iNode, jNode) holds the block entry ordinal of the element-local node
+  pair.  The table is independent of the block size, so one table serves every
+  block matrix built on the same graph.
+*/
+template <typename MatrixType, Plato::OrdinalType NodesPerCell>
+Plato::OrdinalVector
+CreateBlockMatrixScatterMap(
+        Plato::Mesh                           aMesh,
+  const typename MatrixType::RowMapVectorT  & aRowMap,
+  const typename MatrixType::OrdinalVectorT & aColumnIndices
+)
+/******************************************************************************/
+{
+    auto tCells2nodes = aMesh->Connectivity();
+    auto tNumCells = aMesh->NumElements();
+    auto tRowMap = aRowMap;
+    auto tColumnIndices = aColumnIndices;
+
+    Plato::OrdinalVector tScatterMap("scatter map", tNumCells*NodesPerCell*NodesPerCell);
+    Kokkos::parallel_for(Kokkos::RangePolicy<Plato::OrdinalType>(0,tNumCells), KOKKOS_LAMBDA(Plato::OrdinalType aCellOrdinal)
+    {
+      for (Plato::OrdinalType iNode=0; iNode<NodesPerCell; iNode++)
+      {
+        Plato::OrdinalType iLocalOrdinal = tCells2nodes(aCellOrdinal * NodesPerCell + iNode);
+        Plato::OrdinalType tRowStart = tRowMap(iLocalOrdinal);
+        Plato::OrdinalType tRowEnd   = tRowMap(iLocalOrdinal+1);
+        for (Plato::OrdinalType jNode=0; jNode<NodesPerCell; jNode++)
+        {
+          Plato::OrdinalType jLocalOrdinal = tCells2nodes(aCellOrdinal * NodesPerCell + jNode);
+          Plato::OrdinalType tEntry = Plato::OrdinalType(-1);
+          for (Plato::OrdinalType tEntryOrdinal=tRowStart; tEntryOrdinal<tRowEnd; tEntryOrdinal++)
+          {
+            if (tColumnIndices(tEntryOrdinal) == jLocalOrdinal)
+            {
+              tEntry = tEntryOrdinal;
+              break;
+            }
+          }
+          tScatterMap((aCellOrdinal * NodesPerCell + iNode) * NodesPerCell + jNode) = tEntry;
+        }
+      }
+    }, "scatter map");
+
+    return tScatterMap;
+}
+
+/******************************************************************************/
+/*!
+  \brief Create a matrix of type MatrixType
+
+  \param mesh Plato abstract mesh on which the matrix is based.  
+
+  Create a block matrix from connectivity in mesh with block size
+  DofsPerNode_I X DofsPerNode_J.
+*/
+template <typename MatrixType, Plato::OrdinalType DofsPerNode_I, Plato::OrdinalType DofsPerNode_J=DofsPerNode_I>
+Teuchos::RCP<MatrixType>
+CreateBlockMatrix( Plato::Mesh aMesh )
+/******************************************************************************/
+{
+    typename MatrixType::RowMapVectorT  rowMap;
+    typename MatrixType::OrdinalVectorT columnIndices;
+    Plato::CreateBlockMatrixGraph<MatrixType>(aMesh, rowMap, columnIndices);
+
+    auto numRows = rowMap.size() - 1;
+    auto nnz = columnIndices.size();
+
+    // account for num dofs per node
+    constexpr Plato::OrdinalType numBlockDofs = DofsPerNode_I*DofsPerNode_J;
+
+    typename MatrixType::ScalarVectorT  entries("matrix entries", nnz*numBlockDofs);
+
     auto retMatrix = Teuchos::rcp(
      new MatrixType( rowMap, columnIndices, entries,
                      numRows*DofsPerNode_I, numRows*DofsPerNode_J,
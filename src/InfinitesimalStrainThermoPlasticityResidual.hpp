@@ -331,7 +331,8 @@ private:
         const Plato::ScalarArray3DT     <ConfigT>      & aConfig
     )
     {
-        if(std::count(mPlotTable.begin(), mPlotTable.end(), "principal stresses"))
+        // output quantities are only computed by non-AD evaluations
+        if(Plato::storesOutput<ResultT>() && std::count(mPlotTable.begin(), mPlotTable.end(), "principal stresses"))
         {
             Plato::ComputePrincipalStresses<EvaluationType, SimplexPhysicsType> tComputePrincipalStresses;
             tComputePrincipalStresses.setBulkModulus(mElasticBulkModulus);
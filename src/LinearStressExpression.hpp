@@ -213,42 +213,40 @@ public:
       Plato::ScalarMultiVectorT<ResultT> tStress("Temporary Linear Stress",
                                                  tNumCells, mNumVoigtTerms);
 
-      // Note: unlike the original parallel_for one dimension of
-      // parallelism is lost because at present the expression
-      // evaluation is over a single parallel index.
-      Kokkos::parallel_for("Compute linear stress",
-                           Kokkos::RangePolicy<>(0, tNumCells),
-                           KOKKOS_LAMBDA(const Plato::OrdinalType & aCellOrdinal)
+      // Compute the stress one row of the cell stiffness at a time. The
+      // row is the same for all cells, so the expression is evaluated
+      // for all cells at once. Note: the second index of tStress is over
+      // tVoigtIndex_J.
+      for(Plato::OrdinalType tVoigtIndex_I = 0; tVoigtIndex_I < mNumVoigtTerms; tVoigtIndex_I++)
       {
-        // Compute the stress.  This loop cannot be parallelized
-        // because the cell stiffness is set locally and is used by
-        // all threads. In other words the tCellStiffness[tVoigtIndex_I]
-        // is in shared memory and used by all threads
-        for(Plato::OrdinalType tVoigtIndex_I = 0; tVoigtIndex_I < mNumVoigtTerms; tVoigtIndex_I++)
+        // Values that change based on the tVoigtIndex_I index.
+        if( tVarMaps(cCellStiffness).key )
+          tExpEval.set_variable( tVarMaps(cCellStiffness).value,
+                                 tCellStiffness[tVoigtIndex_I] );
+
+        tExpEval.evaluate_expression( tStress );
+
+        // Sum the stress values.
+        Kokkos::parallel_for("Compute linear stress",
+                             Kokkos::RangePolicy<>(0, tNumCells),
+                             KOKKOS_LAMBDA(const Plato::OrdinalType & aCellOrdinal)
         {
-            // Values that change based on the tVoigtIndex_I index.
-            if( tVarMaps(cCellStiffness).key )
-              tExpEval.set_variable( tVarMaps(cCellStiffness).value,
-                                     tCellStiffness[tVoigtIndex_I],
-                                     aCellOrdinal );
-
-            // Evaluate the expression for this cell. Note: the second
-            // index of tStress is over tVoigtIndex_J.
-            tExpEval.evaluate_expression( aCellOrdinal, tStress );
-
-            // Sum the stress values.
-            aCauchyStress(aCellOrdinal, tVoigtIndex_I) = 0.0;
-
-            for(Plato::OrdinalType tVoigtIndex_J = 0; tVoigtIndex_J < mNumVoigtTerms; tVoigtIndex_J++)
-            {
-              aCauchyStress(aCellOrdinal, tVoigtIndex_I) += tStress(aCellOrdinal, tVoigtIndex_J);
-
-              // The original stress equation.
-              // aCauchyStress(aCellOrdinal, tVoigtIndex_I) += (aSmallStrain(aCellOrdinal, tVoigtIndex_J)
-              // - tReferenceStrain(tVoigtIndex_J)) * tCellStiffness(tVoigtIndex_I, tVoigtIndex_J);
-            }
-        }
-      } );
+          aCauchyStress(aCellOrdinal, tVoigtIndex_I) = 0.0;
+
+          for(Plato::OrdinalType tVoigtIndex_J = 0; tVoigtIndex_J < mNumVoigtTerms; tVoigtIndex_J++)
+          {
+            aCauchyStress(aCellOrdinal, tVoigtIndex_I) += tStress(aCellOrdinal, tVoigtIndex_J);
+
+            // The original stress equation.
+            // aCauchyStress(aCellOrdinal, tVoigtIndex_I) += (aSmallStrain(aCellOrdinal, tVoigtIndex_J)
+            // - tReferenceStrain(tVoigtIndex_J)) * tCellStiffness(tVoigtIndex_I, tVoigtIndex_J);
+          }
+        } );
+
+        // Fence before the next row is set on the host, to make sure
+        // that the device kernels are done first.
+        Kokkos::fence();
+      }
 
       // Fence before deallocation on host, to make sure that the
       // device kernel is done first.
@@ -11,6 +11,24 @@ namespace Plato {
 
   enum class MaterialModelType { Linear, Nonlinear, Expression };
 
+  /******************************************************************************//**
+   * \brief Return the type of the material model with the given parameters
+   * \param [in] ParameterList with optional "Temperature Dependent" bool Parameter
+  **********************************************************************************/
+  inline Plato::MaterialModelType
+  materialModelType(const Teuchos::ParameterList& aParamList)
+  {
+      if (aParamList.isSublist("Elastic Stiffness Expression"))
+      {
+          return Plato::MaterialModelType::Expression;
+      }
+      if (aParamList.isType<bool>("Temperature Dependent") && aParamList.get<bool>("Temperature Dependent"))
+      {
+          return Plato::MaterialModelType::Nonlinear;
+      }
+      return Plato::MaterialModelType::Linear;
+  }
+
   /******************************************************************************/
   /*!
     \brief class for mappings from scalar to scalar
@@ -583,16 +601,9 @@ namespace Plato {
       **********************************************************************************/
       MaterialModel(const Teuchos::ParameterList& aParamList) 
       {
-          this->mType = Plato::MaterialModelType::Linear;
-          if (aParamList.isType<bool>("Temperature Dependent"))
-          {
-              if (aParamList.get<bool>("Temperature Dependent")) {
-                  this->mType = Plato::MaterialModelType::Nonlinear;
-              }
-          }
+          this->mType = Plato::materialModelType(aParamList);
           if (aParamList.isSublist("Elastic Stiffness Expression")) 
           {
-              this->mType = Plato::MaterialModelType::Expression;
               auto tCustomElasticSubList = aParamList.sublist("Elastic Stiffness Expression");
               if(tCustomElasticSubList.isType<double>("E0"))
               {          
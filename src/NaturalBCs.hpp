@@ -108,6 +108,18 @@ public :
         const Plato::ScalarMultiVectorT< ResultScalarType> &,
               Plato::Scalar aScale = 1.0,
               Plato::Scalar aCurrentTime = 0.0) const;
+
+    /***************************************************************************//**
+     * \brief Append the side set names of the natural boundary conditions
+     * \param [in,out] aSideSetNames side set names
+    *******************************************************************************/
+    void appendSideSetNames(std::vector<std::string> & aSideSetNames) const
+    {
+        for(const auto & tBC : mBCs)
+        {
+            aSideSetNames.push_back(tBC->getSideSetName());
+        }
+    }
 };
 // class NaturalBCs
 
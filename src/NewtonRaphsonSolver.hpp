@@ -14,6 +14,7 @@
 #include "AnalyzeMacros.hpp"
 #include "PlatoUtilities.hpp"
 #include "ApplyConstraints.hpp"
+#include "BlockMatrixCache.hpp"
 #include "solver/PlatoAbstractSolver.hpp"
 #include "NewtonRaphsonUtilities.hpp"
 #include "LocalVectorFunctionInc.hpp"
@@ -47,6 +48,7 @@ private:
     std::shared_ptr<Plato::GlobalVectorFunctionInc<PhysicsT>> mGlobalEquation;    /*!< global state residual interface */
     std::shared_ptr<Plato::LocalVectorFunctionInc<LocalPhysicsT>> mLocalEquation; /*!< local state residual interface*/
     Plato::WorksetBase<PhysicsT> mWorksetBase;   /*!< interface for assembly routines */
+    Plato::BlockMatrixCache mMatrixCache;        /*!< persistent tangent matrix sparsity graph */
 
     Plato::Scalar mStoppingTolerance;            /*!< stopping tolerance */
     Plato::Scalar mCurrentResidualNormTolerance; /*!< current residual norm stopping tolerance - avoids unnecessary solves */
@@ -267,7 +269,7 @@ private:
 
         // Assemble full Jacobian
         auto tMesh = mGlobalEquation->getMesh();
-        auto tGlobalJacobian = Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumGlobalDofsPerNode, mNumGlobalDofsPerNode>(tMesh);
+        auto tGlobalJacobian = mMatrixCache.matrix<mNumGlobalDofsPerNode, mNumGlobalDofsPerNode>();
         Plato::BlockMatrixEntryOrdinal<mNumNodesPerCell, mNumGlobalDofsPerNode> tGlobalJacEntryOrdinal(tGlobalJacobian, tMesh);
         auto tJacEntries = tGlobalJacobian->entries();
         Plato::assemble_jacobian(tNumCells, mNumGlobalDofsPerCell, mNumGlobalDofsPerCell, tGlobalJacEntryOrdinal, tDrDu, tJacEntries);
@@ -451,6 +453,7 @@ public:
     *******************************************************************************/
     NewtonRaphsonSolver(Plato::Mesh aMesh, Teuchos::ParameterList& aInputs, std::shared_ptr<Plato::AbstractSolver> &aLinearSolver) :
         mWorksetBase(aMesh),
+        mMatrixCache(aMesh),
         mStoppingTolerance(Plato::ParseTools::getSubParam<Plato::Scalar>(aInputs, "Newton-Raphson", "Stopping Tolerance", 1e-8)),
         mCurrentResidualNormTolerance(Plato::ParseTools::getSubParam<Plato::Scalar>(aInputs, "Newton-Raphson", "Current Residual Norm Stopping Tolerance", 1e-8)),
         mMaxNumSolverIter(Plato::ParseTools::getSubParam<Plato::OrdinalType>(aInputs, "Newton-Raphson", "Maximum Number Iterations", 10)),
@@ -470,6 +473,7 @@ public:
     *******************************************************************************/
     explicit NewtonRaphsonSolver(Plato::Mesh aMesh) :
         mWorksetBase(aMesh),
+        mMatrixCache(aMesh),
         mStoppingTolerance(1e-6),
         mCurrentResidualNormTolerance(5e-7),
         mMaxNumSolverIter(20),
@@ -537,6 +541,14 @@ public:
         mDirichletDofs = aInput;
     }
 
+    /***************************************************************************//**
+     * \brief Return number of iterations taken by the last Newton-Raphson solve
+    *******************************************************************************/
+    Plato::OrdinalType numIterations() const
+    {
+        return mCurrentSolverIter;
+    }
+
     /***************************************************************************//**
      * \brief Append output message to Newton-Raphson solver diagnostics file.
      * \param [in] aInput output message
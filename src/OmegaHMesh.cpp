@@ -132,6 +132,7 @@ namespace Plato
     )
     {
         mMesh.set_coords(Omega_h::Read<Plato::Scalar>(Omega_h::Write<Plato::Scalar>(aCoordinates)));
+        mCoordinatesVersion++;
     }
 
     Plato::OrdinalVectorT<const Plato::OrdinalType>
@@ -14,6 +14,7 @@
 #include "Plato_Solve.hpp"
 #include "AnalyzeMacros.hpp"
 #include "ApplyConstraints.hpp"
+#include "BlockMatrixCache.hpp"
 #include "VectorFunctionVMS.hpp"
 #include "solver/PlatoAbstractSolver.hpp"
 #include "LocalScalarFunctionInc.hpp"
@@ -178,6 +179,7 @@ private:
     std::shared_ptr<Plato::LocalVectorFunctionInc<LocalPhysicsT>> mLocalEquation; /*!< local equality constraint interface */
 
     Plato::WorksetBase<PhysicsT> mWorksetBase;   /*!< interface for assembly routines */
+    Plato::BlockMatrixCache mMatrixCache;        /*!< persistent tangent matrix sparsity graph */
 
     Plato::OrdinalType mNumPseudoTimeSteps;   /*!< current number of pseudo time steps*/
     Plato::OrdinalVector mDirichletDofs; /*!< Dirichlet boundary conditions degrees of freedom */
@@ -266,7 +268,7 @@ private:
 
         // Assemble full Jacobian
         auto tMesh = mGlobalEquation->getMesh();
-        auto tGlobalJacobian = Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumGlobalDofsPerNode, mNumGlobalDofsPerNode>(tMesh);
+        auto tGlobalJacobian = mMatrixCache.matrix<mNumGlobalDofsPerNode, mNumGlobalDofsPerNode>();
         Plato::BlockMatrixEntryOrdinal<mNumNodesPerCell, mNumGlobalDofsPerNode> tGlobalJacEntryOrdinal(tGlobalJacobian, tMesh);
         auto tJacEntries = tGlobalJacobian->entries();
         Plato::assemble_jacobian_transpose_pod(tNumCells, mNumGlobalDofsPerCell, mNumGlobalDofsPerCell, tGlobalJacEntryOrdinal, tDrDu, tJacEntries);
@@ -617,6 +619,7 @@ public:
     *******************************************************************************/
     PathDependentAdjointSolver(Plato::Mesh aMesh, Teuchos::ParameterList & aInputs, std::shared_ptr<Plato::AbstractSolver> &aLinearSolver) :
         mWorksetBase(aMesh),
+        mMatrixCache(aMesh),
         mNumPseudoTimeSteps(Plato::ParseTools::getSubParam<Plato::OrdinalType>(aInputs, "Time Stepping", "Initial Num. Pseudo Time Steps", 20)),
         mLinearSolver(aLinearSolver)
     {}
@@ -627,6 +630,7 @@ public:
     *******************************************************************************/
     explicit PathDependentAdjointSolver(Plato::Mesh aMesh) :
         mWorksetBase(aMesh),
+        mMatrixCache(aMesh),
         mNumPseudoTimeSteps(20),
         mLinearSolver(nullptr)
     {}
@@ -24,6 +24,7 @@
 #include "InfinitesimalStrainThermoPlasticity.hpp"
 #include "PathDependentScalarFunctionFactory.hpp"
 #include "TimeData.hpp"
+#include "BinomialCheckpoints.hpp"
 
 //temporary (until mesh IO is done)
 #include "OmegaHMesh.hpp"
@@ -76,6 +77,7 @@ private:
     Plato::Scalar mReferenceTemperature;          /*!< reference temperature */
     Plato::Scalar mInitialNormResidual;           /*!< initial norm of global residual */
     Plato::Scalar mDispControlConstant;           /*!< displacement control constant */
+    Plato::OrdinalType mNumCheckpoints;           /*!< number of checkpoints of the state history, zero stores every time step */
 
     Plato::ScalarVector mPressure;                /*!< projected pressure field */
     Plato::ScalarVector mControl;                 /*!< control variables for output */
@@ -102,6 +104,19 @@ private:
     std::string mPDEType; /*!< partial differential equation type */
     std::string mPhysics; /*!< simulated physics */
 
+    bool mAdaptiveTimeStepping;                    /*!< cut back and grow the failing pseudo time step instead of restarting with more steps */
+    Plato::OrdinalType mNominalNumTimeSteps;       /*!< number of pseudo time steps requested in the input, sets the largest adaptive step */
+    Plato::OrdinalType mEasyConvergenceIterations; /*!< the adaptive step grows if Newton-Raphson converges within this number of iterations */
+
+    std::map<std::string, Plato::Scalar> mCriterionValues; /*!< criteria values accumulated by a checkpointed forward solve */
+    std::vector<Plato::OrdinalType> mCheckpointSteps;      /*!< state stored in each checkpoint, -1 if none */
+    Plato::ScalarMultiVector mCheckpointLocalStates;       /*!< checkpointed local states, one row per checkpoint */
+    Plato::ScalarMultiVector mCheckpointGlobalStates;      /*!< checkpointed global states, one row per checkpoint */
+    Plato::ScalarMultiVector mCheckpointPressGrad;         /*!< checkpointed projected pressure gradients, one row per checkpoint */
+    Plato::ScalarMultiVector mSweepLocalStates;            /*!< previous, current and next local states of the reverse sweep */
+    Plato::ScalarMultiVector mSweepGlobalStates;           /*!< previous, current and next global states of the reverse sweep */
+    Plato::ScalarMultiVector mSweepPressGrad;              /*!< previous, current and next projected pressure gradients of the reverse sweep */
+
 // public functions
 public:
     /***************************************************************************//**
@@ -125,11 +140,12 @@ public:
       mReferenceTemperature(1.0),
       mInitialNormResidual(std::numeric_limits<Plato::Scalar>::max()),
       mDispControlConstant(std::numeric_limits<Plato::Scalar>::min()),
+      mNumCheckpoints(Plato::ParseTools::getSubParam<Plato::OrdinalType>(aInputs, "Time Stepping", "Checkpoints", 0)),
       mPressure("Previous Pressure Field", aMesh->NumNodes()),
-      mLocalStates("Local States", mTimeData->mNumTimeSteps, mLocalEquation->size()),
-      mGlobalStates("Global States", mTimeData->mNumTimeSteps, mGlobalEquation->size()),
-      mReactionForce("Reaction Force", mTimeData->mNumTimeSteps, aMesh->NumNodes()),
-      mProjectedPressGrad("Projected Pressure Gradient", mTimeData->mNumTimeSteps, mProjectionEquation->size()),
+      mLocalStates("Local States", this->numStateRows(), mLocalEquation->size()),
+      mGlobalStates("Global States", this->numStateRows(), mGlobalEquation->size()),
+      mReactionForce("Reaction Force", this->numStateRows(), aMesh->NumNodes()),
+      mProjectedPressGrad("Projected Pressure Gradient", this->numStateRows(), mProjectionEquation->size()),
       mWorksetBase(aMesh),
       mLinearSolverFactory(aInputs.sublist("Linear Solver")),
       mLinearSolver(mLinearSolverFactory.create(aMesh->NumNodes(), aMachine, PhysicsT::mNumDofsPerNode)),
@@ -138,8 +154,12 @@ public:
       mStopOptimization(false),
       mPDEType(aInputs.get<std::string>("PDE Constraint")),
       mPhysics(aInputs.get<std::string>("Physics")),
+      mAdaptiveTimeStepping(Plato::ParseTools::getSubParam<bool>(aInputs, "Time Stepping", "Adaptive Time Stepping", false)),
+      mNominalNumTimeSteps(mTimeData->mNumTimeSteps),
+      mEasyConvergenceIterations(Plato::ParseTools::getSubParam<Plato::OrdinalType>(aInputs, "Time Stepping", "Easy Convergence Iterations", 3)),
       mEssentialBCs(nullptr)
     {
+        mDataMap.mOutputPlan = Plato::parse_state_output_plan(aInputs, aMesh);
         this->initialize(aInputs);
     }
 
@@ -160,6 +180,15 @@ public:
         mGlobalEquation = aInput;
     }
 
+    /***************************************************************************//**
+     * \brief Return time data, it holds the pseudo time step history of the last forward solve
+     * \return time data
+    *******************************************************************************/
+    const Plato::TimeData & getTimeData() const
+    {
+        return (*mTimeData);
+    }
+
     /***************************************************************************//**
      * \brief Read essential (Dirichlet) boundary conditions from the Exodus file.
      * \param [in] aSpatialModel Plato Analyze spatial model
@@ -245,9 +274,15 @@ public:
 
             }
 
-            Plato::AddStateData(tWriter, mDataMap.getState(tSnapshot), mSpaceDim);
+            // with checkpointing, only the last two time steps are stored
+            auto tStepIndex = this->isCheckpointed() ? mTimeData->mNumTimeSteps - 2 + tSnapshot : tSnapshot;
+            auto tStateIndex = mDataMap.stateIndex(tStepIndex);
+            if (tStateIndex >= 0)
+            {
+                Plato::AddStateData(tWriter, mDataMap.getState(tStateIndex), mSpaceDim);
+            }
 
-            auto tTime = mTimeData->mCurrentTimeStepSize * static_cast<Plato::Scalar>(tSnapshot + 1);
+            auto tTime = mTimeData->getTime(tStepIndex);
             tWriter->Write(tSnapshot, tTime);
         }
     }
@@ -297,6 +332,28 @@ public:
         
         mDataMap.scalarNodeFields["Topology"] = aControls;
 
+        if(mAdaptiveTimeStepping == true)
+        {
+            bool tDidSolverConverge = this->solveForwardProblemAdaptive(aControls);
+            std::stringstream tMsg;
+            if(tDidSolverConverge == true)
+            {
+                tMsg << "\n**** Forward Solve Was Successful ****\n";
+            }
+            else
+            {
+                tMsg << "\n**** Minimum Pseudo Time Step Size Was Reached. "
+                        << "Plasticity Problem failed to converge to a solution. ****\n";
+                REPORT(tMsg.str().c_str());
+                mStopOptimization = true;
+            }
+            mNewtonSolver->appendOutputMessage(tMsg);
+
+            Plato::Solutions tSolution(mPhysics);
+            tSolution.set("State", mGlobalStates);
+            return tSolution;
+        }
+
         bool tStop = false;
         while (tStop == false)
         {
@@ -365,6 +422,11 @@ public:
             Criterion tCriterion = mCriteria[aName];
 
             this->shouldOptimizationProblemStop();
+            if(this->isCheckpointed())
+            {
+                // the state history isn't stored, the forward solve accumulated the criterion
+                return mCriterionValues.at(aName);
+            }
             auto tGlobalState = aSolution.get("State"); 
             auto tOutput = this->evaluateCriterion(*tCriterion, tGlobalState, mLocalStates, aControls);
 
@@ -399,6 +461,10 @@ public:
             Criterion tCriterion = mCriteria[aName];
 
             this->shouldOptimizationProblemStop();
+            if(this->isCheckpointed())
+            {
+                return mCriterionValues.at(aName);
+            }
             auto tOutput = this->evaluateCriterion(*tCriterion, mGlobalStates, mLocalStates, aControls);
 
             return (tOutput);
@@ -513,8 +579,16 @@ public:
 
         auto tNumNodes = mGlobalEquation->numNodes();
         Plato::ScalarVector tTotalDerivative("Total Derivative", tNumNodes);
-        this->backwardTimeIntegration(Plato::PartialDerivative::CONTROL, aControls, tTotalDerivative);
-        this->addCriterionPartialDerivativeZ(*aCriterion, aControls, tTotalDerivative);
+        if(this->isCheckpointed())
+        {
+            // the reverse sweep adds the criterion partial derivative of each recomputed time step
+            this->backwardTimeIntegrationCheckpointed(Plato::PartialDerivative::CONTROL, *aCriterion, aControls, tTotalDerivative);
+        }
+        else
+        {
+            this->backwardTimeIntegration(Plato::PartialDerivative::CONTROL, aControls, tTotalDerivative);
+            this->addCriterionPartialDerivativeZ(*aCriterion, aControls, tTotalDerivative);
+        }
 
         return (tTotalDerivative);
     }
@@ -619,8 +693,15 @@ public:
         this->shouldOptimizationProblemStop();
         mAdjointSolver->appendScalarFunction(aCriterion);
         Plato::ScalarVector tTotalDerivative("Total Derivative", mNumConfigDofsPerCell);
-        this->backwardTimeIntegration(Plato::PartialDerivative::CONFIGURATION, aControls, tTotalDerivative);
-        this->addCriterionPartialDerivativeX(*aCriterion, aControls, tTotalDerivative);
+        if(this->isCheckpointed())
+        {
+            this->backwardTimeIntegrationCheckpointed(Plato::PartialDerivative::CONFIGURATION, *aCriterion, aControls, tTotalDerivative);
+        }
+        else
+        {
+            this->backwardTimeIntegration(Plato::PartialDerivative::CONFIGURATION, aControls, tTotalDerivative);
+            this->addCriterionPartialDerivativeX(*aCriterion, aControls, tTotalDerivative);
+        }
 
         return (tTotalDerivative);
     }
@@ -638,7 +719,8 @@ public:
                                                      aStates.mProjectedPressGrad, aControl, *(aStates.mTimeData));
 
         auto tNumNodes = mGlobalEquation->numNodes();
-        auto tReactionForce = Kokkos::subview(mReactionForce, aStates.mCurrentStepIndex, Kokkos::ALL());
+        auto tReactionForce = Kokkos::subview(mReactionForce, this->stateRow(aStates.mCurrentStepIndex), Kokkos::ALL());
+        Plato::blas1::fill(0.0, tReactionForce);
         Kokkos::parallel_for(Kokkos::RangePolicy<>(0, tNumNodes), KOKKOS_LAMBDA(const Plato::OrdinalType &aOrdinal)
         {
             for(Plato::OrdinalType tDim = 0; tDim < mSpaceDim; tDim++)
@@ -729,6 +811,53 @@ private:
             }
         }
 
+        if (mAdaptiveTimeStepping && mTimeData->mTimeStepExpansionMultiplier <= static_cast<Plato::Scalar>(1.0))
+        {
+            ANALYZE_THROWERR("Plasticity Problem: 'Expansion Multiplier' must be greater than 1 for adaptive time stepping.")
+        }
+
+        if (mNumCheckpoints > static_cast<Plato::OrdinalType>(0))
+        {
+            if (mAdaptiveTimeStepping)
+            {
+                ANALYZE_THROWERR("Plasticity Problem: 'Checkpoints' are not supported with adaptive time stepping.")
+            }
+            mCheckpointLocalStates  = Plato::ScalarMultiVector("Checkpoint Local States",  mNumCheckpoints, mLocalEquation->size());
+            mCheckpointGlobalStates = Plato::ScalarMultiVector("Checkpoint Global States", mNumCheckpoints, mGlobalEquation->size());
+            mCheckpointPressGrad    = Plato::ScalarMultiVector("Checkpoint Projected Pressure Gradient", mNumCheckpoints, mProjectionEquation->size());
+            mSweepLocalStates  = Plato::ScalarMultiVector("Sweep Local States",  3, mLocalEquation->size());
+            mSweepGlobalStates = Plato::ScalarMultiVector("Sweep Global States", 3, mGlobalEquation->size());
+            mSweepPressGrad    = Plato::ScalarMultiVector("Sweep Projected Pressure Gradient", 3, mProjectionEquation->size());
+            mCheckpointSteps.assign(mNumCheckpoints, -1);
+        }
+    }
+
+    /***************************************************************************//**
+     * \brief Return true if only checkpoints of the state history are stored, i.e.
+     *   the requested number of checkpoints is smaller than the number of time steps.
+    *******************************************************************************/
+    bool isCheckpointed() const
+    {
+        return mNumCheckpoints > static_cast<Plato::OrdinalType>(0) && mNumCheckpoints < mTimeData->mNumTimeSteps;
+    }
+
+    /***************************************************************************//**
+     * \brief Return the number of time steps held by the state containers
+    *******************************************************************************/
+    Plato::OrdinalType numStateRows() const
+    {
+        return this->isCheckpointed() ? static_cast<Plato::OrdinalType>(2) : mTimeData->mNumTimeSteps;
+    }
+
+    /***************************************************************************//**
+     * \brief Return the row of the state containers that holds a time step.  With
+     *   checkpointing, consecutive time steps alternate between two rows and the
+     *   last time step is held by the second row.
+     * \param [in] aStepIndex time step index
+    *******************************************************************************/
+    Plato::OrdinalType stateRow(const Plato::OrdinalType & aStepIndex) const
+    {
+        return this->isCheckpointed() ? (aStepIndex + mTimeData->mNumTimeSteps) % 2 : aStepIndex;
     }
 
     /***************************************************************************//**
@@ -755,10 +884,29 @@ private:
 
         Plato::blas1::fill(0.0, mPreviousStepDirichletValues);
 
-        Kokkos::resize(mLocalStates, mTimeData->mNumTimeSteps, mLocalEquation->size());
-        Kokkos::resize(mGlobalStates, mTimeData->mNumTimeSteps, mGlobalEquation->size());
-        Kokkos::resize(mReactionForce, mTimeData->mNumTimeSteps, mGlobalEquation->numNodes());
-        Kokkos::resize(mProjectedPressGrad, mTimeData->mNumTimeSteps, mProjectionEquation->size());
+        Kokkos::resize(mLocalStates, this->numStateRows(), mLocalEquation->size());
+        Kokkos::resize(mGlobalStates, this->numStateRows(), mGlobalEquation->size());
+        Kokkos::resize(mReactionForce, this->numStateRows(), mGlobalEquation->numNodes());
+        Kokkos::resize(mProjectedPressGrad, this->numStateRows(), mProjectionEquation->size());
+    }
+
+    /***************************************************************************//**
+     * \brief Grow time-dependent state containers, preserving their content, so that
+     *   they hold at least the requested number of time steps.
+     * \param [in] aNumTimeSteps requested number of time steps
+    *******************************************************************************/
+    void reserveTimeDependentStates(const Plato::OrdinalType & aNumTimeSteps)
+    {
+        Plato::OrdinalType tCapacity = mGlobalStates.extent(0);
+        if(aNumTimeSteps <= tCapacity)
+        {
+            return;
+        }
+        tCapacity = std::max(aNumTimeSteps, static_cast<Plato::OrdinalType>(2) * tCapacity);
+        Kokkos::resize(mLocalStates, tCapacity, mLocalEquation->size());
+        Kokkos::resize(mGlobalStates, tCapacity, mGlobalEquation->size());
+        Kokkos::resize(mReactionForce, tCapacity, mGlobalEquation->numNodes());
+        Kokkos::resize(mProjectedPressGrad, tCapacity, mProjectionEquation->size());
     }
 
     /***************************************************************************//**
@@ -794,6 +942,20 @@ private:
         Plato::blas2::fill(static_cast<Plato::Scalar>(0.0), mGlobalStates);
         Plato::blas2::fill(static_cast<Plato::Scalar>(0.0), mProjectedPressGrad);
 
+        // checkpoint schedules count the zero initial state as state 0, time step k is state k+1
+        std::vector<Plato::OrdinalType> tCheckpointChain;
+        std::size_t tNextCheckpoint = 0;
+        if(this->isCheckpointed())
+        {
+            for(const auto & tPair : mCriteria) { mCriterionValues[tPair.first] = 0.0; }
+            Plato::blas2::fill(static_cast<Plato::Scalar>(0.0), mCheckpointLocalStates);
+            Plato::blas2::fill(static_cast<Plato::Scalar>(0.0), mCheckpointGlobalStates);
+            Plato::blas2::fill(static_cast<Plato::Scalar>(0.0), mCheckpointPressGrad);
+            std::fill(mCheckpointSteps.begin(), mCheckpointSteps.end(), -1);
+            mCheckpointSteps[0] = 0;
+            tCheckpointChain = Plato::binomial_checkpoint_chain(mTimeData->mNumTimeSteps + 1, mNumCheckpoints);
+        }
+
         bool tForwardProblemSolved = false;
         for(Plato::OrdinalType tCurrentStepIndex = 0; tCurrentStepIndex < mTimeData->mNumTimeSteps; tCurrentStepIndex++)
         {
@@ -812,7 +974,7 @@ private:
 
             // update local and global states
             bool tNewtonRaphsonConverged = mNewtonSolver->solve(aControls, tCurrentState);
-            mDataMap.saveState();
+            mDataMap.saveState(tCurrentStepIndex, mTimeData->mCurrentTime);
 
             // compute reaction force
             this->computeReactionForce(aControls, tCurrentState);
@@ -828,6 +990,17 @@ private:
                 return tForwardProblemSolved;
             }
 
+            if(this->isCheckpointed())
+            {
+                this->accumulateCriteria(aControls, tCurrentState);
+                if(tNextCheckpoint < tCheckpointChain.size() && tCheckpointChain[tNextCheckpoint] == tCurrentStepIndex + 1)
+                {
+                    tNextCheckpoint++;
+                    this->storeCheckpoint(tNextCheckpoint, tCurrentStepIndex + 1, tCurrentState.mCurrentGlobalState,
+                                          tCurrentState.mCurrentLocalState, tCurrentState.mProjectedPressGrad);
+                }
+            }
+
             // update projected pressure gradient state
             this->updateProjectedPressureGradient(aControls, tCurrentState);
         }
@@ -837,25 +1010,134 @@ private:
         return tForwardProblemSolved;
     }
 
+    /***************************************************************************//**
+     * \brief Solve forward problem with adaptive pseudo time steps.  If Newton-Raphson
+     *   fails, only the failing step is cut back by the expansion multiplier and solved
+     *   again from the last converged local and global states.  The step grows back,
+     *   up to the nominal step size, after an easy convergence.  The end time of each
+     *   accepted step is recorded in the time data, which is consumed by the criteria
+     *   evaluations and the adjoint backward time integration.
+     * \param [in] aControls 1-D view of controls, e.g. design variables
+     * \return flag used to indicate forward problem was solved to completion
+    *******************************************************************************/
+    bool solveForwardProblemAdaptive(const Plato::ScalarVector & aControls)
+    {
+        mDataMap.clearStates();
+        mTimeData->mTimeHistory.clear();
+
+        Kokkos::resize(mLocalStates, mNominalNumTimeSteps, mLocalEquation->size());
+        Kokkos::resize(mGlobalStates, mNominalNumTimeSteps, mGlobalEquation->size());
+        Kokkos::resize(mReactionForce, mNominalNumTimeSteps, mGlobalEquation->numNodes());
+        Kokkos::resize(mProjectedPressGrad, mNominalNumTimeSteps, mProjectionEquation->size());
+
+        Plato::CurrentStates tCurrentState(mTimeData);
+        tCurrentState.mDeltaGlobalState = Plato::ScalarVector("Global State Increment", mGlobalEquation->size());
+
+        this->initializeNewtonSolver();
+        Plato::blas2::fill(static_cast<Plato::Scalar>(0.0), mLocalStates);
+        Plato::blas2::fill(static_cast<Plato::Scalar>(0.0), mGlobalStates);
+        Plato::blas2::fill(static_cast<Plato::Scalar>(0.0), mProjectedPressGrad);
+
+        const Plato::Scalar tNominalStepSize = mTimeData->mEndTime / static_cast<Plato::Scalar>(mNominalNumTimeSteps);
+        const Plato::Scalar tMinStepSize = mTimeData->mEndTime / static_cast<Plato::Scalar>(mTimeData->mMaxNumTimeSteps);
+        Plato::Scalar tStepSize = tNominalStepSize;
+        Plato::Scalar tPreviousTime = mTimeData->mStartTime;
+        Plato::OrdinalType tStepIndex = 0;
+        while(true)
+        {
+            // a step that would leave a sliver before the end time is stretched to it
+            Plato::Scalar tTrialTime = tPreviousTime + tStepSize;
+            if(tTrialTime > mTimeData->mEndTime - static_cast<Plato::Scalar>(0.5) * tMinStepSize)
+            {
+                tTrialTime = mTimeData->mEndTime;
+            }
+            mTimeData->mTimeHistory.push_back(tTrialTime);
+            mTimeData->updateTimeData(tStepIndex);
+
+            std::stringstream tMsg;
+            tMsg << "TIME STEP #" << mTimeData->getTimeStepIndexPlusOne() << ", TIME STEP SIZE = " << mTimeData->mCurrentTimeStepSize
+                 << ", TOTAL TIME = " << mTimeData->mCurrentTime << "\n";
+            mNewtonSolver->appendOutputMessage(tMsg);
+
+            this->reserveTimeDependentStates(tStepIndex + 1);
+            tCurrentState.mCurrentStepIndex = tStepIndex;
+            this->cacheStateData(tCurrentState);
+
+            // update displacement and load control multiplier
+            this->updateDispAndLoadControlMultipliers(tStepIndex);
+
+            // update local and global states, the previous states are left untouched
+            bool tNewtonRaphsonConverged = mNewtonSolver->solve(aControls, tCurrentState);
+            if(tNewtonRaphsonConverged == false)
+            {
+                mTimeData->mTimeHistory.pop_back();
+                auto tFailedStepSize = tTrialTime - tPreviousTime;
+                if(tFailedStepSize <= tMinStepSize * (static_cast<Plato::Scalar>(1.0) + std::numeric_limits<Plato::Scalar>::epsilon()))
+                {
+                    std::stringstream tFailMsg;
+                    tFailMsg << "**** Newton-Raphson Solver did not converge at time step #" << mTimeData->getTimeStepIndexPlusOne()
+                         << " with the minimum time step size '" << tMinStepSize << "'. ****\n\n";
+                    mNewtonSolver->appendOutputMessage(tFailMsg);
+                    return false;
+                }
+                tStepSize = std::max(tFailedStepSize / mTimeData->mTimeStepExpansionMultiplier, tMinStepSize);
+
+                std::stringstream tFailMsg;
+                tFailMsg << "**** Newton-Raphson Solver did not converge at time step #" << mTimeData->getTimeStepIndexPlusOne()
+                     << ".  Time step size will be decreased to '" << tStepSize << "'. ****\n\n";
+                mNewtonSolver->appendOutputMessage(tFailMsg);
+                continue;
+            }
+            mDataMap.saveState(tStepIndex, mTimeData->mCurrentTime);
+
+            // compute reaction force
+            this->computeReactionForce(aControls, tCurrentState);
+
+            tPreviousTime = tTrialTime;
+            tStepIndex++;
+            if(mTimeData->atFinalTimeStep())
+            {
+                break;
+            }
+
+            // update projected pressure gradient state
+            this->reserveTimeDependentStates(tStepIndex + 1);
+            this->updateProjectedPressureGradient(aControls, tCurrentState);
+
+            if(mNewtonSolver->numIterations() <= mEasyConvergenceIterations)
+            {
+                tStepSize = std::min(tStepSize * mTimeData->mTimeStepExpansionMultiplier, tNominalStepSize);
+            }
+        }
+
+        mTimeData->mNumTimeSteps = tStepIndex;
+        Kokkos::resize(mLocalStates, tStepIndex, mLocalEquation->size());
+        Kokkos::resize(mGlobalStates, tStepIndex, mGlobalEquation->size());
+        Kokkos::resize(mReactionForce, tStepIndex, mGlobalEquation->numNodes());
+        Kokkos::resize(mProjectedPressGrad, tStepIndex, mProjectionEquation->size());
+        return true;
+    }
+
     /***************************************************************************//**
      * \brief Update displacement and load control multiplier.
      * \param [in] aInput  current time step index
     *******************************************************************************/
     void updateDispAndLoadControlMultipliers(const Plato::OrdinalType& aInput)
     {
-        auto tLoadControlConstant = mTimeData->mCurrentTimeStepSize * static_cast<Plato::Scalar>(aInput + 1);
+        auto tLoadControlConstant = mTimeData->mCurrentTime;
         mDataMap.mScalarValues["LoadControlConstant"] = tLoadControlConstant;
 
+        if (mEssentialBCs == nullptr)
+          ANALYZE_THROWERR("EssentialBCs pointer is null!")
+
+        // previous values are evaluated at the previous time, a retried step must not pick up the values of the failed attempt
         if (aInput != static_cast<Plato::OrdinalType>(0))
-          Plato::blas1::copy(mDirichletValues, mPreviousStepDirichletValues);
+          mEssentialBCs->get(mDirichletDofs, mPreviousStepDirichletValues, mTimeData->getPreviousTime());
         else
           Plato::blas1::fill(0.0, mPreviousStepDirichletValues);
 
         auto tCurrentTime = tLoadControlConstant;
-        if (mEssentialBCs != nullptr)
-          mEssentialBCs->get(mDirichletDofs, mDirichletValues, tCurrentTime);
-        else
-          ANALYZE_THROWERR("EssentialBCs pointer is null!")
+        mEssentialBCs->get(mDirichletDofs, mDirichletValues, tCurrentTime);
 
         Plato::ScalarVector tNewtonUpdateDirichletValues("Dirichlet Increment Values", mDirichletValues.size());
         Plato::blas1::copy(mDirichletValues, tNewtonUpdateDirichletValues);
@@ -873,21 +1155,39 @@ private:
                                          Plato::CurrentStates &aStateData)
     {
         Plato::OrdinalType tNextStepIndex = aStateData.mCurrentStepIndex + static_cast<Plato::OrdinalType>(1);
-        if(tNextStepIndex >= mTimeData->mNumTimeSteps)
+        Plato::OrdinalType tNumTimeSteps = this->isCheckpointed() ? mTimeData->mNumTimeSteps
+                                                                  : static_cast<Plato::OrdinalType>(mProjectedPressGrad.extent(0));
+        if(tNextStepIndex >= tNumTimeSteps)
         {
             return;
         }
 
+        auto tNextProjectedPressureGradient = Kokkos::subview(mProjectedPressGrad, this->stateRow(tNextStepIndex), Kokkos::ALL());
+        this->projectPressureGradient(aControls, aStateData.mCurrentGlobalState, tNextStepIndex, tNextProjectedPressureGradient);
+    }
+
+    /***************************************************************************//**
+     * \brief Project the pressure gradient of a time step from the pressure of the
+     *   global state of the previous time step.
+     * \param [in]     aControls    1-D view of controls, e.g. design variables
+     * \param [in]     aGlobalState global state of the previous time step
+     * \param [in]     aStepIndex   time step index
+     * \param [in/out] aOutput      projected pressure gradient
+    *******************************************************************************/
+    void projectPressureGradient(const Plato::ScalarVector & aControls,
+                                 const Plato::ScalarVector & aGlobalState,
+                                 const Plato::OrdinalType  & aStepIndex,
+                                 const Plato::ScalarVector & aOutput)
+    {
         // copy projection state, i.e. pressure
-        Plato::blas1::extract<mNumGlobalDofsPerNode, mPressureDofOffset>(aStateData.mCurrentGlobalState, mPressure);
+        Plato::blas1::extract<mNumGlobalDofsPerNode, mPressureDofOffset>(aGlobalState, mPressure);
 
         // compute projected pressure gradient
-        auto tNextProjectedPressureGradient = Kokkos::subview(mProjectedPressGrad, tNextStepIndex, Kokkos::ALL());
-        Plato::blas1::fill(0.0, tNextProjectedPressureGradient);
-        auto tProjResidual = mProjectionEquation->value(tNextProjectedPressureGradient, mPressure, aControls, tNextStepIndex);
-        auto tProjJacobian = mProjectionEquation->gradient_u(tNextProjectedPressureGradient, mPressure, aControls, tNextStepIndex);
+        Plato::blas1::fill(0.0, aOutput);
+        auto tProjResidual = mProjectionEquation->value(aOutput, mPressure, aControls, aStepIndex);
+        auto tProjJacobian = mProjectionEquation->gradient_u(aOutput, mPressure, aControls, aStepIndex);
         Plato::blas1::scale(-1.0, tProjResidual);
-        Plato::Solve::RowSummed<PhysicsT::mNumSpatialDims>(tProjJacobian, tNextProjectedPressureGradient, tProjResidual);
+        Plato::Solve::RowSummed<PhysicsT::mNumSpatialDims>(tProjJacobian, aOutput, tProjResidual);
     }
 
     /***************************************************************************//**
@@ -903,7 +1203,7 @@ private:
         auto tPreviousStepIndex = aCurrentStepIndex - static_cast<Plato::OrdinalType>(1);
         if(tPreviousStepIndex >= static_cast<Plato::OrdinalType>(0))
         {
-            aOutput = Kokkos::subview(aStates, tPreviousStepIndex, Kokkos::ALL());
+            aOutput = Kokkos::subview(aStates, this->stateRow(tPreviousStepIndex), Kokkos::ALL());
         }
         else
         {
@@ -1065,6 +1365,228 @@ private:
         }
     }
 
+    /***************************************************************************//**
+     * \brief Perform backward time integration on the checkpoints of the state
+     * history and add Partial Differential Equation (PDE) and criterion contributions
+     * to total gradient.  The time steps are recomputed from the checkpoints on a
+     * binomial schedule, the zero initial state is state 0 and time step k is state k+1.
+     * \param [in]     aType      partial derivative type
+     * \param [in]     aCriterion design criterion interface
+     * \param [in]     aControls  current controls, e.g. design variables
+     * \param [in/out] aOutput    total derivative of criterion with respect to controls
+    *******************************************************************************/
+    void backwardTimeIntegrationCheckpointed(const Plato::PartialDerivative::derivative_t & aType,
+                                             Plato::LocalScalarFunctionInc & aCriterion,
+                                             const Plato::ScalarVector & aControls,
+                                             Plato::ScalarVector aTotalDerivative)
+    {
+        // Create state data manager
+        auto tNumCells = mLocalEquation->numCells();
+        Plato::ForwardStates tCurrentStates(aType, *mTimeData);
+        Plato::ForwardStates tPreviousStates(aType, *mTimeData);
+        Plato::AdjointStates tAdjointStates(mGlobalEquation->size(), mLocalEquation->size(), mProjectionEquation->size());
+        tAdjointStates.mInvLocalJacT = ScalarArray3D("Inv(DhDc)^T", tNumCells, mNumLocalDofsPerCell, mNumLocalDofsPerCell);
+
+        this->initializeAdjointSolver();
+        this->initializeNewtonSolver();
+
+        Plato::binomial_reverse_segment(/*begin=*/0, /*end=*/mTimeData->mNumTimeSteps + 1, /*slot=*/0, mCheckpointSteps,
+          [&](Plato::OrdinalType aSlot, Plato::OrdinalType aState)
+        {
+            this->recompute(aControls, aSlot, aState);
+            this->storeCheckpoint(aSlot + 1, aState, Kokkos::subview(mSweepGlobalStates, 1, Kokkos::ALL()),
+                                  Kokkos::subview(mSweepLocalStates, 1, Kokkos::ALL()), Kokkos::subview(mSweepPressGrad, 1, Kokkos::ALL()));
+        },
+          [&](Plato::OrdinalType aSlot, Plato::OrdinalType aState)
+        {
+            this->recompute(aControls, aSlot, aState);
+
+            tCurrentStates.mCurrentStepIndex = aState - static_cast<Plato::OrdinalType>(1);
+            tCurrentStates.mTimeData.updateTimeData(tCurrentStates.mCurrentStepIndex);
+
+            tPreviousStates.mCurrentStepIndex = tCurrentStates.mCurrentStepIndex + 1;
+            tPreviousStates.mTimeData.updateTimeData(tPreviousStates.mCurrentStepIndex);
+            if(tPreviousStates.mCurrentStepIndex < mTimeData->mNumTimeSteps)
+            {
+                this->updateSweepState(tPreviousStates, /*row=*/2);
+            }
+            this->updateSweepState(tCurrentStates, /*row=*/1);
+            this->updateAdjointState(tAdjointStates);
+
+            mAdjointSolver->updateAdjointVariables(aControls, tCurrentStates, tPreviousStates, tAdjointStates);
+            mAdjointSolver->addContributionFromPDE(aControls, tCurrentStates, tAdjointStates, aTotalDerivative);
+            this->addCriterionPartialDerivative(aCriterion, aControls, tCurrentStates, aTotalDerivative);
+
+            // the current time step is the next time step of the following reverse step
+            this->copySweepRow(/*from=*/1, /*to=*/2);
+        });
+
+        // recomputed time steps moved the time data, leave it at the last time step as the forward solve does
+        mTimeData->updateTimeData(mTimeData->mNumTimeSteps - static_cast<Plato::OrdinalType>(1));
+    }
+
+    /***************************************************************************//**
+     * \brief Recompute a state from checkpoint aSlot into the current row of the
+     * sweep containers, the previous row holds the state before it.
+     * \param [in] aControls current controls, e.g. design variables
+     * \param [in] aSlot     checkpoint the recomputation starts from
+     * \param [in] aState    state index, i.e. time step index plus one
+    *******************************************************************************/
+    void recompute(const Plato::ScalarVector & aControls,
+                   Plato::OrdinalType aSlot,
+                   Plato::OrdinalType aState)
+    {
+        if(aState == mCheckpointSteps[aSlot] && aSlot > 0)
+        {
+            // the checkpointed state itself: the previous state isn't stored, so recompute
+            // it from the preceding checkpoint, which stores an earlier state
+            this->recompute(aControls, aSlot - 1, aState - 1);
+            this->copySweepRow(/*from=*/1, /*to=*/0);
+            this->loadCheckpoint(aSlot);
+            return;
+        }
+
+        this->loadCheckpoint(aSlot);
+        for(Plato::OrdinalType tState = mCheckpointSteps[aSlot] + 1; tState <= aState; tState++)
+        {
+            this->copySweepRow(/*from=*/1, /*to=*/0);
+            this->advanceSweepState(aControls, tState - static_cast<Plato::OrdinalType>(1));
+        }
+    }
+
+    /***************************************************************************//**
+     * \brief Solve a time step into the current row of the sweep containers from
+     * the previous row, with the same initial guess as the forward solve.
+     * \param [in] aControls  current controls, e.g. design variables
+     * \param [in] aStepIndex time step index
+    *******************************************************************************/
+    void advanceSweepState(const Plato::ScalarVector & aControls, const Plato::OrdinalType & aStepIndex)
+    {
+        Plato::CurrentStates tCurrentState(mTimeData);
+        tCurrentState.mCurrentStepIndex = aStepIndex;
+        tCurrentState.mDeltaGlobalState = Plato::ScalarVector("Global State Increment", mGlobalEquation->size());
+        tCurrentState.mCurrentLocalState = Kokkos::subview(mSweepLocalStates, 1, Kokkos::ALL());
+        tCurrentState.mCurrentGlobalState = Kokkos::subview(mSweepGlobalStates, 1, Kokkos::ALL());
+        tCurrentState.mProjectedPressGrad = Kokkos::subview(mSweepPressGrad, 1, Kokkos::ALL());
+        if(aStepIndex > static_cast<Plato::OrdinalType>(0))
+        {
+            tCurrentState.mPreviousLocalState = Kokkos::subview(mSweepLocalStates, 0, Kokkos::ALL());
+            tCurrentState.mPreviousGlobalState = Kokkos::subview(mSweepGlobalStates, 0, Kokkos::ALL());
+            this->projectPressureGradient(aControls, tCurrentState.mPreviousGlobalState, aStepIndex, tCurrentState.mProjectedPressGrad);
+        }
+        else
+        {
+            this->getPreviousState(aStepIndex, mSweepLocalStates, tCurrentState.mPreviousLocalState);
+            this->getPreviousState(aStepIndex, mSweepGlobalStates, tCurrentState.mPreviousGlobalState);
+            Plato::blas1::fill(static_cast<Plato::Scalar>(0.0), tCurrentState.mProjectedPressGrad);
+        }
+        Plato::blas1::fill(static_cast<Plato::Scalar>(0.0), tCurrentState.mCurrentLocalState);
+        Plato::blas1::fill(static_cast<Plato::Scalar>(0.0), tCurrentState.mCurrentGlobalState);
+
+        mTimeData->updateTimeData(aStepIndex);
+        this->updateDispAndLoadControlMultipliers(aStepIndex);
+        if(mNewtonSolver->solve(aControls, tCurrentState) == false)
+        {
+            ANALYZE_THROWERR("Plasticity Problem: Newton-Raphson solver did not converge while recomputing a checkpointed time step.")
+        }
+    }
+
+    /***************************************************************************//**
+     * \brief Store a state in a checkpoint
+     * \param [in] aSlot        checkpoint index
+     * \param [in] aState       state index, i.e. time step index plus one
+     * \param [in] aGlobalState global state
+     * \param [in] aLocalState  local state
+     * \param [in] aPressGrad   projected pressure gradient
+    *******************************************************************************/
+    void storeCheckpoint(const Plato::OrdinalType & aSlot,
+                         const Plato::OrdinalType & aState,
+                         const Plato::ScalarVector & aGlobalState,
+                         const Plato::ScalarVector & aLocalState,
+                         const Plato::ScalarVector & aPressGrad)
+    {
+        Kokkos::deep_copy(Kokkos::subview(mCheckpointGlobalStates, aSlot, Kokkos::ALL()), aGlobalState);
+        Kokkos::deep_copy(Kokkos::subview(mCheckpointLocalStates, aSlot, Kokkos::ALL()), aLocalState);
+        Kokkos::deep_copy(Kokkos::subview(mCheckpointPressGrad, aSlot, Kokkos::ALL()), aPressGrad);
+        mCheckpointSteps[aSlot] = aState;
+    }
+
+    /***************************************************************************//**
+     * \brief Copy a checkpoint into the current row of the sweep containers
+     * \param [in] aSlot checkpoint index
+    *******************************************************************************/
+    void loadCheckpoint(const Plato::OrdinalType & aSlot)
+    {
+        Kokkos::deep_copy(Kokkos::subview(mSweepGlobalStates, 1, Kokkos::ALL()), Kokkos::subview(mCheckpointGlobalStates, aSlot, Kokkos::ALL()));
+        Kokkos::deep_copy(Kokkos::subview(mSweepLocalStates, 1, Kokkos::ALL()), Kokkos::subview(mCheckpointLocalStates, aSlot, Kokkos::ALL()));
+        Kokkos::deep_copy(Kokkos::subview(mSweepPressGrad, 1, Kokkos::ALL()), Kokkos::subview(mCheckpointPressGrad, aSlot, Kokkos::ALL()));
+    }
+
+    /***************************************************************************//**
+     * \brief Copy a row of the sweep containers into another row
+     * \param [in] aFrom source row
+     * \param [in] aTo   destination row
+    *******************************************************************************/
+    void copySweepRow(const Plato::OrdinalType & aFrom, const Plato::OrdinalType & aTo)
+    {
+        Kokkos::deep_copy(Kokkos::subview(mSweepGlobalStates, aTo, Kokkos::ALL()), Kokkos::subview(mSweepGlobalStates, aFrom, Kokkos::ALL()));
+        Kokkos::deep_copy(Kokkos::subview(mSweepLocalStates, aTo, Kokkos::ALL()), Kokkos::subview(mSweepLocalStates, aFrom, Kokkos::ALL()));
+        Kokkos::deep_copy(Kokkos::subview(mSweepPressGrad, aTo, Kokkos::ALL()), Kokkos::subview(mSweepPressGrad, aFrom, Kokkos::ALL()));
+    }
+
+    /***************************************************************************//**
+     * \brief Add the criterion values of the current time step to the values
+     * accumulated by a checkpointed forward solve
+     * \param [in] aControls current controls, e.g. design variables
+     * \param [in] aStates   C++ structure with current state information
+    *******************************************************************************/
+    void accumulateCriteria(const Plato::ScalarVector & aControls, const Plato::CurrentStates & aStates)
+    {
+        // the criteria see the reference temperature as the previous state of the first time step
+        Plato::ScalarVector tPreviousGlobalState = aStates.mPreviousGlobalState;
+        if(aStates.mCurrentStepIndex == static_cast<Plato::OrdinalType>(0))
+        {
+            this->getPreviousState(aStates.mCurrentStepIndex, mGlobalStates, tPreviousGlobalState);
+            this->setInitialTemperature(aStates.mCurrentStepIndex, tPreviousGlobalState);
+        }
+
+        for(const auto & tPair : mCriteria)
+        {
+            mCriterionValues[tPair.first] += tPair.second->value(aStates.mCurrentGlobalState, tPreviousGlobalState,
+                                                                 aStates.mCurrentLocalState, aStates.mPreviousLocalState,
+                                                                 aControls, *(aStates.mTimeData));
+        }
+    }
+
+    /***************************************************************************//**
+     * \brief Add contribution from partial derivative of criterion of a time step
+     * to total derivative of criterion with respect to controls or configuration.
+     * \param [in]     aCriterion     design criterion interface
+     * \param [in]     aControls      current controls, e.g. design variables
+     * \param [in]     aStates        state data of the time step
+     * \param [in/out] aTotalGradient total derivative of criterion
+    *******************************************************************************/
+    void addCriterionPartialDerivative(Plato::LocalScalarFunctionInc & aCriterion,
+                                       const Plato::ScalarVector & aControls,
+                                       const Plato::ForwardStates & aStates,
+                                       Plato::ScalarVector & aTotalGradient)
+    {
+        if(aStates.mPartialDerivativeType == Plato::PartialDerivative::CONTROL)
+        {
+            auto tDfDz = aCriterion.gradient_z(aStates.mCurrentGlobalState, aStates.mPreviousGlobalState,
+                                               aStates.mCurrentLocalState, aStates.mPreviousLocalState,
+                                               aControls, aStates.mTimeData);
+            mWorksetBase.assembleScalarGradientZ(tDfDz, aTotalGradient);
+        }
+        else
+        {
+            auto tDfDX = aCriterion.gradient_x(aStates.mCurrentGlobalState, aStates.mPreviousGlobalState,
+                                               aStates.mCurrentLocalState, aStates.mPreviousLocalState,
+                                               aControls, aStates.mTimeData);
+            mWorksetBase.assembleVectorGradientX(tDfDX, aTotalGradient);
+        }
+    }
+
     /***************************************************************************//**
      * \brief Update state data for time step n, i.e. current time step:
      * \param [in] aStateData state data manager
@@ -1073,9 +1595,10 @@ private:
     void cacheStateData(Plato::CurrentStates & aStateData)
     {
         // GET CURRENT STATE
-        aStateData.mCurrentLocalState = Kokkos::subview(mLocalStates, aStateData.mCurrentStepIndex, Kokkos::ALL());
-        aStateData.mCurrentGlobalState = Kokkos::subview(mGlobalStates, aStateData.mCurrentStepIndex, Kokkos::ALL());
-        aStateData.mProjectedPressGrad = Kokkos::subview(mProjectedPressGrad, aStateData.mCurrentStepIndex, Kokkos::ALL());
+        auto tRow = this->stateRow(aStateData.mCurrentStepIndex);
+        aStateData.mCurrentLocalState = Kokkos::subview(mLocalStates, tRow, Kokkos::ALL());
+        aStateData.mCurrentGlobalState = Kokkos::subview(mGlobalStates, tRow, Kokkos::ALL());
+        aStateData.mProjectedPressGrad = Kokkos::subview(mProjectedPressGrad, tRow, Kokkos::ALL());
 
         // GET PREVIOUS STATE
         this->getPreviousState(aStateData.mCurrentStepIndex, mLocalStates, aStateData.mPreviousLocalState);
@@ -1111,6 +1634,39 @@ private:
         this->setInitialTemperature(aStateData.mCurrentStepIndex, aStateData.mPreviousGlobalState);
     }
 
+    /***************************************************************************//**
+     * \brief Update state data of the reverse sweep, the previous state is held by
+     * the row before the given one.
+     * \param [in] aStateData state data manager
+     * \param [in] aRow       row of the sweep containers that holds the time step
+    *******************************************************************************/
+    void updateSweepState(Plato::ForwardStates & aStateData, const Plato::OrdinalType & aRow)
+    {
+        // GET CURRENT STATE
+        aStateData.mCurrentLocalState = Kokkos::subview(mSweepLocalStates, aRow, Kokkos::ALL());
+        aStateData.mCurrentGlobalState = Kokkos::subview(mSweepGlobalStates, aRow, Kokkos::ALL());
+        aStateData.mProjectedPressGrad = Kokkos::subview(mSweepPressGrad, aRow, Kokkos::ALL());
+        if(aStateData.mPressure.size() <= static_cast<Plato::OrdinalType>(0))
+        {
+            auto tNumVerts = mSpatialModel.Mesh->NumNodes();
+            aStateData.mPressure = Plato::ScalarVector("Current Pressure Field", tNumVerts);
+        }
+        Plato::blas1::extract<mNumGlobalDofsPerNode, mPressureDofOffset>(aStateData.mCurrentGlobalState, aStateData.mPressure);
+
+        // GET PREVIOUS STATE.
+        if(aStateData.mCurrentStepIndex > static_cast<Plato::OrdinalType>(0))
+        {
+            aStateData.mPreviousLocalState = Kokkos::subview(mSweepLocalStates, aRow - 1, Kokkos::ALL());
+            aStateData.mPreviousGlobalState = Kokkos::subview(mSweepGlobalStates, aRow - 1, Kokkos::ALL());
+        }
+        else
+        {
+            this->getPreviousState(aStateData.mCurrentStepIndex, mSweepLocalStates, aStateData.mPreviousLocalState);
+            this->getPreviousState(aStateData.mCurrentStepIndex, mSweepGlobalStates, aStateData.mPreviousGlobalState);
+            this->setInitialTemperature(aStateData.mCurrentStepIndex, aStateData.mPreviousGlobalState);
+        }
+    }
+
     /***************************************************************************//**
      * \brief Update adjoint data for time step n, i.e. current time step:
      * \param [in] aAdjointData adjoint data manager
@@ -7,10 +7,14 @@
 #ifndef PLATOABSTRACTPROBLEM_HPP_
 #define PLATOABSTRACTPROBLEM_HPP_
 
+#include <string>
+#include <vector>
+
 #include <Teuchos_RCPDecl.hpp>
 
 #include "Solutions.hpp"
 #include "AnalyzeMacros.hpp"
+#include "AnalyzeOutput.hpp"
 #include "InputDataUtils.hpp"
 #include "PlatoStaticsTypes.hpp"
 
@@ -50,6 +54,7 @@ public:
     )
     {
       readInputData(aProblemParams, mDataMap, aMesh);
+      mDataMap.mOutputPlan = Plato::parse_state_output_plan(aProblemParams, aMesh);
     }
 
     /******************************************************************************//**
@@ -166,6 +171,51 @@ public:
         const std::string         & aName
     )=0;
 
+    /******************************************************************************//**
+     * \brief Evaluate the gradients of several criteria wrt control variables.  Problems
+     *        that can share the adjoint operator across criteria override this method.
+     * \param [in] aControl 1D view of control variables
+     * \param [in] aSolution solution database
+     * \param [in] aNames criteria names
+     * \return criteria gradients wrt control variables, in the order of aNames
+    **********************************************************************************/
+    virtual std::vector<Plato::ScalarVector>
+    criterionGradients(
+        const Plato::ScalarVector      & aControl,
+        const Plato::Solutions         & aSolution,
+        const std::vector<std::string> & aNames
+    )
+    {
+        std::vector<Plato::ScalarVector> tGradients;
+        for(const auto& tName : aNames)
+        {
+            tGradients.push_back(this->criterionGradient(aControl, aSolution, tName));
+        }
+        return tGradients;
+    }
+
+    /******************************************************************************//**
+     * \brief Evaluate the gradients of several criteria wrt configuration variables.
+     * \param [in] aControl 1D view of control variables
+     * \param [in] aSolution solution database
+     * \param [in] aNames criteria names
+     * \return criteria gradients wrt configuration variables, in the order of aNames
+    **********************************************************************************/
+    virtual std::vector<Plato::ScalarVector>
+    criterionGradientsX(
+        const Plato::ScalarVector      & aControl,
+        const Plato::Solutions         & aSolution,
+        const std::vector<std::string> & aNames
+    )
+    {
+        std::vector<Plato::ScalarVector> tGradients;
+        for(const auto& tName : aNames)
+        {
+            tGradients.push_back(this->criterionGradientX(aControl, aSolution, tName));
+        }
+        return tGradients;
+    }
+
     /******************************************************************************//**
      * \fn const Plato::DataMap getDataMap
      * \brief Return constant reference to Plato output database.
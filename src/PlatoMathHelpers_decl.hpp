@@ -2,9 +2,12 @@
 
 #include "PlatoStaticsTypes.hpp"
 
+#include <memory>
+
 #include <Teuchos_RCP.hpp>
 
 #include <KokkosSparse_spgemm.hpp>
+#include <KokkosKernels_Handle.hpp>
 
 namespace Plato
 {
@@ -166,6 +169,84 @@ MatrixMatrixMultiply( const Teuchos::RCP<Plato::CrsMatrixType> & aInMatrixOne,
                             Teuchos::RCP<Plato::CrsMatrixType> & aOutMatrix,
                             KokkosSparse::SPGEMMAlgorithm aAlgorithm = KokkosSparse::SPGEMM_KK_SPEED);
 
+/******************************************************************************//**
+ * \brief Matrix product with a persistent symbolic phase
+ *
+ * Computes aProduct = aM1 . aM2 like Plato::MatrixMatrixMultiply, but keeps the
+ * spgemm handle, the non-block graphs of the inputs, the value gather maps used
+ * to convert block inputs to non-block form, and the output graph between calls.
+ * As long as the input graphs are unchanged (same row map and column index views)
+ * subsequent calls only gather values and run spgemm_numeric.  A change in either
+ * input graph triggers a new symbolic phase.
+**********************************************************************************/
+class MatrixMatrixMultiplyCache
+{
+  public:
+    using OrdinalView = Plato::ScalarVectorT<Plato::OrdinalType>;
+    using ScalarView  = Plato::ScalarVectorT<Plato::Scalar>;
+
+    using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle
+        <Plato::OrdinalType, Plato::OrdinalType, Plato::Scalar,
+         typename Plato::ExecSpace, typename Plato::MemSpace, typename Plato::MemSpace>;
+
+  private:
+    /// @brief non-block form of an input matrix graph
+    struct InputGraph
+    {
+      OrdinalView mBlockRowMap;     /*!< graph the non-block data was built from */
+      OrdinalView mBlockColMap;     /*!< graph the non-block data was built from */
+      OrdinalView mRowMap;          /*!< non-block row map */
+      OrdinalView mColMap;          /*!< non-block column indices */
+      OrdinalView mValueIndices;    /*!< entries index for each non-block value (empty if not a block matrix) */
+      Plato::OrdinalType mNumRowsPerBlock = 0;
+      Plato::OrdinalType mNumColsPerBlock = 0;
+    };
+
+    std::unique_ptr<KernelHandle> mKernel;
+    KokkosSparse::SPGEMMAlgorithm mAlgorithm;
+
+    InputGraph mInputOne;
+    InputGraph mInputTwo;
+
+    OrdinalView mOutRowMap;       /*!< non-block output row map */
+    OrdinalView mOutBlockRowMap;  /*!< output row map in the output block format */
+    OrdinalView mOutBlockColMap;  /*!< output column indices in the output block format */
+    Plato::OrdinalType mNumOutValues;
+    Plato::OrdinalType mNumOutBlockRows;
+    Plato::OrdinalType mNumOutBlockCols;
+
+  public:
+    MatrixMatrixMultiplyCache(KokkosSparse::SPGEMMAlgorithm aAlgorithm = KokkosSparse::SPGEMM_KK_SPEED);
+    ~MatrixMatrixMultiplyCache();
+
+    MatrixMatrixMultiplyCache(const MatrixMatrixMultiplyCache &) = delete;
+    MatrixMatrixMultiplyCache & operator=(const MatrixMatrixMultiplyCache &) = delete;
+
+    /******************************************************************************//**
+     * \brief Compute the matrix product, aProduct = aM1 . aM2
+     * \param [in] aInMatrixOne
+     * \param [in] aInMatrixTwo
+     * \param [out] aOutMatrix
+    **********************************************************************************/
+    void
+    multiply( const Teuchos::RCP<Plato::CrsMatrixType> & aInMatrixOne,
+              const Teuchos::RCP<Plato::CrsMatrixType> & aInMatrixTwo,
+                    Teuchos::RCP<Plato::CrsMatrixType> & aOutMatrix );
+
+    /******************************************************************************//**
+     * \brief Discard the symbolic phase.  The next call to multiply() redoes it.
+    **********************************************************************************/
+    void reset();
+
+  private:
+    bool isCurrent(const InputGraph & aGraph, const Plato::CrsMatrixType & aMatrix) const;
+    void setInputGraph(InputGraph & aGraph, const Teuchos::RCP<Plato::CrsMatrixType> & aMatrix);
+    ScalarView getInputValues(const InputGraph & aGraph, const Plato::CrsMatrixType & aMatrix) const;
+    void symbolic(const Teuchos::RCP<Plato::CrsMatrixType> & aInMatrixOne,
+                  const Teuchos::RCP<Plato::CrsMatrixType> & aInMatrixTwo,
+                        Teuchos::RCP<Plato::CrsMatrixType> & aOutMatrix);
+};
+
 /******************************************************************************//**
  * \brief matrix minus matrix
  * \param [in/out] aM1
@@ -577,6 +577,232 @@ MatrixMatrixMultiply( const Teuchos::RCP<Plato::CrsMatrixType> & aInMatrixOne,
     tKernel.destroy_spgemm_handle();
 }
 
+MatrixMatrixMultiplyCache::
+MatrixMatrixMultiplyCache(SPGEMMAlgorithm aAlgorithm) :
+    mAlgorithm(aAlgorithm),
+    mNumOutValues(0),
+    mNumOutBlockRows(0),
+    mNumOutBlockCols(0)
+{}
+
+MatrixMatrixMultiplyCache::
+~MatrixMatrixMultiplyCache()
+{
+    this->reset();
+}
+
+void
+MatrixMatrixMultiplyCache::
+reset()
+{
+    if (mKernel)
+    {
+      mKernel->destroy_spgemm_handle();
+      mKernel.reset();
+    }
+    mInputOne = InputGraph();
+    mInputTwo = InputGraph();
+    mOutRowMap = OrdinalView();
+    mOutBlockRowMap = OrdinalView();
+    mOutBlockColMap = OrdinalView();
+    mNumOutValues = 0;
+    mNumOutBlockRows = 0;
+    mNumOutBlockCols = 0;
+}
+
+bool
+MatrixMatrixMultiplyCache::
+isCurrent(const InputGraph & aGraph, const Plato::CrsMatrixType & aMatrix) const
+{
+    return aGraph.mBlockRowMap.data()      == aMatrix.rowMap().data()
+        && aGraph.mBlockRowMap.extent(0)   == aMatrix.rowMap().extent(0)
+        && aGraph.mBlockColMap.data()      == aMatrix.columnIndices().data()
+        && aGraph.mBlockColMap.extent(0)   == aMatrix.columnIndices().extent(0)
+        && aGraph.mNumRowsPerBlock         == aMatrix.numRowsPerBlock()
+        && aGraph.mNumColsPerBlock         == aMatrix.numColsPerBlock();
+}
+
+void
+MatrixMatrixMultiplyCache::
+setInputGraph(InputGraph & aGraph, const Teuchos::RCP<Plato::CrsMatrixType> & aMatrix)
+{
+    // hold the block graph views so that their addresses can't be reused while cached
+    aGraph.mBlockRowMap = aMatrix->rowMap();
+    aGraph.mBlockColMap = aMatrix->columnIndices();
+    aGraph.mNumRowsPerBlock = aMatrix->numRowsPerBlock();
+    aGraph.mNumColsPerBlock = aMatrix->numColsPerBlock();
+
+    if (!aMatrix->isBlockMatrix())
+    {
+      aGraph.mRowMap = aGraph.mBlockRowMap;
+      aGraph.mColMap = aGraph.mBlockColMap;
+      aGraph.mValueIndices = OrdinalView();
+      return;
+    }
+
+    ScalarView tValues;
+    Plato::getDataAsNonBlock(aMatrix, aGraph.mRowMap, aGraph.mColMap, tValues);
+
+    // entries index of each non-block value (see getDataAsNonBlock)
+    auto tBlockRowMap = aGraph.mBlockRowMap;
+    auto tNonBlockRowMap = aGraph.mRowMap;
+    auto tNumRowsPerBlock = aGraph.mNumRowsPerBlock;
+    auto tNumColsPerBlock = aGraph.mNumColsPerBlock;
+    auto tBlockSize = tNumRowsPerBlock*tNumColsPerBlock;
+    auto tNumMatrixRows = aMatrix->numRows();
+    OrdinalView tValueIndices(Kokkos::ViewAllocateWithoutInitializing("non block value indices"), aGraph.mColMap.extent(0));
+    Kokkos::parallel_for(Kokkos::RangePolicy<>(0,tNumMatrixRows), KOKKOS_LAMBDA(const Plato::OrdinalType & tMatrixRowIndex) {
+        auto tBlockRowIndex = tMatrixRowIndex / tNumRowsPerBlock;
+        auto tLocalRowIndex = tMatrixRowIndex % tNumRowsPerBlock;
+        auto tFrom = tBlockRowMap(tBlockRowIndex);
+        auto tTo   = tBlockRowMap(tBlockRowIndex+1);
+        Plato::OrdinalType tMatrixRowFrom = tNonBlockRowMap(tMatrixRowIndex);
+        for( auto tColMapIndex=tFrom; tColMapIndex<tTo; ++tColMapIndex )
+        {
+            for( Plato::OrdinalType tBlockColOffset=0; tBlockColOffset<tNumColsPerBlock; ++tBlockColOffset )
+            {
+                tValueIndices(tMatrixRowFrom++) = tColMapIndex*tBlockSize+tLocalRowIndex*tNumColsPerBlock+tBlockColOffset;
+            }
+        }
+    });
+    aGraph.mValueIndices = tValueIndices;
+}
+
+MatrixMatrixMultiplyCache::ScalarView
+MatrixMatrixMultiplyCache::
+getInputValues(const InputGraph & aGraph, const Plato::CrsMatrixType & aMatrix) const
+{
+    if (aGraph.mValueIndices.extent(0) == 0)
+    {
+      return aMatrix.entries();
+    }
+
+    auto tEntries = aMatrix.entries();
+    auto tValueIndices = aGraph.mValueIndices;
+    ScalarView tValues(Kokkos::ViewAllocateWithoutInitializing("non block values"), tValueIndices.extent(0));
+    Kokkos::parallel_for(Kokkos::RangePolicy<>(0,tValueIndices.extent(0)), KOKKOS_LAMBDA(const Plato::OrdinalType & aIndex) {
+        tValues(aIndex) = tEntries(tValueIndices(aIndex));
+    });
+    return tValues;
+}
+
+void
+MatrixMatrixMultiplyCache::
+symbolic(const Teuchos::RCP<Plato::CrsMatrixType> & aInMatrixOne,
+         const Teuchos::RCP<Plato::CrsMatrixType> & aInMatrixTwo,
+               Teuchos::RCP<Plato::CrsMatrixType> & aOutMatrix)
+{
+    this->reset();
+
+    const OrdinalType tNumRowsOne = aInMatrixOne->numRows();
+    const OrdinalType tNumColsOne = aInMatrixOne->numCols();
+    const OrdinalType tNumRowsTwo = aInMatrixTwo->numRows();
+    const OrdinalType tNumColsTwo = aInMatrixTwo->numCols();
+
+    if (tNumRowsTwo != tNumColsOne) { ANALYZE_THROWERR("input matrices have incompatible shapes"); }
+    if (aOutMatrix->numRows() != tNumRowsOne) { ANALYZE_THROWERR("output matrix has incorrect shape"); }
+    if (aOutMatrix->numCols() != tNumColsTwo) { ANALYZE_THROWERR("output matrix has incorrect shape"); }
+
+    this->setInputGraph(mInputOne, aInMatrixOne);
+    this->setInputGraph(mInputTwo, aInMatrixTwo);
+
+    mKernel.reset(new KernelHandle());
+    mKernel->set_team_work_size(1);
+    mKernel->set_dynamic_scheduling(false);
+    mKernel->create_spgemm_handle(mAlgorithm);
+
+    mOutRowMap = OrdinalView("output row map", tNumRowsOne + 1);
+    spgemm_symbolic ( mKernel.get(), tNumRowsOne, tNumRowsTwo, tNumColsTwo,
+        mInputOne.mRowMap, mInputOne.mColMap, /*transpose=*/false,
+        mInputTwo.mRowMap, mInputTwo.mColMap, /*transpose=*/false,
+        mOutRowMap
+    );
+    mNumOutValues = mKernel->get_spgemm_handle()->get_c_nnz();
+}
+
+void
+MatrixMatrixMultiplyCache::
+multiply( const Teuchos::RCP<Plato::CrsMatrixType> & aInMatrixOne,
+          const Teuchos::RCP<Plato::CrsMatrixType> & aInMatrixTwo,
+                Teuchos::RCP<Plato::CrsMatrixType> & aOutMatrix)
+{
+    if (!mKernel || !this->isCurrent(mInputOne, *aInMatrixOne) || !this->isCurrent(mInputTwo, *aInMatrixTwo)
+     || aOutMatrix->numRows() != aInMatrixOne->numRows() || aOutMatrix->numCols() != aInMatrixTwo->numCols())
+    {
+      this->symbolic(aInMatrixOne, aInMatrixTwo, aOutMatrix);
+    }
+
+    auto tMatOneValues = this->getInputValues(mInputOne, *aInMatrixOne);
+    auto tMatTwoValues = this->getInputValues(mInputTwo, *aInMatrixTwo);
+
+    OrdinalView tOutColMap;
+    ScalarView  tOutValues;
+    if (mNumOutValues){
+      tOutColMap = OrdinalView(Kokkos::ViewAllocateWithoutInitializing("out column map"), mNumOutValues);
+      tOutValues = ScalarView (Kokkos::ViewAllocateWithoutInitializing("out values"),  mNumOutValues);
+    }
+    const OrdinalType tNumRowsOne = aInMatrixOne->numRows();
+    spgemm_numeric( mKernel.get(), tNumRowsOne, aInMatrixTwo->numRows(), aInMatrixTwo->numCols(),
+        mInputOne.mRowMap, mInputOne.mColMap, tMatOneValues, /*transpose=*/false,
+        mInputTwo.mRowMap, mInputTwo.mColMap, tMatTwoValues, /*transpose=*/false,
+        mOutRowMap, tOutColMap, tOutValues
+    );
+
+    if (!aOutMatrix->isBlockMatrix())
+    {
+      aOutMatrix->setRowMap(mOutRowMap);
+      aOutMatrix->setColumnIndices(tOutColMap);
+      aOutMatrix->setEntries(tOutValues);
+      return;
+    }
+
+    auto tNumRowsPerBlock = aOutMatrix->numRowsPerBlock();
+    auto tNumColsPerBlock = aOutMatrix->numColsPerBlock();
+    if (mOutBlockRowMap.extent(0) == 0 || mNumOutBlockRows != tNumRowsPerBlock || mNumOutBlockCols != tNumColsPerBlock)
+    {
+      // first numeric phase: build and cache the block output graph
+      Plato::setDataFromNonBlock(aOutMatrix, mOutRowMap, tOutColMap, tOutValues);
+      mOutBlockRowMap = aOutMatrix->rowMap();
+      mOutBlockColMap = aOutMatrix->columnIndices();
+      mNumOutBlockRows = tNumRowsPerBlock;
+      mNumOutBlockCols = tNumColsPerBlock;
+      return;
+    }
+
+    // scatter non-block values into the cached block graph.  Block column indices are sorted.
+    auto tBlockSize = tNumRowsPerBlock*tNumColsPerBlock;
+    auto tOutRowMap = mOutRowMap;
+    auto tBlockRowMap = mOutBlockRowMap;
+    auto tBlockColMap = mOutBlockColMap;
+    ScalarView tEntries("block values", tBlockColMap.extent(0)*tBlockSize);
+    Kokkos::parallel_for(Kokkos::RangePolicy<>(0,tNumRowsOne), KOKKOS_LAMBDA(const Plato::OrdinalType & tMatrixRowIndex) {
+        auto tBlockRowIndex = tMatrixRowIndex / tNumRowsPerBlock;
+        auto tLocalRowIndex = tMatrixRowIndex % tNumRowsPerBlock;
+        auto tBlockFrom = tBlockRowMap(tBlockRowIndex);
+        auto tBlockTo   = tBlockRowMap(tBlockRowIndex+1);
+        for( auto tEntryIndex=tOutRowMap(tMatrixRowIndex); tEntryIndex<tOutRowMap(tMatrixRowIndex+1); ++tEntryIndex )
+        {
+            auto tBlockColIndex = tOutColMap(tEntryIndex) / tNumColsPerBlock;
+            auto tLocalColIndex = tOutColMap(tEntryIndex) % tNumColsPerBlock;
+            auto tLower = tBlockFrom;
+            auto tUpper = tBlockTo;
+            while( tLower < tUpper )
+            {
+                auto tMiddle = (tLower + tUpper) / 2;
+                if( tBlockColMap(tMiddle) < tBlockColIndex ) { tLower = tMiddle + 1; }
+                else { tUpper = tMiddle; }
+            }
+            if( tLower < tBlockTo && tBlockColMap(tLower) == tBlockColIndex )
+            {
+                tEntries(tLower*tBlockSize + tLocalRowIndex*tNumColsPerBlock + tLocalColIndex) = tOutValues(tEntryIndex);
+            }
+        }
+    });
+    aOutMatrix->setRowMap(mOutBlockRowMap);
+    aOutMatrix->setColumnIndices(mOutBlockColMap);
+    aOutMatrix->setEntries(tEntries);
+}
+
 void
 MatrixMinusMatrix(      Teuchos::RCP<Plato::CrsMatrixType> & aInMatrixOne,
                   const Teuchos::RCP<Plato::CrsMatrixType> & aInMatrixTwo,
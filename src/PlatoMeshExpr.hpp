@@ -46,11 +46,8 @@ getFunctionValues(
     tExpEval.set_variable("y", y_coords);
     tExpEval.set_variable("z", z_coords);
 
-    auto tNumTotalPoints = tNumCells*tNumPoints;
-    Kokkos::parallel_for("", Kokkos::RangePolicy<>(0, tNumTotalPoints), KOKKOS_LAMBDA(const Plato::OrdinalType iEntryOrdinal)
-    {
-        tExpEval.evaluate_expression( iEntryOrdinal, aFxnValues );
-    });
+    // the coordinates of all points are set, so evaluate all points at once
+    tExpEval.evaluate_expression( aFxnValues );
     Kokkos::fence();
     tExpEval.clear_storage();
 
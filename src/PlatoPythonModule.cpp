@@ -4,6 +4,7 @@
 #include <structmember.h>
 #include <map>
 #include <vector>
+#include <algorithm>
 #include <string>
 #include <sstream>
 #include <iostream>
@@ -82,6 +83,94 @@ class SharedValue : public SharedData
        SharedData(Plato::data::layout_t::SCALAR, size, initVal){}
 };
 
+/*****************************************************************************/
+// shared data that wraps memory owned by a Python buffer (e.g., a numpy
+// float64 array).  MPMD_App reads and writes hostData() directly, so fields
+// are not copied through intermediate vectors or lists.
+/*****************************************************************************/
+class BufferData {
+  public:
+    BufferData(Plato::data::layout_t layout, Plato::Scalar* data, int size) :
+      mData(data), mSize(size), mLayout(layout){}
+
+    void setData(const std::vector<Plato::Scalar> & aData)
+    {
+      std::copy_n(aData.begin(), std::min<int>(aData.size(), mSize), mData);
+    }
+    void getData(std::vector<Plato::Scalar> & aData) const
+    {
+      aData.assign(mData, mData + mSize);
+    }
+    Plato::Scalar* hostData() const
+    {
+      return mData;
+    }
+    int size() const
+    {
+      return mSize;
+    }
+    std::string myName() const
+    {
+        return "Plato Python BufferData myName";
+    }
+
+    std::string myContext() const {return mContext;}
+
+    Plato::data::layout_t myLayout() const
+    {
+      return mLayout;
+    }
+
+  protected:
+    Plato::Scalar* mData;
+    int mSize;
+    Plato::data::layout_t mLayout;
+    std::string mContext;
+};
+
+/*****************************************************************************/
+// acquires and releases a contiguous float64 view of a Python buffer
+/*****************************************************************************/
+class Buffer {
+  public:
+    Buffer() : mAcquired(false) {}
+    ~Buffer() { if(mAcquired) PyBuffer_Release(&mView); }
+
+    Buffer(const Buffer&) = delete;
+    Buffer& operator=(const Buffer&) = delete;
+
+    bool acquire(PyObject* aObject, bool aWritable)
+    {
+      int tFlags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT;
+      if(aWritable) tFlags |= PyBUF_WRITABLE;
+      if( PyObject_GetBuffer(aObject, &mView, tFlags) != 0 )
+      {
+        return false;
+      }
+      mAcquired = true;
+
+      std::string tFormat(mView.format ? mView.format : "B");
+      if( !tFormat.empty() && (tFormat[0] == '@' || tFormat[0] == '=' || tFormat[0] == '<') )
+      {
+        tFormat.erase(0,1);
+      }
+      if( tFormat != "d" || mView.itemsize != sizeof(Plato::Scalar) )
+      {
+        PyErr_SetString(PyExc_TypeError, "Expected a contiguous buffer of float64 values.");
+        return false;
+      }
+      return true;
+    }
+
+    Plato::Scalar* data() const { return static_cast<Plato::Scalar*>(mView.buf); }
+    int size() const { return mView.len / mView.itemsize; }
+
+  private:
+    Py_buffer mView;
+    bool mAcquired;
+};
+
+
 } // end namespace
 
 
@@ -108,36 +197,48 @@ Analyze_initialize(Analyze* self)
     return Py_BuildValue("i", 1);
 }
 
-static PyObject *
-Analyze_importData(Analyze *self, PyObject *args, PyObject *kwds)
+/*****************************************************************************/
+// import one field.  Fields given as buffers (e.g., numpy float64 arrays) are
+// copied directly from the buffer's memory.  Returns false with a Python
+// exception set on failure.
+/*****************************************************************************/
+static bool
+import_data(Analyze *self, const std::string& inName, const std::string& inType, PyObject *inputData)
 {
-    // parse incoming arguments
-    //
-    char *inputDataName;
-    char *inputDataType;
-    PyObject *inputData;
-
-    if (! PyArg_ParseTuple(args, "ssO", &inputDataName, &inputDataType, &inputData) )
+    if( inType == "SCALAR_FIELD" || inType == "ELEMENT_FIELD" )
     {
-        return Py_BuildValue("i", -1);
-    }
-    std::cout << "Importing " << inputDataName << std::endl;
-
-    std::string inName(inputDataName);
-    std::string inType(inputDataType);
+        bool isNodal = (inType == "SCALAR_FIELD");
+        int tSize = isNodal ? self->mLocalNodeIDs.size() : self->mLocalElemIDs.size();
+        if( PyList_Check(inputData) )
+        {
+            auto vecData = double_vector_from_list(inputData);
+            if( isNodal )
+            {
+                PlatoPython::NodeField inData(tSize);
+                inData.setData(vecData);
+                self->mMPMDApp->importDataT(inName, inData);
+            }
+            else
+            {
+                PlatoPython::ElementField inData(tSize);
+                inData.setData(vecData);
+                self->mMPMDApp->importDataT(inName, inData);
+            }
+            return true;
+        }
 
-    if( inType == "SCALAR_FIELD" )
-    {
-        PlatoPython::NodeField inData(self->mLocalNodeIDs.size());
-        auto vecData = double_vector_from_list(inputData);
-        inData.setData(vecData);
-        self->mMPMDApp->importDataT(inName, inData);
-    } else
-    if( inType == "ELEMENT_FIELD" )
-    {
-        PlatoPython::ElementField inData(self->mLocalElemIDs.size());
-        auto vecData = double_vector_from_list(inputData);
-        inData.setData(vecData);
+        PlatoPython::Buffer tBuffer;
+        if( !tBuffer.acquire(inputData, /*writable=*/false) )
+        {
+            return false;
+        }
+        if( tBuffer.size() != tSize )
+        {
+            PyErr_Format(PyExc_ValueError, "'%s' has %d values, expected %d.", inName.c_str(), tBuffer.size(), tSize);
+            return false;
+        }
+        auto tLayout = isNodal ? Plato::data::layout_t::SCALAR_FIELD : Plato::data::layout_t::ELEMENT_FIELD;
+        PlatoPython::BufferData inData(tLayout, tBuffer.data(), tSize);
         self->mMPMDApp->importDataT(inName, inData);
     } else
     if( inType == "SCALAR_PARAMETER" )
@@ -158,6 +259,16 @@ Analyze_importData(Analyze *self, PyObject *args, PyObject *kwds)
             vecData = double_vector_from_list(inputData);
         }
         else
+        if (PyObject_CheckBuffer(inputData))
+        {
+            PlatoPython::Buffer tBuffer;
+            if( !tBuffer.acquire(inputData, /*writable=*/false) )
+            {
+                return false;
+            }
+            vecData.assign(tBuffer.data(), tBuffer.data() + tBuffer.size());
+        }
+        else
         {
             vecData.push_back(PyFloat_AsDouble(inputData));
         }
@@ -165,6 +276,27 @@ Analyze_importData(Analyze *self, PyObject *args, PyObject *kwds)
         inData.setData(vecData);
         self->mMPMDApp->importDataT(inName, inData);
     }
+    return true;
+}
+
+static PyObject *
+Analyze_importData(Analyze *self, PyObject *args, PyObject *kwds)
+{
+    // parse incoming arguments
+    //
+    char *inputDataName;
+    char *inputDataType;
+    PyObject *inputData;
+
+    if (! PyArg_ParseTuple(args, "ssO", &inputDataName, &inputDataType, &inputData) )
+    {
+        return Py_BuildValue("i", -1);
+    }
+
+    if (! import_data(self, inputDataName, inputDataType, inputData) )
+    {
+        return NULL;
+    }
 
     return Py_BuildValue("i", 1);
 }
@@ -201,39 +333,74 @@ Analyze_compute(Analyze *self, PyObject *args, PyObject *kwds)
     return Py_BuildValue("i", 1);
 }
 
+/*****************************************************************************/
+// create a writable buffer of doubles (a memoryview that numpy.asarray wraps
+// without copying)
+/*****************************************************************************/
 static PyObject *
-Analyze_exportData(Analyze *self, PyObject *args, PyObject *kwds)
+new_double_buffer(int aSize)
 {
-    // parse incoming arguments
-    //
-    char *outputDataName;
-    char *outputDataType;
-    int tNumValues(1);
-
-    if (! PyArg_ParseTuple(args, "ss|i", &outputDataName, &outputDataType, &tNumValues) )
+    PyObject *tBytes = PyByteArray_FromStringAndSize(NULL, aSize*sizeof(Plato::Scalar));
+    if( tBytes == NULL )
     {
-        return Py_BuildValue("i", -1);
+        return NULL;
     }
-    std::cout << "Exporting " << outputDataName << std::endl;
-
-    std::string outName(outputDataName);
-    std::string outType(outputDataType);
-
-    if( outType == "SCALAR_FIELD" )
+    PyObject *tView = PyMemoryView_FromObject(tBytes);
+    Py_DECREF(tBytes);
+    if( tView == NULL )
     {
-        PlatoPython::NodeField outData(self->mLocalNodeIDs.size());
-        self->mMPMDApp->exportDataT(outName, outData);
-        std::vector<Plato::Scalar> vecData(self->mLocalNodeIDs.size());
-        outData.getData(vecData);
-        return list_from_double_vector(vecData);
-    } else
-    if( outType == "ELEMENT_FIELD" )
+        return NULL;
+    }
+    PyObject *tBuffer = PyObject_CallMethod(tView, "cast", "s", "d");
+    Py_DECREF(tView);
+    return tBuffer;
+}
+
+/*****************************************************************************/
+// export one field.  Fields are copied directly into aTarget if given (e.g., a
+// numpy float64 array), otherwise into a new buffer of doubles.  Returns a new
+// reference, or NULL with a Python exception set on failure.
+/*****************************************************************************/
+static PyObject *
+export_data(Analyze *self, const std::string& outName, const std::string& outType, PyObject *aTarget, int tNumValues)
+{
+    if( outType == "SCALAR_FIELD" || outType == "ELEMENT_FIELD" )
     {
-        PlatoPython::ElementField outData(self->mLocalElemIDs.size());
-        self->mMPMDApp->exportDataT(outName, outData);
-        std::vector<Plato::Scalar> vecData(self->mLocalElemIDs.size());
-        outData.getData(vecData);
-        return list_from_double_vector(vecData);
+        bool isNodal = (outType == "SCALAR_FIELD");
+        int tSize = isNodal ? self->mLocalNodeIDs.size() : self->mLocalElemIDs.size();
+
+        PyObject *tOutput = aTarget;
+        if( tOutput == NULL )
+        {
+            tOutput = new_double_buffer(tSize);
+            if( tOutput == NULL )
+            {
+                return NULL;
+            }
+        }
+        else
+        {
+            Py_INCREF(tOutput);
+        }
+
+        {
+            PlatoPython::Buffer tBuffer;
+            if( !tBuffer.acquire(tOutput, /*writable=*/true) )
+            {
+                Py_DECREF(tOutput);
+                return NULL;
+            }
+            if( tBuffer.size() != tSize )
+            {
+                PyErr_Format(PyExc_ValueError, "'%s' has %d values, expected %d.", outName.c_str(), tBuffer.size(), tSize);
+                Py_DECREF(tOutput);
+                return NULL;
+            }
+            auto tLayout = isNodal ? Plato::data::layout_t::SCALAR_FIELD : Plato::data::layout_t::ELEMENT_FIELD;
+            PlatoPython::BufferData outData(tLayout, tBuffer.data(), tSize);
+            self->mMPMDApp->exportDataT(outName, outData);
+        }
+        return tOutput;
     } else
     if( outType == "SCALAR" )
     {
@@ -253,6 +420,148 @@ Analyze_exportData(Analyze *self, PyObject *args, PyObject *kwds)
     return Py_BuildValue("i", 1);
 }
 
+static PyObject *
+Analyze_exportData(Analyze *self, PyObject *args, PyObject *kwds)
+{
+    // parse incoming arguments.  The optional argument is either the number
+    // of values of a SCALAR or the buffer a field is copied into.
+    //
+    char *outputDataName;
+    char *outputDataType;
+    PyObject *outputOption = NULL;
+
+    if (! PyArg_ParseTuple(args, "ss|O", &outputDataName, &outputDataType, &outputOption) )
+    {
+        return Py_BuildValue("i", -1);
+    }
+
+    int tNumValues(1);
+    PyObject *tTarget = NULL;
+    if( outputOption != NULL )
+    {
+        if( PyLong_Check(outputOption) )
+        {
+            tNumValues = PyLong_AsLong(outputOption);
+        }
+        else
+        {
+            tTarget = outputOption;
+        }
+    }
+
+    return export_data(self, outputDataName, outputDataType, tTarget, tNumValues);
+}
+
+/*****************************************************************************/
+// import fields, compute operations, and export fields in a single call:
+//   importComputeExport([(name, type, data), ...],
+//                       operation or [operation, ...],
+//                       [(name, type[, out or number of values]), ...])
+// returns a tuple with the exported data in the order requested.
+/*****************************************************************************/
+static PyObject *
+Analyze_importComputeExport(Analyze *self, PyObject *args, PyObject *kwds)
+{
+    PyObject *imports;
+    PyObject *operations;
+    PyObject *exports;
+
+    if (! PyArg_ParseTuple(args, "OOO", &imports, &operations, &exports) )
+    {
+        return NULL;
+    }
+
+    PyObject *tImports = PySequence_Fast(imports, "imports must be a sequence of (name, type, data)");
+    if( tImports == NULL ) return NULL;
+    PyObject *tExports = PySequence_Fast(exports, "exports must be a sequence of (name, type[, out])");
+    if( tExports == NULL ) { Py_DECREF(tImports); return NULL; }
+
+    PyObject *tResults = NULL;
+    try
+    {
+        Py_ssize_t tNumImports = PySequence_Fast_GET_SIZE(tImports);
+        for( Py_ssize_t i=0; i<tNumImports; i++ )
+        {
+            char *inputDataName;
+            char *inputDataType;
+            PyObject *inputData;
+            PyObject *tItem = PySequence_Fast_GET_ITEM(tImports, i);
+            if( !PyArg_ParseTuple(tItem, "ssO", &inputDataName, &inputDataType, &inputData)
+             || !import_data(self, inputDataName, inputDataType, inputData) )
+            {
+                Py_DECREF(tImports); Py_DECREF(tExports);
+                return NULL;
+            }
+        }
+
+        if( PyUnicode_Check(operations) )
+        {
+            self->mMPMDApp->compute(PyUnicode_AsUTF8(operations));
+        }
+        else
+        {
+            PyObject *tOperations = PySequence_Fast(operations, "operations must be a string or a sequence of strings");
+            if( tOperations == NULL ) { Py_DECREF(tImports); Py_DECREF(tExports); return NULL; }
+            Py_ssize_t tNumOperations = PySequence_Fast_GET_SIZE(tOperations);
+            for( Py_ssize_t i=0; i<tNumOperations; i++ )
+            {
+                const char *operationName = PyUnicode_AsUTF8(PySequence_Fast_GET_ITEM(tOperations, i));
+                if( operationName == NULL ) { Py_DECREF(tOperations); Py_DECREF(tImports); Py_DECREF(tExports); return NULL; }
+                self->mMPMDApp->compute(operationName);
+            }
+            Py_DECREF(tOperations);
+        }
+
+        Py_ssize_t tNumExports = PySequence_Fast_GET_SIZE(tExports);
+        tResults = PyTuple_New(tNumExports);
+        for( Py_ssize_t i=0; tResults != NULL && i<tNumExports; i++ )
+        {
+            char *outputDataName;
+            char *outputDataType;
+            PyObject *outputOption = NULL;
+            PyObject *tItem = PySequence_Fast_GET_ITEM(tExports, i);
+            if( !PyArg_ParseTuple(tItem, "ss|O", &outputDataName, &outputDataType, &outputOption) )
+            {
+                Py_CLEAR(tResults);
+                break;
+            }
+            int tNumValues(1);
+            PyObject *tTarget = NULL;
+            if( outputOption != NULL )
+            {
+                if( PyLong_Check(outputOption) ) tNumValues = PyLong_AsLong(outputOption);
+                else tTarget = outputOption;
+            }
+            PyObject *tOutput = export_data(self, outputDataName, outputDataType, tTarget, tNumValues);
+            if( tOutput == NULL )
+            {
+                Py_CLEAR(tResults);
+                break;
+            }
+            PyTuple_SET_ITEM(tResults, i, tOutput);
+        }
+    }
+    catch(const std::runtime_error& err)
+    {
+        // Expected exception type from ANALYZE_THROWERR
+        Py_XDECREF(tResults);
+        Py_DECREF(tImports); Py_DECREF(tExports);
+        PyErr_SetString(PyExc_RuntimeError, err.what());
+        return NULL;
+    }
+    catch(...)
+    {
+        Py_XDECREF(tResults);
+        Py_DECREF(tImports); Py_DECREF(tExports);
+        PyErr_SetString(PyExc_RuntimeError, "Unexpected C++ exception.");
+        return NULL;
+    }
+
+    Py_DECREF(tImports);
+    Py_DECREF(tExports);
+    return tResults;
+}
+
 static PyObject *
 Analyze_finalize(Analyze* self)
 {
@@ -373,6 +682,8 @@ static PyMethodDef Analyze_methods[] = {
     {"importData", (PyCFunction)Analyze_importData, METH_VARARGS,  "Plato::Application::importData()" },
     {"compute",    (PyCFunction)Analyze_compute,    METH_VARARGS,  "Plato::Application::compute()" },
     {"exportData", (PyCFunction)Analyze_exportData, METH_VARARGS,  "Plato::Application::exportData()" },
+    {"importComputeExport", (PyCFunction)Analyze_importComputeExport, METH_VARARGS,
+        "importData() for each (name, type, data), compute() for each operation, then exportData() for each (name, type[, out])" },
     {"finalize",   (PyCFunction)Analyze_finalize,   METH_NOARGS,   "Plato::Application::finalize()" },
     {NULL}  /* Sentinel */
 };
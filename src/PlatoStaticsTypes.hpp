@@ -7,8 +7,12 @@
 #ifndef SRC_PLATO_PLATOSTATICSTYPES_HPP_
 #define SRC_PLATO_PLATOSTATICSTYPES_HPP_
 
+#include <set>
 #include <map>
+#include <string>
 #include <vector>
+#include <algorithm>
+#include <functional>
 
 #include "solver/CrsMatrix.hpp"
 #include "AnalyzeMacros.hpp"
@@ -63,6 +67,31 @@ template <typename ScalarType>
 using HostScalarArray3DT = typename Kokkos::View<ScalarType***, Kokkos::HostSpace>;
 using HostScalarArray3D  = HostScalarArray3DT<Plato::Scalar>;
 
+struct DataMap;
+
+/******************************************************************************//**
+ * \brief Selects which saved states are kept, and which of their fields.  The
+ *   default plan keeps every field of every saved state.
+**********************************************************************************/
+struct StateOutputPlan
+{
+  std::set<std::string> mFields;     /*!< fields kept in each state, empty keeps all fields */
+  Plato::OrdinalType mStride = 1;    /*!< keep every mStride-th step, zero disables the stride */
+  Plato::OrdinalType mKeepLast = 0;  /*!< keep at most mKeepLast states in memory, zero keeps all */
+  std::vector<Plato::Scalar> mTimes; /*!< ascending list of times, the first step reaching each time is kept */
+  Plato::Scalar mTimeTolerance = 1e-10;
+
+  /// @brief if set, each selected state is passed to the sink instead of being stored.  The
+  ///   first argument is the sequential index of the streamed state since the last clearStates().
+  std::function<void(Plato::OrdinalType, Plato::Scalar, const DataMap &)> mSink;
+
+  bool keepsField(const std::string & aName) const
+  {
+    return mFields.empty() || mFields.count(aName);
+  }
+};
+// struct StateOutputPlan
+
 struct DataMap
 {
   std::map<std::string, Plato::Scalar> mScalarValues;
@@ -75,6 +104,10 @@ struct DataMap
   std::map<std::string, Plato::ScalarVector> vectorNodeFields;
 
   std::vector<DataMap> stateDataMaps;
+  std::vector<Plato::OrdinalType> stateStepIndices; /*!< step index of each saved state */
+  std::vector<Plato::Scalar> stateTimes;            /*!< time of each saved state */
+
+  StateOutputPlan mOutputPlan;
 
   void clearAll()
   {
@@ -90,11 +123,53 @@ struct DataMap
   void clearStates()
   {
     stateDataMaps.clear();
+    stateStepIndices.clear();
+    stateTimes.clear();
+    mNumStateSteps = 0;
+    mNumStreamedStates = 0;
+    mNextPlanTime = 0;
   }
 
+  /******************************************************************************//**
+   * \brief Save the current state as the next step, the step index is also used as time.
+  **********************************************************************************/
   void saveState()
   {
-    stateDataMaps.push_back(getState());
+    saveState(mNumStateSteps, static_cast<Plato::Scalar>(mNumStateSteps));
+  }
+
+  /******************************************************************************//**
+   * \brief Save the current state if the output plan selects the step, then clear
+   *   the current state.  Selected states are either stored or passed to the sink.
+   * \param [in] aStepIndex time step index
+   * \param [in] aTime      time
+  **********************************************************************************/
+  void saveState(Plato::OrdinalType aStepIndex, Plato::Scalar aTime)
+  {
+    mNumStateSteps = aStepIndex + 1;
+
+    if( selectsStep(aStepIndex, aTime) )
+    {
+      if( mOutputPlan.mSink )
+      {
+        mOutputPlan.mSink(mNumStreamedStates++, aTime, getSelectedState());
+      }
+      else
+      {
+        stateDataMaps.push_back(getSelectedState());
+        stateStepIndices.push_back(aStepIndex);
+        stateTimes.push_back(aTime);
+
+        auto tKeepLast = static_cast<std::size_t>(mOutputPlan.mKeepLast);
+        if( tKeepLast > 0 && stateDataMaps.size() > tKeepLast )
+        {
+          auto tNumErase = stateDataMaps.size() - tKeepLast;
+          stateDataMaps.erase(stateDataMaps.begin(), stateDataMaps.begin() + tNumErase);
+          stateStepIndices.erase(stateStepIndices.begin(), stateStepIndices.begin() + tNumErase);
+          stateTimes.erase(stateTimes.begin(), stateTimes.begin() + tNumErase);
+        }
+      }
+    }
 
     mScalarValues.clear();
     scalarVectors.clear();
@@ -105,10 +180,37 @@ struct DataMap
     vectorNodeFields.clear();
   }
 
+  /******************************************************************************//**
+   * \brief Return the number of steps offered to saveState since the last clearStates(),
+   *   whether or not the output plan kept them.
+  **********************************************************************************/
+  Plato::OrdinalType numStateSteps() const
+  {
+    return mNumStateSteps;
+  }
+
+  /******************************************************************************//**
+   * \brief Return the index in stateDataMaps of the state saved at a step, or -1 if
+   *   the step was not kept.
+   * \param [in] aStepIndex time step index
+  **********************************************************************************/
+  Plato::OrdinalType stateIndex(Plato::OrdinalType aStepIndex) const
+  {
+    auto tItr = std::lower_bound(stateStepIndices.begin(), stateStepIndices.end(), aStepIndex);
+    if( tItr == stateStepIndices.end() || *tItr != aStepIndex )
+    {
+      return -1;
+    }
+    return static_cast<Plato::OrdinalType>(tItr - stateStepIndices.begin());
+  }
+
   DataMap getState() const
   {
     DataMap tState(*this);
     tState.stateDataMaps.clear();
+    tState.stateStepIndices.clear();
+    tState.stateTimes.clear();
+    tState.mOutputPlan = StateOutputPlan();
     return tState;
   }
 
@@ -131,6 +233,45 @@ struct DataMap
       }
     }
   }
+
+private:
+  Plato::OrdinalType mNumStateSteps = 0;     /*!< number of steps offered to saveState */
+  Plato::OrdinalType mNumStreamedStates = 0; /*!< number of states passed to the sink */
+  std::size_t mNextPlanTime = 0;             /*!< next listed time not yet reached */
+
+  bool selectsStep(Plato::OrdinalType aStepIndex, Plato::Scalar aTime)
+  {
+    bool tSelected = mOutputPlan.mStride > 0 && (aStepIndex % mOutputPlan.mStride) == 0;
+
+    const auto & tTimes = mOutputPlan.mTimes;
+    while( mNextPlanTime < tTimes.size() && aTime >= tTimes[mNextPlanTime] - mOutputPlan.mTimeTolerance )
+    {
+      tSelected = true;
+      mNextPlanTime++;
+    }
+    return tSelected;
+  }
+
+  DataMap getSelectedState() const
+  {
+    auto tState = getState();
+    if( mOutputPlan.mFields.empty() ) { return tState; }
+
+    auto tFilter = [this](auto & aMap)
+    {
+      for(auto tItr = aMap.begin(); tItr != aMap.end(); )
+      {
+        if( mOutputPlan.keepsField(tItr->first) ) { ++tItr; }
+        else { tItr = aMap.erase(tItr); }
+      }
+    };
+    tFilter(tState.scalarVectors);
+    tFilter(tState.scalarMultiVectors);
+    tFilter(tState.scalarArray3Ds);
+    tFilter(tState.scalarNodeFields);
+    tFilter(tState.vectorNodeFields);
+    return tState;
+  }
 };
 // struct DataMap
 
@@ -2,7 +2,9 @@
 #define PLATO_SOLVE_HPP
 
 #include <memory>
+#include <string>
 
+#include "AnalyzeMacros.hpp"
 #include "PlatoMathFunctors.hpp"
 #include "PlatoStaticsTypes.hpp"
 #include "solver/ParallelComm.hpp"
@@ -44,6 +46,84 @@ namespace Solve {
             }, "row sum inverse");
         }
 
+    /******************************************************************************//**
+     * \brief Mass lumping schemes of explicit time integrators
+    **********************************************************************************/
+    enum struct Lumping
+    {
+        RowSum, /*!< sum of the row entries */
+        HRZ     /*!< diagonal of the element mass scaled to preserve the element mass */
+    };
+
+    /******************************************************************************//**
+     * \brief Return the mass lumping scheme with the given name, i.e., 'Row Sum' or 'HRZ'
+    **********************************************************************************/
+    inline Lumping
+    lumping(const std::string & aName)
+    {
+        if( aName == "Row Sum" ) { return Lumping::RowSum; }
+        if( aName == "HRZ" )     { return Lumping::HRZ; }
+        ANALYZE_THROWERR(std::string("Unknown mass lumping scheme '") + aName + "'. Options are 'Row Sum' and 'HRZ'.");
+    }
+
+    /******************************************************************************//**
+     * \brief Compute the row sum lumped (diagonal) approximation of a block matrix, A.
+     *
+     * The HRZ lumping (Hinton, Rock, and Zienkiewicz) can't be recovered from the
+     * assembled matrix since it scales the diagonal of each element matrix, see
+     * Plato::LumpedInertialContent.
+     *
+     * \param [in] a_A Matrix, A, without essential boundary conditions
+     * \return lumped diagonal
+    **********************************************************************************/
+    template <Plato::OrdinalType NumDofsPerNode>
+    Plato::ScalarVector
+    LumpedDiagonal(
+        Teuchos::RCP<Plato::CrsMatrixType> a_A)
+        {
+            auto tNumBlockRows = a_A->rowMap().extent(0) - 1;
+            Plato::ScalarVector tLumped("lumped diagonal", tNumBlockRows*NumDofsPerNode);
+
+            Plato::RowSum tRowSumFunctor(a_A);
+            Kokkos::parallel_for(Kokkos::RangePolicy<>(0, tNumBlockRows), KOKKOS_LAMBDA(const Plato::OrdinalType& aBlockRowOrdinal)
+            {
+                tRowSumFunctor(aBlockRowOrdinal, tLumped);
+            }, "row sum");
+
+            return tLumped;
+        }
+
+    /******************************************************************************//**
+     * \brief Solve a lumped linear system, L x = b, where L is diagonal, subject to
+     *        essential boundary conditions, x[i] = scale * value[i] for i in the
+     *        constrained dofs.
+     * \param [in]     aLumped   Lumped diagonal, L
+     * \param [in/out] a_x       Solution vector, x
+     * \param [in]     a_b       Forcing vector, b
+     * \param [in]     aBcDofs   Constrained dofs
+     * \param [in]     aBcValues Values of the constrained dofs
+     * \param [in]     aScale    Scale of the values, e.g., zero for homogeneous conditions
+    **********************************************************************************/
+    inline void
+    Lumped(
+        Plato::ScalarVector  aLumped,
+        Plato::ScalarVector  a_x,
+        Plato::ScalarVector  a_b,
+        Plato::OrdinalVector aBcDofs,
+        Plato::ScalarVector  aBcValues,
+        Plato::Scalar        aScale = 1.0)
+        {
+            Kokkos::parallel_for(Kokkos::RangePolicy<>(0, a_x.extent(0)), KOKKOS_LAMBDA(const Plato::OrdinalType& aOrdinal)
+            {
+                a_x(aOrdinal) = a_b(aOrdinal) / aLumped(aOrdinal);
+            }, "lumped inverse");
+
+            Kokkos::parallel_for(Kokkos::RangePolicy<>(0, aBcDofs.extent(0)), KOKKOS_LAMBDA(const Plato::OrdinalType& aBcOrdinal)
+            {
+                a_x(aBcDofs(aBcOrdinal)) = aScale * aBcValues(aBcOrdinal);
+            }, "lumped constraints");
+        }
+
 } // namespace Solve
 
 } // namespace Plato
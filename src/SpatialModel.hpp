@@ -1,5 +1,10 @@
 #pragma once
 
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <utility>
+
 #include <Teuchos_ParameterList.hpp>
 
 #include "PlatoMesh.hpp"
@@ -7,6 +12,7 @@
 #include "ParseTools.hpp"
 #include "PlatoMathTypes.hpp"
 #include "PlatoStaticsTypes.hpp"
+#include "GeometricFactorsCache.hpp"
 
 namespace Plato
 {
@@ -30,17 +36,22 @@ private:
     Plato::OrdinalVector mTotalElemLids;   /*!< List of local elements ids in this domain */
     Plato::OrdinalVector mMaskedElemLids;  /*!< List of local elements ids after application of a masked operation */
 
+    mutable Plato::OrdinalVector mBatchElemLids; /*!< Window into the masked element list, see setCellBatch() */
+    mutable bool mHasCellBatch = false;          /*!< flag for active cell batch */
+
     Plato::DataMap mDataMap;
 
-    bool mHasUniformBasis;
+    bool mHasUniformBasis = false;
 
     // SpatialDomain isn't templated on SpatialDim, so allocate for 3D
     Plato::Matrix<3,3> mUniformCartesianBasis;
 
-    bool mHasVaryingBasis;
+    bool mHasVaryingBasis = false;
 
     Plato::ScalarArray3D mVaryingCartesianBasis;
 
+    mutable Plato::GeometricFactorsCache mGeometricFactors; /*!< optional cache of basis gradients and detJ*w */
+
 public:
     /******************************************************************************//**
      * \fn getDomainName
@@ -124,7 +135,7 @@ public:
     Plato::OrdinalType 
     numCells() const
     {
-        return mMaskedElemLids.extent(0);
+        return this->cellOrdinals().extent(0);
     }
 
     /******************************************************************************//**
@@ -145,7 +156,54 @@ public:
     const Plato::OrdinalVector &
     cellOrdinals() const
     {
-        return mMaskedElemLids;
+        return mHasCellBatch ? mBatchElemLids : mMaskedElemLids;
+    }
+
+    /******************************************************************************//**
+     * \brief Restrict the domain to a contiguous batch of its (masked) cells.
+     *        Subsequent calls to numCells() and cellOrdinals() refer to cells
+     *        [aBegin, aEnd) of the masked element list until clearCellBatch() is
+     *        called.  Workset builders, evaluators, and assembly routines that hold
+     *        a reference to this domain therefore operate on the batch only.
+     * \param [in] aBegin first cell of the batch
+     * \param [in] aEnd   one past the last cell of the batch
+    **********************************************************************************/
+    void setCellBatch(Plato::OrdinalType aBegin, Plato::OrdinalType aEnd) const
+    {
+        mBatchElemLids = Kokkos::subview(mMaskedElemLids, std::make_pair(aBegin, aEnd));
+        mHasCellBatch = true;
+    }
+
+    /******************************************************************************//**
+     * \brief Remove the cell batch set by setCellBatch().
+    **********************************************************************************/
+    void clearCellBatch() const
+    {
+        mBatchElemLids = Plato::OrdinalVector();
+        mHasCellBatch = false;
+    }
+
+    /******************************************************************************//**
+     * \brief Return the cache of geometric factors of this domain.  The cache is
+     *        disabled unless the domain sets 'Cache Geometric Factors'.
+    **********************************************************************************/
+    Plato::GeometricFactorsCache &
+    geometricFactors() const
+    {
+        return mGeometricFactors;
+    }
+
+    /******************************************************************************//**
+     * \brief Set the cell ordinals of this domain to an explicit cell list.
+     * \param [in] aCellOrdinals mesh cell ordinals
+    **********************************************************************************/
+    void cellOrdinals(const Plato::OrdinalVector & aCellOrdinals)
+    {
+        this->clearCellBatch();
+        mGeometricFactors.clear();
+        mTotalElemLids = aCellOrdinals;
+        mMaskedElemLids = Plato::OrdinalVector("masked element list", aCellOrdinals.extent(0));
+        Kokkos::deep_copy(mMaskedElemLids, mTotalElemLids);
     }
 
     /******************************************************************************//**
@@ -208,6 +266,8 @@ public:
     {
         using OrdinalT = Plato::OrdinalType;
 
+        this->clearCellBatch();
+        mGeometricFactors.clear();
         auto tMask = aMask->cellMask();
         auto tTotalElemLids = mTotalElemLids;
         auto tNumEntries = tTotalElemLids.extent(0);
@@ -244,12 +304,15 @@ public:
     void
     removeMask()
     {
+        this->clearCellBatch();
+        mGeometricFactors.clear();
         Kokkos::deep_copy(mMaskedElemLids, mTotalElemLids);
     }
     
     void setMaskLocalElemIDs
     (const std::string& aBlockName)
     {
+        mGeometricFactors.clear();
         auto tElemLids = Mesh->GetLocalElementIDs(aBlockName);
         auto tNumElems = tElemLids.size();
         mTotalElemLids = Plato::OrdinalVector("element list", tNumElems);
@@ -289,6 +352,10 @@ public:
         {
             mIsFixedBlock = aInputParams.get<bool>("Fixed Control");
         }
+        if(aInputParams.isType<bool>("Cache Geometric Factors"))
+        {
+            mGeometricFactors.enable(aInputParams.get<bool>("Cache Geometric Factors"));
+        }
 
         this->setMaskLocalElemIDs(mElementBlockName);
 
@@ -402,6 +469,71 @@ public:
 };
 // class SpatialDomain
 
+/******************************************************************************/
+/*!
+ \brief Splits a spatial domain into contiguous batches of at most a given
+ number of cells.  select(i) restricts the domain to the i-th batch; the domain
+ is restored to its full cell list when the object goes out of scope.
+
+ Batching bounds the size of the cell worksets (e.g., FAD worksets) built for
+ the domain.  A batch size of zero disables batching.  Domains with a varying
+ cartesian basis are never batched since the basis field is indexed by workset
+ cell.
+ */
+class DomainCellBatches
+/******************************************************************************/
+{
+    const Plato::SpatialDomain & mDomain;
+    Plato::OrdinalType mNumCells;
+    Plato::OrdinalType mBatchSize;
+
+public:
+    DomainCellBatches(
+        const Plato::SpatialDomain & aDomain,
+              Plato::OrdinalType     aBatchSize
+    ) :
+        mDomain(aDomain),
+        mNumCells(aDomain.numCells()),
+        mBatchSize(aBatchSize)
+    {
+        if(mBatchSize <= 0 || mBatchSize >= mNumCells || aDomain.hasVaryingCartesianBasis())
+        {
+            mBatchSize = mNumCells;
+        }
+    }
+
+    ~DomainCellBatches()
+    {
+        mDomain.clearCellBatch();
+    }
+
+    DomainCellBatches(const DomainCellBatches&) = delete;
+    DomainCellBatches& operator=(const DomainCellBatches&) = delete;
+
+    /******************************************************************************//**
+     * \brief Return number of batches
+    **********************************************************************************/
+    Plato::OrdinalType size() const
+    {
+        if(mBatchSize == mNumCells) { return 1; }
+        return (mNumCells + mBatchSize - 1) / mBatchSize;
+    }
+
+    /******************************************************************************//**
+     * \brief Restrict the domain to batch \p aBatch.  A single batch leaves the
+     *        domain untouched.
+     * \param [in] aBatch batch index
+    **********************************************************************************/
+    void select(Plato::OrdinalType aBatch) const
+    {
+        if(mBatchSize == mNumCells) { return; }
+        auto tBegin = aBatch * mBatchSize;
+        auto tEnd = std::min(tBegin + mBatchSize, mNumCells);
+        mDomain.setCellBatch(tBegin, tEnd);
+    }
+};
+// class DomainCellBatches
+
 /******************************************************************************/
 /*!
  \brief Spatial models contain the mesh, meshsets, domains, etc that define
@@ -415,6 +547,9 @@ public:
 
     std::vector<Plato::SpatialDomain> Domains; /*!< list of spatial domains, i.e. element blocks */
 
+private:
+    mutable Plato::OrdinalVector mBoundaryWorksetCells; /*!< sorted cells of the boundary workset, empty if whole mesh */
+
     /******************************************************************************//**
      * \brief Constructor for Plato::SpatialModel base class
      * \param [in] aMesh     Default mesh
@@ -472,6 +607,61 @@ public:
         }
     }
 
+    /******************************************************************************//**
+     * \brief Return the sorted, unique parent cells of the named side sets.
+     * \param [in] aSideSetNames side set names
+    **********************************************************************************/
+    Plato::OrdinalVector
+    sideSetCells
+    (const std::vector<std::string> & aSideSetNames) const
+    {
+        std::vector<Plato::OrdinalType> tCells;
+        for( const auto& tName : aSideSetNames )
+        {
+            auto tElementOrds = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Mesh->GetSideSetElements(tName));
+            tCells.insert(tCells.end(), tElementOrds.data(), tElementOrds.data() + tElementOrds.extent(0));
+        }
+        std::sort(tCells.begin(), tCells.end());
+        tCells.erase(std::unique(tCells.begin(), tCells.end()), tCells.end());
+
+        Plato::OrdinalVector tCellOrdinals("side set cells", tCells.size());
+        Kokkos::View<Plato::OrdinalType*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+            tHostCells(tCells.data(), tCells.size());
+        Kokkos::deep_copy(tCellOrdinals, tHostCells);
+        return tCellOrdinals;
+    }
+
+    /******************************************************************************//**
+     * \brief Declare that the worksets passed to boundary evaluators hold only the
+     *        given cells, i.e., workset row i holds mesh cell aCells(i).  Boundary
+     *        integrals map mesh cells to workset rows with Plato::workset_cell_ordinal.
+     *        Call clearBoundaryWorksetCells() to restore whole-mesh worksets.
+     * \param [in] aCells sorted mesh cell ordinals
+    **********************************************************************************/
+    void setBoundaryWorksetCells
+    (const Plato::OrdinalVector & aCells) const
+    {
+        mBoundaryWorksetCells = aCells;
+    }
+
+    /******************************************************************************//**
+     * \brief Restore whole-mesh boundary worksets.
+    **********************************************************************************/
+    void clearBoundaryWorksetCells() const
+    {
+        mBoundaryWorksetCells = Plato::OrdinalVector();
+    }
+
+    /******************************************************************************//**
+     * \brief Return the sorted cells of the boundary workset, or an empty view if
+     *        boundary worksets span the whole mesh.
+    **********************************************************************************/
+    const Plato::OrdinalVector &
+    boundaryWorksetCells() const
+    {
+        return mBoundaryWorksetCells;
+    }
+
     /******************************************************************************//**
      * \brief Append spatial domain to spatial model.
      * \param [in] aDomain Spatial domain
@@ -484,4 +674,29 @@ public:
 };
 // class SpatialModel
 
+/******************************************************************************//**
+ * \brief Return the workset row of a mesh cell.
+ * \param [in] aWorksetCells sorted workset cells (see SpatialModel::boundaryWorksetCells),
+ *                           empty if the workset spans the whole mesh
+ * \param [in] aCellOrdinal  mesh cell ordinal
+**********************************************************************************/
+KOKKOS_INLINE_FUNCTION
+Plato::OrdinalType
+workset_cell_ordinal(
+    const Plato::OrdinalVector & aWorksetCells,
+          Plato::OrdinalType     aCellOrdinal
+)
+{
+    Plato::OrdinalType tEnd = aWorksetCells.extent(0);
+    if( tEnd == 0 ) { return aCellOrdinal; }
+    Plato::OrdinalType tBegin = 0;
+    while( tBegin < tEnd )
+    {
+        auto tMid = tBegin + (tEnd - tBegin) / 2;
+        if( aWorksetCells(tMid) < aCellOrdinal ) { tBegin = tMid + 1; }
+        else { tEnd = tMid; }
+    }
+    return tBegin;
+}
+
 } // namespace Plato
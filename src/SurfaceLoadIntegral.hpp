@@ -99,6 +99,7 @@ void SurfaceLoadIntegral<ElementType, NumDofs, DofsPerNode, DofOffset>::operator
 ) const
 {
     auto tElementOrds = aSpatialModel.Mesh->GetSideSetElements(mSideSetName);
+    auto tWorksetCells = aSpatialModel.boundaryWorksetCells();
     auto tNodeOrds = aSpatialModel.Mesh->GetSideSetLocalNodes(mSideSetName);
     Plato::OrdinalType tNumFaces = tElementOrds.size();
 
@@ -113,6 +114,7 @@ void SurfaceLoadIntegral<ElementType, NumDofs, DofsPerNode, DofOffset>::operator
     KOKKOS_LAMBDA(const Plato::OrdinalType & aSideOrdinal, const Plato::OrdinalType & aPointOrdinal)
     {
       auto tElementOrdinal = tElementOrds(aSideOrdinal);
+      auto tCellOrdinal = Plato::workset_cell_ordinal(tWorksetCells, tElementOrdinal);
 
       Plato::Array<ElementType::mNumNodesPerFace, Plato::OrdinalType> tLocalNodeOrds;
       for( Plato::OrdinalType tNodeOrd=0; tNodeOrd<ElementType::mNumNodesPerFace; tNodeOrd++)
@@ -126,7 +128,7 @@ void SurfaceLoadIntegral<ElementType, NumDofs, DofsPerNode, DofOffset>::operator
       auto tBasisGrads  = ElementType::Face::basisGrads(tCubaturePoint);
 
       ResultScalarType tSurfaceArea(0.0);
-      surfaceArea(tElementOrdinal, tLocalNodeOrds, tBasisGrads, aConfig, tSurfaceArea);
+      surfaceArea(tCellOrdinal, tLocalNodeOrds, tBasisGrads, aConfig, tSurfaceArea);
       tSurfaceArea *= aScale;
       tSurfaceArea *= tCubatureWeight;
 
@@ -137,7 +139,7 @@ void SurfaceLoadIntegral<ElementType, NumDofs, DofsPerNode, DofOffset>::operator
           {
               auto tElementDofOrdinal = tLocalNodeOrds[tNode] * DofsPerNode + tDof + DofOffset;
               ResultScalarType tResult = tBasisValues(tNode)*tFlux[tDof]*tSurfaceArea;
-              Kokkos::atomic_add(&aResult(tElementOrdinal,tElementDofOrdinal), tResult);
+              Kokkos::atomic_add(&aResult(tCellOrdinal,tElementDofOrdinal), tResult);
           }
       }
     }, "surface load integral");
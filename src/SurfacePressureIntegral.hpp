@@ -99,6 +99,7 @@ void SurfacePressureIntegral<ElementType, NumDofs, DofsPerNode, DofOffset>::oper
 ) const
 {
     auto tElementOrds = aSpatialModel.Mesh->GetSideSetElements(mSideSetName);
+    auto tWorksetCells = aSpatialModel.boundaryWorksetCells();
     auto tNodeOrds    = aSpatialModel.Mesh->GetSideSetLocalNodes(mSideSetName);
     auto tFaceOrds    = aSpatialModel.Mesh->GetSideSetFaces(mSideSetName);
 
@@ -117,6 +118,7 @@ void SurfacePressureIntegral<ElementType, NumDofs, DofsPerNode, DofOffset>::oper
     KOKKOS_LAMBDA(const Plato::OrdinalType & aSideOrdinal, const Plato::OrdinalType & aPointOrdinal)
     {
         auto tElementOrdinal = tElementOrds(aSideOrdinal);
+        auto tCellOrdinal = Plato::workset_cell_ordinal(tWorksetCells, tElementOrdinal);
         auto tElemFaceOrdinal = tFaceOrds(aSideOrdinal);
 
         Plato::Array<ElementType::mNumNodesPerFace, Plato::OrdinalType> tLocalNodeOrds;
@@ -132,7 +134,7 @@ void SurfacePressureIntegral<ElementType, NumDofs, DofsPerNode, DofOffset>::oper
 
         // compute area weighted normal vector
         Plato::Array<ElementType::mNumSpatialDims, ConfigScalarType> tWeightedNormalVec;
-        weightedNormalVector(tElementOrdinal, tLocalNodeOrds, tBasisGrads, aConfig, tWeightedNormalVec);
+        weightedNormalVector(tCellOrdinal, tLocalNodeOrds, tBasisGrads, aConfig, tWeightedNormalVec);
 
         // project into aResult workset
         for( Plato::OrdinalType tNode=0; tNode<ElementType::mNumNodesPerFace; tNode++)
@@ -142,7 +144,7 @@ void SurfacePressureIntegral<ElementType, NumDofs, DofsPerNode, DofOffset>::oper
                 auto tElementDofOrdinal = (tLocalNodeOrds[tNode] * DofsPerNode) + tDof + DofOffset;
                 ResultScalarType tVal = 
                   tWeightedNormalVec(tDof) * tFlux(tDof) * aScale * tCubatureWeight * tNormalMultiplier * tBasisValues(tNode);
-                Kokkos::atomic_add(&aResult(tElementOrdinal, tElementDofOrdinal), tVal);
+                Kokkos::atomic_add(&aResult(tCellOrdinal, tElementDofOrdinal), tVal);
             }
         }
     }, "surface pressure integral");
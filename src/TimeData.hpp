@@ -7,6 +7,7 @@
 #pragma once
 
 #include <limits>
+#include <vector>
 #include "PlatoTypes.hpp"
 #include "ParseTools.hpp"
 
@@ -32,6 +33,8 @@ public:
 
     bool mMaxNumTimeStepsReached; /*!< whether the maximum number of time steps has been reached */
 
+    std::vector<Plato::Scalar> mTimeHistory; /*!< end time of each step of a variable step history, steps are uniform if empty */
+
     /***************************************************************************//**
      * \brief Time Data constructor
      * \param [in] aInputs input parameters database
@@ -67,7 +70,8 @@ public:
       mEndTime(aInputTimeData.mEndTime),
       mCurrentTimeStepSize(aInputTimeData.mCurrentTimeStepSize),
       mTimeStepExpansionMultiplier(aInputTimeData.mTimeStepExpansionMultiplier),
-      mMaxNumTimeStepsReached(aInputTimeData.mMaxNumTimeStepsReached)
+      mMaxNumTimeStepsReached(aInputTimeData.mMaxNumTimeStepsReached),
+      mTimeHistory(aInputTimeData.mTimeHistory)
     {
 
     }
@@ -102,9 +106,46 @@ public:
             ANALYZE_THROWERR("Provided time step index is less than 0.")
         }
         mCurrentTimeStepIndex = aUpdatedTimeStepIndex;
-        mCurrentTime = mCurrentTimeStepSize * static_cast<Plato::Scalar>(mCurrentTimeStepIndex + 1);
-        mCurrentTime = std::min(mCurrentTime, mEndTime);
-        mCurrentTime = std::max(mCurrentTime, mStartTime);
+        mCurrentTime = this->getTime(mCurrentTimeStepIndex);
+        if (mCurrentTimeStepIndex < static_cast<Plato::OrdinalType>(mTimeHistory.size()))
+        {
+            mCurrentTimeStepSize = mCurrentTime - this->getPreviousTime();
+        }
+    }
+
+    /***************************************************************************//**
+     * \brief Return the time at the end of a time step.  The time step size is
+     *   uniform unless a variable step time history was recorded.
+     * \param [in] aTimeStepIndex time step index
+     * \return time at the end of the time step
+    *******************************************************************************/
+    Plato::Scalar getTime(const Plato::OrdinalType aTimeStepIndex) const
+    {
+        Plato::Scalar tTime = mEndTime;
+        if (mTimeHistory.empty())
+        {
+            tTime = mCurrentTimeStepSize * static_cast<Plato::Scalar>(aTimeStepIndex + 1);
+        }
+        else if (aTimeStepIndex < static_cast<Plato::OrdinalType>(mTimeHistory.size()))
+        {
+            tTime = mTimeHistory[aTimeStepIndex];
+        }
+        tTime = std::min(tTime, mEndTime);
+        tTime = std::max(tTime, mStartTime);
+        return tTime;
+    }
+
+    /***************************************************************************//**
+     * \brief Return the time at the end of the previous time step
+     * \return previous time, start time if at the first time step
+    *******************************************************************************/
+    Plato::Scalar getPreviousTime() const
+    {
+        if (mCurrentTimeStepIndex <= static_cast<Plato::OrdinalType>(0))
+        {
+            return mStartTime;
+        }
+        return this->getTime(mCurrentTimeStepIndex - static_cast<Plato::OrdinalType>(1));
     }
 
     /***************************************************************************//**
@@ -120,6 +161,7 @@ public:
         }
         mCurrentTimeStepSize  = mEndTime / mNumTimeSteps;
         mCurrentTime          = mStartTime;
+        mTimeHistory.clear();
         mCurrentTimeStepIndex = static_cast<Plato::OrdinalType>(0);
     }
 
@@ -2,6 +2,7 @@
 #define PLATO_TO_MAP_HPP
 
 #include <string>
+#include <type_traits>
 
 #include "SpatialModel.hpp"
 #include "PlatoStaticsTypes.hpp"
@@ -9,6 +10,20 @@
 namespace Plato
 {
 
+/******************************************************************************//**
+ * \brief Return true if an evaluation with this result scalar type stores output
+ *        quantities of interest.  Only plain (non-AD) evaluations store output,
+ *        AD evaluations can skip the computation of output quantities.
+ * \tparam ScalarType result scalar type
+ **********************************************************************************/
+template<typename ScalarType>
+inline constexpr bool
+storesOutput()
+{
+    return std::is_same<ScalarType, Plato::Scalar>::value;
+}
+// function storesOutput
+
 /******************************************************************************//**
  * \brief Null operation for all types (only specializations below are non-trivial)
  * \param [in/out] aDataMap output data storage
@@ -81,10 +81,19 @@ public:
                Kokkos::View< Plato::ScalarVectorT< ControlT > *,
                              Plato::UVMSpace > const& aParameters) const override
   {
-      // Method used with the factory and has it own Kokkos parallel_for
+      // Method used with the factory, evaluates all cells at once
       const Plato::OrdinalType tNumCells = aResult.extent(0);
       const Plato::OrdinalType tNumTerms = aResult.extent(1);
 
+      // The input parameters have one value per cell. With one value
+      // per thread (cell) the expression evaluator indexes vector
+      // variables over the threads, so the parameters can be set for
+      // all cells at once.
+      if( tNumTerms != 1 )
+      {
+        ANALYZE_THROWERR("Yield Stress Expression: the yield stress must have one value per cell.");
+      }
+
       // Strings for mapping parameter names to the equation
       // variables. Note: the LocalState is a required parameter
       // though possibly not used. That is in the operator() just the
@@ -133,26 +142,18 @@ public:
       if( tVarMaps(tNumParamLabels-1).key )
         tExpEval.set_variable( tVarMaps(tNumParamLabels-1).value, aLocalState );
 
-      // Finally do the evaluation.
-      Kokkos::parallel_for("Compute yield stress",
-                           Kokkos::RangePolicy<>(0, tNumCells),
-                           KOKKOS_LAMBDA(const Plato::OrdinalType & aCellOrdinal)
+      // Values that change based on the cell index. These are values
+      // that the user has requested to come from the input
+      // parameters. The last is the LocalState and is handled above,
+      // thus the reason for subtracting one.
+      for( Plato::OrdinalType i=0; i<tNumParamLabels-1; ++i )
       {
-        // Values that change based on the aCellOrdinal index. These
-        // are values that the user has requested to come from the
-        // input parameters. The last is the LocalState and is handled
-        // above, thus the reason for subtracting one.
-        for( Plato::OrdinalType i=0; i<tNumParamLabels-1; ++i )
-        {
-          if( tVarMaps(i).key )
-            tExpEval.set_variable( tVarMaps(i).value,
-                                   (aParameters(i))(aCellOrdinal),
-                                   aCellOrdinal );
-        }
-
-        // Evaluate the expression for this cell.
-        tExpEval.evaluate_expression( aCellOrdinal, aResult );
-      } );
+        if( tVarMaps(i).key )
+          tExpEval.set_variable( tVarMaps(i).value, aParameters(i) );
+      }
+
+      // Finally evaluate the expression for all cells at once.
+      tExpEval.evaluate_expression( aResult );
 
       // Fence before deallocation on host, to make sure that the
       // device kernel is done first.
@@ -95,6 +95,39 @@ public:
           Plato::WorkSets     & aWorkSets,
           Plato::Scalar         aCycle = 0.0
   ) const = 0;
+
+  /// @fn postProcess
+  /// @brief compute output quantities of interest at a converged state.  The
+  ///   default evaluates the residual, which stores its output quantities as a
+  ///   side effect; residuals that only compute output quantities in this stage
+  ///   override this function.
+  /// @param [in,out] aWorkSets domain and range workset database
+  /// @param [in]     aCycle    scalar
+  virtual
+  void
+  postProcess(
+    Plato::WorkSets & aWorkSets,
+    Plato::Scalar     aCycle = 0.0
+  ) const
+  {
+    this->evaluate(aWorkSets, aCycle);
+  }
+
+  /// @fn getBoundarySideSets
+  /// @brief get side sets on which evaluateBoundary integrates.  If the function
+  ///   returns true, evaluateBoundary only reads and writes workset rows of the
+  ///   parent cells of these side sets, and the caller may pass worksets built
+  ///   over those cells only (see Plato::SpatialModel::setBoundaryWorksetCells).
+  /// @param [in,out] aSideSetNames side set names are appended
+  /// @return false if the boundary terms require whole-mesh worksets
+  virtual
+  bool
+  getBoundarySideSets(
+    std::vector<std::string> & aSideSetNames
+  ) const
+  {
+    return false;
+  }
 };
 // class abstract residual
 
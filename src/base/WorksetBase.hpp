@@ -1,6 +1,7 @@
 #ifndef WORKSET_BASE_HPP
 #define WORKSET_BASE_HPP
 
+#include <memory>
 #include <cassert>
 
 #include "ImplicitFunctors.hpp"
@@ -25,6 +26,8 @@ protected:
     Plato::OrdinalType mNumCells; /*!< local number of elements */
     Plato::OrdinalType mNumNodes; /*!< local number of nodes */
 
+    std::shared_ptr<Plato::ElementColoring> mElementColoring; /*!< if set, assemble by color without atomics */
+
     using ElementType::mNumDofsPerNode;      /*!< number of degrees of freedom per node */
     using ElementType::mNumControl;          /*!< number of control vectors, i.e. materials */
     using ElementType::mNumNodesPerCell;     /*!< number of nodes per element */
@@ -74,6 +77,17 @@ public:
         return (mNumNodes);
     }
 
+    /******************************************************************************//**
+     * \brief Set element coloring.  If set, residuals and Jacobians are assembled one
+     *        color at a time without atomics, which makes the summation order, and
+     *        hence the assembled values, deterministic.
+     * \param [in] aElementColoring element coloring of the mesh (may be null)
+    **********************************************************************************/
+    void setElementColoring(std::shared_ptr<Plato::ElementColoring> aElementColoring)
+    {
+        mElementColoring = aElementColoring;
+    }
+
     /******************************************************************************//**
      * \brief Constructor
      * \param [in] aMesh mesh metadata
@@ -432,6 +446,12 @@ public:
         const Plato::SpatialDomain  & aDomain
     ) const
     {
+        if(mElementColoring)
+        {
+            Plato::assemble_residual_colored<mNumNodesPerCell, mNumDofsPerNode>
+                (mElementColoring->cells(aDomain), mGlobalStateEntryOrdinal, aResidualWorkset, aReturnValue);
+            return;
+        }
         Plato::assemble_residual<mNumNodesPerCell, mNumDofsPerNode>
             (aDomain, WorksetBase<ElementType>::mGlobalStateEntryOrdinal, aResidualWorkset, aReturnValue);
     }
@@ -451,6 +471,12 @@ public:
               AssembledResidualType & aReturnValue
     ) const
     {
+        if(mElementColoring)
+        {
+            Plato::assemble_residual_colored<mNumNodesPerCell, mNumDofsPerNode>
+                (mElementColoring->cells(), mGlobalStateEntryOrdinal, aResidualWorkset, aReturnValue);
+            return;
+        }
         Plato::assemble_residual<mNumNodesPerCell, mNumDofsPerNode>
             (mNumCells, WorksetBase<ElementType>::mGlobalStateEntryOrdinal, aResidualWorkset, aReturnValue);
     }
@@ -657,6 +683,13 @@ public:
               AssembledJacobianType    & aReturnValue
     ) const
     {
+      if(mElementColoring)
+      {
+        Plato::assemble_jacobian_fad_colored(
+          mElementColoring->cells(), aNumRows, aNumColumns, aMatrixEntryOrdinal, aJacobianWorkset, aReturnValue
+        );
+        return;
+      }
       Plato::assemble_jacobian_fad(
         mNumCells, aNumRows, aNumColumns, aMatrixEntryOrdinal, aJacobianWorkset, aReturnValue
       );
@@ -687,6 +720,12 @@ public:
         const Plato::SpatialDomain     & aDomain
     ) const
     {
+        if(mElementColoring)
+        {
+            Plato::assemble_jacobian_fad_colored
+                (mElementColoring->cells(aDomain), aNumRows, aNumColumns, aMatrixEntryOrdinal, aJacobianWorkset, aReturnValue);
+            return;
+        }
         Plato::assemble_jacobian_fad(aDomain, aNumRows, aNumColumns, aMatrixEntryOrdinal, aJacobianWorkset, aReturnValue);
     }
 
@@ -736,6 +775,12 @@ public:
         const Plato::SpatialDomain     & aDomain
     ) const
     {
+        if(mElementColoring)
+        {
+            Plato::assemble_transpose_jacobian_colored
+                (mElementColoring->cells(aDomain), aNumRowsPerCell, aNumColumnsPerCell, aMatrixEntryOrdinal, aJacobianWorkset, aReturnValue);
+            return;
+        }
         Plato::assemble_transpose_jacobian
             (aDomain, aNumRowsPerCell, aNumColumnsPerCell, aMatrixEntryOrdinal, aJacobianWorkset, aReturnValue);
     }
@@ -763,6 +808,12 @@ public:
               AssembledJacobianType    & aReturnValue
     ) const
     {
+        if(mElementColoring)
+        {
+            Plato::assemble_transpose_jacobian_colored
+                (mElementColoring->cells(), aNumRowsPerCell, aNumColumnsPerCell, aMatrixEntryOrdinal, aJacobianWorkset, aReturnValue);
+            return;
+        }
         Plato::assemble_transpose_jacobian
             (mNumCells, aNumRowsPerCell, aNumColumnsPerCell, aMatrixEntryOrdinal, aJacobianWorkset, aReturnValue);
     }
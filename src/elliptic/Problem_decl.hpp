@@ -47,6 +47,12 @@ private:
   bool mSaveState = false;
   /// @brief apply dirichlet boundary condition weakly
   bool mWeakEBCs = false;
+  /// @brief reuse the forward operator and its factorization for the adjoint solves
+  bool mSelfAdjoint = false;
+  /// @brief true if mJacobianState and the solver hold the constrained forward operator
+  bool mReusableOperator = false;
+  /// @brief controls at which the reusable forward operator was assembled
+  Plato::ScalarVector mReusableControls;
   /// @brief vector of adjoint values
   Plato::ScalarMultiVector mAdjoints;
   /// @brief scalar residual vector
@@ -254,6 +260,37 @@ public:
         const std::string         & aName
     ) override;
 
+    /******************************************************************************//**
+     * \brief Evaluate the gradients of several criteria wrt control variables.  The
+     *        adjoint operator is assembled once and the adjoint problems of all nonlinear
+     *        criteria are solved together as one multiple right-hand-side solve.
+     * \param [in] aControl 1D view of control variables
+     * \param [in] aSolution solution database
+     * \param [in] aNames criteria names
+     * \return criteria gradients wrt control variables, in the order of aNames
+    **********************************************************************************/
+    std::vector<Plato::ScalarVector>
+    criterionGradients(
+        const Plato::ScalarVector      & aControl,
+        const Plato::Solutions         & aSolution,
+        const std::vector<std::string> & aNames
+    ) override;
+
+    /******************************************************************************//**
+     * \brief Evaluate the gradients of several criteria wrt configuration variables.
+     *        See criterionGradients.
+     * \param [in] aControl 1D view of control variables
+     * \param [in] aSolution solution database
+     * \param [in] aNames criteria names
+     * \return criteria gradients wrt configuration variables, in the order of aNames
+    **********************************************************************************/
+    std::vector<Plato::ScalarVector>
+    criterionGradientsX(
+        const Plato::ScalarVector      & aControl,
+        const Plato::Solutions         & aSolution,
+        const std::vector<std::string> & aNames
+    ) override;
+
     /***************************************************************************//**
      * \brief Read essential (Dirichlet) boundary conditions from the Exodus file.
      * \param [in] aParamList input parameters database
@@ -336,6 +373,34 @@ private:
     Criterion       & aCriterion
   );
 
+  std::vector<Plato::ScalarVector>
+  computeCriterionGradients(
+    const Plato::ScalarVector          & aControls,
+    const std::vector<std::string>     & aNames,
+          Plato::partial::derivative_t   aPartial
+  );
+
+  /// @brief return true if the material models of all the domains are linear, i.e., their
+  ///        properties don't depend on the state
+  /// @param aParamList input problem parameters
+  /// @return boolean
+  bool
+  hasLinearMaterialModels(
+    Teuchos::ParameterList & aParamList
+  ) const;
+
+  bool
+  isOperatorReusable(
+    const Plato::ScalarVector & aControls
+  ) const;
+
+  void
+  solveAdjointSystems(
+    Plato::Database          & aDatabase,
+    Plato::ScalarMultiVector & aAdjoints,
+    Plato::ScalarMultiVector & aRHS
+  );
+
   void
   enforceStrongEssentialBoundaryConditions(
     const Teuchos::RCP<Plato::CrsMatrixType> & aMatrix,
@@ -3,6 +3,7 @@
 #include "BLAS1.hpp"
 #include "Solutions.hpp"
 #include "ParseTools.hpp"
+#include "MaterialModel.hpp"
 #include "EssentialBCs.hpp"
 #include "AnalyzeMacros.hpp"
 #include "AnalyzeOutput.hpp"
@@ -40,6 +41,9 @@ Problem(
   mPhysics      (aParamList.get<std::string>("Physics")),
   mMPCs         (nullptr)
 {
+  mSelfAdjoint = PhysicsType::mSelfAdjoint
+    && Plato::ParseTools::getParam<bool>(aParamList,"Reuse Forward Operator",true)
+    && this->hasLinearMaterialModels(aParamList);
   this->initializeEvaluators(aParamList);
   this->initializeMultiPointConstraints(aParamList);
   this->readEssentialBoundaryConditions(aParamList);
@@ -198,6 +202,8 @@ solution(
   // initialize state values
   Plato::ScalarVector tMyStates = tDatabase.vector("states");
   Plato::blas1::fill(0.0, tMyStates);
+  mReusableOperator = false;
+  Plato::OrdinalType tNumSolves = 0;
   // inner loop for non-linear models
   constexpr Plato::Scalar tCYCLE = 0.0;
   for(Plato::OrdinalType tNewtonIndex = 0; tNewtonIndex < mNumNewtonSteps; tNewtonIndex++)
@@ -220,6 +226,7 @@ solution(
     Plato::ScalarVector tDeltaD("increment", tMyStates.extent(0));
     Plato::blas1::fill(static_cast<Plato::Scalar>(0.0), tDeltaD);
     mSolver->solve(*mJacobianState, tDeltaD, mResidual);
+    tNumSolves++;
     Plato::blas1::axpy(1.0, tDeltaD, tMyStates);
     if (mNumNewtonSteps > 1) {
       auto tIncrementNorm = Plato::blas1::norm(tDeltaD);
@@ -230,10 +237,18 @@ solution(
       }
     }
   }
+  // keep the constrained forward operator for the adjoint solves.  after more than one newton
+  // step the operator was assembled at a state preceding the converged one, so it isn't reused.
+  if( mSelfAdjoint && !mWeakEBCs && tNumSolves == 1 )
+  {
+    Kokkos::resize(mReusableControls, aControls.extent(0));
+    Kokkos::deep_copy(mReusableControls, aControls);
+    mReusableOperator = true;
+  }
   if ( mSaveState )
   {
-    // evaluate at new state
-    mResidual = mResidualEvaluator->value(tDatabase,tCYCLE);
+    // compute output quantities of interest at new state
+    mResidualEvaluator->postProcess(tDatabase,tCYCLE);
     mDataMap.saveState();
   }
   auto tSolution = this->getSolution();
@@ -390,16 +405,11 @@ computeCriterionGradientControl(
     // compute gradient with respect to state variables
     auto tGradientState = aCriterion->gradientState(aDatabase, tCYCLE);
     Plato::blas1::scale(-1.0, tGradientState);
-    // compute jacobian with respect to state variables
-    mJacobianState = mResidualEvaluator->jacobianState(aDatabase, tCYCLE, /*transpose=*/ true);
-    if( mWeakEBCs )
-    { this->enforceWeakEssentialAdjointBoundaryConditions(aDatabase); }
-    else
-    { this->enforceStrongEssentialAdjointBoundaryConditions(mJacobianState, tGradientState); }
     // solve adjoint system of equations
+    Plato::ScalarMultiVector tRHS(tGradientState.data(), 1, tGradientState.extent(0));
+    this->solveAdjointSystems(aDatabase, mAdjoints, tRHS);
     constexpr size_t tCYCLE_INDEX = 0;
     Plato::ScalarVector tMyAdjoints = Kokkos::subview(mAdjoints, tCYCLE_INDEX, Kokkos::ALL());
-    mSolver->solve(*mJacobianState, tMyAdjoints, tGradientState, /*isAdjointSolve=*/ true);
     // compute jacobian with respect to control variables
     auto tJacobianControl = mResidualEvaluator->jacobianControl(aDatabase, tCYCLE, /*transpose=*/ true);
     // compute gradient with respect to design variables
@@ -472,16 +482,11 @@ computeCriterionGradientConfig(
     // compute gradient with respect to state variables
     auto tGradientState = aCriterion->gradientState(aDatabase, tCYCLE);
     Plato::blas1::scale(static_cast<Plato::Scalar>(-1), tGradientState);
-    // compute jacobian with respect to state variables
-    mJacobianState = mResidualEvaluator->jacobianState(aDatabase, tCYCLE, /*transpose=*/true);
-    if( mWeakEBCs )
-    { this->enforceWeakEssentialAdjointBoundaryConditions(aDatabase); }
-    else
-    { this->enforceStrongEssentialAdjointBoundaryConditions(mJacobianState, tGradientState); }
     // solve adjoint system of equations
+    Plato::ScalarMultiVector tRHS(tGradientState.data(), 1, tGradientState.extent(0));
+    this->solveAdjointSystems(aDatabase, mAdjoints, tRHS);
     constexpr size_t tCYCLE_INDEX = 0;
     Plato::ScalarVector tMyAdjoints = Kokkos::subview(mAdjoints, tCYCLE_INDEX, Kokkos::ALL());
-    mSolver->solve(*mJacobianState, tMyAdjoints, tGradientState, /*isAdjointSolve=*/ true);
     // compute jacobian with respect to configuration variables
     auto tJacobianConfig = mResidualEvaluator->jacobianConfig(aDatabase, tCYCLE, /*transpose=*/ true);
     // compute gradient with respect to design variables: dgdx * adjoint + dfdx
@@ -490,6 +495,192 @@ computeCriterionGradientConfig(
   return tGradientConfig;
 }
 
+template<typename PhysicsType>
+std::vector<Plato::ScalarVector>
+Problem<PhysicsType>::
+criterionGradients(
+  const Plato::ScalarVector      & aControls,
+  const Plato::Solutions         & aSolution,
+  const std::vector<std::string> & aNames
+)
+{
+  return ( this->computeCriterionGradients(aControls, aNames, Plato::partial::CONTROL) );
+}
+
+template<typename PhysicsType>
+std::vector<Plato::ScalarVector>
+Problem<PhysicsType>::
+criterionGradientsX(
+  const Plato::ScalarVector      & aControls,
+  const Plato::Solutions         & aSolution,
+  const std::vector<std::string> & aNames
+)
+{
+  return ( this->computeCriterionGradients(aControls, aNames, Plato::partial::CONFIGURATION) );
+}
+
+template<typename PhysicsType>
+std::vector<Plato::ScalarVector>
+Problem<PhysicsType>::
+computeCriterionGradients(
+  const Plato::ScalarVector          & aControls,
+  const std::vector<std::string>     & aNames,
+        Plato::partial::derivative_t   aPartial
+)
+{
+  for(const auto& tName : aNames)
+  {
+    if( mCriterionEvaluator.find(tName) == mCriterionEvaluator.end() )
+    {
+      auto tErrMsg = this->getErrorMsg(tName);
+      ANALYZE_THROWERR(tErrMsg)
+    }
+  }
+  // build database
+  Plato::Database tDatabase;
+  this->buildDatabase(aControls,tDatabase);
+  // compute criteria contributions to the gradients
+  constexpr Plato::Scalar tCYCLE = 0.0;
+  std::vector<Plato::ScalarVector> tGradients;
+  std::vector<size_t> tNonlinear;
+  for(size_t tIndex = 0; tIndex < aNames.size(); tIndex++)
+  {
+    auto & tCriterion = mCriterionEvaluator.at(aNames[tIndex]);
+    if( aPartial == Plato::partial::CONTROL )
+    { tGradients.push_back(tCriterion->gradientControl(tDatabase, tCYCLE)); }
+    else
+    { tGradients.push_back(tCriterion->gradientConfig(tDatabase, tCYCLE)); }
+    if( !tCriterion->isLinear() )
+    { tNonlinear.push_back(tIndex); }
+  }
+  if( tNonlinear.empty() )
+  { return tGradients; }
+
+  // assemble adjoint right-hand sides, one row per nonlinear criterion
+  const auto tNumDofs = mResidualEvaluator->numDofs();
+  const Plato::OrdinalType tNumRHS = tNonlinear.size();
+  Plato::ScalarMultiVector tRHS("Adjoint RHS", tNumRHS, tNumDofs);
+  for(Plato::OrdinalType tRow = 0; tRow < tNumRHS; tRow++)
+  {
+    auto tGradientState = mCriterionEvaluator.at(aNames[tNonlinear[tRow]])->gradientState(tDatabase, tCYCLE);
+    Plato::ScalarVector tMyRHS = Kokkos::subview(tRHS, tRow, Kokkos::ALL());
+    Plato::blas1::update(static_cast<Plato::Scalar>(-1), tGradientState, static_cast<Plato::Scalar>(0), tMyRHS);
+  }
+  // solve all adjoint systems of equations in one pass
+  Plato::ScalarMultiVector tAdjoints("Adjoint Variables", tNumRHS, tNumDofs);
+  this->solveAdjointSystems(tDatabase, tAdjoints, tRHS);
+  // compute jacobian with respect to design variables once for all criteria
+  auto tJacobian = aPartial == Plato::partial::CONTROL ?
+    mResidualEvaluator->jacobianControl(tDatabase, tCYCLE, /*transpose=*/ true) :
+    mResidualEvaluator->jacobianConfig(tDatabase, tCYCLE, /*transpose=*/ true);
+  for(Plato::OrdinalType tRow = 0; tRow < tNumRHS; tRow++)
+  {
+    Plato::ScalarVector tMyAdjoints = Kokkos::subview(tAdjoints, tRow, Kokkos::ALL());
+    Plato::MatrixTimesVectorPlusVector(tJacobian, tMyAdjoints, tGradients[tNonlinear[tRow]]);
+  }
+  return tGradients;
+}
+
+template<typename PhysicsType>
+bool
+Problem<PhysicsType>::
+hasLinearMaterialModels(
+  Teuchos::ParameterList & aParamList
+) const
+{
+  if( !aParamList.isSublist("Material Models") )
+  { return true; }
+  auto & tMaterialModels = aParamList.sublist("Material Models");
+  for(const auto & tDomain : mSpatialModel.Domains)
+  {
+    auto tMaterialName = tDomain.getMaterialName();
+    if( !tMaterialModels.isSublist(tMaterialName) )
+    { continue; }
+    auto & tMaterial = tMaterialModels.sublist(tMaterialName);
+    for(auto tIndex = tMaterial.begin(); tIndex != tMaterial.end(); ++tIndex)
+    {
+      if( !tMaterial.entry(tIndex).isList() )
+      { continue; }
+      auto & tModel = tMaterial.sublist(tMaterial.name(tIndex));
+      if( Plato::materialModelType(tModel) != Plato::MaterialModelType::Linear )
+      { return false; }
+    }
+  }
+  return true;
+}
+
+template<typename PhysicsType>
+bool
+Problem<PhysicsType>::
+isOperatorReusable(
+  const Plato::ScalarVector & aControls
+) const
+{
+  if( !mReusableOperator || mReusableControls.extent(0) != aControls.extent(0) )
+  { return false; }
+  auto tControls = aControls;
+  auto tReusableControls = mReusableControls;
+  Plato::OrdinalType tNumChanged = 0;
+  Kokkos::parallel_reduce("compare controls", Kokkos::RangePolicy<>(0, tControls.extent(0)),
+    KOKKOS_LAMBDA(const Plato::OrdinalType & aOrdinal, Plato::OrdinalType & aNumChanged)
+  {
+    if( tControls(aOrdinal) != tReusableControls(aOrdinal) ) { aNumChanged++; }
+  }, tNumChanged);
+  return tNumChanged == 0;
+}
+
+template<typename PhysicsType>
+void
+Problem<PhysicsType>::
+solveAdjointSystems(
+  Plato::Database          & aDatabase,
+  Plato::ScalarMultiVector & aAdjoints,
+  Plato::ScalarMultiVector & aRHS
+)
+{
+  // rows of aRHS whose essential dofs still need zeroing
+  Plato::OrdinalType tFirstUnconstrainedRow = 0;
+  if( this->isOperatorReusable(aDatabase.vector("controls")) )
+  {
+    // the operator is self-adjoint and already constrained by the forward solve, so the
+    // solver can reuse its factorization or preconditioner
+    mSolver->reuseOperator();
+  }
+  else
+  {
+    constexpr Plato::Scalar tCYCLE = 0.0;
+    mJacobianState = mResidualEvaluator->jacobianState(aDatabase, tCYCLE, /*transpose=*/ true);
+    mReusableOperator = false;
+    if( mWeakEBCs )
+    {
+      this->enforceWeakEssentialAdjointBoundaryConditions(aDatabase);
+      tFirstUnconstrainedRow = aRHS.extent(0);
+    }
+    else
+    {
+      Plato::ScalarVector tFirstRHS = Kokkos::subview(aRHS, 0, Kokkos::ALL());
+      this->enforceStrongEssentialAdjointBoundaryConditions(mJacobianState, tFirstRHS);
+      tFirstUnconstrainedRow = 1;
+    }
+  }
+  // the adjoint essential values are zero, so once the operator is constrained the
+  // remaining right-hand sides only need their essential dofs zeroed
+  const Plato::OrdinalType tNumRHS = aRHS.extent(0);
+  if( tFirstUnconstrainedRow < tNumRHS )
+  {
+    auto tRHS = aRHS;
+    auto tDirichletDofs = mDirichletDofs;
+    const Plato::OrdinalType tNumDirichletDofs = tDirichletDofs.extent(0);
+    Kokkos::parallel_for("zero adjoint essential dofs",
+      Kokkos::MDRangePolicy<Kokkos::Rank<2>>({tFirstUnconstrainedRow, 0}, {tNumRHS, tNumDirichletDofs}),
+      KOKKOS_LAMBDA(const Plato::OrdinalType & aRow, const Plato::OrdinalType & aDof)
+    {
+      tRHS(aRow, tDirichletDofs(aDof)) = 0.0;
+    });
+  }
+  mSolver->solve(*mJacobianState, aAdjoints, aRHS, /*isAdjointSolve=*/ true);
+}
+
 template<typename PhysicsType>
 void Problem<PhysicsType>::
 readEssentialBoundaryConditions(
@@ -501,6 +692,7 @@ readEssentialBoundaryConditions(
   Plato::EssentialBCs<ElementType>
   tEssentialBoundaryConditions(aParamList.sublist("Essential Boundary Conditions", false), mSpatialModel.Mesh);
   tEssentialBoundaryConditions.get(mDirichletDofs, mDirichletStateVals);
+  mReusableOperator = false;
   
   if(aParamList.isType<bool>("Weak Essential Boundary Conditions"))
   { mWeakEBCs = aParamList.get<bool>("Weak Essential Boundary Conditions",false); }
@@ -524,6 +716,7 @@ setEssentialBoundaryConditions(
   }
   mDirichletDofs = aDofs;
   mDirichletStateVals = aValues;
+  mReusableOperator = false;
 }
 
 template<typename PhysicsType>
@@ -32,6 +32,17 @@ public:
     const Plato::Scalar   & aCycle
   ) = 0;
 
+  /// @fn postProcess
+  /// @brief compute output quantities of interest at a converged state
+  /// @param [in] aDatabase function domain and range database
+  /// @param [in] aCycle    scalar, e.g.; time step
+  virtual
+  void
+  postProcess(
+    const Plato::Database & aDatabase,
+    const Plato::Scalar   & aCycle
+  ) = 0;
+
   /// @fn jacobianState
   /// @brief evaluate jacobian with respect to states
   /// @param [in] aDatabase  function domain and range database
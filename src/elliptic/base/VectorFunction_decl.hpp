@@ -12,6 +12,7 @@
 
 #include "Solutions.hpp"
 #include "SpatialModel.hpp"
+#include "BlockMatrixCache.hpp"
 #include "base/Database.hpp"
 #include "base/WorksetBase.hpp"
 #include "base/ResidualBase.hpp"
@@ -66,6 +67,14 @@ private:
   const Plato::SpatialModel & mSpatialModel;
   /// @brief interface to workset constructors 
   Plato::WorksetBase<ElementType> mWorksetFuncs;
+  /// @brief persistent sparsity graph and recycled jacobian matrices
+  Plato::BlockMatrixCache mMatrixCache;
+  /// @brief maximum number of cells per domain workset, zero evaluates each domain in one workset
+  Plato::OrdinalType mCellBatchSize;
+  /// @brief cells of the worksets passed to boundary evaluators
+  Plato::SpatialDomain mBoundaryDomain;
+  /// @brief true if boundary worksets only hold the parent cells of loaded side sets
+  bool mBoundaryCellsOnly;
 
 public:
   /// @brief class constructor
@@ -159,6 +168,17 @@ public:
     const Plato::Scalar   & aCycle
   );
 
+  /// @fn postProcess
+  /// @brief compute output quantities of interest at a converged state, only the
+  ///   residual (i.e., non-AD) evaluators are called
+  /// @param [in] aDatabase function domain and range database
+  /// @param [in] aCycle    scalar, e.g.; time step
+  void
+  postProcess(
+    const Plato::Database & aDatabase,
+    const Plato::Scalar   & aCycle
+  );
+
   /// @fn jacobianState
   /// @brief return jacobian with respect to states
   /// @param [in] aDatabase function domain and range database
@@ -197,6 +217,26 @@ public:
     const Plato::Scalar   & aCycle,
           bool              aTranspose = true
   );
+
+private:
+  /// @fn initializeBoundaryDomain
+  /// @brief set the cells of the boundary worksets.  If the boundary evaluators report
+  ///   their side sets, only the parent cells of these side sets are included; otherwise,
+  ///   all mesh cells are included.
+  void
+  initializeBoundaryDomain();
+
+  /// @fn evaluateBoundary
+  /// @brief evaluate boundary terms on the boundary worksets
+  /// @param [in]     aResidual boundary evaluator
+  /// @param [in,out] aWorksets domain and range workset database
+  /// @param [in]     aCycle    scalar, e.g.; time step
+  void
+  evaluateBoundary(
+    const std::shared_ptr<Plato::ResidualBase> & aResidual,
+          Plato::WorkSets                      & aWorksets,
+    const Plato::Scalar                        & aCycle
+  ) const;
 };
     
 } // namespace Elliptic
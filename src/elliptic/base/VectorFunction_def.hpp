@@ -7,7 +7,9 @@
 #pragma once
 
 #include "WorkSets.hpp"
+#include "ParseTools.hpp"
 #include "ImplicitFunctors.hpp"
+#include "ElementColoring.hpp"
 #include "elliptic/base/WorksetBuilder.hpp"
 
 namespace Plato
@@ -26,8 +28,19 @@ VectorFunction(
 ) :
   mSpatialModel(aSpatialModel),
   mWorksetFuncs(aSpatialModel.Mesh),
-  mDataMap     (aDataMap)
+  mMatrixCache (aSpatialModel.Mesh),
+  mDataMap     (aDataMap),
+  mCellBatchSize(Plato::ParseTools::getSubParam<int>(aProbParams, "Assembly", "Cell Batch Size", 0)),
+  mBoundaryDomain(aSpatialModel.Mesh, aDataMap, "Boundary Cells"),
+  mBoundaryCellsOnly(false)
 {
+  mMatrixCache.useScatterMap(
+    Plato::ParseTools::getSubParam<bool>(aProbParams, "Assembly", "Precompute Scatter Map", false)
+  );
+  if(Plato::ParseTools::getSubParam<bool>(aProbParams, "Assembly", "Colored Assembly", false))
+  {
+    mWorksetFuncs.setElementColoring(std::make_shared<Plato::ElementColoring>(aSpatialModel.Mesh));
+  }
   typename PhysicsType::FunctionFactory tFactoryResidual;
   for(const auto& tDomain : mSpatialModel.Domains)
   {
@@ -41,6 +54,49 @@ VectorFunction(
     mJacobiansX[tName] = 
       tFactoryResidual.template createVectorFunction<JacobianXEvalType>(tDomain, aDataMap, aProbParams, aType);
   }
+  this->initializeBoundaryDomain();
+}
+
+template<typename PhysicsType>
+void
+VectorFunction<PhysicsType>::
+initializeBoundaryDomain()
+{
+  // boundary terms are evaluated by the first domain's evaluators
+  std::vector<std::string> tSideSetNames;
+  auto tFirstBlockName = mSpatialModel.Domains.front().getDomainName();
+  mBoundaryCellsOnly = mResiduals.at(tFirstBlockName)->getBoundarySideSets(tSideSetNames);
+  if(mBoundaryCellsOnly)
+  {
+    mBoundaryDomain.cellOrdinals(mSpatialModel.sideSetCells(tSideSetNames));
+  }
+  else
+  {
+    Plato::OrdinalVector tCellOrdinals("mesh cells", mSpatialModel.Mesh->NumElements());
+    Kokkos::parallel_for("mesh cells", Kokkos::RangePolicy<>(0, tCellOrdinals.extent(0)),
+    KOKKOS_LAMBDA(const Plato::OrdinalType & aCellOrdinal)
+    {
+      tCellOrdinals(aCellOrdinal) = aCellOrdinal;
+    });
+    mBoundaryDomain.cellOrdinals(tCellOrdinals);
+  }
+}
+
+template<typename PhysicsType>
+void
+VectorFunction<PhysicsType>::
+evaluateBoundary(
+  const std::shared_ptr<Plato::ResidualBase> & aResidual,
+        Plato::WorkSets                      & aWorksets,
+  const Plato::Scalar                        & aCycle
+) const
+{
+  if(mBoundaryCellsOnly)
+  {
+    mSpatialModel.setBoundaryWorksetCells(mBoundaryDomain.cellOrdinals());
+  }
+  aResidual->evaluateBoundary(mSpatialModel, aWorksets, aCycle);
+  mSpatialModel.clearBoundaryWorksetCells();
 }
 
 template<typename PhysicsType>
@@ -149,39 +205,77 @@ value(
   // internal forces
   for(const auto& tDomain : mSpatialModel.Domains)
   {
-    // build residual domain worksets
-    Plato::WorkSets tWorksets;
-    tWorksetBuilder.build(tDomain, aDatabase, tWorksets);
-    // build residual range workset
-    auto tNumCells = tDomain.numCells();
-    auto tResultWS = std::make_shared< Plato::MetaData< Plato::ScalarMultiVectorT<ResultScalarType> > >
-      ( Plato::ScalarMultiVectorT<ResultScalarType>("Result Workset", tNumCells, mNumDofsPerCell) );
-    tWorksets.set("result", tResultWS);
-    // evaluate internal forces
-    auto tName = tDomain.getDomainName();
-    mResiduals.at(tName)->evaluate( tWorksets, aCycle );
-    // assemble to return view
-    mWorksetFuncs.assembleResidual(tResultWS->mData, tResidual, tDomain );
+    Plato::DomainCellBatches tBatches(tDomain, mCellBatchSize);
+    for(Plato::OrdinalType tBatch = 0; tBatch < tBatches.size(); tBatch++)
+    {
+      tBatches.select(tBatch);
+      // build residual domain worksets
+      Plato::WorkSets tWorksets;
+      tWorksetBuilder.build(tDomain, aDatabase, tWorksets);
+      // build residual range workset
+      auto tNumCells = tDomain.numCells();
+      auto tResultWS = std::make_shared< Plato::MetaData< Plato::ScalarMultiVectorT<ResultScalarType> > >
+        ( Plato::ScalarMultiVectorT<ResultScalarType>("Result Workset", tNumCells, mNumDofsPerCell) );
+      tWorksets.set("result", tResultWS);
+      // evaluate internal forces
+      auto tName = tDomain.getDomainName();
+      mResiduals.at(tName)->evaluate( tWorksets, aCycle );
+      // assemble to return view
+      mWorksetFuncs.assembleResidual(tResultWS->mData, tResidual, tDomain );
+    }
   }
   // prescribed boundary conditions
+  if(mBoundaryDomain.numCells() > 0)
   {
     // build residual domain worksets
     Plato::WorkSets tWorksets;
-    auto tNumCells = mSpatialModel.Mesh->NumElements();
-    tWorksetBuilder.build(tNumCells, aDatabase, tWorksets);
+    tWorksetBuilder.build(mBoundaryDomain, aDatabase, tWorksets);
+    auto tNumCells = mBoundaryDomain.numCells();
     // build residual range workset
     auto tResultWS = std::make_shared< Plato::MetaData< Plato::ScalarMultiVectorT<ResultScalarType> > >
       ( Plato::ScalarMultiVectorT<ResultScalarType>("Result Workset", tNumCells, mNumDofsPerCell) );
     tWorksets.set("result", tResultWS);
     // evaluate prescribed forces
     auto tFirstBlockName = mSpatialModel.Domains.front().getDomainName();
-    mResiduals.at(tFirstBlockName)->evaluateBoundary(mSpatialModel, tWorksets, aCycle );
+    this->evaluateBoundary(mResiduals.at(tFirstBlockName), tWorksets, aCycle);
     // create and assemble to return view
-    mWorksetFuncs.assembleResidual(tResultWS->mData, tResidual);
+    mWorksetFuncs.assembleResidual(tResultWS->mData, tResidual, mBoundaryDomain);
   }
   return tResidual;
 }
 
+template<typename PhysicsType>
+void
+VectorFunction<PhysicsType>::
+postProcess(
+  const Plato::Database & aDatabase,
+  const Plato::Scalar   & aCycle
+)
+{
+  // set local result workset scalar type
+  using ResultScalarType  = typename ResidualEvalType::ResultScalarType;
+  Plato::Elliptic::WorksetBuilder<ResidualEvalType> tWorksetBuilder(mWorksetFuncs);
+  for(const auto& tDomain : mSpatialModel.Domains)
+  {
+    Plato::DomainCellBatches tBatches(tDomain, mCellBatchSize);
+    for(Plato::OrdinalType tBatch = 0; tBatch < tBatches.size(); tBatch++)
+    {
+      tBatches.select(tBatch);
+      // build residual domain worksets
+      Plato::WorkSets tWorksets;
+      tWorksetBuilder.build(tDomain, aDatabase, tWorksets);
+      // build residual range workset, only used by residuals evaluated in this stage
+      auto tNumCells = tDomain.numCells();
+      auto tResultWS = std::make_shared< Plato::MetaData< Plato::ScalarMultiVectorT<ResultScalarType> > >
+        ( Plato::ScalarMultiVectorT<ResultScalarType>("Result Workset", tNumCells, mNumDofsPerCell) );
+      tWorksets.set("result", tResultWS);
+      // compute output quantities of interest
+      auto tName = tDomain.getDomainName();
+      mResiduals.at(tName)->postProcess( tWorksets, aCycle );
+    }
+  }
+}
+
 template<typename PhysicsType>
 Teuchos::RCP<Plato::CrsMatrixType>
 VectorFunction<PhysicsType>::
@@ -196,48 +290,54 @@ jacobianState(
   // create return Jacobian
   auto tMesh = mSpatialModel.Mesh;
   Teuchos::RCP<Plato::CrsMatrixType> tJacobianU =
-          Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumDofsPerNode, mNumDofsPerNode>( tMesh );
+          mMatrixCache.matrix<mNumDofsPerNode, mNumDofsPerNode>();
   Plato::Elliptic::WorksetBuilder<JacobianUEvalType> tWorksetBuilder(mWorksetFuncs);
   // internal forces
   for(const auto& tDomain : mSpatialModel.Domains)
   {
-    // build jacobian domain worksets
-    Plato::WorkSets tWorksets;
-    tWorksetBuilder.build(tDomain, aDatabase, tWorksets);
-    // build jacobian range workset
-    auto tNumCells = tDomain.numCells();
-    auto tResultWS = std::make_shared< Plato::MetaData< Plato::ScalarMultiVectorT<ResultScalarType> > >
-      ( Plato::ScalarMultiVectorT<ResultScalarType>("Result Workset", tNumCells, mNumDofsPerCell) );
-    tWorksets.set("result", tResultWS);
-    // evaluate internal forces
-    auto tName = tDomain.getDomainName();
-    mJacobiansU.at(tName)->evaluate(tWorksets, aCycle);
-    // assembly to return Jacobian
-    Plato::BlockMatrixEntryOrdinal<mNumNodesPerCell, mNumDofsPerNode, mNumDofsPerNode>
-      tJacEntryOrdinal( tJacobianU, tMesh );
-    auto tJacEntries = tJacobianU->entries();
-    mWorksetFuncs.assembleJacobianFad(
-      mNumDofsPerCell,mNumDofsPerCell,tJacEntryOrdinal,tResultWS->mData,tJacEntries,tDomain
-    );
+    Plato::DomainCellBatches tBatches(tDomain, mCellBatchSize);
+    for(Plato::OrdinalType tBatch = 0; tBatch < tBatches.size(); tBatch++)
+    {
+      tBatches.select(tBatch);
+      // build jacobian domain worksets
+      Plato::WorkSets tWorksets;
+      tWorksetBuilder.build(tDomain, aDatabase, tWorksets);
+      // build jacobian range workset
+      auto tNumCells = tDomain.numCells();
+      auto tResultWS = std::make_shared< Plato::MetaData< Plato::ScalarMultiVectorT<ResultScalarType> > >
+        ( Plato::ScalarMultiVectorT<ResultScalarType>("Result Workset", tNumCells, mNumDofsPerCell) );
+      tWorksets.set("result", tResultWS);
+      // evaluate internal forces
+      auto tName = tDomain.getDomainName();
+      mJacobiansU.at(tName)->evaluate(tWorksets, aCycle);
+      // assembly to return Jacobian
+      Plato::BlockMatrixEntryOrdinal<mNumNodesPerCell, mNumDofsPerNode, mNumDofsPerNode>
+        tJacEntryOrdinal( tJacobianU, tMesh, mMatrixCache.scatterMap<mNumNodesPerCell>() );
+      auto tJacEntries = tJacobianU->entries();
+      mWorksetFuncs.assembleJacobianFad(
+        mNumDofsPerCell,mNumDofsPerCell,tJacEntryOrdinal,tResultWS->mData,tJacEntries,tDomain
+      );
+    }
   }
   // prescribed forces
+  if(mBoundaryDomain.numCells() > 0)
   {
     // build jacobian domain worksets
     Plato::WorkSets tWorksets;
-    auto tNumCells = mSpatialModel.Mesh->NumElements();
-    tWorksetBuilder.build(tNumCells, aDatabase, tWorksets);
+    tWorksetBuilder.build(mBoundaryDomain, aDatabase, tWorksets);
+    auto tNumCells = mBoundaryDomain.numCells();
     // build jacobian range workset
     auto tResultWS = std::make_shared< Plato::MetaData< Plato::ScalarMultiVectorT<ResultScalarType> > >
       ( Plato::ScalarMultiVectorT<ResultScalarType>("Result Workset", tNumCells, mNumDofsPerCell) );
     tWorksets.set("result", tResultWS);
     // evaluate prescribed forces
     auto tFirstBlockName = mSpatialModel.Domains.front().getDomainName();
-    mJacobiansU.at(tFirstBlockName)->evaluateBoundary(mSpatialModel, tWorksets, aCycle );
+    this->evaluateBoundary(mJacobiansU.at(tFirstBlockName), tWorksets, aCycle);
     // assembly to return matrix
-    Plato::BlockMatrixEntryOrdinal<mNumNodesPerCell, mNumDofsPerNode, mNumDofsPerNode> tJacEntryOrdinal( tJacobianU, tMesh );
+    Plato::BlockMatrixEntryOrdinal<mNumNodesPerCell, mNumDofsPerNode, mNumDofsPerNode> tJacEntryOrdinal( tJacobianU, tMesh, mMatrixCache.scatterMap<mNumNodesPerCell>() );
     auto tJacEntries = tJacobianU->entries();
     mWorksetFuncs.assembleJacobianFad(
-      mNumDofsPerCell, mNumDofsPerCell,tJacEntryOrdinal,tResultWS->mData,tJacEntries
+      mNumDofsPerCell, mNumDofsPerCell,tJacEntryOrdinal,tResultWS->mData,tJacEntries,mBoundaryDomain
     );
   }
   return tJacobianU;
@@ -258,68 +358,74 @@ jacobianConfig(
   auto tMesh = mSpatialModel.Mesh;
   Teuchos::RCP<Plato::CrsMatrixType> tJacobianX;
   if(aTranspose)
-  { tJacobianX = Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumSpatialDims, mNumDofsPerNode>(tMesh); }
+  { tJacobianX = mMatrixCache.matrix<mNumSpatialDims, mNumDofsPerNode>(); }
   else
-  { tJacobianX = Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumDofsPerNode, mNumSpatialDims>(tMesh); }
+  { tJacobianX = mMatrixCache.matrix<mNumDofsPerNode, mNumSpatialDims>(); }
   Plato::Elliptic::WorksetBuilder<JacobianXEvalType> tWorksetBuilder(mWorksetFuncs);
   // internal forces
   for(const auto& tDomain : mSpatialModel.Domains)
   {
-    // build jacobian domain worksets
-    Plato::WorkSets tWorksets;
-    tWorksetBuilder.build(tDomain, aDatabase, tWorksets);
-    // build jacobian range workset
-    auto tNumCells = tDomain.numCells();
-    auto tResultWS = std::make_shared< Plato::MetaData< Plato::ScalarMultiVectorT<ResultScalarType> > >
-      ( Plato::ScalarMultiVectorT<ResultScalarType>("Result Workset", tNumCells, mNumDofsPerCell) );
-    tWorksets.set("result", tResultWS);
-    // evaluate internal forces
-    auto tName     = tDomain.getDomainName();
-    mJacobiansX.at(tName)->evaluate(tWorksets, aCycle);
-    // assembly to return matrix
-    Plato::BlockMatrixEntryOrdinal<mNumNodesPerCell, mNumSpatialDims, mNumDofsPerNode>
-      tJacEntryOrdinal(tJacobianX, tMesh);
-    auto tJacEntries = tJacobianX->entries();
-    if(aTranspose)
-    { 
-      mWorksetFuncs.assembleTransposeJacobian(
-        mNumDofsPerCell, mNumConfigDofsPerCell, tJacEntryOrdinal, tResultWS->mData, tJacEntries, tDomain
-      ); 
-    }
-    else
-    { 
-      mWorksetFuncs.assembleJacobianFad(
-        mNumDofsPerCell, mNumConfigDofsPerCell, tJacEntryOrdinal, tResultWS->mData, tJacEntries, tDomain
-      ); 
+    Plato::DomainCellBatches tBatches(tDomain, mCellBatchSize);
+    for(Plato::OrdinalType tBatch = 0; tBatch < tBatches.size(); tBatch++)
+    {
+      tBatches.select(tBatch);
+      // build jacobian domain worksets
+      Plato::WorkSets tWorksets;
+      tWorksetBuilder.build(tDomain, aDatabase, tWorksets);
+      // build jacobian range workset
+      auto tNumCells = tDomain.numCells();
+      auto tResultWS = std::make_shared< Plato::MetaData< Plato::ScalarMultiVectorT<ResultScalarType> > >
+        ( Plato::ScalarMultiVectorT<ResultScalarType>("Result Workset", tNumCells, mNumDofsPerCell) );
+      tWorksets.set("result", tResultWS);
+      // evaluate internal forces
+      auto tName     = tDomain.getDomainName();
+      mJacobiansX.at(tName)->evaluate(tWorksets, aCycle);
+      // assembly to return matrix
+      Plato::BlockMatrixEntryOrdinal<mNumNodesPerCell, mNumSpatialDims, mNumDofsPerNode>
+        tJacEntryOrdinal( tJacobianX, tMesh, mMatrixCache.scatterMap<mNumNodesPerCell>() );
+      auto tJacEntries = tJacobianX->entries();
+      if(aTranspose)
+      { 
+        mWorksetFuncs.assembleTransposeJacobian(
+          mNumDofsPerCell, mNumConfigDofsPerCell, tJacEntryOrdinal, tResultWS->mData, tJacEntries, tDomain
+        ); 
+      }
+      else
+      { 
+        mWorksetFuncs.assembleJacobianFad(
+          mNumDofsPerCell, mNumConfigDofsPerCell, tJacEntryOrdinal, tResultWS->mData, tJacEntries, tDomain
+        ); 
+      }
     }
   }
   // prescribed forces
+  if(mBoundaryDomain.numCells() > 0)
   {
     // build jacobian domain worksets
     Plato::WorkSets tWorksets;
-    auto tNumCells = mSpatialModel.Mesh->NumElements();
-    tWorksetBuilder.build(tNumCells, aDatabase, tWorksets);
+    tWorksetBuilder.build(mBoundaryDomain, aDatabase, tWorksets);
+    auto tNumCells = mBoundaryDomain.numCells();
     // build jacobian range workset
     auto tResultWS = std::make_shared< Plato::MetaData< Plato::ScalarMultiVectorT<ResultScalarType> > >
       ( Plato::ScalarMultiVectorT<ResultScalarType>("Result Workset", tNumCells, mNumDofsPerCell) );
     tWorksets.set("result", tResultWS);
     // evaluate prescribed forces
     auto tFirstBlockName = mSpatialModel.Domains.front().getDomainName();
-    mJacobiansX.at(tFirstBlockName)->evaluateBoundary(mSpatialModel, tWorksets, aCycle );
+    this->evaluateBoundary(mJacobiansX.at(tFirstBlockName), tWorksets, aCycle);
     // assembly to return matrix
     Plato::BlockMatrixEntryOrdinal<mNumNodesPerCell, mNumSpatialDims, mNumDofsPerNode>
-      tJacEntryOrdinal(tJacobianX, tMesh);
+      tJacEntryOrdinal( tJacobianX, tMesh, mMatrixCache.scatterMap<mNumNodesPerCell>() );
     auto tJacEntries = tJacobianX->entries();
     if(aTranspose)
     { 
       mWorksetFuncs.assembleTransposeJacobian(
-        mNumDofsPerCell, mNumConfigDofsPerCell, tJacEntryOrdinal, tResultWS->mData, tJacEntries
+        mNumDofsPerCell, mNumConfigDofsPerCell, tJacEntryOrdinal, tResultWS->mData, tJacEntries, mBoundaryDomain
       ); 
     }
     else
     { 
       mWorksetFuncs.assembleJacobianFad(
-        mNumDofsPerCell, mNumConfigDofsPerCell, tJacEntryOrdinal, tResultWS->mData, tJacEntries
+        mNumDofsPerCell, mNumConfigDofsPerCell, tJacEntryOrdinal, tResultWS->mData, tJacEntries, mBoundaryDomain
       ); 
     }
   }
@@ -340,65 +446,71 @@ jacobianControl
   auto tMesh = mSpatialModel.Mesh;
   Teuchos::RCP<Plato::CrsMatrixType> tJacobianZ;
   if(aTranspose)
-  { tJacobianZ = Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumControlDofsPerNode, mNumDofsPerNode>( tMesh ); }
+  { tJacobianZ = mMatrixCache.matrix<mNumControlDofsPerNode, mNumDofsPerNode>(); }
   else
-  { tJacobianZ = Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumDofsPerNode, mNumControlDofsPerNode>( tMesh ); }
+  { tJacobianZ = mMatrixCache.matrix<mNumDofsPerNode, mNumControlDofsPerNode>(); }
   Plato::Elliptic::WorksetBuilder<JacobianZEvalType> tWorksetBuilder(mWorksetFuncs);
   // internal forces
   for(const auto& tDomain : mSpatialModel.Domains)
   {
-    // build jacobian domain worksets
-    Plato::WorkSets tWorksets;
-    tWorksetBuilder.build(tDomain, aDatabase, tWorksets);
-    // build jacobian range workset
-    auto tNumCells = tDomain.numCells();
-    auto tResultWS = std::make_shared< Plato::MetaData< Plato::ScalarMultiVectorT<ResultScalarType> > >
-        ( Plato::ScalarMultiVectorT<ResultScalarType>("Result Workset", tNumCells, mNumDofsPerCell) );
-    tWorksets.set("result", tResultWS);
-    // evaluate internal forces
-    auto tName = tDomain.getDomainName();
-    mJacobiansZ.at(tName)->evaluate(tWorksets, aCycle);
-    // assembly to return matrix
-    Plato::BlockMatrixEntryOrdinal<mNumNodesPerCell, mNumControlDofsPerNode, mNumDofsPerNode> 
-      tJacEntryOrdinal( tJacobianZ, tMesh );
-    auto tJacEntries = tJacobianZ->entries();
-    if(aTranspose)
-    { 
-      mWorksetFuncs.assembleTransposeJacobian(
-        mNumDofsPerCell, mNumNodesPerCell, tJacEntryOrdinal, tResultWS->mData, tJacEntries, tDomain); 
-    }
-    else
-    { 
-      mWorksetFuncs.assembleJacobianFad(
-        mNumDofsPerCell, mNumNodesPerCell, tJacEntryOrdinal, tResultWS->mData, tJacEntries, tDomain); 
+    Plato::DomainCellBatches tBatches(tDomain, mCellBatchSize);
+    for(Plato::OrdinalType tBatch = 0; tBatch < tBatches.size(); tBatch++)
+    {
+      tBatches.select(tBatch);
+      // build jacobian domain worksets
+      Plato::WorkSets tWorksets;
+      tWorksetBuilder.build(tDomain, aDatabase, tWorksets);
+      // build jacobian range workset
+      auto tNumCells = tDomain.numCells();
+      auto tResultWS = std::make_shared< Plato::MetaData< Plato::ScalarMultiVectorT<ResultScalarType> > >
+          ( Plato::ScalarMultiVectorT<ResultScalarType>("Result Workset", tNumCells, mNumDofsPerCell) );
+      tWorksets.set("result", tResultWS);
+      // evaluate internal forces
+      auto tName = tDomain.getDomainName();
+      mJacobiansZ.at(tName)->evaluate(tWorksets, aCycle);
+      // assembly to return matrix
+      Plato::BlockMatrixEntryOrdinal<mNumNodesPerCell, mNumControlDofsPerNode, mNumDofsPerNode> 
+        tJacEntryOrdinal( tJacobianZ, tMesh, mMatrixCache.scatterMap<mNumNodesPerCell>() );
+      auto tJacEntries = tJacobianZ->entries();
+      if(aTranspose)
+      { 
+        mWorksetFuncs.assembleTransposeJacobian(
+          mNumDofsPerCell, mNumNodesPerCell, tJacEntryOrdinal, tResultWS->mData, tJacEntries, tDomain); 
+      }
+      else
+      { 
+        mWorksetFuncs.assembleJacobianFad(
+          mNumDofsPerCell, mNumNodesPerCell, tJacEntryOrdinal, tResultWS->mData, tJacEntries, tDomain); 
+      }
     }
   }
   // prescribed forces
+  if(mBoundaryDomain.numCells() > 0)
   {
     // build jacobian domain worksets
     Plato::WorkSets tWorksets;
-    auto tNumCells = mSpatialModel.Mesh->NumElements();
-    tWorksetBuilder.build(tNumCells, aDatabase, tWorksets);
+    tWorksetBuilder.build(mBoundaryDomain, aDatabase, tWorksets);
+    auto tNumCells = mBoundaryDomain.numCells();
     // build jacobian range workset
     auto tResultWS = std::make_shared< Plato::MetaData< Plato::ScalarMultiVectorT<ResultScalarType> > >
       ( Plato::ScalarMultiVectorT<ResultScalarType>("Result Workset", tNumCells, mNumDofsPerCell) );
     tWorksets.set("result", tResultWS);
     // evaluate prescribed forces
     auto tFirstBlockName = mSpatialModel.Domains.front().getDomainName();
-    mJacobiansZ.at(tFirstBlockName)->evaluateBoundary(mSpatialModel, tWorksets, aCycle );
+    this->evaluateBoundary(mJacobiansZ.at(tFirstBlockName), tWorksets, aCycle);
     // assembly to return matrix
     Plato::BlockMatrixEntryOrdinal<mNumNodesPerCell, mNumControlDofsPerNode, mNumDofsPerNode> 
-      tJacEntryOrdinal( tJacobianZ, tMesh );
+      tJacEntryOrdinal( tJacobianZ, tMesh, mMatrixCache.scatterMap<mNumNodesPerCell>() );
     auto tJacEntries = tJacobianZ->entries();
     if(aTranspose)
     { 
       mWorksetFuncs.assembleTransposeJacobian(
-        mNumDofsPerCell, mNumNodesPerCell, tJacEntryOrdinal, tResultWS->mData, tJacEntries); 
+        mNumDofsPerCell, mNumNodesPerCell, tJacEntryOrdinal, tResultWS->mData, tJacEntries, mBoundaryDomain); 
     }
     else
     { 
       mWorksetFuncs.assembleJacobianFad(
-        mNumDofsPerCell, mNumNodesPerCell, tJacEntryOrdinal, tResultWS->mData, tJacEntries); 
+        mNumDofsPerCell, mNumNodesPerCell, tJacEntryOrdinal, tResultWS->mData, tJacEntries, mBoundaryDomain); 
     }
   }
   return tJacobianZ;
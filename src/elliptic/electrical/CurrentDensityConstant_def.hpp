@@ -53,14 +53,15 @@ evaluate(
   auto tCubPoints  = ElementType::getCubPoints();
   auto tCubWeights = ElementType::getCubWeights();
   auto tNumPoints  = ElementType::mNumGaussPoints;
-  // output quantities of interest
+  // output quantities of interest, only computed by non-AD evaluations
   auto tNumCells = mSpatialDomain.numCells();
+  auto tNumOutputCells = Plato::storesOutput<ResultScalarType>() ? tNumCells : 0;
   Plato::ScalarVectorT<ConfigScalarType>      
-    tVolume("volume",tNumCells);
+    tVolume("volume",tNumOutputCells);
   Plato::ScalarMultiVectorT<GradScalarType>   
-    tElectricField("electrical field",tNumCells,ElementType::mNumSpatialDims);
+    tElectricField("electrical field",tNumOutputCells,ElementType::mNumSpatialDims);
   Plato::ScalarMultiVectorT<ResultScalarType>   
-    tCurrentDensity("current density",tNumCells,ElementType::mNumSpatialDims);
+    tCurrentDensity("current density",tNumOutputCells,ElementType::mNumSpatialDims);
   // evaluate internal forces
   Kokkos::parallel_for("evaluate electrostatics residual", 
     Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {tNumCells,tNumPoints}),
@@ -83,15 +84,17 @@ evaluate(
       }
     }
     // pre-process output quantities of interests  
-    tCellVolume *= tCubWeights(iGpOrdinal);
-    Kokkos::atomic_add(&tVolume(iCellOrdinal),tCellVolume);
-    for(Plato::OrdinalType tDim=0; tDim<ElementType::mNumSpatialDims; tDim++){
-      /*Kokkos::atomic_add(&tElectricField(iCellOrdinal,tDim),-1.0*tCellVolume*tCellElectricField(tDim));
-      Kokkos::atomic_add(&tCurrentDensity(iCellOrdinal,tDim), -1.0*tCellVolume*aResult(iCellOrdinal,iGpOrdinal,tDim));*/
-      Kokkos::atomic_add(&tElectricField(iCellOrdinal,tDim) , tCellVolume*tCellElectricField(tDim));
-      Kokkos::atomic_add(&tCurrentDensity(iCellOrdinal,tDim), tCellVolume*aResult(iCellOrdinal,iGpOrdinal,tDim));
+    if constexpr (Plato::storesOutput<ResultScalarType>())
+    {
+      tCellVolume *= tCubWeights(iGpOrdinal);
+      Kokkos::atomic_add(&tVolume(iCellOrdinal),tCellVolume);
+      for(Plato::OrdinalType tDim=0; tDim<ElementType::mNumSpatialDims; tDim++){
+        Kokkos::atomic_add(&tElectricField(iCellOrdinal,tDim) , tCellVolume*tCellElectricField(tDim));
+        Kokkos::atomic_add(&tCurrentDensity(iCellOrdinal,tDim), tCellVolume*aResult(iCellOrdinal,iGpOrdinal,tDim));
+      }
     }
   });
+  if constexpr (!Plato::storesOutput<ResultScalarType>()) { return; }
   
   // post-process output quantities of interests
   Kokkos::parallel_for("compute output quantities", 
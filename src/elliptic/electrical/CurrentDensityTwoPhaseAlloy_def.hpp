@@ -57,14 +57,15 @@ evaluate(
   Plato::ComputeGradientMatrix<ElementType> tComputeGradient;
   // create material penalty model
   Plato::MSIMP tSIMP(mPenaltyExponent,mMinErsatzMaterialValue);
-  // output quantities of interest
+  // output quantities of interest, only computed by non-AD evaluations
   auto tNumCells = mSpatialDomain.numCells();
+  auto tNumOutputCells = Plato::storesOutput<ResultScalarType>() ? tNumCells : 0;
   Plato::ScalarVectorT<ConfigScalarType>      
-    tVolume("volume",tNumCells);
+    tVolume("volume",tNumOutputCells);
   Plato::ScalarMultiVectorT<GradScalarType>   
-    tElectricField("electrical field",tNumCells,ElementType::mNumSpatialDims);
+    tElectricField("electrical field",tNumOutputCells,ElementType::mNumSpatialDims);
   Plato::ScalarMultiVectorT<ResultScalarType>   
-    tCurrentDensity("current density",tNumCells,ElementType::mNumSpatialDims);
+    tCurrentDensity("current density",tNumOutputCells,ElementType::mNumSpatialDims);
   // evaluate current density     
   auto tCubPoints  = ElementType::getCubPoints();
   auto tCubWeights = ElementType::getCubWeights();
@@ -97,13 +98,17 @@ evaluate(
       aResult(iCellOrdinal,iGpOrdinal,tDimI) = tValue;
     }
     // pre-process output quantities of interests  
-    tCellVolume *= tCubWeights(iGpOrdinal);
-    Kokkos::atomic_add(&tVolume(iCellOrdinal),tCellVolume);
-    for(Plato::OrdinalType tDim=0; tDim<ElementType::mNumSpatialDims; tDim++){
-      Kokkos::atomic_add(&tElectricField(iCellOrdinal,tDim),-1.0*tCellVolume*tCellElectricField(tDim));
-      Kokkos::atomic_add(&tCurrentDensity(iCellOrdinal,tDim), -1.0*tCellVolume*aResult(iCellOrdinal,iGpOrdinal,tDim));
+    if constexpr (Plato::storesOutput<ResultScalarType>())
+    {
+      tCellVolume *= tCubWeights(iGpOrdinal);
+      Kokkos::atomic_add(&tVolume(iCellOrdinal),tCellVolume);
+      for(Plato::OrdinalType tDim=0; tDim<ElementType::mNumSpatialDims; tDim++){
+        Kokkos::atomic_add(&tElectricField(iCellOrdinal,tDim),-1.0*tCellVolume*tCellElectricField(tDim));
+        Kokkos::atomic_add(&tCurrentDensity(iCellOrdinal,tDim), -1.0*tCellVolume*aResult(iCellOrdinal,iGpOrdinal,tDim));
+      }
     }
   });
+  if constexpr (!Plato::storesOutput<ResultScalarType>()) { return; }
 
   // post-process output quantities of interests
   Kokkos::parallel_for("compute output quantities", 
@@ -122,6 +122,20 @@ evaluateBoundary(
   }
 }
 
+template<typename EvaluationType>
+bool
+ResidualSteadyStateCurrent<EvaluationType>::
+getBoundarySideSets(
+  std::vector<std::string> & aSideSetNames
+) const
+{
+  if( mSurfaceLoads != nullptr )
+  {
+    mSurfaceLoads->appendSideSetNames(aSideSetNames);
+  }
+  return true;
+}
+
 template<typename EvaluationType>
 void 
 ResidualSteadyStateCurrent<EvaluationType>::
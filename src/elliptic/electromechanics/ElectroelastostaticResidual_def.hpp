@@ -108,12 +108,15 @@ evaluate(
   Plato::GeneralFluxDivergence  <ElementType, mNumDofsPerNode, EDofOffset> tEdispDivergence;
 
   auto tNumCells = mSpatialDomain.numCells();
-  Plato::ScalarVectorT<ConfigScalarType> tCellVolume("cell weight",tNumCells);
-  Plato::ScalarMultiVectorT<GradScalarType> tCellStrain("strain", tNumCells, mNumVoigtTerms);
-  Plato::ScalarMultiVectorT<GradScalarType> tCellEField("efield", tNumCells, mNumSpatialDims);
+  // output quantities are only computed by non-AD evaluations
+  const bool tComputeOutput = Plato::storesOutput<ResultScalarType>() && !mPlottable.empty();
+  auto tNumOutputCells = tComputeOutput ? tNumCells : 0;
+  Plato::ScalarVectorT<ConfigScalarType> tCellVolume("cell weight",tNumOutputCells);
+  Plato::ScalarMultiVectorT<GradScalarType> tCellStrain("strain", tNumOutputCells, mNumVoigtTerms);
+  Plato::ScalarMultiVectorT<GradScalarType> tCellEField("efield", tNumOutputCells, mNumSpatialDims);
 
-  Plato::ScalarMultiVectorT<ResultScalarType> tCellStress("stress", tNumCells, mNumVoigtTerms);
-  Plato::ScalarMultiVectorT<ResultScalarType> tCellEDisp ("edisp" , tNumCells, mNumSpatialDims);
+  Plato::ScalarMultiVectorT<ResultScalarType> tCellStress("stress", tNumOutputCells, mNumVoigtTerms);
+  Plato::ScalarMultiVectorT<ResultScalarType> tCellEDisp ("edisp" , tNumOutputCells, mNumSpatialDims);
 
   auto tNumPoints  = mNumGaussPoints;
   auto tCubPoints  = ElementType::getCubPoints();
@@ -149,18 +152,26 @@ evaluate(
     //
     tStressDivergence(iCellOrdinal, tResultWS, tStress, tGradient, tVolume);
     tEdispDivergence (iCellOrdinal, tResultWS, tEDisp,  tGradient, tVolume);
-    for(int i=0; i<mNumVoigtTerms; i++)
-    {
-      Kokkos::atomic_add(&tCellStrain(iCellOrdinal,i), tVolume*tStrain(i));
-      Kokkos::atomic_add(&tCellStress(iCellOrdinal,i), tVolume*tStress(i));
-    }
-    for(int i=0; i<mNumSpatialDims; i++)
+    if(tComputeOutput)
     {
-      Kokkos::atomic_add(&tCellEField(iCellOrdinal,i), tVolume*tEField(i));
-      Kokkos::atomic_add(&tCellEDisp(iCellOrdinal,i), tVolume*tEDisp(i));
+      for(int i=0; i<mNumVoigtTerms; i++)
+      {
+        Kokkos::atomic_add(&tCellStrain(iCellOrdinal,i), tVolume*tStrain(i));
+        Kokkos::atomic_add(&tCellStress(iCellOrdinal,i), tVolume*tStress(i));
+      }
+      for(int i=0; i<mNumSpatialDims; i++)
+      {
+        Kokkos::atomic_add(&tCellEField(iCellOrdinal,i), tVolume*tEField(i));
+        Kokkos::atomic_add(&tCellEDisp(iCellOrdinal,i), tVolume*tEDisp(i));
+      }
+      Kokkos::atomic_add(&tCellVolume(iCellOrdinal), tVolume);
     }
-    Kokkos::atomic_add(&tCellVolume(iCellOrdinal), tVolume);
   });
+  if( mBodyLoads != nullptr )
+  {
+    mBodyLoads->get( mSpatialDomain, tStateWS, tControlWS, tConfigWS, tResultWS, -1.0 );
+  }
+  if( !tComputeOutput ) { return; }
   Kokkos::parallel_for("compute cell quantities", Kokkos::RangePolicy<>(0, tNumCells),
   KOKKOS_LAMBDA(const Plato::OrdinalType iCellOrdinal)
   {
@@ -175,10 +186,6 @@ evaluate(
       tCellEDisp(iCellOrdinal,i) /= tCellVolume(iCellOrdinal);
     }
   });
-  if( mBodyLoads != nullptr )
-  {
-    mBodyLoads->get( mSpatialDomain, tStateWS, tControlWS, tConfigWS, tResultWS, -1.0 );
-  }
   if( std::count(mPlottable.begin(),mPlottable.end(),"strain") ) 
     toMap(mDataMap, tCellStrain, "strain", mSpatialDomain);
   if( std::count(mPlottable.begin(),mPlottable.end(),"efield") ) 
@@ -218,6 +225,24 @@ evaluateBoundary(
   }
 }
 
+template<typename EvaluationType, typename IndicatorFunctionType>
+bool
+ElectroelastostaticResidual<EvaluationType, IndicatorFunctionType>::
+getBoundarySideSets(
+  std::vector<std::string> & aSideSetNames
+) const
+{
+  if( mBoundaryLoads != nullptr )
+  {
+    mBoundaryLoads->appendSideSetNames(aSideSetNames);
+  }
+  if( mBoundaryCharges != nullptr )
+  {
+    mBoundaryCharges->appendSideSetNames(aSideSetNames);
+  }
+  return true;
+}
+
 } // namespace Elliptic
 
 } // namespace Plato
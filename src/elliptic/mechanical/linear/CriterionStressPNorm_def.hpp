@@ -5,7 +5,7 @@
 #include "SmallStrain.hpp"
 #include "LinearStress.hpp"
 #include "PlatoMeshExpr.hpp"
-#include "GradientMatrix.hpp"
+#include "GeometricFactors.hpp"
 
 namespace Plato
 {
@@ -83,7 +83,7 @@ evaluateConditional(
   using StrainScalarType = typename Plato::fad_type_t<ElementType, StateScalarType, ConfigScalarType>;
   Plato::ScalarMultiVectorT<ResultScalarType> tCellStress("stress", tNumCells, mNumVoigtTerms);
   Plato::ScalarVectorT<ConfigScalarType> tCellVolume("volume", tNumCells);
-  Plato::ComputeGradientMatrix<ElementType> computeGradient;
+  Plato::GeometricFactors<ElementType> computeGradient(mSpatialDomain, tConfigWS);
   Plato::SmallStrain<ElementType>           computeVoigtStrain;
   Plato::LinearStress<EvaluationType, ElementType> computeVoigtStress(mMaterialModel);
   auto applyWeighting = mApplyWeighting;
@@ -96,10 +96,9 @@ evaluateConditional(
     Plato::Array<mNumVoigtTerms, StrainScalarType> tStrain(0.0);
     Plato::Array<mNumVoigtTerms, ResultScalarType> tStress(0.0);
     auto tCubPoint = tCubPoints(iGpOrdinal);
-    computeGradient(iCellOrdinal, tCubPoint, tConfigWS, tGradient, tVolume);
+    computeGradient(iCellOrdinal, iGpOrdinal, tCubPoint, tConfigWS, tGradient, tVolume);
     computeVoigtStrain(iCellOrdinal, tStrain, tStateWS, tGradient);
     computeVoigtStress(tStress, tStrain);
-    tVolume *= tCubWeights(iGpOrdinal);
     tVolume *= tFxnValues(iCellOrdinal*tNumPoints + iGpOrdinal, 0);
     auto tBasisValues = ElementType::basisValues(tCubPoint);
     applyWeighting(iCellOrdinal, tControlWS, tBasisValues, tStress);
@@ -330,6 +330,9 @@ public:
   typedef Plato::Elliptic::LinearMechanics::FunctionFactory FunctionFactory;
   /// @brief physics-based topological element typename
   using ElementType = MechanicsElement<TopoElementType>;
+  /// @brief true if the state jacobian is symmetric and independent of the state,
+  ///        i.e., the forward operator can be reused for the adjoint solve
+  static constexpr bool mSelfAdjoint = true;
 };
 
 } // namespace Linear
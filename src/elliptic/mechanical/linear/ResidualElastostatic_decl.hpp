@@ -99,6 +99,17 @@ public:
     Plato::Scalar     aCycle = 0.0
   ) const;
 
+  /// @fn postProcess
+  /// @brief compute requested cell-averaged strain, stress and von mises stress
+  ///   at a converged state, non-AD evaluations only
+  /// @param [in] aWorkSets domain and range workset database
+  /// @param [in] aCycle    scalar
+  void
+  postProcess(
+    Plato::WorkSets & aWorkSets,
+    Plato::Scalar     aCycle = 0.0
+  ) const;
+
   /// @fn evaluateBoundary
   /// @brief evaluate boundary forces
   /// @param [in]     aSpatialModel contains mesh and model information
@@ -111,6 +122,15 @@ public:
           Plato::Scalar         aCycle = 0.0
   ) const;
 
+  /// @fn getBoundarySideSets
+  /// @brief get side sets of the natural boundary conditions
+  /// @param [in,out] aSideSetNames side set names are appended
+  /// @return true, boundary terms are restricted to the natural boundary condition side sets
+  bool
+  getBoundarySideSets(
+    std::vector<std::string> & aSideSetNames
+  ) const;
+
   /// @fn outputVonMises
   /// @brief compute Von Mises stresses and save in output database
   /// @param [in] aCauchyStress  cauchy stress
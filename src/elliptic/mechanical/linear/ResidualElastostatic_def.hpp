@@ -5,7 +5,7 @@
 #include "PlatoTypes.hpp"
 #include "SmallStrain.hpp"
 #include "LinearStress.hpp"
-#include "GradientMatrix.hpp"
+#include "GeometricFactors.hpp"
 #include "GeneralStressDivergence.hpp"
 #include "elliptic/mechanical/linear/VonMisesYieldFunction.hpp"
 
@@ -100,19 +100,14 @@ evaluate(
   Plato::ScalarMultiVectorT<ResultScalarType> tResultWS = 
     Plato::unpack<Plato::ScalarMultiVectorT<ResultScalarType>>(aWorkSets.get("result"));
   
-  Plato::ComputeGradientMatrix<ElementType>        tComputeGradient;
+  Plato::GeometricFactors<ElementType>             tComputeGradient(mSpatialDomain, tConfigWS);
   Plato::SmallStrain<ElementType>                  tComputeVoigtStrain;
   Plato::GeneralStressDivergence<ElementType>      tComputeStressDivergence;
   Plato::LinearStress<EvaluationType, ElementType> tComputeVoigtStress(mMaterialModel);
 
   auto tNumCells = mSpatialDomain.numCells();
-  Plato::ScalarVectorT<ConfigScalarType>      tCellVolume("volume", tNumCells);
-  Plato::ScalarMultiVectorT<StrainScalarType> tCellStrain("strain", tNumCells, mNumVoigtTerms);
-  Plato::ScalarMultiVectorT<ResultScalarType> tCellStress("stress", tNumCells, mNumVoigtTerms);
-  
   auto tNumPoints  = mNumGaussPoints;
   auto tCubPoints  = ElementType::getCubPoints();
-  auto tCubWeights = ElementType::getCubWeights();
   
   auto& tApplyWeighting = mApplyWeighting;
   auto& tCellForcing = mCellForcing;
@@ -125,40 +120,88 @@ evaluate(
     Plato::Array<mNumVoigtTerms, StrainScalarType> tStrain(0.0);
     Plato::Array<mNumVoigtTerms, ResultScalarType> tStress(0.0);
     auto tCubPoint = tCubPoints(iGpOrdinal);
-    tComputeGradient(iCellOrdinal, tCubPoint, tConfigWS, tGradient, tVolume);
+    tComputeGradient(iCellOrdinal, iGpOrdinal, tCubPoint, tConfigWS, tGradient, tVolume);
     
     tComputeVoigtStrain(iCellOrdinal, tStrain, tStateWS, tGradient);
     tComputeVoigtStress(tStress, tStrain);
     tCellForcing(tStress);
 
-    tVolume *= tCubWeights(iGpOrdinal);
     auto tBasisValues = ElementType::basisValues(tCubPoint);
     tApplyWeighting(iCellOrdinal, tControlWS, tBasisValues, tStress);
     tComputeStressDivergence(iCellOrdinal, tResultWS, tStress, tGradient, tVolume);
-    for(int i=0; i<mNumVoigtTerms; i++)
-    {
-      Kokkos::atomic_add(&tCellStrain(iCellOrdinal,i), tVolume*tStrain(i));
-      Kokkos::atomic_add(&tCellStress(iCellOrdinal,i), tVolume*tStress(i));
-    }
-    Kokkos::atomic_add(&tCellVolume(iCellOrdinal), tVolume);
   });
 
+  if( mBodyLoads != nullptr )
+  {
+    mBodyLoads->get( mSpatialDomain, tStateWS, tControlWS, tConfigWS, tResultWS, -1.0 );
+  }
+}
+
+template<typename EvaluationType, typename IndicatorFunctionType>
+void
+ResidualElastostatic<EvaluationType, IndicatorFunctionType>::
+postProcess(
+  Plato::WorkSets & aWorkSets,
+  Plato::Scalar     aCycle
+) const
+{
+  if( !Plato::storesOutput<ResultScalarType>() || mPlotTable.empty() ) { return; }
+
+  // unpack worksets
+  Plato::ScalarArray3DT<ConfigScalarType> tConfigWS  = 
+    Plato::unpack<Plato::ScalarArray3DT<ConfigScalarType>>(aWorkSets.get("configuration"));
+  Plato::ScalarMultiVectorT<ControlScalarType> tControlWS = 
+    Plato::unpack<Plato::ScalarMultiVectorT<ControlScalarType>>(aWorkSets.get("controls"));
+  Plato::ScalarMultiVectorT<StateScalarType> tStateWS = 
+    Plato::unpack<Plato::ScalarMultiVectorT<StateScalarType>>(aWorkSets.get("states"));
+
+  Plato::GeometricFactors<ElementType>             tComputeGradient(mSpatialDomain, tConfigWS);
+  Plato::SmallStrain<ElementType>                  tComputeVoigtStrain;
+  Plato::LinearStress<EvaluationType, ElementType> tComputeVoigtStress(mMaterialModel);
+
+  auto tNumCells = mSpatialDomain.numCells();
+  Plato::ScalarMultiVectorT<StrainScalarType> tCellStrain("strain", tNumCells, mNumVoigtTerms);
+  Plato::ScalarMultiVectorT<ResultScalarType> tCellStress("stress", tNumCells, mNumVoigtTerms);
+
+  auto tNumPoints  = mNumGaussPoints;
+  auto tCubPoints  = ElementType::getCubPoints();
+
+  auto& tApplyWeighting = mApplyWeighting;
+  auto& tCellForcing = mCellForcing;
   Kokkos::parallel_for("compute cell quantities", 
     Kokkos::RangePolicy<>(0, tNumCells),
     KOKKOS_LAMBDA(const Plato::OrdinalType iCellOrdinal)
   {
+    ConfigScalarType tCellVolume(0.0);
+    for(Plato::OrdinalType iGpOrdinal = 0; iGpOrdinal < tNumPoints; iGpOrdinal++)
+    {
+      ConfigScalarType tVolume(0.0);
+      Plato::Matrix<mNumNodesPerCell, mNumSpatialDims, ConfigScalarType> tGradient;
+      Plato::Array<mNumVoigtTerms, StrainScalarType> tStrain(0.0);
+      Plato::Array<mNumVoigtTerms, ResultScalarType> tStress(0.0);
+      auto tCubPoint = tCubPoints(iGpOrdinal);
+      tComputeGradient(iCellOrdinal, iGpOrdinal, tCubPoint, tConfigWS, tGradient, tVolume);
+
+      tComputeVoigtStrain(iCellOrdinal, tStrain, tStateWS, tGradient);
+      tComputeVoigtStress(tStress, tStrain);
+      tCellForcing(tStress);
+
+      auto tBasisValues = ElementType::basisValues(tCubPoint);
+      tApplyWeighting(iCellOrdinal, tControlWS, tBasisValues, tStress);
+      for(int i=0; i<mNumVoigtTerms; i++)
+      {
+        tCellStrain(iCellOrdinal,i) += tVolume*tStrain(i);
+        tCellStress(iCellOrdinal,i) += tVolume*tStress(i);
+      }
+      tCellVolume += tVolume;
+    }
     for(int i=0; i<mNumVoigtTerms; i++)
     {
-      tCellStrain(iCellOrdinal,i) /= tCellVolume(iCellOrdinal);
-      tCellStress(iCellOrdinal,i) /= tCellVolume(iCellOrdinal);
+      tCellStrain(iCellOrdinal,i) /= tCellVolume;
+      tCellStress(iCellOrdinal,i) /= tCellVolume;
     }
   });
 
-  if( mBodyLoads != nullptr )
-  {
-    mBodyLoads->get( mSpatialDomain, tStateWS, tControlWS, tConfigWS, tResultWS, -1.0 );
-  }
-
   if(std::count(mPlotTable.begin(), mPlotTable.end(), "strain")) 
   { Plato::toMap(mDataMap, tCellStrain, "strain", mSpatialDomain); }
   if(std::count(mPlotTable.begin(), mPlotTable.end(), "stress")) 
@@ -192,6 +235,20 @@ evaluateBoundary(
   }
 }
 
+template<typename EvaluationType, typename IndicatorFunctionType>
+bool
+ResidualElastostatic<EvaluationType, IndicatorFunctionType>::
+getBoundarySideSets(
+  std::vector<std::string> & aSideSetNames
+) const
+{
+  if( mBoundaryLoads != nullptr )
+  {
+    mBoundaryLoads->appendSideSetNames(aSideSetNames);
+  }
+  return true;
+}
+
 template<typename EvaluationType, typename IndicatorFunctionType>
 void
 ResidualElastostatic<EvaluationType, IndicatorFunctionType>::
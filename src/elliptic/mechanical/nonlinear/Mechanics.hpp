@@ -129,6 +129,9 @@ public:
   typedef Plato::Elliptic::NonlinearMechanics::FunctionFactory FunctionFactory;
   /// @brief physics-based topological element typename
   using ElementType = Plato::MechanicsElement<TopoElementType>;
+  /// @brief true if the state jacobian is symmetric and independent of the state,
+  ///        i.e., the forward operator can be reused for the adjoint solve
+  static constexpr bool mSelfAdjoint = false;
 };
 
 } // namespace Nonlinear
@@ -115,6 +115,15 @@ public:
           Plato::Scalar         aCycle = 0.0
   ) const;
 
+  /// @fn getBoundarySideSets
+  /// @brief get side sets of the natural boundary conditions
+  /// @param [in,out] aSideSetNames side set names are appended
+  /// @return true, boundary terms are restricted to the natural boundary condition side sets
+  bool
+  getBoundarySideSets(
+    std::vector<std::string> & aSideSetNames
+  ) const;
+
 private:
   /// @fn initialize
   /// @brief initialize member data
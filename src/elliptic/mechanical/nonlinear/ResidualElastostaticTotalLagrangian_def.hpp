@@ -132,6 +132,20 @@ evaluateBoundary(
   }
 }
 
+template<typename EvaluationType>
+bool
+ResidualElastostaticTotalLagrangian<EvaluationType>::
+getBoundarySideSets(
+  std::vector<std::string> & aSideSetNames
+) const
+{
+  if( mNaturalBCs != nullptr )
+  {
+    mNaturalBCs->appendSideSetNames(aSideSetNames);
+  }
+  return true;
+}
+
 template<typename EvaluationType>
 void 
 ResidualElastostaticTotalLagrangian<EvaluationType>::
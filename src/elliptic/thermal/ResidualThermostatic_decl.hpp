@@ -75,6 +75,17 @@ public:
     Plato::Scalar     aCycle = 0.0
   ) const;
 
+  /// @fn postProcess
+  /// @brief compute requested cell-averaged temperature gradient and thermal flux
+  ///   at a converged state, non-AD evaluations only
+  /// @param [in] aWorkSets domain and range workset database
+  /// @param [in] aCycle    scalar
+  void
+  postProcess(
+    Plato::WorkSets & aWorkSets,
+    Plato::Scalar     aCycle = 0.0
+  ) const;
+
   /// @fn evaluateBoundary
   /// @brief evaluate boundary forces
   /// @param [in]     aSpatialModel contains mesh and model information
@@ -87,6 +98,15 @@ public:
           Plato::Scalar         aCycle = 0.0
   ) const;
 
+  /// @fn getBoundarySideSets
+  /// @brief get side sets of the natural boundary conditions
+  /// @param [in,out] aSideSetNames side set names are appended
+  /// @return true, boundary terms are restricted to the natural boundary condition side sets
+  bool
+  getBoundarySideSets(
+    std::vector<std::string> & aSideSetNames
+  ) const;
+
 }; // class ResidualThermostatic
 
 } // namespace Elliptic
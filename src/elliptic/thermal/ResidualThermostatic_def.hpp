@@ -4,7 +4,7 @@
 #include "MetaData.hpp"
 #include "ScalarGrad.hpp"
 #include "ThermalFlux.hpp"
-#include "GradientMatrix.hpp"
+#include "GeometricFactors.hpp"
 #include "InterpolateFromNodal.hpp"
 #include "GeneralFluxDivergence.hpp"
 
@@ -83,20 +83,15 @@ evaluate(
   Plato::ScalarMultiVectorT<ResultScalarType> tResultWS = 
     Plato::unpack<Plato::ScalarMultiVectorT<ResultScalarType>>(aWorkSets.get("result"));
   // create local functors
-  Plato::ComputeGradientMatrix<ElementType>  tComputeGradient;
+  Plato::GeometricFactors<ElementType>       tComputeGradient(mSpatialDomain, tConfigWS);
   Plato::ScalarGrad<ElementType>             tScalarGrad;
   Plato::GeneralFluxDivergence<ElementType>  tFluxDivergence;
   Plato::ThermalFlux<EvaluationType>         tThermalFlux(mMaterialModel);
   Plato::InterpolateFromNodal<ElementType, mNumDofsPerNode> tInterpolateFromNodal;
-  // create temporary containers
-  auto tNumCells = mSpatialDomain.numCells();
-  Plato::ScalarVectorT<ConfigScalarType>      tCellVolume("cell weight",tNumCells);
-  Plato::ScalarMultiVectorT<GradScalarType>   tCellGrad("temperature gradient", tNumCells, mNumSpatialDims);
-  Plato::ScalarMultiVectorT<ResultScalarType> tCellFlux("thermal flux", tNumCells, mNumSpatialDims);
   // get interpolation rule
+  auto tNumCells = mSpatialDomain.numCells();
   auto tNumPoints  = mNumGaussPoints;
   auto tCubPoints  = ElementType::getCubPoints();
-  auto tCubWeights = ElementType::getCubWeights();
 
   auto& tApplyWeighting = mApplyWeighting;
   Kokkos::parallel_for("compute stress", 
@@ -110,40 +105,84 @@ evaluate(
     Plato::Array<mNumSpatialDims, ResultScalarType> tFlux(0.0);
     auto tCubPoint = tCubPoints(iGpOrdinal);
     auto tBasisValues = ElementType::basisValues(tCubPoint);
-    tComputeGradient(iCellOrdinal, tCubPoint, tConfigWS, tGradient, tVolume);
+    tComputeGradient(iCellOrdinal, iGpOrdinal, tCubPoint, tConfigWS, tGradient, tVolume);
     // compute temperature gradient and interpolate temperature to integration points
     tScalarGrad(iCellOrdinal, tGrad, tStateWS, tGradient);
     StateScalarType tTemperature = tInterpolateFromNodal(iCellOrdinal, tBasisValues, tStateWS);
     // compute penalized thermal flux
     tThermalFlux(tFlux, tGrad, tTemperature);
-    tVolume *= tCubWeights(iGpOrdinal);
     tApplyWeighting(iCellOrdinal, tControlWS, tBasisValues, tFlux);
     // applied divergence operator to thermal flux
     tFluxDivergence(iCellOrdinal, tResultWS, tFlux, tGradient, tVolume, -1.0);
-    // compute element quantity of interests
-    for(int i=0; i<mNumSpatialDims; i++)
-    {
-      Kokkos::atomic_add(&tCellGrad(iCellOrdinal,i), tVolume*tGrad(i));
-      Kokkos::atomic_add(&tCellFlux(iCellOrdinal,i), tVolume*tFlux(i));
-    }
-    Kokkos::atomic_add(&tCellVolume(iCellOrdinal), tVolume);
   });
+  // evaluate body forces
+  if( mBodyLoads != nullptr )
+  {
+    mBodyLoads->get( mSpatialDomain, tStateWS, tControlWS, tConfigWS, tResultWS, -1.0 );
+  }
+}
+
+template<typename EvaluationType, typename IndicatorFunctionType>
+void
+ResidualThermostatic<EvaluationType, IndicatorFunctionType>::
+postProcess(
+  Plato::WorkSets & aWorkSets,
+  Plato::Scalar     aCycle
+) const
+{
+  if( !Plato::storesOutput<ResultScalarType>() || mPlottable.empty() ) { return; }
+  // unpack worksets
+  Plato::ScalarArray3DT<ConfigScalarType> tConfigWS  = 
+    Plato::unpack<Plato::ScalarArray3DT<ConfigScalarType>>(aWorkSets.get("configuration"));
+  Plato::ScalarMultiVectorT<ControlScalarType> tControlWS = 
+    Plato::unpack<Plato::ScalarMultiVectorT<ControlScalarType>>(aWorkSets.get("controls"));
+  Plato::ScalarMultiVectorT<StateScalarType> tStateWS = 
+    Plato::unpack<Plato::ScalarMultiVectorT<StateScalarType>>(aWorkSets.get("states"));
+  // create local functors
+  Plato::GeometricFactors<ElementType>       tComputeGradient(mSpatialDomain, tConfigWS);
+  Plato::ScalarGrad<ElementType>             tScalarGrad;
+  Plato::ThermalFlux<EvaluationType>         tThermalFlux(mMaterialModel);
+  Plato::InterpolateFromNodal<ElementType, mNumDofsPerNode> tInterpolateFromNodal;
+  // create output containers
+  auto tNumCells = mSpatialDomain.numCells();
+  Plato::ScalarMultiVectorT<GradScalarType>   tCellGrad("temperature gradient", tNumCells, mNumSpatialDims);
+  Plato::ScalarMultiVectorT<ResultScalarType> tCellFlux("thermal flux", tNumCells, mNumSpatialDims);
+  // get interpolation rule
+  auto tNumPoints  = mNumGaussPoints;
+  auto tCubPoints  = ElementType::getCubPoints();
   // compute output element quantities of interests
+  auto& tApplyWeighting = mApplyWeighting;
   Kokkos::parallel_for("compute cell quantities", 
     Kokkos::RangePolicy<>(0, tNumCells),
     KOKKOS_LAMBDA(const Plato::OrdinalType iCellOrdinal)
   {
+    ConfigScalarType tCellVolume(0.0);
+    for(Plato::OrdinalType iGpOrdinal = 0; iGpOrdinal < tNumPoints; iGpOrdinal++)
+    {
+      ConfigScalarType tVolume(0.0);
+      Plato::Matrix<mNumNodesPerCell, mNumSpatialDims, ConfigScalarType> tGradient;
+      Plato::Array<mNumSpatialDims, GradScalarType> tGrad(0.0);
+      Plato::Array<mNumSpatialDims, ResultScalarType> tFlux(0.0);
+      auto tCubPoint = tCubPoints(iGpOrdinal);
+      auto tBasisValues = ElementType::basisValues(tCubPoint);
+      tComputeGradient(iCellOrdinal, iGpOrdinal, tCubPoint, tConfigWS, tGradient, tVolume);
+      tScalarGrad(iCellOrdinal, tGrad, tStateWS, tGradient);
+      StateScalarType tTemperature = tInterpolateFromNodal(iCellOrdinal, tBasisValues, tStateWS);
+      tThermalFlux(tFlux, tGrad, tTemperature);
+      tApplyWeighting(iCellOrdinal, tControlWS, tBasisValues, tFlux);
+      for(int i=0; i<mNumSpatialDims; i++)
+      {
+        tCellGrad(iCellOrdinal,i) += tVolume*tGrad(i);
+        tCellFlux(iCellOrdinal,i) += tVolume*tFlux(i);
+      }
+      tCellVolume += tVolume;
+    }
     for(int i=0; i<mNumSpatialDims; i++)
     {
-      tCellGrad(iCellOrdinal,i) /= tCellVolume(iCellOrdinal);
-      tCellFlux(iCellOrdinal,i) /= tCellVolume(iCellOrdinal);
+      tCellGrad(iCellOrdinal,i) /= tCellVolume;
+      tCellFlux(iCellOrdinal,i) /= tCellVolume;
     }
   });
-  // evaluate body forces
-  if( mBodyLoads != nullptr )
-  {
-    mBodyLoads->get( mSpatialDomain, tStateWS, tControlWS, tConfigWS, tResultWS, -1.0 );
-  }
   // save output quantities of interests
   if( std::count(mPlottable.begin(),mPlottable.end(),"tgrad") ) 
     { toMap(mDataMap, tCellGrad, "tgrad", mSpatialDomain); }
@@ -176,6 +215,20 @@ evaluateBoundary(
   }
 }
 
+template<typename EvaluationType, typename IndicatorFunctionType>
+bool
+ResidualThermostatic<EvaluationType, IndicatorFunctionType>::
+getBoundarySideSets(
+  std::vector<std::string> & aSideSetNames
+) const
+{
+  if( mBoundaryLoads != nullptr )
+  {
+    mBoundaryLoads->appendSideSetNames(aSideSetNames);
+  }
+  return true;
+}
+
 } // namespace Elliptic
 
 } // namespace Plato
@@ -111,11 +111,6 @@ evaluate(
   Plato::GeneralFluxDivergence  <ElementType, mNumDofsPerNode, TDofOffset> tFluxDivergence;
 
   auto tNumCells = mSpatialDomain.numCells();
-  Plato::ScalarVectorT<ConfigScalarType>      tCellVolume("volume", tNumCells);
-  Plato::ScalarMultiVectorT<GradScalarType>   tCellStrain("strain", tNumCells, mNumVoigtTerms);
-  Plato::ScalarMultiVectorT<GradScalarType>   tCellTgrad("tgrad", tNumCells, mNumSpatialDims);
-  Plato::ScalarMultiVectorT<ResultScalarType> tCellStress("stress", tNumCells, mNumVoigtTerms);
-  Plato::ScalarMultiVectorT<ResultScalarType> tCellFlux("flux" , tNumCells, mNumSpatialDims);
 
   auto tNumPoints  = mNumGaussPoints;
   auto tCubPoints  = ElementType::getCubPoints();
@@ -160,48 +155,48 @@ evaluate(
     //
     tStressDivergence(iCellOrdinal, iGpOrdinal, tResultWS, tStress, tGradient, tVolume);
     tFluxDivergence  (iCellOrdinal, iGpOrdinal, tResultWS, tFlux,   tGradient, tVolume);
-    for(int i=0; i<mNumVoigtTerms; i++)
-    {
-      Kokkos::atomic_add(
-        &tCellStrain(iCellOrdinal,i), tVolume(iCellOrdinal, iGpOrdinal)*tStrain(iCellOrdinal, iGpOrdinal, i)
-      );
-      Kokkos::atomic_add(
-        &tCellStress(iCellOrdinal,i), tVolume(iCellOrdinal, iGpOrdinal)*tStress(iCellOrdinal, iGpOrdinal, i)
-      );
-    }
-    for(int i=0; i<mNumSpatialDims; i++)
-    {
-      Kokkos::atomic_add(
-        &tCellTgrad(iCellOrdinal,i), tVolume(iCellOrdinal, iGpOrdinal)*tTGrad(iCellOrdinal, iGpOrdinal, i)
-      );
-      Kokkos::atomic_add(
-        &tCellFlux(iCellOrdinal,i), tVolume(iCellOrdinal, iGpOrdinal)*tFlux(iCellOrdinal, iGpOrdinal, i)
-      );
-    }
-    Kokkos::atomic_add(&tCellVolume(iCellOrdinal), tVolume(iCellOrdinal, iGpOrdinal));
   });
-
+  // evaluate body forces
+  if( mBodyLoads != nullptr )
+  {
+    mBodyLoads->get( mSpatialDomain, tStateWS, tControlWS, tConfigWS, tResultWS, -1.0 );
+  }
+  // populate output database, output quantities are only computed by non-AD evaluations
+  if( !Plato::storesOutput<ResultScalarType>() || mPlottable.empty() ) { return; }
+  Plato::ScalarMultiVectorT<GradScalarType>   tCellStrain("strain", tNumCells, mNumVoigtTerms);
+  Plato::ScalarMultiVectorT<GradScalarType>   tCellTgrad("tgrad", tNumCells, mNumSpatialDims);
+  Plato::ScalarMultiVectorT<ResultScalarType> tCellStress("stress", tNumCells, mNumVoigtTerms);
+  Plato::ScalarMultiVectorT<ResultScalarType> tCellFlux("flux" , tNumCells, mNumSpatialDims);
   Kokkos::parallel_for("compute cell quantities", 
     Kokkos::RangePolicy<>(0, tNumCells),
     KOKKOS_LAMBDA(const Plato::OrdinalType iCellOrdinal)
   {
+    ConfigScalarType tCellVolume(0.0);
+    for(Plato::OrdinalType iGpOrdinal = 0; iGpOrdinal < tNumPoints; iGpOrdinal++)
+    {
+      for(int i=0; i<mNumVoigtTerms; i++)
+      {
+        tCellStrain(iCellOrdinal,i) += tVolume(iCellOrdinal, iGpOrdinal)*tStrain(iCellOrdinal, iGpOrdinal, i);
+        tCellStress(iCellOrdinal,i) += tVolume(iCellOrdinal, iGpOrdinal)*tStress(iCellOrdinal, iGpOrdinal, i);
+      }
+      for(int i=0; i<mNumSpatialDims; i++)
+      {
+        tCellTgrad(iCellOrdinal,i) += tVolume(iCellOrdinal, iGpOrdinal)*tTGrad(iCellOrdinal, iGpOrdinal, i);
+        tCellFlux(iCellOrdinal,i) += tVolume(iCellOrdinal, iGpOrdinal)*tFlux(iCellOrdinal, iGpOrdinal, i);
+      }
+      tCellVolume += tVolume(iCellOrdinal, iGpOrdinal);
+    }
     for(int i=0; i<mNumVoigtTerms; i++)
     {
-      tCellStrain(iCellOrdinal,i) /= tCellVolume(iCellOrdinal);
-      tCellStress(iCellOrdinal,i) /= tCellVolume(iCellOrdinal);
+      tCellStrain(iCellOrdinal,i) /= tCellVolume;
+      tCellStress(iCellOrdinal,i) /= tCellVolume;
     }
     for(int i=0; i<mNumSpatialDims; i++)
     {
-      tCellTgrad(iCellOrdinal,i) /= tCellVolume(iCellOrdinal);
-      tCellFlux(iCellOrdinal,i) /= tCellVolume(iCellOrdinal);
+      tCellTgrad(iCellOrdinal,i) /= tCellVolume;
+      tCellFlux(iCellOrdinal,i) /= tCellVolume;
     }
   });
-  // evaluate body forces
-  if( mBodyLoads != nullptr )
-  {
-    mBodyLoads->get( mSpatialDomain, tStateWS, tControlWS, tConfigWS, tResultWS, -1.0 );
-  }
-  // populate output database
   if( std::count(mPlottable.begin(),mPlottable.end(),"strain") ) 
     { toMap(mDataMap, tCellStrain, "strain", mSpatialDomain); }
   if( std::count(mPlottable.begin(),mPlottable.end(),"tgrad" ) ) 
@@ -241,6 +236,24 @@ evaluateBoundary(
   }
 }
 
+template<typename EvaluationType, typename IndicatorFunctionType>
+bool
+ThermoelastostaticResidual<EvaluationType, IndicatorFunctionType>::
+getBoundarySideSets(
+  std::vector<std::string> & aSideSetNames
+) const
+{
+  if( mBoundaryLoads != nullptr )
+  {
+    mBoundaryLoads->appendSideSetNames(aSideSetNames);
+  }
+  if( mBoundaryFluxes != nullptr )
+  {
+    mBoundaryFluxes->appendSideSetNames(aSideSetNames);
+  }
+  return true;
+}
+
 } // namespace Elliptic
 
 } // namespace Plato
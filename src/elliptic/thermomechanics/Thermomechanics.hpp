@@ -172,6 +172,9 @@ public:
   typedef Plato::Elliptic::LinearThermoMechanics::FunctionFactory FunctionFactory;
   /// @brief topological element type with additional physics related information 
   using ElementType = ThermomechanicsElement<TopoElementType>;
+  /// @brief true if the state jacobian is symmetric and independent of the state,
+  ///        i.e., the forward operator can be reused for the adjoint solve
+  static constexpr bool mSelfAdjoint = false;
 };
 
 } // namespace Linear
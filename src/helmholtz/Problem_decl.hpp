@@ -51,7 +51,11 @@ private:
 
     Plato::ScalarMultiVector mStates; /*!< state variables */
 
-    Teuchos::RCP<Plato::CrsMatrixType> mJacobian; /*!< Jacobian matrix */
+    Teuchos::RCP<Plato::CrsMatrixType> mJacobian; /*!< Jacobian matrix, i.e., the filter operator */
+
+    Teuchos::RCP<Plato::CrsMatrixType> mPartialControl; /*!< transposed partial derivative of the residual wrt controls */
+
+    bool mIsOperatorFactored = false; /*!< true once the solver holds a factorization/preconditioner of mJacobian */
 
     rcp<Plato::AbstractSolver> mSolver;
 
@@ -120,6 +124,23 @@ public:
         const std::string         & aName
     ) override;
 
+    /******************************************************************************//**
+     * \brief Filter several fields at once, one per row of aControls
+     * \param [in] aControls 2D view of unfiltered fields
+     * \return 2D view - filtered fields
+    **********************************************************************************/
+    Plato::ScalarMultiVector
+    filter(const Plato::ScalarMultiVector & aControls);
+
+    /******************************************************************************//**
+     * \brief Apply the chain rule of the filter to several criterion partial derivatives
+     *        at once, one per row of aPartials
+     * \param [in] aPartials 2D view of criterion partial derivatives wrt filtered control
+     * \return 2D view - criterion partial derivatives wrt unfiltered control
+    **********************************************************************************/
+    Plato::ScalarMultiVector
+    filterGradients(const Plato::ScalarMultiVector & aPartials);
+
     /******************************************************************************//**
      * \brief Evaluate criterion function
      * \param [in] aControl 1D view of control variables
@@ -193,6 +214,18 @@ private:
     **********************************************************************************/
     void initialize(Plato::Mesh& aMesh, Teuchos::ParameterList& aProblemParams);
 
+    /******************************************************************************//**
+     * \brief Assemble the filter operator and the partial derivative wrt controls.  Both
+     *        depend only on the mesh and the length scales, so they are assembled once.
+    **********************************************************************************/
+    void assembleOperators();
+
+    /******************************************************************************//**
+     * \brief Solve the filter system for each row of aB.  The operator is factored (or
+     *        preconditioned) on the first solve only.
+    **********************************************************************************/
+    void solveFilterSystem(Plato::ScalarMultiVector aX, Plato::ScalarMultiVector aB);
+
     /******************************************************************************/ /**
     * \brief Return solution database.
     * \return solution database
@@ -118,12 +118,16 @@ namespace Helmholtz
         mDataMap.clearStates();
         mDataMap.scalarNodeFields["Topology"] = aControl;
 
-        mResidual = mPDE->value(tStatesSubView, aControl);
-        Plato::blas1::scale(-1.0, mResidual);
+        this->assembleOperators();
 
-        mJacobian = mPDE->gradient_u(tStatesSubView, aControl);
+        // the residual is linear in the controls, R = K u - M z, so the rhs is M z
+        Plato::blas1::fill(static_cast<Plato::Scalar>(0.0), mResidual);
+        Plato::MatrixTimesVectorPlusVector(mPartialControl, aControl, mResidual);
+        Plato::blas1::scale(-1.0, mResidual);
 
-        mSolver->solve(*mJacobian, tStatesSubView, mResidual);
+        Plato::ScalarMultiVector tStates = Kokkos::subview(mStates, std::make_pair(0, 1), Kokkos::ALL());
+        Plato::ScalarMultiVector tRHS(mResidual.data(), 1, mResidual.extent(0));
+        this->solveFilterSystem(tStates, tRHS);
 
         auto tSolution = this->getSolution();
         return tSolution;
@@ -145,22 +149,72 @@ namespace Helmholtz
         const std::string         & aName
     )
     {
-        Plato::ScalarVector tSolution("derivative of criterion wrt unfiltered control", mPDE->size());
-        Plato::blas1::fill(static_cast<Plato::Scalar>(0.0), tSolution);
-
-        mJacobian = mPDE->gradient_u(tSolution, aControl);
-
-        auto tPartialPDE_WRT_Control = mPDE->gradient_z(tSolution, aControl);
-
-        Plato::blas1::scale(-1.0, aControl);
-
-        Plato::ScalarVector tIntermediateSolution("intermediate solution", mPDE->size());
-        Plato::blas1::fill(static_cast<Plato::Scalar>(0.0), tIntermediateSolution);
-        mSolver->solve(*mJacobian, tIntermediateSolution, aControl);
+        Plato::ScalarMultiVector tPartials(aControl.data(), 1, aControl.extent(0));
+        auto tGradients = this->filterGradients(tPartials);
+        Plato::ScalarVector tSolution = Kokkos::subview(tGradients, 0, Kokkos::ALL());
+        return tSolution;
+    }
 
-        Plato::MatrixTimesVectorPlusVector(tPartialPDE_WRT_Control, tIntermediateSolution, tSolution);
+    /******************************************************************************//**
+     * \brief Filter several fields at once, one per row of aControls
+     * \param [in] aControls 2D view of unfiltered fields
+     * \return 2D view - filtered fields
+    **********************************************************************************/
+    template<typename PhysicsType>
+    Plato::ScalarMultiVector
+    Problem<PhysicsType>::filter(const Plato::ScalarMultiVector & aControls)
+    {
+        this->assembleOperators();
+
+        const Plato::OrdinalType tNumFields = aControls.extent(0);
+        Plato::ScalarMultiVector tRHS("filter rhs", tNumFields, mPDE->size());
+        for(Plato::OrdinalType tField = 0; tField < tNumFields; tField++)
+        {
+            Plato::ScalarVector tControl = Kokkos::subview(aControls, tField, Kokkos::ALL());
+            Plato::ScalarVector tMyRHS = Kokkos::subview(tRHS, tField, Kokkos::ALL());
+            Plato::MatrixTimesVectorPlusVector(mPartialControl, tControl, tMyRHS);
+        }
+        // dR/dz = -M, so the rhs of K x = M z is -(dR/dz) z
+        Plato::ScalarVector tRHSValues(tRHS.data(), tRHS.size());
+        Plato::blas1::scale(static_cast<Plato::Scalar>(-1.0), tRHSValues);
+
+        Plato::ScalarMultiVector tFiltered("filtered fields", tNumFields, mPDE->size());
+        this->solveFilterSystem(tFiltered, tRHS);
+        return tFiltered;
+    }
 
-        return tSolution;
+    /******************************************************************************//**
+     * \brief Apply the chain rule of the filter to several criterion partial derivatives
+     *        at once, one per row of aPartials
+     * \param [in] aPartials 2D view of criterion partial derivatives wrt filtered control
+     * \return 2D view - criterion partial derivatives wrt unfiltered control
+    **********************************************************************************/
+    template<typename PhysicsType>
+    Plato::ScalarMultiVector
+    Problem<PhysicsType>::filterGradients(const Plato::ScalarMultiVector & aPartials)
+    {
+        this->assembleOperators();
+
+        const Plato::OrdinalType tNumFields = aPartials.extent(0);
+        Plato::ScalarMultiVector tRHS("filter adjoint rhs", tNumFields, mPDE->size());
+        for(Plato::OrdinalType tField = 0; tField < tNumFields; tField++)
+        {
+            Plato::ScalarVector tPartial = Kokkos::subview(aPartials, tField, Kokkos::ALL());
+            Plato::ScalarVector tMyRHS = Kokkos::subview(tRHS, tField, Kokkos::ALL());
+            Plato::blas1::update(static_cast<Plato::Scalar>(-1.0), tPartial, static_cast<Plato::Scalar>(0.0), tMyRHS);
+        }
+
+        Plato::ScalarMultiVector tAdjoints("filter adjoints", tNumFields, mPDE->size());
+        this->solveFilterSystem(tAdjoints, tRHS);
+
+        Plato::ScalarMultiVector tGradients("derivative of criterion wrt unfiltered control", tNumFields, mPDE->size());
+        for(Plato::OrdinalType tField = 0; tField < tNumFields; tField++)
+        {
+            Plato::ScalarVector tAdjoint = Kokkos::subview(tAdjoints, tField, Kokkos::ALL());
+            Plato::ScalarVector tGradient = Kokkos::subview(tGradients, tField, Kokkos::ALL());
+            Plato::MatrixTimesVectorPlusVector(mPartialControl, tAdjoint, tGradient);
+        }
+        return tGradients;
     }
 
     /******************************************************************************//**
@@ -261,6 +315,40 @@ namespace Helmholtz
         mPDE = std::make_shared<Plato::Helmholtz::VectorFunction<PhysicsType>>(mSpatialModel, mDataMap, aProblemParams, tName);
     }
 
+    /******************************************************************************//**
+     * \brief Assemble the filter operator and the partial derivative wrt controls.  Both
+     *        depend only on the mesh and the length scales, so they are assembled once.
+    **********************************************************************************/
+    template<typename PhysicsType>
+    void Problem<PhysicsType>::assembleOperators()
+    {
+        if(!mJacobian.is_null() && !mPartialControl.is_null())
+        {
+            return;
+        }
+        Plato::ScalarVector tStates("states", mPDE->size());
+        Plato::ScalarVector tControls("controls", mPDE->size());
+        mJacobian = mPDE->gradient_u(tStates, tControls);
+        mPartialControl = mPDE->gradient_z(tStates, tControls);
+        mIsOperatorFactored = false;
+    }
+
+    /******************************************************************************//**
+     * \brief Solve the filter system for each row of aB.  The operator is factored (or
+     *        preconditioned) on the first solve only.
+    **********************************************************************************/
+    template<typename PhysicsType>
+    void Problem<PhysicsType>::solveFilterSystem(Plato::ScalarMultiVector aX, Plato::ScalarMultiVector aB)
+    {
+        Kokkos::deep_copy(aX, 0.0);
+        if(mIsOperatorFactored)
+        {
+            mSolver->reuseOperator();
+        }
+        mSolver->solve(*mJacobian, aX, aB);
+        mIsOperatorFactored = true;
+    }
+
     /******************************************************************************/ /**
     * \brief Return solution database.
     * \return solution database
@@ -2,6 +2,7 @@
 
 #include "BodyLoads.hpp"
 #include "NaturalBCs.hpp"
+#include "Plato_Solve.hpp"
 #include "ApplyWeighting.hpp"
 #include "ElasticModelFactory.hpp"
 #include "hyperbolic/VectorFunction.hpp"
@@ -47,6 +48,9 @@ class TransientMechanicsResidual :
 
     bool mRayleighDamping;
 
+    bool mLumpedMass;
+    Plato::Solve::Lumping mLumping;
+
     Teuchos::RCP<Plato::LinearElasticMaterial<mNumSpatialDims>> mMaterialModel;
 
     std::vector<std::string> mPlotTable;
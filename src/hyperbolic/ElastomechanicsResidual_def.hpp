@@ -5,6 +5,7 @@
 #include "ToMap.hpp"
 #include "PlatoTypes.hpp"
 #include "PlatoStaticsTypes.hpp"
+#include "ParseTools.hpp"
 
 #include "GradientMatrix.hpp"
 #include "CellVolume.hpp"
@@ -38,7 +39,9 @@ namespace Hyperbolic
         mApplyStressWeighting (mIndicatorFunction),
         mApplyMassWeighting   (mIndicatorFunction),
         mBodyLoads            (nullptr),
-        mBoundaryLoads        (nullptr)
+        mBoundaryLoads        (nullptr),
+        mLumpedMass           (false),
+        mLumping              (Plato::Solve::Lumping::RowSum)
     {
         Plato::ElasticModelFactory<mNumSpatialDims> tMaterialModelFactory(aProblemParams);
         mMaterialModel = tMaterialModelFactory.create(aSpatialDomain.getMaterialName());
@@ -58,6 +61,15 @@ namespace Hyperbolic
                              (aProblemParams.sublist("Natural Boundary Conditions"));
         }
 
+        // the central difference integrator requires a diagonal mass matrix, so the mass is lumped per element
+        if(aProblemParams.isSublist("Time Integration"))
+        {
+            auto& tIntegratorParams = aProblemParams.sublist("Time Integration");
+            auto tIntegrator = Plato::ParseTools::getParam<std::string>(tIntegratorParams, "Integrator", "Newmark");
+            mLumpedMass = (tIntegrator == "Central Difference");
+            mLumping = Plato::Solve::lumping(Plato::ParseTools::getParam<std::string>(tIntegratorParams, "Mass Lumping", "Row Sum"));
+        }
+
         auto tResidualParams = aProblemParams.sublist("Hyperbolic");
         if( tResidualParams.isType<Teuchos::Array<std::string>>("Plottable") )
         {
@@ -158,6 +170,7 @@ namespace Hyperbolic
       Plato::InertialContent<ElementType>       computeInertialContent(mMaterialModel);
       Plato::InterpolateFromNodal<ElementType, mNumDofsPerNode, /*offset=*/0, mNumSpatialDims> interpolateFromNodal;
       Plato::ProjectToNode<ElementType>         projectInertialContent;
+      Plato::LumpedInertialContent<ElementType> computeLumpedInertialContent(mMaterialModel, mLumping);
 
       Plato::ScalarVectorT<ConfigScalarType>
         tCellVolume("volume",tNumCells);
@@ -168,6 +181,13 @@ namespace Hyperbolic
       Plato::ScalarMultiVectorT<ResultScalarType>
         tCellStress("stress",tNumCells,mNumVoigtTerms);
 
+      auto tLumpedMass = mLumpedMass;
+      Plato::ScalarMultiVectorT<ResultScalarType>
+        tNodalMass("nodal mass",(tLumpedMass ? tNumCells : 0),mNumNodesPerCell);
+
+      Plato::ScalarVectorT<ResultScalarType>
+        tCellMass("cell mass",(tLumpedMass ? tNumCells : 0));
+
       auto tCubPoints = ElementType::getCubPoints();
       auto tCubWeights = ElementType::getCubWeights();
       auto tNumPoints = tCubWeights.size();
@@ -203,13 +223,22 @@ namespace Hyperbolic
 
           computeStressDivergence(iCellOrdinal, aResult, tStress, tGradient, tVolume);
       
-          interpolateFromNodal(iCellOrdinal, tBasisValues, aStateDotDot, tAcceleration);
+          if( tLumpedMass )
+          {
+              Plato::Array<ElementType::mNumSpatialDims, ResultScalarType> tMassWeight(1.0);
+              applyMassWeighting(iCellOrdinal, aControl, tBasisValues, tMassWeight);
+              computeLumpedInertialContent.accumulate(iCellOrdinal, tVolume, tBasisValues, tMassWeight(0), tNodalMass, tCellMass);
+          }
+          else
+          {
+              interpolateFromNodal(iCellOrdinal, tBasisValues, aStateDotDot, tAcceleration);
 
-          computeInertialContent(tInertialContent, tAcceleration);
+              computeInertialContent(tInertialContent, tAcceleration);
 
-          applyMassWeighting(iCellOrdinal, aControl, tBasisValues, tInertialContent);
+              applyMassWeighting(iCellOrdinal, aControl, tBasisValues, tInertialContent);
 
-          projectInertialContent(iCellOrdinal, tVolume, tBasisValues, tInertialContent, aResult);
+              projectInertialContent(iCellOrdinal, tVolume, tBasisValues, tInertialContent, aResult);
+          }
 
           for(int i=0; i<ElementType::mNumVoigtTerms; i++)
           {
@@ -220,6 +249,15 @@ namespace Hyperbolic
 
       });
 
+      if( tLumpedMass )
+      {
+          Kokkos::parallel_for("compute lumped inertial content", Kokkos::RangePolicy<>(0, tNumCells),
+          KOKKOS_LAMBDA(const Plato::OrdinalType iCellOrdinal)
+          {
+              computeLumpedInertialContent(iCellOrdinal, tNodalMass, tCellMass, aStateDot, aStateDotDot, aResult);
+          });
+      }
+
       Kokkos::parallel_for("compute cell quantities", Kokkos::RangePolicy<>(0, tNumCells),
       KOKKOS_LAMBDA(const Plato::OrdinalType iCellOrdinal)
       {
@@ -269,6 +307,7 @@ namespace Hyperbolic
       Plato::InertialContent<ElementType>        computeInertialContent(mMaterialModel);
       Plato::InterpolateFromNodal<ElementType, mNumDofsPerNode, /*offset=*/0, mNumSpatialDims> interpolateFromNodal;
       Plato::ProjectToNode<ElementType>         projectInertialContent;
+      Plato::LumpedInertialContent<ElementType> computeLumpedInertialContent(mMaterialModel, mLumping);
 
       Plato::ScalarVectorT<ConfigScalarType>
         tCellVolume("volume",tNumCells);
@@ -282,6 +321,13 @@ namespace Hyperbolic
       Plato::ScalarMultiVectorT<ResultScalarType>
         tCellStress("stress",tNumCells,mNumVoigtTerms);
 
+      auto tLumpedMass = mLumpedMass;
+      Plato::ScalarMultiVectorT<ResultScalarType>
+        tNodalMass("nodal mass",(tLumpedMass ? tNumCells : 0),mNumNodesPerCell);
+
+      Plato::ScalarVectorT<ResultScalarType>
+        tCellMass("cell mass",(tLumpedMass ? tNumCells : 0));
+
       auto tCubPoints = ElementType::getCubPoints();
       auto tCubWeights = ElementType::getCubWeights();
       auto tNumPoints = tCubWeights.size();
@@ -321,15 +367,24 @@ namespace Hyperbolic
 
           computeStressDivergence(iCellOrdinal, aResult, tStress, tGradient, tVolume);
 
-          interpolateFromNodal(iCellOrdinal, tBasisValues, aStateDotDot, tAcceleration);
+          if( tLumpedMass )
+          {
+              Plato::Array<ElementType::mNumSpatialDims, ResultScalarType> tMassWeight(1.0);
+              applyMassWeighting(iCellOrdinal, aControl, tBasisValues, tMassWeight);
+              computeLumpedInertialContent.accumulate(iCellOrdinal, tVolume, tBasisValues, tMassWeight(0), tNodalMass, tCellMass);
+          }
+          else
+          {
+              interpolateFromNodal(iCellOrdinal, tBasisValues, aStateDotDot, tAcceleration);
 
-          interpolateFromNodal(iCellOrdinal, tBasisValues, aStateDot, tVelocity);
+              interpolateFromNodal(iCellOrdinal, tBasisValues, aStateDot, tVelocity);
 
-          computeInertialContent(tInertialContent, tVelocity, tAcceleration);
-          
-          applyMassWeighting(iCellOrdinal, aControl, tBasisValues, tInertialContent);
+              computeInertialContent(tInertialContent, tVelocity, tAcceleration);
 
-          projectInertialContent(iCellOrdinal, tVolume, tBasisValues, tInertialContent, aResult);
+              applyMassWeighting(iCellOrdinal, aControl, tBasisValues, tInertialContent);
+
+              projectInertialContent(iCellOrdinal, tVolume, tBasisValues, tInertialContent, aResult);
+          }
 
           for(int i=0; i<ElementType::mNumVoigtTerms; i++)
           {
@@ -341,6 +396,15 @@ namespace Hyperbolic
         
       });
 
+      if( tLumpedMass )
+      {
+          Kokkos::parallel_for("compute lumped inertial content", Kokkos::RangePolicy<>(0, tNumCells),
+          KOKKOS_LAMBDA(const Plato::OrdinalType iCellOrdinal)
+          {
+              computeLumpedInertialContent(iCellOrdinal, tNodalMass, tCellMass, aStateDot, aStateDotDot, aResult);
+          });
+      }
+
       Kokkos::parallel_for("compute cell quantities", Kokkos::RangePolicy<>(0, tNumCells),
       KOKKOS_LAMBDA(const Plato::OrdinalType iCellOrdinal)
       {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Plato_Solve.hpp"
 #include "PlatoStaticsTypes.hpp"
 #include "LinearElasticMaterial.hpp"
 
@@ -66,5 +67,94 @@ class InertialContent : public ElementType
 };
 // class InertialContent
 
+/******************************************************************************/
+/*! Lumped inertial content functor.
+  
+    given nodal accelerations and velocities, compute the inertial content,
+    m_i (a_i + \alpha v_i), with the element mass lumped to the nodes.  The
+    row sum lumping assigns node i the mass \int \rho N_i.  The HRZ lumping
+    assigns node i the mass \int \rho N_i^2 scaled such that the lumped masses
+    of an element add up to its mass.
+
+    The nodal masses are accumulated over the cubature points (accumulate),
+    then the content of each cell is added to the result (operator()).
+*/
+/******************************************************************************/
+template<typename ElementType>
+class LumpedInertialContent : public ElementType
+{
+  private:
+    using ElementType::mNumSpatialDims;
+    using ElementType::mNumNodesPerCell;
+    using ElementType::mNumDofsPerNode;
+
+    const Plato::Scalar mCellDensity;
+    const Plato::Scalar mRayleighA;
+    const Plato::Solve::Lumping mLumping;
+
+  public:
+    LumpedInertialContent(
+      const Teuchos::RCP<Plato::LinearElasticMaterial<mNumSpatialDims>> aMaterialModel,
+            Plato::Solve::Lumping aLumping
+    ) :
+            mCellDensity (aMaterialModel->getMassDensity()),
+            mRayleighA   (aMaterialModel->getRayleighA()),
+            mLumping     (aLumping) {}
+
+    template<typename TVolumeType, typename TWeightType, typename TMassScalarType>
+    KOKKOS_INLINE_FUNCTION void
+    accumulate( Plato::OrdinalType                                 aCellOrdinal,
+                const TVolumeType                                & aVolume,
+                const Plato::Array<mNumNodesPerCell>             & aBasisValues,
+                const TWeightType                                & aWeight,
+                const Plato::ScalarMultiVectorT<TMassScalarType> & aNodalMass,
+                const Plato::ScalarVectorT<TMassScalarType>      & aCellMass) const {
+
+      TMassScalarType tMass = mCellDensity * aWeight * aVolume;
+      for(Plato::OrdinalType tNode = 0; tNode < mNumNodesPerCell; tNode++)
+      {
+          TMassScalarType tNodalMass = tMass * aBasisValues(tNode);
+          if( mLumping == Plato::Solve::Lumping::HRZ )
+          {
+              tNodalMass *= aBasisValues(tNode);
+          }
+          Kokkos::atomic_add(&aNodalMass(aCellOrdinal, tNode), tNodalMass);
+      }
+      Kokkos::atomic_add(&aCellMass(aCellOrdinal), tMass);
+    }
+
+    template<typename TVelocityType, typename TAccelerationType, typename TMassScalarType, typename TResultScalarType>
+    KOKKOS_INLINE_FUNCTION void
+    operator()( Plato::OrdinalType                                   aCellOrdinal,
+                const Plato::ScalarMultiVectorT<TMassScalarType>   & aNodalMass,
+                const Plato::ScalarVectorT<TMassScalarType>        & aCellMass,
+                const Plato::ScalarMultiVectorT<TVelocityType>     & aVelocity,
+                const Plato::ScalarMultiVectorT<TAccelerationType> & aAcceleration,
+                const Plato::ScalarMultiVectorT<TResultScalarType> & aResult) const {
+
+      TMassScalarType tScale(1.0);
+      if( mLumping == Plato::Solve::Lumping::HRZ )
+      {
+          TMassScalarType tDiagonalMass(0.0);
+          for(Plato::OrdinalType tNode = 0; tNode < mNumNodesPerCell; tNode++)
+          {
+              tDiagonalMass += aNodalMass(aCellOrdinal, tNode);
+          }
+          tScale = aCellMass(aCellOrdinal) / tDiagonalMass;
+      }
+
+      for(Plato::OrdinalType tNode = 0; tNode < mNumNodesPerCell; tNode++)
+      {
+          for(Plato::OrdinalType tDimIndex = 0; tDimIndex < mNumSpatialDims; tDimIndex++)
+          {
+              Plato::OrdinalType tDof = mNumDofsPerNode * tNode + tDimIndex;
+              aResult(aCellOrdinal, tDof) += tScale * aNodalMass(aCellOrdinal, tNode)
+                * (aAcceleration(aCellOrdinal, tDof) + mRayleighA * aVelocity(aCellOrdinal, tDof));
+          }
+      }
+    }
+};
+// class LumpedInertialContent
+
 } // namespace Plato
 
@@ -21,8 +21,19 @@ class NewmarkIntegrator
         const Teuchos::ParameterList & aParams,
               Plato::Scalar            aMaxEigenvalue
     ) :
-        mGamma           (aParams.get<double>("Newmark Gamma") ),
-        mBeta            (aParams.get<double>("Newmark Beta") ),
+        NewmarkIntegrator(aParams, aMaxEigenvalue, aParams.get<double>("Newmark Gamma"), aParams.get<double>("Newmark Beta"))
+    {
+    }
+
+  protected:
+    NewmarkIntegrator(
+        const Teuchos::ParameterList & aParams,
+              Plato::Scalar            aMaxEigenvalue,
+              Plato::Scalar            aGamma,
+              Plato::Scalar            aBeta
+    ) :
+        mGamma           (aGamma),
+        mBeta            (aBeta),
         mTimeStep        (0.0),
         mTimeStepScale   (1.0),
         mTerminationTime (0.0),
@@ -98,8 +109,8 @@ class NewmarkIntegrator
         }
     }
 
-
-    ~NewmarkIntegrator() {}
+  public:
+    virtual ~NewmarkIntegrator() {}
 
     Plato::Scalar
     getOmega() const
@@ -113,6 +124,16 @@ class NewmarkIntegrator
         return mBeta < mGamma/2.0;
     }
 
+    /******************************************************************************//**
+     * \brief Return true if the effective operator of a step is the (lumped) mass, i.e.,
+     *        the steps do not require a linear solve
+    **********************************************************************************/
+    virtual bool
+    isExplicit() const
+    {
+        return false;
+    }
+
     decltype(mNumSteps)
     getNumSteps() const
     {
@@ -136,6 +157,9 @@ class NewmarkIntegrator
     virtual Plato::Scalar a_grad_u_prev ( Plato::Scalar aTimeStep ) = 0;
     virtual Plato::Scalar a_grad_v_prev ( Plato::Scalar aTimeStep ) = 0;
     virtual Plato::Scalar a_grad_a_prev ( Plato::Scalar aTimeStep ) = 0;
+    virtual Plato::Scalar u_grad_u_prev ( Plato::Scalar aTimeStep ) = 0;
+    virtual Plato::Scalar u_grad_v_prev ( Plato::Scalar aTimeStep ) = 0;
+    virtual Plato::Scalar u_grad_a_prev ( Plato::Scalar aTimeStep ) = 0;
 
     virtual Plato::ScalarVector 
     u_value(const Plato::ScalarVector & aU,
@@ -185,8 +209,11 @@ class NewmarkIntegratorUForm : public NewmarkIntegrator
     {
     }
 
-    Plato::Scalar v_grad_a ( Plato::Scalar aTimeStep ) override { return 0; }
-    Plato::Scalar u_grad_a ( Plato::Scalar aTimeStep ) override { return 0; }
+    Plato::Scalar v_grad_a      ( Plato::Scalar aTimeStep ) override { return 0; }
+    Plato::Scalar u_grad_a      ( Plato::Scalar aTimeStep ) override { return 0; }
+    Plato::Scalar u_grad_u_prev ( Plato::Scalar aTimeStep ) override { return 0; }
+    Plato::Scalar u_grad_v_prev ( Plato::Scalar aTimeStep ) override { return 0; }
+    Plato::Scalar u_grad_a_prev ( Plato::Scalar aTimeStep ) override { return 0; }
 
     Plato::Scalar
     v_grad_u( Plato::Scalar aTimeStep ) override
@@ -307,14 +334,30 @@ class NewmarkIntegratorAForm : public NewmarkIntegrator
     {
     }
 
+  protected:
+    NewmarkIntegratorAForm(
+        const Teuchos::ParameterList & aParams,
+              Plato::Scalar            aMaxEigenvalue,
+              Plato::Scalar            aGamma,
+              Plato::Scalar            aBeta
+    ) :
+        NewmarkIntegrator(aParams, aMaxEigenvalue, aGamma, aBeta)
+    {
+    }
+
+  public:
     ~NewmarkIntegratorAForm()
     {
     }
 
+    bool
+    isExplicit() const override
+    {
+        return mBeta == 0.0;
+    }
+
     Plato::Scalar v_grad_u      ( Plato::Scalar aTimeStep ) override { return 0; }
     Plato::Scalar v_grad_u_prev ( Plato::Scalar aTimeStep ) override { return 0; }
-    Plato::Scalar v_grad_v_prev ( Plato::Scalar aTimeStep ) override { return 0; }
-    Plato::Scalar v_grad_a_prev ( Plato::Scalar aTimeStep ) override { return 0; }
     Plato::Scalar a_grad_u      ( Plato::Scalar aTimeStep ) override { return 0; }
     Plato::Scalar a_grad_u_prev ( Plato::Scalar aTimeStep ) override { return 0; }
     Plato::Scalar a_grad_v_prev ( Plato::Scalar aTimeStep ) override { return 0; }
@@ -332,6 +375,36 @@ class NewmarkIntegratorAForm : public NewmarkIntegrator
         return -mBeta*aTimeStep*aTimeStep;
     }
 
+    Plato::Scalar
+    v_grad_v_prev( Plato::Scalar aTimeStep ) override
+    {
+        return -1.0;
+    }
+
+    Plato::Scalar
+    v_grad_a_prev( Plato::Scalar aTimeStep ) override
+    {
+        return -(1.0-mGamma)*aTimeStep;
+    }
+
+    Plato::Scalar
+    u_grad_u_prev( Plato::Scalar aTimeStep ) override
+    {
+        return -1.0;
+    }
+
+    Plato::Scalar
+    u_grad_v_prev( Plato::Scalar aTimeStep ) override
+    {
+        return -aTimeStep;
+    }
+
+    Plato::Scalar
+    u_grad_a_prev( Plato::Scalar aTimeStep ) override
+    {
+        return -(1.0-2.0*mBeta)*aTimeStep*aTimeStep/2.0;
+    }
+
     Plato::ScalarVector 
     v_value(const Plato::ScalarVector & aU,
             const Plato::ScalarVector & aU_prev,
@@ -389,4 +462,29 @@ class NewmarkIntegratorAForm : public NewmarkIntegrator
 
 };
 
+/******************************************************************************//**
+ * \brief Explicit central difference integrator, i.e., the acceleration-based
+ *        Newmark integrator with gamma=1/2 and beta=0.
+ *
+ * The effective operator of a step is the mass (plus the damping, if any), which
+ * the problem lumps.  The time step is not an input: it is the critical time step
+ * estimated from the element sizes and the wave speed, scaled by 'Time Step Scale'.
+**********************************************************************************/
+class CentralDifferenceIntegrator : public NewmarkIntegratorAForm
+{
+  public:
+    explicit
+    CentralDifferenceIntegrator(
+        const Teuchos::ParameterList & aParams,
+              Plato::Scalar            aMaxEigenvalue
+    ) :
+        NewmarkIntegratorAForm(aParams, aMaxEigenvalue, /*gamma=*/ 0.5, /*beta=*/ 0.0)
+    {
+    }
+
+    ~CentralDifferenceIntegrator()
+    {
+    }
+};
+
 } // namespace Plato
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <map>
+#include <vector>
+
 #include "PlatoStaticsTypes.hpp"
+#include "Plato_Solve.hpp"
 #include "Solutions.hpp"
 #include "EssentialBCs.hpp"
 #include "SpatialModel.hpp"
@@ -38,10 +42,12 @@ class Problem: public Plato::AbstractProblem
 
     Plato::OrdinalType mNumSteps;
     Plato::Scalar      mTimeStep;
+    Plato::OrdinalType mNumCheckpoints; /*!< number of stored time steps, zero stores every step */
 
     bool mSaveState;
 
     Criteria mCriteria;
+    std::map<std::string, Plato::Scalar> mCriterionValues; /*!< criteria summed over the time steps when checkpointed */
 
     Plato::ScalarMultiVector mAdjoints_U;
     Plato::ScalarMultiVector mAdjoints_V;
@@ -51,6 +57,15 @@ class Problem: public Plato::AbstractProblem
     Plato::ScalarMultiVector mVelocity;
     Plato::ScalarMultiVector mAcceleration;
 
+    Plato::ScalarMultiVector mCheckpointDisplacements; /*!< states of the checkpointed time steps */
+    Plato::ScalarMultiVector mCheckpointVelocities;
+    Plato::ScalarMultiVector mCheckpointAccelerations;
+    std::vector<Plato::OrdinalType> mCheckpointSteps;  /*!< time step stored in each checkpoint, -1 if none */
+
+    Plato::ScalarMultiVector mSweepDisplacement; /*!< previous and current states recomputed by the reverse sweep */
+    Plato::ScalarMultiVector mSweepVelocity;
+    Plato::ScalarMultiVector mSweepAcceleration;
+
     Plato::ScalarVector mInitDisplacement;
     Plato::ScalarVector mInitVelocity;
     Plato::ScalarVector mInitAcceleration;
@@ -78,6 +93,11 @@ class Problem: public Plato::AbstractProblem
     std::string mPDE; /*!< partial differential equation type */
     std::string mPhysics; /*!< physics used for the simulation */
     bool mUForm; /*!< true: displacement-based formulation, false: acceleration-based formulation */
+    bool mLinear; /*!< true: the jacobians are independent of the states and time, see 'Linear' in 'Time Integration' */
+
+    Plato::ScalarVector mEffectiveEntries; /*!< unconstrained entries of the effective operator of a linear problem */
+
+    Plato::ScalarVector mLumpedOperator; /*!< lumped effective operator of explicit integrators */
 
   public:
     Problem(
@@ -116,29 +136,116 @@ class Problem: public Plato::AbstractProblem
       const Teuchos::RCP<Plato::CrsMatrixType> & aMatrix,
       const Plato::ScalarVector                & aVector,
       const Plato::OrdinalVector               & aBcDofs,
-      const Plato::ScalarVector                & aBcValues
+      const Plato::ScalarVector                & aBcValues,
+            Plato::Scalar                        aScale = 1.0
     );
 
     void updateProblem(const Plato::ScalarVector & aControl, const Plato::Solutions & aSolution);
 
     Plato::Solutions solution(const Plato::ScalarVector & aControl);
 
-    void forwardStepUForm(
+    bool isCheckpointed() const;
+
+    void advance(
+        const Plato::ScalarVector      & aControl,
+              Plato::OrdinalType         aStepIndex,
+        const Plato::ScalarMultiVector & aDisplacement,
+        const Plato::ScalarMultiVector & aVelocity,
+        const Plato::ScalarMultiVector & aAcceleration,
+              Plato::OrdinalType         aPrevRow,
+              Plato::OrdinalType         aRow
+    );
+
+    void recompute(
         const Plato::ScalarVector & aControl,
-              Plato::Scalar       & aCurrentTime,
+              Plato::OrdinalType    aSlot,
               Plato::OrdinalType    aStepIndex
     );
 
+    void storeCheckpoint(
+              Plato::OrdinalType    aSlot,
+              Plato::OrdinalType    aStepIndex,
+        const Plato::ScalarVector & aDisplacement,
+        const Plato::ScalarVector & aVelocity,
+        const Plato::ScalarVector & aAcceleration
+    );
+
+    void forwardStepUForm(
+        const Plato::ScalarVector      & aControl,
+              Plato::Scalar              aCurrentTime,
+              Plato::OrdinalType         aStepIndex,
+        const Plato::ScalarMultiVector & aDisplacement,
+        const Plato::ScalarMultiVector & aVelocity,
+        const Plato::ScalarMultiVector & aAcceleration,
+              Plato::OrdinalType         aPrevRow,
+              Plato::OrdinalType         aRow
+    );
+
     void forwardStepAForm(
-        const Plato::ScalarVector & aControl,
-              Plato::Scalar       & aCurrentTime,
-              Plato::OrdinalType    aStepIndex
+        const Plato::ScalarVector      & aControl,
+              Plato::Scalar              aCurrentTime,
+              Plato::OrdinalType         aStepIndex,
+        const Plato::ScalarMultiVector & aDisplacement,
+        const Plato::ScalarMultiVector & aVelocity,
+        const Plato::ScalarMultiVector & aAcceleration,
+              Plato::OrdinalType         aPrevRow,
+              Plato::OrdinalType         aRow
+    );
+
+    void forwardStepExplicit(
+        const Plato::ScalarVector      & aControl,
+              Plato::Scalar              aCurrentTime,
+              Plato::OrdinalType         aStepIndex,
+        const Plato::ScalarMultiVector & aDisplacement,
+        const Plato::ScalarMultiVector & aVelocity,
+        const Plato::ScalarMultiVector & aAcceleration,
+              Plato::OrdinalType         aPrevRow,
+              Plato::OrdinalType         aRow
+    );
+
+    void computeLumpedOperator(
+        const Plato::ScalarVector & aControl
     );
 
     void computeInitialState(
         const Plato::ScalarVector & aControl
     );
 
+    void adjointStepUForm(
+        const Plato::ScalarVector & aControl,
+              Plato::Scalar         aCurrentTime,
+              Plato::OrdinalType    aStepIndex,
+        const Plato::ScalarVector & aU,
+        const Plato::ScalarVector & aV,
+        const Plato::ScalarVector & aA,
+              Plato::ScalarVector   a_dFdu,
+              Plato::ScalarVector   a_dFdv,
+              Plato::ScalarVector   a_dFda
+    );
+
+    void adjointStepAForm(
+        const Plato::ScalarVector & aControl,
+              Plato::Scalar         aCurrentTime,
+              Plato::OrdinalType    aStepIndex,
+        const Plato::ScalarVector & aU,
+        const Plato::ScalarVector & aV,
+        const Plato::ScalarVector & aA,
+              Plato::ScalarVector   a_dFdu,
+              Plato::ScalarVector   a_dFdv,
+              Plato::ScalarVector   a_dFda
+    );
+
+    bool updateAdjointJacobians(
+        const Plato::ScalarVector & aU,
+        const Plato::ScalarVector & aV,
+        const Plato::ScalarVector & aA,
+        const Plato::ScalarVector & aControl,
+              Plato::Scalar         aCurrentTime,
+              bool                  aFirstStep
+    );
+
+    void saveEffectiveOperator(const Teuchos::RCP<Plato::CrsMatrixType> & aMatrix);
+
     void constrainFieldsAtBoundary(
               Plato::ScalarVector & aDisplacement,
               Plato::ScalarVector & aVelocity,
@@ -200,6 +307,12 @@ class Problem: public Plato::AbstractProblem
               Criterion             aCriterion
     );
 
+    Plato::ScalarVector adjointGradient(
+        const Plato::ScalarVector & aControl,
+              Criterion             aCriterion,
+              bool                  aConfigGradient
+    );
+
   private:
     Plato::Solutions getSolution() const override;
 };
@@ -11,6 +11,9 @@
 #include "solver/PlatoSolverFactory.hpp"
 #include "Plato_Solve.hpp"
 #include "ComputedField.hpp"
+#include "ParseTools.hpp"
+#include "PlatoUtilities.hpp"
+#include "BinomialCheckpoints.hpp"
 
 #include "hyperbolic/Newmark.hpp"
 #include "hyperbolic/ScalarFunctionFactory.hpp"
@@ -67,7 +70,19 @@ namespace Hyperbolic
 
         auto tIntegratorParams = aProblemParams.sublist("Time Integration");
 
-        if (tIntegratorParams.isType<bool>("A-Form"))
+        auto tIntegratorType = Plato::ParseTools::getParam<std::string>(tIntegratorParams, "Integrator", "Newmark");
+        auto tCentralDifference = (tIntegratorType == "Central Difference");
+        if (!tCentralDifference && tIntegratorType != "Newmark")
+        {
+            ANALYZE_THROWERR("Unknown 'Integrator' in 'Time Integration': " + tIntegratorType
+              + ". Options are 'Newmark' and 'Central Difference'.");
+        }
+
+        if (tCentralDifference)
+        {
+            mUForm = false;
+        }
+        else if (tIntegratorParams.isType<bool>("A-Form"))
         {
             auto tAForm = tIntegratorParams.get<bool>("A-Form");
             mUForm = !tAForm;
@@ -79,13 +94,44 @@ namespace Hyperbolic
 
         auto tMaxEigenvalue = mPDEConstraint.getMaxEigenvalue();
 
-        if (mUForm)
+        if (tCentralDifference)
+            mIntegrator = std::make_shared<Plato::CentralDifferenceIntegrator>(tIntegratorParams, tMaxEigenvalue);
+        else if (mUForm)
             mIntegrator = std::make_shared<Plato::NewmarkIntegratorUForm>(tIntegratorParams, tMaxEigenvalue);
         else
             mIntegrator = std::make_shared<Plato::NewmarkIntegratorAForm>(tIntegratorParams, tMaxEigenvalue);
 
+        // with central difference the residual lumps the mass per element, so the operator is already
+        // diagonal unless stiffness proportional damping couples the nodes; its row sum is used then.
+        // the explicit newmark a-form lumps the assembled operator, which only admits the row sum.
+        auto tLumping = Plato::Solve::lumping(
+          Plato::ParseTools::getParam<std::string>(tIntegratorParams, "Mass Lumping", "Row Sum"));
+        if (!tCentralDifference && tLumping == Plato::Solve::Lumping::HRZ)
+        {
+            ANALYZE_THROWERR("'Mass Lumping' of 'HRZ' requires the 'Central Difference' integrator.");
+        }
+
         mNumSteps = mIntegrator->getNumSteps();
         mTimeStep = mIntegrator->getTimeStep();
+
+        mLinear = Plato::ParseTools::getParam<bool>(tIntegratorParams, "Linear", /*default=*/ false);
+
+        mNumCheckpoints = Plato::ParseTools::getParam<int>(tIntegratorParams, "Checkpoints", /*default=*/ 0);
+    }
+
+    template<typename PhysicsType>
+    void
+    Problem<PhysicsType>::
+    saveEffectiveOperator(
+      const Teuchos::RCP<Plato::CrsMatrixType> & aMatrix
+    )
+    {
+        auto tEntries = aMatrix->entries();
+        if( mEffectiveEntries.extent(0) != tEntries.extent(0) )
+        {
+            mEffectiveEntries = Plato::ScalarVector("effective operator entries", tEntries.extent(0));
+        }
+        Kokkos::deep_copy(mEffectiveEntries, tEntries);
     }
 
     template<typename PhysicsType>
@@ -93,9 +139,23 @@ namespace Hyperbolic
     Problem<PhysicsType>::
     allocateStateData()
     {
-        mDisplacement = Plato::ScalarMultiVector("Displacement", mNumSteps, mPDEConstraint.size());
-        mVelocity     = Plato::ScalarMultiVector("Velocity",     mNumSteps, mPDEConstraint.size());
-        mAcceleration = Plato::ScalarMultiVector("Acceleration", mNumSteps, mPDEConstraint.size());
+        // with checkpointing, only the previous and current states are stored
+        auto tNumRows = this->isCheckpointed() ? 2 : mNumSteps;
+        mDisplacement = Plato::ScalarMultiVector("Displacement", tNumRows, mPDEConstraint.size());
+        mVelocity     = Plato::ScalarMultiVector("Velocity",     tNumRows, mPDEConstraint.size());
+        mAcceleration = Plato::ScalarMultiVector("Acceleration", tNumRows, mPDEConstraint.size());
+
+        if(this->isCheckpointed())
+        {
+            auto tLength = mPDEConstraint.size();
+            mCheckpointDisplacements = Plato::ScalarMultiVector("Checkpoint Displacements", mNumCheckpoints, tLength);
+            mCheckpointVelocities    = Plato::ScalarMultiVector("Checkpoint Velocities",    mNumCheckpoints, tLength);
+            mCheckpointAccelerations = Plato::ScalarMultiVector("Checkpoint Accelerations", mNumCheckpoints, tLength);
+            mSweepDisplacement       = Plato::ScalarMultiVector("Sweep Displacement",       2, tLength);
+            mSweepVelocity           = Plato::ScalarMultiVector("Sweep Velocity",           2, tLength);
+            mSweepAcceleration       = Plato::ScalarMultiVector("Sweep Acceleration",       2, tLength);
+            mCheckpointSteps.assign(mNumCheckpoints, -1);
+        }
     }
 
     template<typename PhysicsType>
@@ -118,6 +178,17 @@ namespace Hyperbolic
                 TEUCHOS_TEST_FOR_EXCEPTION(!tEntry.isList(), std::logic_error,
                   " Parameter in Criteria block not valid.  Expect lists only.");
 
+                if(this->isCheckpointed())
+                {
+                    // checkpointed criteria are summed over the time steps
+                    auto tFunctionType = Plato::ParseTools::getSubParam<std::string>(tCriteriaParams, tName, "Scalar Function Type", "");
+                    if(Plato::tolower(tFunctionType) == "stress p-norm")
+                    {
+                        ANALYZE_THROWERR("Criterion '" + tName + "': 'Stress P-Norm' isn't a sum over the time steps, "
+                          + "so it can't be evaluated with 'Checkpoints' in 'Time Integration'.");
+                    }
+                }
+
                 {
                     auto tCriterion = tFunctionBaseFactory.create(mSpatialModel, mDataMap, aProblemParams, tName);
                     if( tCriterion != nullptr )
@@ -128,10 +199,11 @@ namespace Hyperbolic
             }
             if( mCriteria.size() )
             {
+                // the adjoints of a time step only depend on those of the next step
                 auto tLength = mPDEConstraint.size();
-                mAdjoints_U = Plato::ScalarMultiVector("MyAdjoint U", mNumSteps, tLength);
-                mAdjoints_V = Plato::ScalarMultiVector("MyAdjoint V", mNumSteps, tLength);
-                mAdjoints_A = Plato::ScalarMultiVector("MyAdjoint A", mNumSteps, tLength);
+                mAdjoints_U = Plato::ScalarMultiVector("MyAdjoint U", 2, tLength);
+                mAdjoints_V = Plato::ScalarMultiVector("MyAdjoint V", 2, tLength);
+                mAdjoints_A = Plato::ScalarMultiVector("MyAdjoint A", 2, tLength);
             }
         }
     }
@@ -219,6 +291,11 @@ namespace Hyperbolic
       Comm::Machine            aMachine
     )
     {
+        if (mIntegrator->isExplicit())
+        {
+            // explicit steps and their adjoints only solve lumped systems
+            return;
+        }
         Plato::SolverFactory tSolverFactory(aProblemParams.sublist("Linear Solver"));
         mSolver = tSolverFactory.create(aMesh->NumNodes(), aMachine, ElementType::mNumDofsPerNode);
     }
@@ -259,16 +336,17 @@ namespace Hyperbolic
       const Teuchos::RCP<Plato::CrsMatrixType> & aMatrix,
       const Plato::ScalarVector                & aVector,
       const Plato::OrdinalVector               & aBcDofs,
-      const Plato::ScalarVector                & aBcValues
+      const Plato::ScalarVector                & aBcValues,
+            Plato::Scalar                        aScale
     )
     {
         if(mJacobianU->isBlockMatrix())
         {
-            Plato::applyBlockConstraints<ElementType::mNumDofsPerNode>(aMatrix, aVector, aBcDofs, aBcValues);
+            Plato::applyBlockConstraints<ElementType::mNumDofsPerNode>(aMatrix, aVector, aBcDofs, aBcValues, aScale);
         }
         else
         {
-            Plato::applyConstraints<ElementType::mNumDofsPerNode>(aMatrix, aVector, aBcDofs, aBcValues);
+            Plato::applyConstraints<ElementType::mNumDofsPerNode>(aMatrix, aVector, aBcDofs, aBcValues, aScale);
         }
     }
 
@@ -285,16 +363,66 @@ namespace Hyperbolic
     {
         this->computeInitialState(aControl);
 
-        Plato::Scalar tCurrentTime(0.0);
+        if (mIntegrator->isExplicit())
+        {
+            this->computeLumpedOperator(aControl);
+        }
+
+        // checkpoints taken by the forward sweep are the first ones used by the reverse sweep
+        std::vector<Plato::OrdinalType> tCheckpointChain;
+        if(this->isCheckpointed())
+        {
+            for(const auto & tPair : mCriteria) { mCriterionValues[tPair.first] = 0.0; }
+            tCheckpointChain = Plato::binomial_checkpoint_chain(mNumSteps, mNumCheckpoints);
+
+            // the first checkpoint holds the initial state
+            Plato::ScalarVector tDisplacementInit = Kokkos::subview(mDisplacement, /*StepIndex=*/0, Kokkos::ALL());
+            Plato::ScalarVector tVelocityInit     = Kokkos::subview(mVelocity,     /*StepIndex=*/0, Kokkos::ALL());
+            Plato::ScalarVector tAccelerationInit = Kokkos::subview(mAcceleration, /*StepIndex=*/0, Kokkos::ALL());
+            this->storeCheckpoint(/*slot=*/0, /*step=*/0, tDisplacementInit, tVelocityInit, tAccelerationInit);
+        }
+        std::size_t tNextCheckpoint = 0;
+
         for(Plato::OrdinalType tStepIndex = 1; tStepIndex < mNumSteps; tStepIndex++) {
 
-            if (mUForm)
+            // with checkpointing, only the previous (row 0) and current (row 1) states are stored
+            auto tPrevRow = this->isCheckpointed() ? 0 : tStepIndex-1;
+            auto tRow     = this->isCheckpointed() ? 1 : tStepIndex;
+            this->advance(aControl, tStepIndex, mDisplacement, mVelocity, mAcceleration, tPrevRow, tRow);
+
+            Plato::ScalarVector tDisplacement = Kokkos::subview(mDisplacement, tRow, Kokkos::ALL());
+            Plato::ScalarVector tVelocity     = Kokkos::subview(mVelocity,     tRow, Kokkos::ALL());
+            Plato::ScalarVector tAcceleration = Kokkos::subview(mAcceleration, tRow, Kokkos::ALL());
+
+            if ( mSaveState )
             {
-                this->forwardStepUForm(aControl, tCurrentTime, tStepIndex );
+                // evaluate at new state
+                Plato::Scalar tCurrentTime = tStepIndex*mTimeStep;
+                auto tResidual = mPDEConstraint.value(tDisplacement, tVelocity, tAcceleration, aControl, mTimeStep, tCurrentTime);
+                mDataMap.saveState(tStepIndex, tCurrentTime);
             }
-            else
+
+            if(this->isCheckpointed())
             {
-                this->forwardStepAForm(aControl, tCurrentTime, tStepIndex );
+                // criteria are sums over the time steps
+                auto tSolution = this->getSolution();
+                for(const auto & tPair : mCriteria)
+                {
+                    mCriterionValues[tPair.first] += tPair.second->value(tSolution, aControl, mTimeStep);
+                }
+
+                if(tNextCheckpoint < tCheckpointChain.size() && tCheckpointChain[tNextCheckpoint] == tStepIndex)
+                {
+                    tNextCheckpoint++;
+                    this->storeCheckpoint(tNextCheckpoint, tStepIndex, tDisplacement, tVelocity, tAcceleration);
+                }
+
+                if(tStepIndex < mNumSteps-1)
+                {
+                    Kokkos::deep_copy(Kokkos::subview(mDisplacement, tPrevRow, Kokkos::ALL()), tDisplacement);
+                    Kokkos::deep_copy(Kokkos::subview(mVelocity,     tPrevRow, Kokkos::ALL()), tVelocity);
+                    Kokkos::deep_copy(Kokkos::subview(mAcceleration, tPrevRow, Kokkos::ALL()), tAcceleration);
+                }
             }
         }
 
@@ -302,24 +430,123 @@ namespace Hyperbolic
         return tSolution;
     }
 
+    template<typename PhysicsType>
+    bool
+    Problem<PhysicsType>::
+    isCheckpointed() const
+    {
+        return mNumCheckpoints > 0 && mNumCheckpoints < mNumSteps;
+    }
+
     template<typename PhysicsType>
     void
     Problem<PhysicsType>::
-    forwardStepUForm(
+    advance(
+        const Plato::ScalarVector      & aControl,
+              Plato::OrdinalType         aStepIndex,
+        const Plato::ScalarMultiVector & aDisplacement,
+        const Plato::ScalarMultiVector & aVelocity,
+        const Plato::ScalarMultiVector & aAcceleration,
+              Plato::OrdinalType         aPrevRow,
+              Plato::OrdinalType         aRow
+    )
+    {
+        // start from zero so that recomputed steps reproduce the forward sweep
+        Kokkos::deep_copy(Kokkos::subview(aDisplacement, aRow, Kokkos::ALL()), 0.0);
+        Kokkos::deep_copy(Kokkos::subview(aVelocity,     aRow, Kokkos::ALL()), 0.0);
+        Kokkos::deep_copy(Kokkos::subview(aAcceleration, aRow, Kokkos::ALL()), 0.0);
+
+        Plato::Scalar tCurrentTime = aStepIndex*mTimeStep;
+        if (mIntegrator->isExplicit())
+        {
+            this->forwardStepExplicit(aControl, tCurrentTime, aStepIndex, aDisplacement, aVelocity, aAcceleration, aPrevRow, aRow);
+        }
+        else if (mUForm)
+        {
+            this->forwardStepUForm(aControl, tCurrentTime, aStepIndex, aDisplacement, aVelocity, aAcceleration, aPrevRow, aRow);
+        }
+        else
+        {
+            this->forwardStepAForm(aControl, tCurrentTime, aStepIndex, aDisplacement, aVelocity, aAcceleration, aPrevRow, aRow);
+        }
+    }
+
+    template<typename PhysicsType>
+    void
+    Problem<PhysicsType>::
+    recompute(
         const Plato::ScalarVector & aControl,
-              Plato::Scalar       & aCurrentTime,
+              Plato::OrdinalType    aSlot,
               Plato::OrdinalType    aStepIndex
     )
     {
-        aCurrentTime += mTimeStep;
+        Plato::ScalarVector tDisplacementPrev = Kokkos::subview(mSweepDisplacement, 0, Kokkos::ALL());
+        Plato::ScalarVector tVelocityPrev     = Kokkos::subview(mSweepVelocity,     0, Kokkos::ALL());
+        Plato::ScalarVector tAccelerationPrev = Kokkos::subview(mSweepAcceleration, 0, Kokkos::ALL());
+        Plato::ScalarVector tDisplacement     = Kokkos::subview(mSweepDisplacement, 1, Kokkos::ALL());
+        Plato::ScalarVector tVelocity         = Kokkos::subview(mSweepVelocity,     1, Kokkos::ALL());
+        Plato::ScalarVector tAcceleration     = Kokkos::subview(mSweepAcceleration, 1, Kokkos::ALL());
+
+        if(aStepIndex == mCheckpointSteps[aSlot] && aSlot > 0)
+        {
+            // the checkpointed step itself: the previous step isn't stored, so recompute
+            // it from the preceding checkpoint, which stores an earlier step
+            this->recompute(aControl, aSlot-1, aStepIndex-1);
+            Kokkos::deep_copy(tDisplacementPrev, tDisplacement);
+            Kokkos::deep_copy(tVelocityPrev,     tVelocity);
+            Kokkos::deep_copy(tAccelerationPrev, tAcceleration);
+        }
+        Kokkos::deep_copy(tDisplacement, Kokkos::subview(mCheckpointDisplacements, aSlot, Kokkos::ALL()));
+        Kokkos::deep_copy(tVelocity,     Kokkos::subview(mCheckpointVelocities,    aSlot, Kokkos::ALL()));
+        Kokkos::deep_copy(tAcceleration, Kokkos::subview(mCheckpointAccelerations, aSlot, Kokkos::ALL()));
+
+        for(Plato::OrdinalType tStepIndex = mCheckpointSteps[aSlot]+1; tStepIndex <= aStepIndex; tStepIndex++)
+        {
+            Kokkos::deep_copy(tDisplacementPrev, tDisplacement);
+            Kokkos::deep_copy(tVelocityPrev,     tVelocity);
+            Kokkos::deep_copy(tAccelerationPrev, tAcceleration);
+            this->advance(aControl, tStepIndex, mSweepDisplacement, mSweepVelocity, mSweepAcceleration, /*prev row=*/0, /*row=*/1);
+        }
+    }
+
+    template<typename PhysicsType>
+    void
+    Problem<PhysicsType>::
+    storeCheckpoint(
+              Plato::OrdinalType    aSlot,
+              Plato::OrdinalType    aStepIndex,
+        const Plato::ScalarVector & aDisplacement,
+        const Plato::ScalarVector & aVelocity,
+        const Plato::ScalarVector & aAcceleration
+    )
+    {
+        Kokkos::deep_copy(Kokkos::subview(mCheckpointDisplacements, aSlot, Kokkos::ALL()), aDisplacement);
+        Kokkos::deep_copy(Kokkos::subview(mCheckpointVelocities,    aSlot, Kokkos::ALL()), aVelocity);
+        Kokkos::deep_copy(Kokkos::subview(mCheckpointAccelerations, aSlot, Kokkos::ALL()), aAcceleration);
+        mCheckpointSteps[aSlot] = aStepIndex;
+    }
 
-        Plato::ScalarVector tDisplacementPrev = Kokkos::subview(mDisplacement, aStepIndex-1, Kokkos::ALL());
-        Plato::ScalarVector tVelocityPrev     = Kokkos::subview(mVelocity,     aStepIndex-1, Kokkos::ALL());
-        Plato::ScalarVector tAccelerationPrev = Kokkos::subview(mAcceleration, aStepIndex-1, Kokkos::ALL());
+    template<typename PhysicsType>
+    void
+    Problem<PhysicsType>::
+    forwardStepUForm(
+        const Plato::ScalarVector      & aControl,
+              Plato::Scalar              aCurrentTime,
+              Plato::OrdinalType         aStepIndex,
+        const Plato::ScalarMultiVector & aDisplacement,
+        const Plato::ScalarMultiVector & aVelocity,
+        const Plato::ScalarMultiVector & aAcceleration,
+              Plato::OrdinalType         aPrevRow,
+              Plato::OrdinalType         aRow
+    )
+    {
+        Plato::ScalarVector tDisplacementPrev = Kokkos::subview(aDisplacement, aPrevRow, Kokkos::ALL());
+        Plato::ScalarVector tVelocityPrev     = Kokkos::subview(aVelocity,     aPrevRow, Kokkos::ALL());
+        Plato::ScalarVector tAccelerationPrev = Kokkos::subview(aAcceleration, aPrevRow, Kokkos::ALL());
 
-        Plato::ScalarVector tDisplacement = Kokkos::subview(mDisplacement, aStepIndex, Kokkos::ALL());
-        Plato::ScalarVector tVelocity     = Kokkos::subview(mVelocity,     aStepIndex, Kokkos::ALL());
-        Plato::ScalarVector tAcceleration = Kokkos::subview(mAcceleration, aStepIndex, Kokkos::ALL());
+        Plato::ScalarVector tDisplacement = Kokkos::subview(aDisplacement, aRow, Kokkos::ALL());
+        Plato::ScalarVector tVelocity     = Kokkos::subview(aVelocity,     aRow, Kokkos::ALL());
+        Plato::ScalarVector tAcceleration = Kokkos::subview(aAcceleration, aRow, Kokkos::ALL());
 
         // -R
         auto tResidual = 
@@ -331,8 +558,14 @@ namespace Hyperbolic
                                                tVelocity,     tVelocityPrev,
                                                tAcceleration, tAccelerationPrev, mTimeStep);
 
+        // a linear problem reuses the jacobians and the effective operator of the first step
+        auto tReuseOperator = mLinear && aStepIndex > 1;
+
         // R_{,v^N}
-        mJacobianV = mPDEConstraint.gradient_v(tDisplacement, tVelocity, tAcceleration, aControl, mTimeStep, aCurrentTime);
+        if( !tReuseOperator )
+        {
+            mJacobianV = mPDEConstraint.gradient_v(tDisplacement, tVelocity, tAcceleration, aControl, mTimeStep, aCurrentTime);
+        }
 
         // -R += R_{,v^N} R_{v}
         Plato::MatrixTimesVectorPlusVector(mJacobianV, tResidualV, tResidual);
@@ -343,25 +576,38 @@ namespace Hyperbolic
                                                tAcceleration, tAccelerationPrev, mTimeStep);
 
         // R_{,a^N}
-        mJacobianA = mPDEConstraint.gradient_a(tDisplacement, tVelocity, tAcceleration, aControl, mTimeStep, aCurrentTime);
+        if( !tReuseOperator )
+        {
+            mJacobianA = mPDEConstraint.gradient_a(tDisplacement, tVelocity, tAcceleration, aControl, mTimeStep, aCurrentTime);
+        }
 
         // -R += R_{,a^N} R_{a}
         Plato::MatrixTimesVectorPlusVector(mJacobianA, tResidualA, tResidual);
 
-        // R_{,u^N}
-        mJacobianU = mPDEConstraint.gradient_u(tDisplacement, tVelocity, tAcceleration, aControl, mTimeStep, aCurrentTime);
-
         // R_{v,u^N}
         auto tR_vu = mIntegrator->v_grad_u(mTimeStep);
 
-        // R_{,u^N} += R_{,v^N} R_{v,u^N}
-        Plato::blas1::axpy(-tR_vu, mJacobianV->entries(), mJacobianU->entries());
-
         // R_{a,u^N}
         auto tR_au = mIntegrator->a_grad_u(mTimeStep);
 
-        // R_{,u^N} += R_{,a^N} R_{a,u^N}
-        Plato::blas1::axpy(-tR_au, mJacobianA->entries(), mJacobianU->entries());
+        if( tReuseOperator )
+        {
+            // restore the unconstrained effective operator
+            Kokkos::deep_copy(mJacobianU->entries(), mEffectiveEntries);
+        }
+        else
+        {
+            // R_{,u^N}
+            mJacobianU = mPDEConstraint.gradient_u(tDisplacement, tVelocity, tAcceleration, aControl, mTimeStep, aCurrentTime);
+
+            // R_{,u^N} += R_{,v^N} R_{v,u^N}
+            Plato::blas1::axpy(-tR_vu, mJacobianV->entries(), mJacobianU->entries());
+
+            // R_{,u^N} += R_{,a^N} R_{a,u^N}
+            Plato::blas1::axpy(-tR_au, mJacobianA->entries(), mJacobianU->entries());
+
+            if( mLinear ) { this->saveEffectiveOperator(mJacobianU); }
+        }
 
         mStateBoundaryConditions.get(mStateBcDofs, mStateBcValues, aCurrentTime);
         this->applyConstraints(mJacobianU, tResidual);
@@ -370,6 +616,7 @@ namespace Hyperbolic
         Plato::blas1::fill(static_cast<Plato::Scalar>(0.0), tDeltaD);
 
         // compute displacement increment:
+        if( tReuseOperator ) { mSolver->reuseOperator(); }
         mSolver->solve(*mJacobianU, tDeltaD, tResidual);
 
         // compute and add velocity increment: \Delta v = - ( R_{v} + R_{v,u} \Delta u )
@@ -387,33 +634,29 @@ namespace Hyperbolic
 
         // fill in essential boundary fields
         this->constrainFieldsAtBoundary(tDisplacement,tVelocity,tAcceleration,aCurrentTime);
-
-        if ( mSaveState )
-        {
-            // evaluate at new state
-            tResidual  = mPDEConstraint.value(tDisplacement, tVelocity, tAcceleration, aControl, mTimeStep, aCurrentTime);
-            mDataMap.saveState();
-        }
     }
 
     template<typename PhysicsType>
     void
     Problem<PhysicsType>::
     forwardStepAForm(
-        const Plato::ScalarVector & aControl,
-              Plato::Scalar       & aCurrentTime,
-              Plato::OrdinalType    aStepIndex
+        const Plato::ScalarVector      & aControl,
+              Plato::Scalar              aCurrentTime,
+              Plato::OrdinalType         aStepIndex,
+        const Plato::ScalarMultiVector & aDisplacement,
+        const Plato::ScalarMultiVector & aVelocity,
+        const Plato::ScalarMultiVector & aAcceleration,
+              Plato::OrdinalType         aPrevRow,
+              Plato::OrdinalType         aRow
     )
     {
-        aCurrentTime += mTimeStep;
+        Plato::ScalarVector tDisplacementPrev = Kokkos::subview(aDisplacement, aPrevRow, Kokkos::ALL());
+        Plato::ScalarVector tVelocityPrev     = Kokkos::subview(aVelocity,     aPrevRow, Kokkos::ALL());
+        Plato::ScalarVector tAccelerationPrev = Kokkos::subview(aAcceleration, aPrevRow, Kokkos::ALL());
 
-        Plato::ScalarVector tDisplacementPrev = Kokkos::subview(mDisplacement, aStepIndex-1, Kokkos::ALL());
-        Plato::ScalarVector tVelocityPrev     = Kokkos::subview(mVelocity,     aStepIndex-1, Kokkos::ALL());
-        Plato::ScalarVector tAccelerationPrev = Kokkos::subview(mAcceleration, aStepIndex-1, Kokkos::ALL());
-
-        Plato::ScalarVector tDisplacement = Kokkos::subview(mDisplacement, aStepIndex, Kokkos::ALL());
-        Plato::ScalarVector tVelocity     = Kokkos::subview(mVelocity,     aStepIndex, Kokkos::ALL());
-        Plato::ScalarVector tAcceleration = Kokkos::subview(mAcceleration, aStepIndex, Kokkos::ALL());
+        Plato::ScalarVector tDisplacement = Kokkos::subview(aDisplacement, aRow, Kokkos::ALL());
+        Plato::ScalarVector tVelocity     = Kokkos::subview(aVelocity,     aRow, Kokkos::ALL());
+        Plato::ScalarVector tAcceleration = Kokkos::subview(aAcceleration, aRow, Kokkos::ALL());
 
         // -R
         auto tResidual  = mPDEConstraint.value(tDisplacement, tVelocity, tAcceleration, aControl, mTimeStep, aCurrentTime);
@@ -424,8 +667,14 @@ namespace Hyperbolic
                                                 tVelocity,     tVelocityPrev,
                                                 tAcceleration, tAccelerationPrev, mTimeStep);
 
+        // a linear problem reuses the jacobians and the effective operator of the first step
+        auto tReuseOperator = mLinear && aStepIndex > 1;
+
         // R_{,v^N}
-        mJacobianV = mPDEConstraint.gradient_v(tDisplacement, tVelocity, tAcceleration, aControl, mTimeStep, aCurrentTime);
+        if( !tReuseOperator )
+        {
+            mJacobianV = mPDEConstraint.gradient_v(tDisplacement, tVelocity, tAcceleration, aControl, mTimeStep, aCurrentTime);
+        }
 
         // -R += R_{,v^N} R_{v}
         Plato::MatrixTimesVectorPlusVector(mJacobianV, tResidualV, tResidual);
@@ -436,39 +685,48 @@ namespace Hyperbolic
                                                 tAcceleration, tAccelerationPrev, mTimeStep);
 
         // R_{,u^N}
-        mJacobianU = mPDEConstraint.gradient_u(tDisplacement, tVelocity, tAcceleration, aControl, mTimeStep, aCurrentTime);
+        if( !tReuseOperator )
+        {
+            mJacobianU = mPDEConstraint.gradient_u(tDisplacement, tVelocity, tAcceleration, aControl, mTimeStep, aCurrentTime);
+        }
 
         // -R += R_{,u^N} R_{u}
         Plato::MatrixTimesVectorPlusVector(mJacobianU, tResidualU, tResidual);
 
-        // R_{,a^N}
-        mJacobianA = mPDEConstraint.gradient_a(tDisplacement, tVelocity, tAcceleration, aControl, mTimeStep, aCurrentTime);
-
         // R_{v,a^N}
         auto tR_va = mIntegrator->v_grad_a(mTimeStep);
 
-        // R_{,a^N} -= R_{,v^N} R_{v,a^N}
-        Plato::blas1::axpy(-tR_va, mJacobianV->entries(), mJacobianA->entries());
-
         // R_{u,a^N}
         auto tR_ua = mIntegrator->u_grad_a(mTimeStep);
 
-        // R_{,a^N} -= R_{,u^N} R_{u,a^N}
-        Plato::blas1::axpy(-tR_ua, mJacobianU->entries(), mJacobianA->entries());
+        if( tReuseOperator )
+        {
+            // restore the unconstrained effective operator
+            Kokkos::deep_copy(mJacobianA->entries(), mEffectiveEntries);
+        }
+        else
+        {
+            // R_{,a^N}
+            mJacobianA = mPDEConstraint.gradient_a(tDisplacement, tVelocity, tAcceleration, aControl, mTimeStep, aCurrentTime);
+
+            // R_{,a^N} -= R_{,v^N} R_{v,a^N}
+            Plato::blas1::axpy(-tR_va, mJacobianV->entries(), mJacobianA->entries());
+
+            // R_{,a^N} -= R_{,u^N} R_{u,a^N}
+            Plato::blas1::axpy(-tR_ua, mJacobianU->entries(), mJacobianA->entries());
+
+            if( mLinear ) { this->saveEffectiveOperator(mJacobianA); }
+        }
 
         mStateDotDotBoundaryConditions.get(mStateDotDotBcDofs, mStateDotDotBcValues, aCurrentTime);
-        this->applyConstraints(mJacobianA, tResidual);
 
         Plato::ScalarVector tDeltaA("increment", tAcceleration.extent(0));
         Plato::blas1::fill(static_cast<Plato::Scalar>(0.0), tDeltaA);
 
         // compute acceleration increment:
-        if(tR_ua == 0.0)
-        {
-          Plato::Solve::RowSummed<ElementType::mNumDofsPerNode>(mJacobianA, tDeltaA, tResidual);
-        } else {
-          mSolver->solve(*mJacobianA, tDeltaA, tResidual);
-        }
+        this->applyConstraints(mJacobianA, tResidual);
+        if( tReuseOperator ) { mSolver->reuseOperator(); }
+        mSolver->solve(*mJacobianA, tDeltaA, tResidual);
 
         // compute and add velocity increment: \Delta v = - ( R_{v} + R_{v,a} \Delta a )
         Plato::blas1::axpy(tR_va, tDeltaA, tResidualV);
@@ -485,13 +743,81 @@ namespace Hyperbolic
 
         // fill in essential boundary fields
         this->constrainFieldsAtBoundary(tDisplacement,tVelocity,tAcceleration,aCurrentTime);
+    }
 
-        if ( mSaveState )
-        {
-            // evaluate at new state
-            tResidual  = mPDEConstraint.value(tDisplacement, tVelocity, tAcceleration, aControl, mTimeStep, aCurrentTime);
-            mDataMap.saveState();
-        }
+    template<typename PhysicsType>
+    void
+    Problem<PhysicsType>::
+    forwardStepExplicit(
+        const Plato::ScalarVector      & aControl,
+              Plato::Scalar              aCurrentTime,
+              Plato::OrdinalType         aStepIndex,
+        const Plato::ScalarMultiVector & aDisplacement,
+        const Plato::ScalarMultiVector & aVelocity,
+        const Plato::ScalarMultiVector & aAcceleration,
+              Plato::OrdinalType         aPrevRow,
+              Plato::OrdinalType         aRow
+    )
+    {
+        Plato::ScalarVector tDisplacementPrev = Kokkos::subview(aDisplacement, aPrevRow, Kokkos::ALL());
+        Plato::ScalarVector tVelocityPrev     = Kokkos::subview(aVelocity,     aPrevRow, Kokkos::ALL());
+        Plato::ScalarVector tAccelerationPrev = Kokkos::subview(aAcceleration, aPrevRow, Kokkos::ALL());
+
+        Plato::ScalarVector tDisplacement = Kokkos::subview(aDisplacement, aRow, Kokkos::ALL());
+        Plato::ScalarVector tVelocity     = Kokkos::subview(aVelocity,     aRow, Kokkos::ALL());
+        Plato::ScalarVector tAcceleration = Kokkos::subview(aAcceleration, aRow, Kokkos::ALL());
+
+        // R_{u} and R_{v} at zero states are the negated predictors
+        Kokkos::deep_copy(tDisplacement, 0.0);
+        Kokkos::deep_copy(tVelocity,     0.0);
+        Kokkos::deep_copy(tAcceleration, 0.0);
+        auto tResidualU = mIntegrator->u_value(tDisplacement, tDisplacementPrev,
+                                               tVelocity,     tVelocityPrev,
+                                               tAcceleration, tAccelerationPrev, mTimeStep);
+        auto tResidualV = mIntegrator->v_value(tDisplacement, tDisplacementPrev,
+                                               tVelocity,     tVelocityPrev,
+                                               tAcceleration, tAccelerationPrev, mTimeStep);
+        Plato::blas1::axpy(-1.0, tResidualU, tDisplacement);
+        Plato::blas1::axpy(-1.0, tResidualV, tVelocity);
+
+        // -R at the predictor, evaluated element by element.  no global matrix is assembled.
+        auto tResidual = mPDEConstraint.value(tDisplacement, tVelocity, tAcceleration, aControl, mTimeStep, aCurrentTime);
+        Plato::blas1::scale(-1.0, tResidual);
+
+        mStateDotDotBoundaryConditions.get(mStateDotDotBcDofs, mStateDotDotBcValues, aCurrentTime);
+
+        // a_{k+1} = M_{lumped}^{-1} (-R)
+        Plato::Solve::Lumped(mLumpedOperator, tAcceleration, tResidual, mStateDotDotBcDofs, mStateDotDotBcValues);
+
+        // v_{k+1} = v^{*} - R_{v,a} a_{k+1}
+        Plato::blas1::axpy(-mIntegrator->v_grad_a(mTimeStep), tAcceleration, tVelocity);
+
+        // u_{k+1} = u^{*} - R_{u,a} a_{k+1}, where R_{u,a} is zero for explicit integrators
+        Plato::blas1::axpy(-mIntegrator->u_grad_a(mTimeStep), tAcceleration, tDisplacement);
+
+        // fill in essential boundary fields
+        this->constrainFieldsAtBoundary(tDisplacement,tVelocity,tAcceleration,aCurrentTime);
+    }
+
+    template<typename PhysicsType>
+    void
+    Problem<PhysicsType>::
+    computeLumpedOperator(
+        const Plato::ScalarVector & aControl
+    )
+    {
+        // the mass and damping don't depend on the state, so the lumped effective operator
+        // R_{,a} - R_{v,a} R_{,v} is computed once per solution at the initial state.  the
+        // stiffness doesn't enter since R_{u,a} is zero for explicit integrators.
+        Plato::ScalarVector tU = Kokkos::subview(mDisplacement, /*StepIndex=*/0, Kokkos::ALL());
+        Plato::ScalarVector tV = Kokkos::subview(mVelocity,     /*StepIndex=*/0, Kokkos::ALL());
+        Plato::ScalarVector tA = Kokkos::subview(mAcceleration, /*StepIndex=*/0, Kokkos::ALL());
+
+        mJacobianV = mPDEConstraint.gradient_v(tU, tV, tA, aControl, mTimeStep, /*time=*/0.0);
+        mJacobianA = mPDEConstraint.gradient_a(tU, tV, tA, aControl, mTimeStep, /*time=*/0.0);
+        Plato::blas1::axpy(-mIntegrator->v_grad_a(mTimeStep), mJacobianV->entries(), mJacobianA->entries());
+
+        mLumpedOperator = Plato::Solve::LumpedDiagonal<ElementType::mNumDofsPerNode>(mJacobianA);
     }
 
     template<typename PhysicsType>
@@ -518,7 +844,7 @@ namespace Hyperbolic
 
         auto tResidual = 
           mPDEConstraint.value(tDisplacementInit, tVelocityInit, tAccelerationInit, aControl, mTimeStep, 0.0);
-        mDataMap.saveState();
+        mDataMap.saveState(/*StepIndex=*/0, /*Time=*/0.0);
     }
 
     template<typename PhysicsType>
@@ -591,6 +917,10 @@ namespace Hyperbolic
     {
         if( mCriteria.count(aName) )
         {
+            if(this->isCheckpointed())
+            {
+                return mCriterionValues.at(aName);
+            }
             Criterion tCriterion = mCriteria[aName];
             return tCriterion->value(aSolution, aControl, mTimeStep);
         }
@@ -610,6 +940,10 @@ namespace Hyperbolic
     {
         if( mCriteria.count(aName) )
         {
+            if(this->isCheckpointed())
+            {
+                return mCriterionValues.at(aName);
+            }
             auto tSolution = this->getSolution();
             Criterion tCriterion = mCriteria[aName];
             return tCriterion->value(tSolution, aControl, mTimeStep);
@@ -674,135 +1008,7 @@ namespace Hyperbolic
             ANALYZE_THROWERR("REQUESTED CRITERION NOT DEFINED BY USER.");
         }
 
-        Plato::Solutions tSolution(mPhysics);
-        tSolution.set("State", mDisplacement);
-        tSolution.set("StateDot", mVelocity);
-        tSolution.set("StateDotDot", mAcceleration);
-
-        // F_{,z}
-        auto t_dFdz = aCriterion->gradient_z(tSolution, aControl, mTimeStep);
-
-        auto tLastStepIndex = mNumSteps - 1;
-        Plato::Scalar tCurrentTime(mTimeStep*mNumSteps);
-        for(Plato::OrdinalType tStepIndex = tLastStepIndex; tStepIndex > 0; tStepIndex--)
-        {
-            auto tU = Kokkos::subview(mDisplacement, tStepIndex, Kokkos::ALL());
-            auto tV = Kokkos::subview(mVelocity,     tStepIndex, Kokkos::ALL());
-            auto tA = Kokkos::subview(mAcceleration, tStepIndex, Kokkos::ALL());
-
-            Plato::ScalarVector tAdjoint_U = Kokkos::subview(mAdjoints_U, tStepIndex, Kokkos::ALL());
-            Plato::ScalarVector tAdjoint_V = Kokkos::subview(mAdjoints_V, tStepIndex, Kokkos::ALL());
-            Plato::ScalarVector tAdjoint_A = Kokkos::subview(mAdjoints_A, tStepIndex, Kokkos::ALL());
-
-            // F_{,u^k}
-            auto t_dFdu = aCriterion->gradient_u(tSolution, aControl, tStepIndex, mTimeStep);
-            // F_{,v^k}
-            auto t_dFdv = aCriterion->gradient_v(tSolution, aControl, tStepIndex, mTimeStep);
-            // F_{,a^k}
-            auto t_dFda = aCriterion->gradient_a(tSolution, aControl, tStepIndex, mTimeStep);
-
-            if(tStepIndex != tLastStepIndex) { // the last step doesn't have a contribution from k+1
-
-                // L_{v}^{k+1}
-                Plato::ScalarVector tAdjoint_V_next = Kokkos::subview(mAdjoints_V, tStepIndex+1, Kokkos::ALL());
-
-                // L_{a}^{k+1}
-                Plato::ScalarVector tAdjoint_A_next = Kokkos::subview(mAdjoints_A, tStepIndex+1, Kokkos::ALL());
-
-
-                // R_{v,u^k}^{k+1}
-                auto tR_vu_prev = mIntegrator->v_grad_u_prev(mTimeStep);
-
-                // F_{,u^k} += L_{v}^{k+1} R_{v,u^k}^{k+1}
-                Plato::blas1::axpy(tR_vu_prev, tAdjoint_V_next, t_dFdu);
-
-                // R_{a,u^k}^{k+1}
-                auto tR_au_prev = mIntegrator->a_grad_u_prev(mTimeStep);
-
-                // F_{,u^k} += L_{a}^{k+1} R_{a,u^k}^{k+1}
-                Plato::blas1::axpy(tR_au_prev, tAdjoint_A_next, t_dFdu);
-
-
-                // R_{v,v^k}^{k+1}
-                auto tR_vv_prev = mIntegrator->v_grad_v_prev(mTimeStep);
-
-                // F_{,v^k} += L_{v}^{k+1} R_{v,v^k}^{k+1}
-                Plato::blas1::axpy(tR_vv_prev, tAdjoint_V_next, t_dFdv);
-
-                // R_{a,v^k}^{k+1}
-                auto tR_av_prev = mIntegrator->a_grad_v_prev(mTimeStep);
-
-                // F_{,v^k} += L_{a}^{k+1} R_{a,v^k}^{k+1}
-                Plato::blas1::axpy(tR_av_prev, tAdjoint_A_next, t_dFdv);
-
-
-                // R_{v,a^k}^{k+1}
-                auto tR_va_prev = mIntegrator->v_grad_a_prev(mTimeStep);
-
-                // F_{,a^k} += L_{v}^{k+1} R_{v,a^k}^{k+1}
-                Plato::blas1::axpy(tR_va_prev, tAdjoint_V_next, t_dFda);
-
-                // R_{a,a^k}^{k+1}
-                auto tR_aa_prev = mIntegrator->a_grad_a_prev(mTimeStep);
-
-                // F_{,a^k} += L_{a}^{k+1} R_{a,a^k}^{k+1}
-                Plato::blas1::axpy(tR_aa_prev, tAdjoint_A_next, t_dFda);
-
-            }
-            Plato::blas1::scale(static_cast<Plato::Scalar>(-1), t_dFdu);
-
-            // R_{v,u^k}
-            auto tR_vu = mIntegrator->v_grad_u(mTimeStep);
-
-            // -F_{,u^k} += R_{v,u^k}^k F_{,v^k}
-            Plato::blas1::axpy(tR_vu, t_dFdv, t_dFdu);
-
-            // R_{a,u^k}
-            auto tR_au = mIntegrator->a_grad_u(mTimeStep);
-
-            // -F_{,u^k} += R_{a,u^k}^k F_{,a^k}
-            Plato::blas1::axpy(tR_au, t_dFda, t_dFdu);
-
-            // R_{u,u^k}
-            mJacobianU = mPDEConstraint.gradient_u(tU, tV, tA, aControl, mTimeStep, tCurrentTime);
-
-            // R_{u,v^k}
-            mJacobianV = mPDEConstraint.gradient_v(tU, tV, tA, aControl, mTimeStep, tCurrentTime);
-
-            // R_{u,a^k}
-            mJacobianA = mPDEConstraint.gradient_a(tU, tV, tA, aControl, mTimeStep, tCurrentTime);
-
-            // R_{u,u^k} -= R_{v,u^k} R_{u,v^k}
-            Plato::blas1::axpy(-tR_vu, mJacobianV->entries(), mJacobianU->entries());
-
-            // R_{u,u^k} -= R_{a,u^k} R_{u,a^k}
-            Plato::blas1::axpy(-tR_au, mJacobianA->entries(), mJacobianU->entries());
-
-            this->applyConstraints(mJacobianU, t_dFdu);
-
-            // L_u^k
-            mSolver->solve(*mJacobianU, tAdjoint_U, t_dFdu);
-
-            // L_v^k
-            Plato::MatrixTimesVectorPlusVector(mJacobianV, tAdjoint_U, t_dFdv);
-            Plato::blas1::fill(0.0, tAdjoint_V);
-            Plato::blas1::axpy(-1.0, t_dFdv, tAdjoint_V);
-
-            // L_a^k
-            Plato::MatrixTimesVectorPlusVector(mJacobianA, tAdjoint_U, t_dFda);
-            Plato::blas1::fill(0.0, tAdjoint_A);
-            Plato::blas1::axpy(-1.0, t_dFda, tAdjoint_A);
-
-            // R^k_{,z}
-            auto t_dRdz = mPDEConstraint.gradient_z(tU, tV, tA, aControl, mTimeStep, tCurrentTime);
-
-            // F_{,z} += L_u^k R^k_{,z}
-            Plato::MatrixTimesVectorPlusVector(t_dRdz, tAdjoint_U, t_dFdz);
-
-            tCurrentTime -= mTimeStep;
-        }
-
-        return t_dFdz;
+        return this->adjointGradient(aControl, aCriterion, /*aConfigGradient=*/false);
     }
 
     template<typename PhysicsType>
@@ -859,135 +1065,344 @@ namespace Hyperbolic
             ANALYZE_THROWERR("REQUESTED CRITERION NOT DEFINED BY USER.");
         }
 
-        Plato::Solutions tSolution(mPhysics);
-        tSolution.set("State", mDisplacement);
-        tSolution.set("StateDot", mVelocity);
-        tSolution.set("StateDotDot", mAcceleration);
-
-        // F_{,x}
-        auto t_dFdx = aCriterion->gradient_x(tSolution, aControl, mTimeStep);
-
-        auto tLastStepIndex = mNumSteps - 1;
-        Plato::Scalar tCurrentTime(mTimeStep*mNumSteps);
-        for(Plato::OrdinalType tStepIndex = tLastStepIndex; tStepIndex > 0; tStepIndex--) {
+        return this->adjointGradient(aControl, aCriterion, /*aConfigGradient=*/true);
+    }
 
-            auto tU = Kokkos::subview(mDisplacement, tStepIndex, Kokkos::ALL());
-            auto tV = Kokkos::subview(mVelocity,     tStepIndex, Kokkos::ALL());
-            auto tA = Kokkos::subview(mAcceleration, tStepIndex, Kokkos::ALL());
+    template<typename PhysicsType>
+    Plato::ScalarVector
+    Problem<PhysicsType>::
+    adjointGradient(
+        const Plato::ScalarVector & aControl,
+              Criterion             aCriterion,
+              bool                  aConfigGradient
+    )
+    {
+        // F_{,z} (or F_{,x}).  With checkpointing, it's summed over the steps of the reverse sweep.
+        Plato::ScalarVector tGradient;
+        if(!this->isCheckpointed())
+        {
+            auto tSolution = this->getSolution();
+            tGradient = aConfigGradient ? aCriterion->gradient_x(tSolution, aControl, mTimeStep)
+                                        : aCriterion->gradient_z(tSolution, aControl, mTimeStep);
+        }
 
-            Plato::ScalarVector tAdjoint_U = Kokkos::subview(mAdjoints_U, tStepIndex, Kokkos::ALL());
-            Plato::ScalarVector tAdjoint_V = Kokkos::subview(mAdjoints_V, tStepIndex, Kokkos::ALL());
-            Plato::ScalarVector tAdjoint_A = Kokkos::subview(mAdjoints_A, tStepIndex, Kokkos::ALL());
+        // the state of time step aStepIndex is row aSolutionStep of aSolution
+        auto tAdjointStep = [&](Plato::OrdinalType aStepIndex, const Plato::Solutions & aSolution, Plato::OrdinalType aSolutionStep)
+        {
+            Plato::ScalarVector tU = Kokkos::subview(aSolution.get("State"),       aSolutionStep, Kokkos::ALL());
+            Plato::ScalarVector tV = Kokkos::subview(aSolution.get("StateDot"),    aSolutionStep, Kokkos::ALL());
+            Plato::ScalarVector tA = Kokkos::subview(aSolution.get("StateDotDot"), aSolutionStep, Kokkos::ALL());
+            Plato::Scalar tCurrentTime = aStepIndex*mTimeStep;
 
             // F_{,u^k}
-            auto t_dFdu = aCriterion->gradient_u(tSolution, aControl, tStepIndex, mTimeStep);
+            auto t_dFdu = aCriterion->gradient_u(aSolution, aControl, aSolutionStep, mTimeStep);
             // F_{,v^k}
-            auto t_dFdv = aCriterion->gradient_v(tSolution, aControl, tStepIndex, mTimeStep);
+            auto t_dFdv = aCriterion->gradient_v(aSolution, aControl, aSolutionStep, mTimeStep);
             // F_{,a^k}
-            auto t_dFda = aCriterion->gradient_a(tSolution, aControl, tStepIndex, mTimeStep);
+            auto t_dFda = aCriterion->gradient_a(aSolution, aControl, aSolutionStep, mTimeStep);
 
-            if(tStepIndex != tLastStepIndex) { // the last step doesn't have a contribution from k+1
+            if (mUForm)
+            {
+                this->adjointStepUForm(aControl, tCurrentTime, aStepIndex, tU, tV, tA, t_dFdu, t_dFdv, t_dFda);
+            }
+            else
+            {
+                this->adjointStepAForm(aControl, tCurrentTime, aStepIndex, tU, tV, tA, t_dFdu, t_dFdv, t_dFda);
+            }
 
-                // L_{v}^{k+1}
-                Plato::ScalarVector tAdjoint_V_next = Kokkos::subview(mAdjoints_V, tStepIndex+1, Kokkos::ALL());
+            if(this->isCheckpointed())
+            {
+                auto tPartial = aConfigGradient ? aCriterion->gradient_x(aSolution, aControl, mTimeStep)
+                                                : aCriterion->gradient_z(aSolution, aControl, mTimeStep);
+                if(tGradient.extent(0) == 0) { tGradient = tPartial; }
+                else { Plato::blas1::axpy(1.0, tPartial, tGradient); }
+            }
 
-                // L_{a}^{k+1}
-                Plato::ScalarVector tAdjoint_A_next = Kokkos::subview(mAdjoints_A, tStepIndex+1, Kokkos::ALL());
+            // L^k, adjoint of the equation of motion
+            auto tAdjoints = mUForm ? mAdjoints_U : mAdjoints_A;
+            Plato::ScalarVector tAdjoint = Kokkos::subview(tAdjoints, aStepIndex % 2, Kokkos::ALL());
 
+            // R^k_{,z} (or R^k_{,x})
+            auto t_dRdz = aConfigGradient ? mPDEConstraint.gradient_x(tU, tV, tA, aControl, mTimeStep, tCurrentTime)
+                                          : mPDEConstraint.gradient_z(tU, tV, tA, aControl, mTimeStep, tCurrentTime);
 
-                // R_{v,u^k}^{k+1}
-                auto tR_vu_prev = mIntegrator->v_grad_u_prev(mTimeStep);
+            // F_{,z} += L^k R^k_{,z}
+            Plato::MatrixTimesVectorPlusVector(t_dRdz, tAdjoint, tGradient);
+        };
 
-                // F_{,u^k} += L_{v}^{k+1} R_{v,u^k}^{k+1}
-                Plato::blas1::axpy(tR_vu_prev, tAdjoint_V_next, t_dFdu);
+        if(this->isCheckpointed())
+        {
+            Plato::Solutions tSolution(mPhysics);
+            tSolution.set("State", mSweepDisplacement);
+            tSolution.set("StateDot", mSweepVelocity);
+            tSolution.set("StateDotDot", mSweepAcceleration);
+            Plato::binomial_reverse_segment(/*begin=*/0, /*end=*/mNumSteps, /*slot=*/0, mCheckpointSteps,
+              [&](Plato::OrdinalType aSlot, Plato::OrdinalType aStepIndex)
+            {
+                this->recompute(aControl, aSlot, aStepIndex);
+                Plato::ScalarVector tDisplacement = Kokkos::subview(mSweepDisplacement, 1, Kokkos::ALL());
+                Plato::ScalarVector tVelocity     = Kokkos::subview(mSweepVelocity,     1, Kokkos::ALL());
+                Plato::ScalarVector tAcceleration = Kokkos::subview(mSweepAcceleration, 1, Kokkos::ALL());
+                this->storeCheckpoint(aSlot+1, aStepIndex, tDisplacement, tVelocity, tAcceleration);
+            },
+              [&](Plato::OrdinalType aSlot, Plato::OrdinalType aStepIndex)
+            {
+                this->recompute(aControl, aSlot, aStepIndex);
+                tAdjointStep(aStepIndex, tSolution, /*row=*/1);
+            });
+        }
+        else
+        {
+            auto tSolution = this->getSolution();
+            for(Plato::OrdinalType tStepIndex = mNumSteps - 1; tStepIndex > 0; tStepIndex--)
+            {
+                tAdjointStep(tStepIndex, tSolution, tStepIndex);
+            }
+        }
 
-                // R_{a,u^k}^{k+1}
-                auto tR_au_prev = mIntegrator->a_grad_u_prev(mTimeStep);
+        return tGradient;
+    }
 
-                // F_{,u^k} += L_{a}^{k+1} R_{a,u^k}^{k+1}
-                Plato::blas1::axpy(tR_au_prev, tAdjoint_A_next, t_dFdu);
+    template<typename PhysicsType>
+    void
+    Problem<PhysicsType>::
+    adjointStepUForm(
+        const Plato::ScalarVector & aControl,
+              Plato::Scalar         aCurrentTime,
+              Plato::OrdinalType    aStepIndex,
+        const Plato::ScalarVector & aU,
+        const Plato::ScalarVector & aV,
+        const Plato::ScalarVector & aA,
+              Plato::ScalarVector   a_dFdu,
+              Plato::ScalarVector   a_dFdv,
+              Plato::ScalarVector   a_dFda
+    )
+    {
+        // the adjoints of steps k and k+1 alternate between the two rows
+        auto tRow     = aStepIndex % 2;
+        auto tNextRow = (aStepIndex + 1) % 2;
 
+        Plato::ScalarVector tAdjoint_U = Kokkos::subview(mAdjoints_U, tRow, Kokkos::ALL());
+        Plato::ScalarVector tAdjoint_V = Kokkos::subview(mAdjoints_V, tRow, Kokkos::ALL());
+        Plato::ScalarVector tAdjoint_A = Kokkos::subview(mAdjoints_A, tRow, Kokkos::ALL());
 
-                // R_{v,v^k}^{k+1}
-                auto tR_vv_prev = mIntegrator->v_grad_v_prev(mTimeStep);
+        if(aStepIndex != mNumSteps - 1) { // the last step doesn't have a contribution from k+1
 
-                // F_{,v^k} += L_{v}^{k+1} R_{v,v^k}^{k+1}
-                Plato::blas1::axpy(tR_vv_prev, tAdjoint_V_next, t_dFdv);
+            // L_{v}^{k+1}
+            Plato::ScalarVector tAdjoint_V_next = Kokkos::subview(mAdjoints_V, tNextRow, Kokkos::ALL());
 
-                // R_{a,v^k}^{k+1}
-                auto tR_av_prev = mIntegrator->a_grad_v_prev(mTimeStep);
+            // L_{a}^{k+1}
+            Plato::ScalarVector tAdjoint_A_next = Kokkos::subview(mAdjoints_A, tNextRow, Kokkos::ALL());
 
-                // F_{,v^k} += L_{a}^{k+1} R_{a,v^k}^{k+1}
-                Plato::blas1::axpy(tR_av_prev, tAdjoint_A_next, t_dFdv);
 
+            // R_{v,u^k}^{k+1}
+            auto tR_vu_prev = mIntegrator->v_grad_u_prev(mTimeStep);
 
-                // R_{v,a^k}^{k+1}
-                auto tR_va_prev = mIntegrator->v_grad_a_prev(mTimeStep);
+            // F_{,u^k} += L_{v}^{k+1} R_{v,u^k}^{k+1}
+            Plato::blas1::axpy(tR_vu_prev, tAdjoint_V_next, a_dFdu);
 
-                // F_{,a^k} += L_{v}^{k+1} R_{v,a^k}^{k+1}
-                Plato::blas1::axpy(tR_va_prev, tAdjoint_V_next, t_dFda);
+            // R_{a,u^k}^{k+1}
+            auto tR_au_prev = mIntegrator->a_grad_u_prev(mTimeStep);
 
-                // R_{a,a^k}^{k+1}
-                auto tR_aa_prev = mIntegrator->a_grad_a_prev(mTimeStep);
+            // F_{,u^k} += L_{a}^{k+1} R_{a,u^k}^{k+1}
+            Plato::blas1::axpy(tR_au_prev, tAdjoint_A_next, a_dFdu);
 
-                // F_{,a^k} += L_{a}^{k+1} R_{a,a^k}^{k+1}
-                Plato::blas1::axpy(tR_aa_prev, tAdjoint_A_next, t_dFda);
 
-            }
-            Plato::blas1::scale(static_cast<Plato::Scalar>(-1), t_dFdu);
+            // R_{v,v^k}^{k+1}
+            auto tR_vv_prev = mIntegrator->v_grad_v_prev(mTimeStep);
 
-            // R_{v,u^k}
-            auto tR_vu = mIntegrator->v_grad_u(mTimeStep);
+            // F_{,v^k} += L_{v}^{k+1} R_{v,v^k}^{k+1}
+            Plato::blas1::axpy(tR_vv_prev, tAdjoint_V_next, a_dFdv);
 
-            // -F_{,u^k} += R_{v,u^k}^k F_{,v^k}
-            Plato::blas1::axpy(tR_vu, t_dFdv, t_dFdu);
+            // R_{a,v^k}^{k+1}
+            auto tR_av_prev = mIntegrator->a_grad_v_prev(mTimeStep);
 
-            // R_{a,u^k}
-            auto tR_au = mIntegrator->a_grad_u(mTimeStep);
+            // F_{,v^k} += L_{a}^{k+1} R_{a,v^k}^{k+1}
+            Plato::blas1::axpy(tR_av_prev, tAdjoint_A_next, a_dFdv);
 
-            // -F_{,u^k} += R_{a,u^k}^k F_{,a^k}
-            Plato::blas1::axpy(tR_au, t_dFda, t_dFdu);
 
-            // R_{u,u^k}
-            mJacobianU = mPDEConstraint.gradient_u(tU, tV, tA, aControl, mTimeStep, tCurrentTime);
+            // R_{v,a^k}^{k+1}
+            auto tR_va_prev = mIntegrator->v_grad_a_prev(mTimeStep);
 
-            // R_{u,v^k}
-            mJacobianV = mPDEConstraint.gradient_v(tU, tV, tA, aControl, mTimeStep, tCurrentTime);
+            // F_{,a^k} += L_{v}^{k+1} R_{v,a^k}^{k+1}
+            Plato::blas1::axpy(tR_va_prev, tAdjoint_V_next, a_dFda);
 
-            // R_{u,a^k}
-            mJacobianA = mPDEConstraint.gradient_a(tU, tV, tA, aControl, mTimeStep, tCurrentTime);
+            // R_{a,a^k}^{k+1}
+            auto tR_aa_prev = mIntegrator->a_grad_a_prev(mTimeStep);
 
-            // R_{u,u^k} -= R_{v,u^k} R_{u,v^k}
-            Plato::blas1::axpy(-tR_vu, mJacobianV->entries(), mJacobianU->entries());
+            // F_{,a^k} += L_{a}^{k+1} R_{a,a^k}^{k+1}
+            Plato::blas1::axpy(tR_aa_prev, tAdjoint_A_next, a_dFda);
 
-            // R_{u,u^k} -= R_{a,u^k} R_{u,a^k}
-            Plato::blas1::axpy(-tR_au, mJacobianA->entries(), mJacobianU->entries());
+        }
+        Plato::blas1::scale(static_cast<Plato::Scalar>(-1), a_dFdu);
+
+        // R_{v,u^k}
+        auto tR_vu = mIntegrator->v_grad_u(mTimeStep);
+
+        // -F_{,u^k} += R_{v,u^k}^k F_{,v^k}
+        Plato::blas1::axpy(tR_vu, a_dFdv, a_dFdu);
+
+        // R_{a,u^k}
+        auto tR_au = mIntegrator->a_grad_u(mTimeStep);
+
+        // -F_{,u^k} += R_{a,u^k}^k F_{,a^k}
+        Plato::blas1::axpy(tR_au, a_dFda, a_dFdu);
+
+        // R_{u,u^k} - R_{v,u^k} R_{u,v^k} - R_{a,u^k} R_{u,a^k}
+        auto tReuseOperator =
+          this->updateAdjointJacobians(aU, aV, aA, aControl, aCurrentTime, aStepIndex == mNumSteps - 1);
+
+        this->applyConstraints(mJacobianU, a_dFdu);
+
+        // L_u^k
+        if( tReuseOperator ) { mSolver->reuseOperator(); }
+        mSolver->solve(*mJacobianU, tAdjoint_U, a_dFdu);
+
+        // L_v^k
+        Plato::MatrixTimesVectorPlusVector(mJacobianV, tAdjoint_U, a_dFdv);
+        Plato::blas1::fill(0.0, tAdjoint_V);
+        Plato::blas1::axpy(-1.0, a_dFdv, tAdjoint_V);
+
+        // L_a^k
+        Plato::MatrixTimesVectorPlusVector(mJacobianA, tAdjoint_U, a_dFda);
+        Plato::blas1::fill(0.0, tAdjoint_A);
+        Plato::blas1::axpy(-1.0, a_dFda, tAdjoint_A);
+    }
+
+    template<typename PhysicsType>
+    void
+    Problem<PhysicsType>::
+    adjointStepAForm(
+        const Plato::ScalarVector & aControl,
+              Plato::Scalar         aCurrentTime,
+              Plato::OrdinalType    aStepIndex,
+        const Plato::ScalarVector & aU,
+        const Plato::ScalarVector & aV,
+        const Plato::ScalarVector & aA,
+              Plato::ScalarVector   a_dFdu,
+              Plato::ScalarVector   a_dFdv,
+              Plato::ScalarVector   a_dFda
+    )
+    {
+        // the adjoints of steps k and k+1 alternate between the two rows
+        auto tRow     = aStepIndex % 2;
+        auto tNextRow = (aStepIndex + 1) % 2;
+
+        Plato::ScalarVector tAdjoint_U = Kokkos::subview(mAdjoints_U, tRow, Kokkos::ALL());
+        Plato::ScalarVector tAdjoint_V = Kokkos::subview(mAdjoints_V, tRow, Kokkos::ALL());
+        Plato::ScalarVector tAdjoint_A = Kokkos::subview(mAdjoints_A, tRow, Kokkos::ALL());
+
+        if(aStepIndex != mNumSteps - 1) { // the last step doesn't have a contribution from k+1
+
+            // L_{u}^{k+1}
+            Plato::ScalarVector tAdjoint_U_next = Kokkos::subview(mAdjoints_U, tNextRow, Kokkos::ALL());
+
+            // L_{v}^{k+1}
+            Plato::ScalarVector tAdjoint_V_next = Kokkos::subview(mAdjoints_V, tNextRow, Kokkos::ALL());
+
+
+            // F_{,u^k} += L_{u}^{k+1} R_{u,u^k}^{k+1}
+            Plato::blas1::axpy(mIntegrator->u_grad_u_prev(mTimeStep), tAdjoint_U_next, a_dFdu);
+
+            // F_{,v^k} += L_{u}^{k+1} R_{u,v^k}^{k+1} + L_{v}^{k+1} R_{v,v^k}^{k+1}
+            Plato::blas1::axpy(mIntegrator->u_grad_v_prev(mTimeStep), tAdjoint_U_next, a_dFdv);
+            Plato::blas1::axpy(mIntegrator->v_grad_v_prev(mTimeStep), tAdjoint_V_next, a_dFdv);
+
+            // F_{,a^k} += L_{u}^{k+1} R_{u,a^k}^{k+1} + L_{v}^{k+1} R_{v,a^k}^{k+1}
+            Plato::blas1::axpy(mIntegrator->u_grad_a_prev(mTimeStep), tAdjoint_U_next, a_dFda);
+            Plato::blas1::axpy(mIntegrator->v_grad_a_prev(mTimeStep), tAdjoint_V_next, a_dFda);
+
+        }
+        Plato::blas1::scale(static_cast<Plato::Scalar>(-1), a_dFda);
+
+        // -F_{,a^k} += R_{v,a^k}^k F_{,v^k}
+        Plato::blas1::axpy(mIntegrator->v_grad_a(mTimeStep), a_dFdv, a_dFda);
+
+        // -F_{,a^k} += R_{u,a^k}^k F_{,u^k}
+        Plato::blas1::axpy(mIntegrator->u_grad_a(mTimeStep), a_dFdu, a_dFda);
+
+        // R_{,a^k} - R_{v,a^k} R_{,v^k} - R_{u,a^k} R_{,u^k}
+        auto tReuseOperator =
+          this->updateAdjointJacobians(aU, aV, aA, aControl, aCurrentTime, aStepIndex == mNumSteps - 1);
+
+        // L_a^k, with homogeneous essential conditions
+        if( mIntegrator->isExplicit() )
+        {
+            if( !tReuseOperator )
+            {
+                mLumpedOperator = Plato::Solve::LumpedDiagonal<ElementType::mNumDofsPerNode>(mJacobianA);
+            }
+            Plato::Solve::Lumped(mLumpedOperator, tAdjoint_A, a_dFda, mStateDotDotBcDofs, mStateDotDotBcValues, /*scale=*/0.0);
+        }
+        else
+        {
+            this->applyConstraintType(mJacobianA, a_dFda, mStateDotDotBcDofs, mStateDotDotBcValues, /*scale=*/0.0);
+            if( tReuseOperator ) { mSolver->reuseOperator(); }
+            mSolver->solve(*mJacobianA, tAdjoint_A, a_dFda);
+        }
+
+        // L_v^k
+        Plato::MatrixTimesVectorPlusVector(mJacobianV, tAdjoint_A, a_dFdv);
+        Plato::blas1::fill(0.0, tAdjoint_V);
+        Plato::blas1::axpy(-1.0, a_dFdv, tAdjoint_V);
+
+        // L_u^k
+        Plato::MatrixTimesVectorPlusVector(mJacobianU, tAdjoint_A, a_dFdu);
+        Plato::blas1::fill(0.0, tAdjoint_U);
+        Plato::blas1::axpy(-1.0, a_dFdu, tAdjoint_U);
+    }
+
+    template<typename PhysicsType>
+    bool
+    Problem<PhysicsType>::
+    updateAdjointJacobians(
+        const Plato::ScalarVector & aU,
+        const Plato::ScalarVector & aV,
+        const Plato::ScalarVector & aA,
+        const Plato::ScalarVector & aControl,
+              Plato::Scalar         aCurrentTime,
+              bool                  aFirstStep
+    )
+    {
+        if( mLinear && !aFirstStep )
+        {
+            // the jacobians are unchanged, restore the unconstrained adjoint operator
+            auto tEffectiveOperator = mUForm ? mJacobianU : mJacobianA;
+            Kokkos::deep_copy(tEffectiveOperator->entries(), mEffectiveEntries);
+            return true;
+        }
 
-            this->applyConstraints(mJacobianU, t_dFdu);
+        // R_{u,u^k}
+        mJacobianU = mPDEConstraint.gradient_u(aU, aV, aA, aControl, mTimeStep, aCurrentTime);
 
-            // L_u^k
-            mSolver->solve(*mJacobianU, tAdjoint_U, t_dFdu);
+        // R_{u,v^k}
+        mJacobianV = mPDEConstraint.gradient_v(aU, aV, aA, aControl, mTimeStep, aCurrentTime);
 
-            // L_v^k
-            Plato::MatrixTimesVectorPlusVector(mJacobianV, tAdjoint_U, t_dFdv);
-            Plato::blas1::fill(0.0, tAdjoint_V);
-            Plato::blas1::axpy(-1.0, t_dFdv, tAdjoint_V);
+        // R_{u,a^k}
+        mJacobianA = mPDEConstraint.gradient_a(aU, aV, aA, aControl, mTimeStep, aCurrentTime);
+
+        if( mUForm )
+        {
+            // R_{u,u^k} -= R_{v,u^k} R_{u,v^k}
+            Plato::blas1::axpy(-mIntegrator->v_grad_u(mTimeStep), mJacobianV->entries(), mJacobianU->entries());
 
-            // L_a^k
-            Plato::MatrixTimesVectorPlusVector(mJacobianA, tAdjoint_U, t_dFda);
-            Plato::blas1::fill(0.0, tAdjoint_A);
-            Plato::blas1::axpy(-1.0, t_dFda, tAdjoint_A);
+            // R_{u,u^k} -= R_{a,u^k} R_{u,a^k}
+            Plato::blas1::axpy(-mIntegrator->a_grad_u(mTimeStep), mJacobianA->entries(), mJacobianU->entries());
 
-            // R^k_{,x}
-            auto t_dRdx = mPDEConstraint.gradient_x(tU, tV, tA, aControl, mTimeStep, tCurrentTime);
+            if( mLinear ) { this->saveEffectiveOperator(mJacobianU); }
+        }
+        else
+        {
+            // R_{,a^k} -= R_{v,a^k} R_{,v^k}
+            Plato::blas1::axpy(-mIntegrator->v_grad_a(mTimeStep), mJacobianV->entries(), mJacobianA->entries());
 
-            // F_{,x} += L_u^k R^k_{,x}
-            Plato::MatrixTimesVectorPlusVector(t_dRdx, tAdjoint_U, t_dFdx);
+            // R_{,a^k} -= R_{u,a^k} R_{,u^k}
+            Plato::blas1::axpy(-mIntegrator->u_grad_a(mTimeStep), mJacobianU->entries(), mJacobianA->entries());
 
-            tCurrentTime -= mTimeStep;
+            if( mLinear ) { this->saveEffectiveOperator(mJacobianA); }
         }
 
-        return t_dFdx;
+        return false;
     }
 
     template<typename PhysicsType>
@@ -3,6 +3,9 @@
 #include <memory>
 
 #include "SpatialModel.hpp"
+#include "ParseTools.hpp"
+#include "BlockMatrixCache.hpp"
+#include "ElementColoring.hpp"
 #include "base/WorksetBase.hpp"
 #include "hyperbolic/AbstractVectorFunction.hpp"
 #include "hyperbolic/EvaluationTypes.hpp"
@@ -75,6 +78,8 @@ class VectorFunction : public Plato::WorksetBase<typename PhysicsType::ElementTy
 
     const Plato::SpatialModel& mSpatialModel;
 
+    mutable Plato::BlockMatrixCache mMatrixCache; /*!< persistent sparsity graph and recycled matrices */
+
     Plato::DataMap& mDataMap;
 
   public:
@@ -87,8 +92,14 @@ class VectorFunction : public Plato::WorksetBase<typename PhysicsType::ElementTy
     ) :
         Plato::WorksetBase<ElementType>(aSpatialModel.Mesh),
         mSpatialModel (aSpatialModel),
+        mMatrixCache  (aSpatialModel.Mesh),
         mDataMap      (aDataMap)
     {
+        if(Plato::ParseTools::getSubParam<bool>(aParamList, "Assembly", "Colored Assembly", false))
+        {
+            this->setElementColoring(std::make_shared<Plato::ElementColoring>(aSpatialModel.Mesh));
+        }
+
         typename PhysicsType::FunctionFactory tFunctionFactory;
 
         for(const auto& tDomain : mSpatialModel.Domains)
@@ -122,6 +133,7 @@ class VectorFunction : public Plato::WorksetBase<typename PhysicsType::ElementTy
 
     VectorFunction(Plato::Mesh aMesh, Plato::DataMap& aDataMap) :
             Plato::WorksetBase<ElementType>(aMesh),
+            mMatrixCache(aMesh),
             mDataMap(aDataMap)
     {
     }
@@ -271,7 +283,7 @@ class VectorFunction : public Plato::WorksetBase<typename PhysicsType::ElementTy
 
         auto tMesh = mSpatialModel.Mesh;
         Teuchos::RCP<Plato::CrsMatrixType> tJacobianMat =
-                Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumSpatialDims, mNumDofsPerNode>(tMesh);
+                mMatrixCache.matrix<mNumSpatialDims, mNumDofsPerNode>();
 
         for(const auto& tDomain : mSpatialModel.Domains)
         {
@@ -354,7 +366,7 @@ class VectorFunction : public Plato::WorksetBase<typename PhysicsType::ElementTy
 
         auto tMesh = mSpatialModel.Mesh;
         Teuchos::RCP<Plato::CrsMatrixType> tJacobianMat =
-                Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumDofsPerNode, mNumDofsPerNode>( tMesh );
+                mMatrixCache.matrix<mNumDofsPerNode, mNumDofsPerNode>();
 
         for(const auto& tDomain : mSpatialModel.Domains)
         {
@@ -437,7 +449,7 @@ class VectorFunction : public Plato::WorksetBase<typename PhysicsType::ElementTy
 
         auto tMesh = mSpatialModel.Mesh;
         Teuchos::RCP<Plato::CrsMatrixType> tJacobianMat =
-             Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumDofsPerNode, mNumDofsPerNode>( tMesh );
+             mMatrixCache.matrix<mNumDofsPerNode, mNumDofsPerNode>();
 
         for(const auto& tDomain : mSpatialModel.Domains)
         {
@@ -520,7 +532,7 @@ class VectorFunction : public Plato::WorksetBase<typename PhysicsType::ElementTy
 
         auto tMesh = mSpatialModel.Mesh;
         Teuchos::RCP<Plato::CrsMatrixType> tJacobianMat =
-             Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumDofsPerNode, mNumDofsPerNode>( tMesh );
+             mMatrixCache.matrix<mNumDofsPerNode, mNumDofsPerNode>();
 
         for(const auto& tDomain : mSpatialModel.Domains)
         {
@@ -603,7 +615,7 @@ class VectorFunction : public Plato::WorksetBase<typename PhysicsType::ElementTy
 
         auto tMesh = mSpatialModel.Mesh;
         Teuchos::RCP<Plato::CrsMatrixType> tJacobianMat =
-            Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumControl, mNumDofsPerNode>( tMesh );
+            mMatrixCache.matrix<mNumControl, mNumDofsPerNode>();
 
         for(const auto& tDomain : mSpatialModel.Domains)
         {
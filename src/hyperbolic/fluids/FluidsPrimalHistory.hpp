@@ -0,0 +1,608 @@
+/*
+ * FluidsPrimalHistory.hpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <Teuchos_ParameterList.hpp>
+
+#include "PlatoMesh.hpp"
+#include "AnalyzeMacros.hpp"
+#include "base/Database.hpp"
+
+namespace Plato
+{
+
+namespace Fluids
+{
+
+/******************************************************************************//**
+ * \struct PrimalHistoryField
+ *
+ * \brief Node field written to the primal state history.
+ **********************************************************************************/
+struct PrimalHistoryField
+{
+    std::string mName;                  /*!< field name, e.g. 'Velocity' */
+    Plato::ScalarVector mData;          /*!< field values */
+    Plato::OrdinalType mNumDofsPerNode; /*!< number of degrees of freedom per node */
+};
+
+/******************************************************************************//**
+ * \class PrimalHistory
+ *
+ * \brief Interface to the store holding the primal state history computed during
+ *   the forward solve and read back, step by step, during the adjoint sweep.
+ **********************************************************************************/
+class PrimalHistory
+{
+public:
+    virtual ~PrimalHistory() = default;
+
+    /******************************************************************************//**
+     * \fn void clear
+     * \brief Discard the stored history. Called before each forward solve.
+     **********************************************************************************/
+    virtual void clear() = 0;
+
+    /******************************************************************************//**
+     * \fn void write
+     * \brief Store the fields of a time step.
+     * \param [in] aStepIndex time step index
+     * \param [in] aFields    node fields
+     **********************************************************************************/
+    virtual void write(
+        Plato::OrdinalType                        aStepIndex,
+        const std::vector<PrimalHistoryField>   & aFields) = 0;
+
+    /******************************************************************************//**
+     * \fn void finalize
+     * \brief Complete the history once the forward solve is done.
+     **********************************************************************************/
+    virtual void finalize() = 0;
+
+    /******************************************************************************//**
+     * \fn Plato::OrdinalType numSteps
+     * \brief Return the number of stored time steps.
+     **********************************************************************************/
+    virtual Plato::OrdinalType numSteps() = 0;
+
+    /******************************************************************************//**
+     * \fn void read
+     * \brief Read node fields of a time step into the primal state database.
+     * \param [in]     aStepIndex time step index
+     * \param [in]     aFieldTags map from field name to primal database identifier
+     * \param [in,out] aPrimal    primal state database
+     **********************************************************************************/
+    virtual void read(
+        Plato::OrdinalType       aStepIndex,
+        const Plato::FieldTags & aFieldTags,
+        Plato::Primal          & aPrimal) = 0;
+};
+
+/******************************************************************************//**
+ * \class ExodusPrimalHistory
+ *
+ * \brief Primal state history written to, and read back from, an Exodus file.
+ *   The file doubles as a visualization file of the forward solve.
+ **********************************************************************************/
+class ExodusPrimalHistory : public PrimalHistory
+{
+private:
+    Plato::Mesh mMesh;       /*!< finite element mesh */
+    std::string mFileName;   /*!< history file name */
+    Plato::MeshIO mWriter;   /*!< open while the forward solve writes the history */
+    Plato::MeshIO mReader;   /*!< open while the adjoint sweep reads the history */
+
+public:
+    /******************************************************************************//**
+     * \brief Constructor
+     * \param [in] aMesh     finite element mesh
+     * \param [in] aFileName history file name
+     **********************************************************************************/
+    ExodusPrimalHistory(Plato::Mesh aMesh, const std::string & aFileName) :
+        mMesh(aMesh),
+        mFileName(aFileName)
+    {}
+
+    void clear() override
+    {
+        mReader.reset();
+        mWriter = Plato::MeshIOFactory::create(mFileName, mMesh, "Write");
+    }
+
+    void write(
+        Plato::OrdinalType                        aStepIndex,
+        const std::vector<PrimalHistoryField>   & aFields) override
+    {
+        for(const auto & tField : aFields)
+        {
+            mWriter->AddNodeData(tField.mName, tField.mData, tField.mNumDofsPerNode);
+        }
+        mWriter->Write(aStepIndex, aStepIndex);
+    }
+
+    void finalize() override
+    {
+        mWriter.reset();
+    }
+
+    Plato::OrdinalType numSteps() override
+    {
+        return this->reader()->NumTimeSteps();
+    }
+
+    void read(
+        Plato::OrdinalType       aStepIndex,
+        const Plato::FieldTags & aFieldTags,
+        Plato::Primal          & aPrimal) override
+    {
+        auto tReader = this->reader();
+        for(auto & tTag : aFieldTags.tags())
+        {
+            aPrimal.vector(aFieldTags.id(tTag), tReader->ReadNodeData(tTag, aStepIndex));
+        }
+    }
+
+private:
+    Plato::MeshIO reader()
+    {
+        if(mReader == nullptr)
+        {
+            mWriter.reset();
+            mReader = Plato::MeshIOFactory::create(mFileName, mMesh, "Read");
+        }
+        return mReader;
+    }
+};
+
+/******************************************************************************//**
+ * \enum PrimalHistoryCompression
+ *
+ * \brief Compression applied to the fields held by Plato::Fluids::MemoryPrimalHistory.
+ **********************************************************************************/
+enum class PrimalHistoryCompression
+{
+    NONE,     /*!< raw values */
+    LOSSLESS, /*!< exclusive-or of consecutive values with leading zero bytes dropped */
+    BOUNDED   /*!< values quantized to a bound on the absolute error, then delta encoded */
+};
+
+/******************************************************************************//**
+ * \class MemoryPrimalHistory
+ *
+ * \brief Primal state history held in host memory.
+ *
+ * Each field of each time step is encoded in its own byte buffer, so any step can
+ * be decoded independently, in any order.  Buffers are kept in memory up to a
+ * budget; buffers past the budget are appended to a spill file, which is memory
+ * mapped for reading during the adjoint sweep.
+ *
+ * Lossless compression stores the exclusive-or of each value with the preceding
+ * value of the field, without its leading zero bytes, and packs the number of
+ * bytes kept in a nibble.  Bounded compression rounds each value to the nearest
+ * multiple of twice the tolerance, so the absolute error is at most the tolerance,
+ * and stores the differences between consecutive multiples as variable-length
+ * integers.  A field that cannot be quantized (non-finite or too large values)
+ * falls back to lossless compression.
+ **********************************************************************************/
+class MemoryPrimalHistory : public PrimalHistory
+{
+private:
+    /// @brief encoding of a field buffer
+    enum class Encoding : unsigned char { RAW, XOR, QUANTIZED };
+
+    /// @brief location and encoding of a stored field
+    struct Record
+    {
+        Encoding mEncoding;
+        std::size_t mNumValues;
+        std::vector<unsigned char> mBuffer; /*!< encoded values, empty if spilled */
+        std::size_t mFileOffset;            /*!< offset into the spill file, if spilled */
+        std::size_t mFileSize;              /*!< number of bytes in the spill file, if spilled */
+    };
+
+    PrimalHistoryCompression mCompression; /*!< compression applied to new records */
+    Plato::Scalar mTolerance;              /*!< absolute error bound for bounded compression */
+    std::size_t mBudget;                   /*!< maximum number of bytes held in memory */
+    std::size_t mMemoryBytes;              /*!< number of bytes held in memory */
+    std::vector<unsigned char> mScratch;   /*!< encoding buffer, reused across records */
+
+    std::string mSpillFileName;  /*!< spill file name */
+    std::ofstream mSpillStream;  /*!< open while the forward solve appends to the spill file */
+    std::size_t mSpillBytes;     /*!< number of bytes in the spill file */
+    int mMapDescriptor;          /*!< spill file descriptor while mapped */
+    void* mMap;                  /*!< spill file mapping */
+    std::size_t mMapBytes;       /*!< number of bytes mapped */
+
+    std::vector<Plato::OrdinalType> mStepIndices; /*!< stored step indices, in write order */
+    std::unordered_map<Plato::OrdinalType, std::unordered_map<std::string, Record>> mRecords; /*!< records by step and field */
+
+public:
+    /******************************************************************************//**
+     * \brief Constructor
+     * \param [in] aCompression   compression applied to the fields
+     * \param [in] aTolerance     absolute error bound for bounded compression
+     * \param [in] aBudget        maximum number of bytes held in memory
+     * \param [in] aSpillFileName file receiving the fields past the budget
+     **********************************************************************************/
+    MemoryPrimalHistory(
+        PrimalHistoryCompression   aCompression,
+        Plato::Scalar              aTolerance,
+        std::size_t                aBudget,
+        const std::string        & aSpillFileName) :
+        mCompression(aCompression),
+        mTolerance(aTolerance),
+        mBudget(aBudget),
+        mMemoryBytes(0),
+        mSpillFileName(aSpillFileName),
+        mSpillBytes(0),
+        mMapDescriptor(-1),
+        mMap(nullptr),
+        mMapBytes(0)
+    {
+        if(mCompression == PrimalHistoryCompression::BOUNDED && !(mTolerance > 0.0))
+        {
+            ANALYZE_THROWERR("Primal history 'Compression Tolerance' must be positive for 'Bounded' compression.")
+        }
+    }
+
+    ~MemoryPrimalHistory()
+    {
+        this->clear();
+    }
+
+    MemoryPrimalHistory(const MemoryPrimalHistory &) = delete;
+    MemoryPrimalHistory & operator=(const MemoryPrimalHistory &) = delete;
+
+    void clear() override
+    {
+        this->unmap();
+        if(mSpillStream.is_open()) { mSpillStream.close(); }
+        if(mSpillBytes > 0) { std::remove(mSpillFileName.c_str()); }
+        mSpillBytes = 0;
+        mMemoryBytes = 0;
+        mRecords.clear();
+        mStepIndices.clear();
+        std::vector<unsigned char>().swap(mScratch);
+    }
+
+    void write(
+        Plato::OrdinalType                        aStepIndex,
+        const std::vector<PrimalHistoryField>   & aFields) override
+    {
+        if(mRecords.count(aStepIndex) == 0) { mStepIndices.push_back(aStepIndex); }
+        auto & tStep = mRecords[aStepIndex];
+        for(const auto & tField : aFields)
+        {
+            auto tHostData = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tField.mData);
+            Record tRecord;
+            tRecord.mNumValues = tHostData.extent(0);
+            tRecord.mFileOffset = 0;
+            tRecord.mFileSize = 0;
+            this->encode(tHostData.data(), tRecord, mScratch);
+
+            // store an exactly sized copy, the scratch buffer keeps the worst-case capacity
+            tRecord.mBuffer.assign(mScratch.begin(), mScratch.end());
+            tRecord.mBuffer.shrink_to_fit();
+            if(mMemoryBytes + tRecord.mBuffer.capacity() > mBudget)
+            {
+                this->spill(tRecord);
+            }
+            else
+            {
+                mMemoryBytes += tRecord.mBuffer.capacity();
+            }
+            tStep[tField.mName] = std::move(tRecord);
+        }
+    }
+
+    void finalize() override
+    {
+        if(mSpillStream.is_open()) { mSpillStream.flush(); }
+    }
+
+    Plato::OrdinalType numSteps() override
+    {
+        return mStepIndices.size();
+    }
+
+    void read(
+        Plato::OrdinalType       aStepIndex,
+        const Plato::FieldTags & aFieldTags,
+        Plato::Primal          & aPrimal) override
+    {
+        auto tStep = mRecords.find(aStepIndex);
+        if(tStep == mRecords.end())
+        {
+            ANALYZE_THROWERR(std::string("Time step '") + std::to_string(aStepIndex) + "' is not stored in the primal history.")
+        }
+        for(auto & tTag : aFieldTags.tags())
+        {
+            auto tItr = tStep->second.find(tTag);
+            if(tItr == tStep->second.end())
+            {
+                ANALYZE_THROWERR(std::string("Field '") + tTag + "' is not stored in the primal history.")
+            }
+            const auto & tRecord = tItr->second;
+            const unsigned char* tBytes = tRecord.mBuffer.data();
+            if(tRecord.mFileSize > 0)
+            {
+                tBytes = static_cast<const unsigned char*>(this->map()) + tRecord.mFileOffset;
+            }
+
+            Plato::ScalarVector tData(tTag, tRecord.mNumValues);
+            auto tHostData = Kokkos::create_mirror_view(tData);
+            this->decode(tRecord, tBytes, tHostData.data());
+            Kokkos::deep_copy(tData, tHostData);
+            aPrimal.vector(aFieldTags.id(tTag), tData);
+        }
+    }
+
+    /******************************************************************************//**
+     * \fn std::size_t memoryBytes
+     * \brief Return the number of bytes allocated for the records held in memory.
+     **********************************************************************************/
+    std::size_t memoryBytes() const { return mMemoryBytes; }
+
+    /******************************************************************************//**
+     * \fn std::size_t spillBytes
+     * \brief Return the number of encoded bytes written to the spill file.
+     **********************************************************************************/
+    std::size_t spillBytes() const { return mSpillBytes; }
+
+private:
+    void encode(const Plato::Scalar* aValues, Record & aRecord, std::vector<unsigned char> & aBuffer) const
+    {
+        if(mCompression == PrimalHistoryCompression::BOUNDED && this->encodeQuantized(aValues, aRecord, aBuffer))
+        {
+            return;
+        }
+        if(mCompression == PrimalHistoryCompression::NONE)
+        {
+            aRecord.mEncoding = Encoding::RAW;
+            aBuffer.resize(aRecord.mNumValues * sizeof(Plato::Scalar));
+            std::memcpy(aBuffer.data(), aValues, aBuffer.size());
+            return;
+        }
+        this->encodeXor(aValues, aRecord, aBuffer);
+    }
+
+    void encodeXor(const Plato::Scalar* aValues, Record & aRecord, std::vector<unsigned char> & aBuffer) const
+    {
+        static_assert(sizeof(Plato::Scalar) == sizeof(std::uint64_t), "lossless primal history compression expects 64-bit scalars");
+
+        auto tNumValues = aRecord.mNumValues;
+        aRecord.mEncoding = Encoding::XOR;
+        aBuffer.assign((tNumValues + 1) / 2, 0); // byte counts, one nibble per value
+        aBuffer.reserve(aBuffer.size() + tNumValues * sizeof(std::uint64_t));
+
+        std::uint64_t tPrevious = 0;
+        for(std::size_t tIndex = 0; tIndex < tNumValues; tIndex++)
+        {
+            std::uint64_t tBits;
+            std::memcpy(&tBits, aValues + tIndex, sizeof(tBits));
+            auto tXor = tBits ^ tPrevious;
+            tPrevious = tBits;
+
+            unsigned char tNumBytes = 0;
+            for(auto tValue = tXor; tValue != 0; tValue >>= 8) { tNumBytes++; }
+            aBuffer[tIndex / 2] |= tNumBytes << (4 * (tIndex % 2));
+            for(unsigned char tByte = 0; tByte < tNumBytes; tByte++)
+            {
+                aBuffer.push_back(static_cast<unsigned char>(tXor >> (8 * tByte)));
+            }
+        }
+    }
+
+    bool encodeQuantized(const Plato::Scalar* aValues, Record & aRecord, std::vector<unsigned char> & aBuffer) const
+    {
+        const Plato::Scalar tMaxMultiple = std::ldexp(1.0, 61);
+        auto tNumValues = aRecord.mNumValues;
+        aRecord.mEncoding = Encoding::QUANTIZED;
+        aBuffer.clear();
+        aBuffer.reserve(tNumValues * 2);
+
+        std::int64_t tPrevious = 0;
+        for(std::size_t tIndex = 0; tIndex < tNumValues; tIndex++)
+        {
+            auto tMultiple = aValues[tIndex] / (2.0 * mTolerance);
+            if(!std::isfinite(tMultiple) || std::abs(tMultiple) > tMaxMultiple)
+            {
+                aBuffer.clear();
+                return false;
+            }
+            auto tCurrent = static_cast<std::int64_t>(std::llround(tMultiple));
+            auto tDelta = tCurrent - tPrevious;
+            tPrevious = tCurrent;
+
+            // zigzag, then base-128 variable-length integer
+            auto tUnsigned = (static_cast<std::uint64_t>(tDelta) << 1) ^ static_cast<std::uint64_t>(tDelta >> 63);
+            while(tUnsigned >= 0x80)
+            {
+                aBuffer.push_back(static_cast<unsigned char>(tUnsigned | 0x80));
+                tUnsigned >>= 7;
+            }
+            aBuffer.push_back(static_cast<unsigned char>(tUnsigned));
+        }
+        return true;
+    }
+
+    void decode(const Record & aRecord, const unsigned char* aBytes, Plato::Scalar* aValues) const
+    {
+        auto tNumValues = aRecord.mNumValues;
+        if(aRecord.mEncoding == Encoding::RAW)
+        {
+            std::memcpy(aValues, aBytes, tNumValues * sizeof(Plato::Scalar));
+        }
+        else if(aRecord.mEncoding == Encoding::XOR)
+        {
+            const unsigned char* tPayload = aBytes + (tNumValues + 1) / 2;
+            std::uint64_t tPrevious = 0;
+            for(std::size_t tIndex = 0; tIndex < tNumValues; tIndex++)
+            {
+                unsigned char tNumBytes = (aBytes[tIndex / 2] >> (4 * (tIndex % 2))) & 0x0F;
+                std::uint64_t tXor = 0;
+                for(unsigned char tByte = 0; tByte < tNumBytes; tByte++)
+                {
+                    tXor |= static_cast<std::uint64_t>(*tPayload++) << (8 * tByte);
+                }
+                tPrevious ^= tXor;
+                std::memcpy(aValues + tIndex, &tPrevious, sizeof(tPrevious));
+            }
+        }
+        else
+        {
+            const unsigned char* tPayload = aBytes;
+            std::int64_t tPrevious = 0;
+            for(std::size_t tIndex = 0; tIndex < tNumValues; tIndex++)
+            {
+                std::uint64_t tUnsigned = 0;
+                for(unsigned tShift = 0; ; tShift += 7)
+                {
+                    auto tByte = *tPayload++;
+                    tUnsigned |= static_cast<std::uint64_t>(tByte & 0x7F) << tShift;
+                    if((tByte & 0x80) == 0) { break; }
+                }
+                auto tDelta = static_cast<std::int64_t>(tUnsigned >> 1) ^ -static_cast<std::int64_t>(tUnsigned & 1);
+                tPrevious += tDelta;
+                aValues[tIndex] = static_cast<Plato::Scalar>(tPrevious) * (2.0 * mTolerance);
+            }
+        }
+    }
+
+    void spill(Record & aRecord)
+    {
+        if(!mSpillStream.is_open())
+        {
+            this->unmap();
+            auto tMode = mSpillBytes > 0 ? std::ios::binary | std::ios::app : std::ios::binary | std::ios::trunc;
+            mSpillStream.open(mSpillFileName, tMode);
+            if(!mSpillStream.is_open())
+            {
+                ANALYZE_THROWERR(std::string("Failed to open primal history spill file '") + mSpillFileName + "'.")
+            }
+        }
+        mSpillStream.write(reinterpret_cast<const char*>(aRecord.mBuffer.data()), aRecord.mBuffer.size());
+        if(!mSpillStream)
+        {
+            ANALYZE_THROWERR(std::string("Failed to write primal history spill file '") + mSpillFileName + "'.")
+        }
+        aRecord.mFileOffset = mSpillBytes;
+        aRecord.mFileSize = aRecord.mBuffer.size();
+        mSpillBytes += aRecord.mBuffer.size();
+        std::vector<unsigned char>().swap(aRecord.mBuffer);
+    }
+
+    const void* map()
+    {
+        if(mMap != nullptr && mMapBytes == mSpillBytes)
+        {
+            return mMap;
+        }
+        this->unmap();
+        if(mSpillStream.is_open()) { mSpillStream.close(); }
+
+        mMapDescriptor = ::open(mSpillFileName.c_str(), O_RDONLY);
+        if(mMapDescriptor < 0)
+        {
+            ANALYZE_THROWERR(std::string("Failed to open primal history spill file '") + mSpillFileName + "'.")
+        }
+        auto tMap = ::mmap(nullptr, mSpillBytes, PROT_READ, MAP_PRIVATE, mMapDescriptor, 0);
+        if(tMap == MAP_FAILED)
+        {
+            ::close(mMapDescriptor);
+            mMapDescriptor = -1;
+            ANALYZE_THROWERR(std::string("Failed to map primal history spill file '") + mSpillFileName + "'.")
+        }
+        mMap = tMap;
+        mMapBytes = mSpillBytes;
+        return mMap;
+    }
+
+    void unmap()
+    {
+        if(mMap != nullptr) { ::munmap(mMap, mMapBytes); }
+        if(mMapDescriptor >= 0) { ::close(mMapDescriptor); }
+        mMap = nullptr;
+        mMapBytes = 0;
+        mMapDescriptor = -1;
+    }
+};
+
+/******************************************************************************//**
+ * \fn std::shared_ptr<PrimalHistory> create_primal_history
+ *
+ * \brief Create the primal state history store from the 'Primal History' sublist:
+ *
+ *   'Type'                  'Exodus' (default) or 'Memory'
+ *   'Compression'           'None' (default), 'Lossless' or 'Bounded'; 'Memory' only
+ *   'Compression Tolerance' absolute error bound of 'Bounded' compression
+ *   'Memory Budget (MB)'    memory held before spilling to file (default = 1024); 'Memory' only
+ *   'Spill File'            spill file name (default = 'primal_history'); 'Memory' only
+ *
+ * \param [in] aInputs input problem parameters
+ * \param [in] aMesh   finite element mesh
+ * \param [in] aRank   processor rank, appended to the spill file name
+ **********************************************************************************/
+inline std::shared_ptr<PrimalHistory>
+create_primal_history(
+    Teuchos::ParameterList & aInputs,
+    Plato::Mesh              aMesh,
+    int                      aRank)
+{
+    if(!aInputs.isSublist("Primal History"))
+    {
+        return std::make_shared<ExodusPrimalHistory>(aMesh, "solution_history");
+    }
+
+    auto & tParams = aInputs.sublist("Primal History");
+    auto tType = tParams.get<std::string>("Type", "Exodus");
+    if(tType == "Exodus")
+    {
+        return std::make_shared<ExodusPrimalHistory>(aMesh, "solution_history");
+    }
+    if(tType != "Memory")
+    {
+        ANALYZE_THROWERR(std::string("Primal history 'Type' '") + tType + "' is not supported. Options are 'Exodus' and 'Memory'.")
+    }
+
+    auto tCompressionName = tParams.get<std::string>("Compression", "None");
+    PrimalHistoryCompression tCompression;
+    if(tCompressionName == "None")          { tCompression = PrimalHistoryCompression::NONE; }
+    else if(tCompressionName == "Lossless") { tCompression = PrimalHistoryCompression::LOSSLESS; }
+    else if(tCompressionName == "Bounded")  { tCompression = PrimalHistoryCompression::BOUNDED; }
+    else
+    {
+        ANALYZE_THROWERR(std::string("Primal history 'Compression' '") + tCompressionName
+            + "' is not supported. Options are 'None', 'Lossless' and 'Bounded'.")
+    }
+
+    auto tTolerance = tParams.get<Plato::Scalar>("Compression Tolerance", 0.0);
+    auto tBudgetMB = tParams.get<Plato::Scalar>("Memory Budget (MB)", 1024.0);
+    auto tBudget = tBudgetMB > 0.0 ? static_cast<std::size_t>(tBudgetMB * 1024.0 * 1024.0) : std::size_t(0);
+    auto tSpillFile = tParams.get<std::string>("Spill File", "primal_history") + "." + std::to_string(aRank);
+    return std::make_shared<MemoryPrimalHistory>(tCompression, tTolerance, tBudget, tSpillFile);
+}
+
+} // namespace Fluids
+
+} // namespace Plato
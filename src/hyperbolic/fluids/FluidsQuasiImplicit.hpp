@@ -27,6 +27,7 @@
 #include "solver/PlatoSolverFactory.hpp"
 
 #include "hyperbolic/fluids/FluidsUtils.hpp"
+#include "hyperbolic/fluids/FluidsPrimalHistory.hpp"
 #include "hyperbolic/fluids/FluidsCriterionBase.hpp"
 #include "hyperbolic/fluids/FluidsVectorFunction.hpp"
 #include "hyperbolic/fluids/FluidsCriterionFactory.hpp"
@@ -100,6 +101,21 @@ private:
     // critical time step container
     std::vector<Plato::Scalar> mCriticalTimeStepHistory; /*!< critical time step history */
 
+    // primal state history read by the adjoint sweep
+    std::shared_ptr<Plato::Fluids::PrimalHistory> mPrimalHistory; /*!< primal state history store */
+
+    // linear solvers, kept across time steps and optimization iterations
+    rcp<Plato::AbstractSolver> mPressureSolver; /*!< pressure and pressure adjoint linear solver */
+    rcp<Plato::AbstractSolver> mPredictorSolver; /*!< velocity predictor and predictor adjoint linear solver */
+    rcp<Plato::AbstractSolver> mCorrectorSolver; /*!< velocity corrector and velocity adjoint linear solver */
+    rcp<Plato::AbstractSolver> mTemperatureSolver; /*!< temperature and temperature adjoint linear solver */
+
+    // operator of the last pressure solve
+    typename Plato::CrsMatrixType::RowMapVectorT mPressureOperatorRowMap; /*!< row map of the last pressure operator */
+    typename Plato::CrsMatrixType::OrdinalVectorT mPressureOperatorColumns; /*!< column indices of the last pressure operator */
+    typename Plato::CrsMatrixType::ScalarVectorT mPressureOperatorEntries; /*!< entries of the last pressure operator */
+    Plato::OrdinalType mNumPressureOperatorSetups = 0; /*!< number of pressure solves that could not reuse the previous operator */
+
     // vector functions
     Plato::Fluids::VectorFunction<typename PhysicsT::MassPhysicsT>     mPressureResidual; /*!< pressure solver vector function interface */
     Plato::Fluids::VectorFunction<typename PhysicsT::MomentumPhysicsT> mPredictorResidual; /*!< velocity predictor solver vector function interface */
@@ -187,6 +203,17 @@ public:
         tWriter->Write(/*plot_index=*/0, tTime);
     }
 
+    /******************************************************************************//**
+     * \fn Plato::OrdinalType getNumPressureOperatorSetups
+     * \brief Return the number of pressure solves that set up a new operator, i.e. that
+     *   could not reuse the factorization or preconditioner of the previous pressure solve.
+     * \return number of pressure operator setups
+    **********************************************************************************/
+    Plato::OrdinalType getNumPressureOperatorSetups() const
+    {
+        return mNumPressureOperatorSetups;
+    }
+
     /******************************************************************************//**
      * \brief Update simulation parameters within optimization iterations
      * \param [in] aControl 1D container of control variables
@@ -213,10 +240,8 @@ public:
         this->clear();
         this->checkProblemSetup();
 
-        auto tWriter = Plato::MeshIOFactory::create("solution_history", mSpatialModel.Mesh, "Write");
-
         Plato::Primal tPrimal;
-        this->setInitialConditions(tPrimal, tWriter);
+        this->setInitialConditions(tPrimal);
         this->calculateCharacteristicElemSize(tPrimal);
         
         mDataMap.scalarNodeFields["Topology"] = aControl;
@@ -241,7 +266,7 @@ public:
 
             if(this->writeOutput(tIteration))
             {
-                this->write(tPrimal, tWriter);
+                this->write(tPrimal);
             }
 
             if(this->checkStoppingCriteria(tPrimal))
@@ -250,6 +275,7 @@ public:
             }
             this->savePrimal(tPrimal);
         }
+        mPrimalHistory->finalize();
 
         auto tSolution = this->setSolution();
         return tSolution;
@@ -296,18 +322,12 @@ public:
             ANALYZE_THROWERR(std::string("Criterion with tag '") + aName + "' is not defined in the criteria list");
         }
 
-        auto tBaseName = std::string("solution_history");
-        auto tReader = Plato::MeshIOFactory::create(tBaseName, mSpatialModel.Mesh, "Read");
-        if( tReader->NumTimeSteps() != static_cast<size_t>(mNumForwardSolveTimeSteps + 1))
-        {
-            ANALYZE_THROWERR(std::string("Number of time steps read from '") + tBaseName
-                 + "' does not match the expected number of time steps: '" + std::to_string(mNumForwardSolveTimeSteps + 1) + "'.")
-        }
+        this->checkPrimalHistory();
 
         // evaluate steady-state criterion
         Plato::Primal tPrimal;
         tPrimal.scalar("time step index", mNumForwardSolveTimeSteps);
-        this->setPrimal(tReader, tPrimal);
+        this->readPrimal(tPrimal);
         this->setCriticalTimeStep(tPrimal);
         auto tOutput = tItr->second->value(aControl, tPrimal);
 
@@ -356,13 +376,7 @@ public:
 
         Plato::Dual tDual;
         Plato::Primal tCurrentState, tPreviousState;
-        auto tBaseName = std::string("solution_history");
-        auto tReader = Plato::MeshIOFactory::create(tBaseName, mSpatialModel.Mesh, "Read");
-        if( tReader->NumTimeSteps() != static_cast<size_t>(mNumForwardSolveTimeSteps + 1))
-        {
-            ANALYZE_THROWERR(std::string("Number of time steps read from '") + tBaseName
-                 + "' does not match the expected value: '" + std::to_string(mNumForwardSolveTimeSteps + 1) + "'.")
-        }
+        this->checkPrimalHistory();
 
         Plato::ScalarVector tTotalDerivative("total derivative", mSpatialModel.Mesh->NumNodes());
         auto tLastStepIndex = mNumForwardSolveTimeSteps;
@@ -370,15 +384,15 @@ public:
         {
             // set fields for the current primal state
             tCurrentState.scalar("time step index", tCurrentStateIndex);
-            this->setPrimal(tReader, tCurrentState);
+            this->readPrimal(tCurrentState);
             this->setCriticalTimeStep(tCurrentState);
 
                 // set fields for the previous primal state
             auto tPreviousStateIndex = tCurrentStateIndex + 1u;
             tPreviousState.scalar("time step index", tPreviousStateIndex);
-            if(tPreviousStateIndex != tReader->NumTimeSteps())
+            if(tPreviousStateIndex != mPrimalHistory->numSteps())
             {
-                this->setPrimal(tReader, tPreviousState);
+                this->readPrimal(tPreviousState);
                 this->setCriticalTimeStep(tPreviousState);
             }
 
@@ -425,13 +439,7 @@ public:
 
         Plato::Dual tDual;
         Plato::Primal tCurrentState, tPreviousState;
-        auto tBaseName = std::string("solution_history");
-        auto tReader = Plato::MeshIOFactory::create(tBaseName, mSpatialModel.Mesh, "Read");
-        if( tReader->NumTimeSteps() != static_cast<size_t>(mNumForwardSolveTimeSteps + 1))
-        {
-            ANALYZE_THROWERR(std::string("Number of time steps read from '") + tBaseName
-                 + "' does not match the expected value: '" + std::to_string(mNumForwardSolveTimeSteps + 1) + "'.")
-        }
+        this->checkPrimalHistory();
 
         Plato::ScalarVector tTotalDerivative("total derivative", mSpatialModel.Mesh->NumNodes());
         auto tLastStepIndex = mNumForwardSolveTimeSteps - 1;
@@ -439,15 +447,15 @@ public:
         {
             // set fields for the current primal state
             tCurrentState.scalar("time step index", tCurrentStateIndex);
-            this->setPrimal(tReader, tCurrentState);
+            this->readPrimal(tCurrentState);
             this->setCriticalTimeStep(tCurrentState);
 
             // set fields for the previous primal state
             auto tPreviousStateIndex = tCurrentStateIndex + 1u;
             tPreviousState.scalar("time step index", tPreviousStateIndex);
-            if(tPreviousStateIndex != tReader->NumTimeSteps())
+            if(tPreviousStateIndex != mPrimalHistory->numSteps())
             {
-                this->setPrimal(tReader, tPreviousState);
+                this->readPrimal(tPreviousState);
                 this->setCriticalTimeStep(tPreviousState);
             }
 
@@ -494,41 +502,28 @@ public:
 private:
     /******************************************************************************//**
      * \fn void write
-     * \brief Write solution to visualization file. This function is mostly used for
-     *   optimization purposes to avoid storing large time-dependent state history in
-     *   memory. Thus, maximizing available GPU memory.
+     * \brief Write solution to the primal state history. The history is kept out of
+     *   device memory (i.e. in an Exodus file or in host memory) to avoid storing large
+     *   time-dependent state history on the device. Thus, maximizing available GPU memory.
      *
      * \param [in] aPrimal primal state database
-     * \param [in] aMeshIO interface to allow output to a VTK visualization file
      *
      **********************************************************************************/
-    void write(
-        const Plato::Primal & aPrimal,
-              Plato::MeshIO   aMeshIO
-    )
+    void write(const Plato::Primal & aPrimal)
     {
         const Plato::OrdinalType tTimeStepIndex = aPrimal.scalar("time step index");
+        std::string tPrefix = tTimeStepIndex != static_cast<Plato::OrdinalType>(0) ? "current " : "previous ";
 
-        std::string tTag = tTimeStepIndex != static_cast<Plato::OrdinalType>(0) ? "current pressure" : "previous pressure";
-        auto tPressureView = aPrimal.vector(tTag);
-        aMeshIO->AddNodeData("Pressure", tPressureView, mNumPressDofsPerNode);
-
-        tTag = tTimeStepIndex != static_cast<Plato::OrdinalType>(0) ? "current velocity" : "previous velocity";
-        auto tVelocityView = aPrimal.vector(tTag);
-        aMeshIO->AddNodeData("Velocity", tVelocityView, mNumVelDofsPerNode);
-
-        tTag = tTimeStepIndex != static_cast<Plato::OrdinalType>(0) ? "current predictor" : "previous predictor";
-        auto tPredictorView = aPrimal.vector(tTag);
-        aMeshIO->AddNodeData("Predictor", tPredictorView, mNumVelDofsPerNode);
-
+        std::vector<Plato::Fluids::PrimalHistoryField> tFields;
+        tFields.push_back({"Pressure", aPrimal.vector(tPrefix + "pressure"), mNumPressDofsPerNode});
+        tFields.push_back({"Velocity", aPrimal.vector(tPrefix + "velocity"), mNumVelDofsPerNode});
+        tFields.push_back({"Predictor", aPrimal.vector(tPrefix + "predictor"), mNumVelDofsPerNode});
         if(mCalculateHeatTransfer)
         {
-            tTag = tTimeStepIndex != static_cast<Plato::OrdinalType>(0) ? "current temperature" : "previous temperature";
-            auto tTemperatureView = aPrimal.vector(tTag);
-            aMeshIO->AddNodeData("Temperature", tTemperatureView, mNumTempDofsPerNode);
+            tFields.push_back({"Temperature", aPrimal.vector(tPrefix + "temperature"), mNumTempDofsPerNode});
         }
 
-        aMeshIO->Write(tTimeStepIndex, tTimeStepIndex);
+        mPrimalHistory->write(tTimeStepIndex, tFields);
     }
 
     /******************************************************************************//**
@@ -555,13 +550,11 @@ private:
      * \fn void readCurrentFields
      *
      * \brief Read current states
-     * \param [in]     aReader    Plato mesh reader
      * \param [in]     aStepIndex Index of the time step to be read
      * \param [in/out] aPrimal    Primal state solution database
      *
      **********************************************************************************/
     void readCurrentFields(
-        Plato::MeshIO        aReader,
         Plato::OrdinalType   aStepIndex,
         Plato::Primal      & aPrimal
     )
@@ -575,20 +568,18 @@ private:
             tFieldTags.set("Temperature", "current temperature");
         }
 
-        Plato::readNodeFields(aReader, aStepIndex, tFieldTags, aPrimal);
+        mPrimalHistory->read(aStepIndex, tFieldTags, aPrimal);
     }
 
     /******************************************************************************//**
      * \fn void readPreviousFields
      *
      * \brief Read previous states
-     * \param [in]     aReader    Plato mesh reader
      * \param [in]     aStepIndex Index of the time step to be read
      * \param [in/out] aPrimal    Primal state solution database
      *
      **********************************************************************************/
     void readPreviousFields(
-        Plato::MeshIO        aReader,
         Plato::OrdinalType   aStepIndex,
         Plato::Primal      & aPrimal
     )
@@ -601,26 +592,38 @@ private:
             tFieldTags.set("Temperature", "previous temperature");
         }
 
-        Plato::readNodeFields(aReader, aStepIndex, tFieldTags, aPrimal);
+        mPrimalHistory->read(aStepIndex, tFieldTags, aPrimal);
     }
 
     /******************************************************************************//**
-     * \fn void setPrimal
+     * \fn void readPrimal
      *
-     * \brief Set primal state solution database for the current optimization iteration.
-     * \param [in]     aReader Plato mesh reader
+     * \brief Read primal state solution database for the current optimization iteration
+     *   from the primal state history.
      * \param [in/out] aPrimal primal state solution database
      *
      **********************************************************************************/
-    void setPrimal(
-        Plato::MeshIO   aReader,
-        Plato::Primal & aPrimal
-    )
+    void readPrimal(Plato::Primal & aPrimal)
     {
         auto tCurrentStepIndex = static_cast<size_t>(aPrimal.scalar("time step index"));
         auto tPreviousStepIndex = tCurrentStepIndex - 1;
-        this->readCurrentFields(aReader, tCurrentStepIndex, aPrimal);
-        this->readPreviousFields(aReader, tPreviousStepIndex, aPrimal);
+        this->readCurrentFields(tCurrentStepIndex, aPrimal);
+        this->readPreviousFields(tPreviousStepIndex, aPrimal);
+    }
+
+    /******************************************************************************//**
+     * \fn void checkPrimalHistory
+     *
+     * \brief Check that the primal state history holds every forward solve time step.
+     *
+     **********************************************************************************/
+    void checkPrimalHistory()
+    {
+        if( mPrimalHistory->numSteps() != mNumForwardSolveTimeSteps + 1 )
+        {
+            ANALYZE_THROWERR(std::string("Number of time steps in the primal state history does not match the expected value: '")
+                 + std::to_string(mNumForwardSolveTimeSteps + 1) + "'.")
+        }
     }
 
     /******************************************************************************//**
@@ -665,12 +668,10 @@ private:
      *
      * \brief Set initial conditions for pressure, temperature and veloctity fields.
      * \param [in] aPrimal primal state database
-     * \param [in] aMeshIO interface to allow output to a VTK visualization file
      *
      **********************************************************************************/
     void setInitialConditions
-    (Plato::Primal & aPrimal,
-     Plato::MeshIO   aMeshIO)
+    (Plato::Primal & aPrimal)
     {
         const Plato::Scalar tTime = 0.0;
         const Plato::OrdinalType tTimeStep = 0;
@@ -710,7 +711,7 @@ private:
 
         if(this->writeOutput(tTimeStep))
         {
-            this->write(aPrimal, aMeshIO);
+            this->write(aPrimal);
         }
     }
 
@@ -772,10 +773,12 @@ private:
     {
         this->allocatePrimalStates();
         this->areDianosticsEnabled(aInputs);
+        mPrimalHistory = Plato::Fluids::create_primal_history(aInputs, mSpatialModel.Mesh, Plato::Comm::rank(mMachine));
         this->parseNewtonSolverInputs(aInputs);
         this->parseConvergenceCriteria(aInputs);
         this->parseTimeIntegratorInputs(aInputs);
         this->setHeatTransferEquation(aInputs);
+        this->allocateLinearSolvers();
         this->allocateOptimizationMetadata(aInputs);
     }
 
@@ -891,6 +894,7 @@ private:
 
         mNumForwardSolveTimeSteps = 0;
         mCriticalTimeStepHistory.clear();
+        mPrimalHistory->clear();
         Plato::blas2::fill(0.0, mPressure);
         Plato::blas2::fill(0.0, mVelocity);
         Plato::blas2::fill(0.0, mPredictor);
@@ -958,6 +962,103 @@ private:
         mTemperature = Plato::ScalarMultiVector("Temperature Snapshots", tTimeSnapshotsStored, tNumNodes);
     }
 
+    /******************************************************************************//**
+     * \fn void allocateLinearSolvers
+     *
+     * \brief Allocate one linear solver per field. Each solver is used by the forward
+     *   and adjoint solves of its field for the lifetime of the problem, so its maps,
+     *   factorization and preconditioner persist across time steps.
+     *
+     **********************************************************************************/
+    void allocateLinearSolvers()
+    {
+        if( mInputs.isSublist("Linear Solver") == false )
+        { return; }
+
+        auto & tParamList = mInputs.sublist("Linear Solver");
+        Plato::SolverFactory tSolverFactory(tParamList);
+        auto tNumNodes = mSpatialModel.Mesh->NumNodes();
+        mPressureSolver  = tSolverFactory.create(tNumNodes, mMachine, mNumPressDofsPerNode);
+        mPredictorSolver = tSolverFactory.create(tNumNodes, mMachine, mNumVelDofsPerNode);
+        mCorrectorSolver = tSolverFactory.create(tNumNodes, mMachine, mNumVelDofsPerNode);
+        if(mCalculateHeatTransfer)
+        {
+            mTemperatureSolver = tSolverFactory.create(tNumNodes, mMachine, mNumTempDofsPerNode);
+        }
+    }
+
+    /******************************************************************************//**
+     * \fn bool isPressureOperatorUnchanged
+     *
+     * \brief Return true if the constrained pressure operator matches the operator of the
+     *   previous pressure solve, in which case the pressure solver can reuse its
+     *   factorization or preconditioner. The pressure operator only depends on the
+     *   configuration, thus it is usually unchanged across time steps, adjoint steps and
+     *   optimization iterations.
+     * \param [in] aOperator constrained pressure operator
+     * \return boolean (true = unchanged; false = changed)
+     *
+     **********************************************************************************/
+    bool isPressureOperatorUnchanged(const Plato::CrsMatrixType & aOperator)
+    {
+        auto tRowMap = aOperator.rowMap();
+        auto tColumns = aOperator.columnIndices();
+        auto tEntries = aOperator.entries();
+
+        bool tUnchanged = tRowMap.extent(0) == mPressureOperatorRowMap.extent(0)
+                       && tColumns.extent(0) == mPressureOperatorColumns.extent(0)
+                       && tEntries.extent(0) == mPressureOperatorEntries.extent(0);
+        if(tUnchanged)
+        {
+            // the entries are assembled with atomic additions, so their round-off may vary between assemblies
+            constexpr Plato::Scalar tRelativeTolerance = 1e-12;
+            tUnchanged = this->countChangedValues(tRowMap, mPressureOperatorRowMap) == 0
+                      && this->countChangedValues(tColumns, mPressureOperatorColumns) == 0
+                      && this->countChangedValues(tEntries, mPressureOperatorEntries, tRelativeTolerance) == 0;
+        }
+
+        if(!tUnchanged)
+        {
+            mNumPressureOperatorSetups++;
+            // keep a copy, the solver may modify the operator passed to it (e.g. diagonal shift)
+            mPressureOperatorRowMap = typename Plato::CrsMatrixType::RowMapVectorT("pressure operator row map", tRowMap.extent(0));
+            mPressureOperatorColumns = typename Plato::CrsMatrixType::OrdinalVectorT("pressure operator columns", tColumns.extent(0));
+            mPressureOperatorEntries = typename Plato::CrsMatrixType::ScalarVectorT("pressure operator entries", tEntries.extent(0));
+            Kokkos::deep_copy(mPressureOperatorRowMap, tRowMap);
+            Kokkos::deep_copy(mPressureOperatorColumns, tColumns);
+            Kokkos::deep_copy(mPressureOperatorEntries, tEntries);
+        }
+        return tUnchanged;
+    }
+
+    /******************************************************************************//**
+     * \fn Plato::OrdinalType countChangedValues
+     *
+     * \brief Return the number of entries that differ between two views of equal length.
+     * \param [in] aCurrent   current values
+     * \param [in] aLast      last values
+     * \param [in] aTolerance relative tolerance below which two values are equal (default = 0)
+     * \return number of changed entries
+     *
+     **********************************************************************************/
+    template<typename ViewT>
+    Plato::OrdinalType countChangedValues
+    (const ViewT & aCurrent,
+     const ViewT & aLast,
+     Plato::Scalar aTolerance = 0.0) const
+    {
+        Plato::OrdinalType tNumChanges = 0;
+        Kokkos::parallel_reduce("count changed values", Kokkos::RangePolicy<>(0, aCurrent.extent(0)),
+        KOKKOS_LAMBDA(const Plato::OrdinalType & aOrdinal, Plato::OrdinalType & aSum)
+        {
+            Plato::Scalar tCurrent = aCurrent(aOrdinal);
+            Plato::Scalar tLast = aLast(aOrdinal);
+            Plato::Scalar tScale = fabs(tCurrent) > fabs(tLast) ? fabs(tCurrent) : fabs(tLast);
+            if(fabs(tCurrent - tLast) > aTolerance * tScale) { aSum++; }
+        }, tNumChanges);
+        return tNumChanges;
+    }
+
     /******************************************************************************//**
      * \fn void allocateCriteriaList
      *
@@ -1489,12 +1590,9 @@ private:
         Plato::OrdinalVector tBcDofs;
         mVelocityEssentialBCs.get(tBcDofs, tBcValues);
 
-        // create linear solver
-        if( mInputs.isSublist("Linear Solver") == false )
+        // check linear solver
+        if( mCorrectorSolver == nullptr )
         { ANALYZE_THROWERR("Parameter list 'Linear Solver' is not defined.") }
-        auto tParamList = mInputs.sublist("Linear Solver");
-        Plato::SolverFactory tSolverFactory(tParamList);
-        auto tSolver = tSolverFactory.create(mSpatialModel.Mesh->NumNodes(), mMachine, mNumVelDofsPerNode);
 
         // set initial guess for current velocity
         Plato::OrdinalType tIteration = 1;
@@ -1507,7 +1605,9 @@ private:
             auto tResidual = mCorrectorResidual.value(aControl, aPrimal);
             Plato::blas1::scale(-1.0, tResidual);
             Plato::blas1::fill(0.0, tDeltaCorrector);
-            tSolver->solve(*tJacobian, tDeltaCorrector, tResidual);
+            // the jacobian is unchanged within the newton loop
+            if(tIteration > 1) { mCorrectorSolver->reuseOperator(); }
+            mCorrectorSolver->solve(*tJacobian, tDeltaCorrector, tResidual);
             Plato::blas1::update(1.0, tDeltaCorrector, 1.0, tCurrentVelocity);
 
             auto tNormResidual = Plato::blas1::norm(tResidual);
@@ -1624,12 +1724,9 @@ private:
         auto tResidual = mPredictorResidual.value(aControl, aStates);
         auto tJacobian = mPredictorResidual.gradientPredictor(aControl, aStates);
 
-        // create linear solver
-        if( mInputs.isSublist("Linear Solver") == false )
+        // check linear solver
+        if( mPredictorSolver == nullptr )
         { ANALYZE_THROWERR("Parameter list 'Linear Solver' is not defined.") }
-        auto tParamList = mInputs.sublist("Linear Solver");
-        Plato::SolverFactory tSolverFactory(tParamList);
-        auto tSolver = tSolverFactory.create(mSpatialModel.Mesh->NumNodes(), mMachine, mNumVelDofsPerNode);
 
         Plato::OrdinalType tIteration = 1;
         Plato::Scalar tInitialNormStep = 0.0, tInitialNormResidual = 0.0;
@@ -1640,7 +1737,9 @@ private:
 
             Plato::blas1::fill(0.0, tDeltaPredictor);
             Plato::blas1::scale(-1.0, tResidual);
-            tSolver->solve(*tJacobian, tDeltaPredictor, tResidual);
+            // the jacobian is unchanged within the newton loop
+            if(tIteration > 1) { mPredictorSolver->reuseOperator(); }
+            mPredictorSolver->solve(*tJacobian, tDeltaPredictor, tResidual);
             Plato::blas1::update(1.0, tDeltaPredictor, 1.0, tCurrentPredictor);
 
             auto tNormResidual = Plato::blas1::norm(tResidual);
@@ -1716,12 +1815,9 @@ private:
         Plato::OrdinalVector tBcDofs;
         mPressureEssentialBCs.get(tBcDofs, tBcValues);
 
-        // create linear solver
-        if( mInputs.isSublist("Linear Solver") == false )
+        // check linear solver
+        if( mPressureSolver == nullptr )
         { ANALYZE_THROWERR("Parameter list 'Linear Solver' is not defined.") }
-        auto tParamList = mInputs.sublist("Linear Solver");
-        Plato::SolverFactory tSolverFactory(tParamList);
-        auto tSolver = tSolverFactory.create(mSpatialModel.Mesh->NumNodes(), mMachine, mNumPressDofsPerNode);
 
         Plato::OrdinalType tIteration = 1;
         Plato::Scalar tInitialNormStep = 0.0, tInitialNormResidual = 0.0;
@@ -1737,7 +1833,8 @@ private:
             Plato::Scalar tScale = (tIteration == 1) ? 1.0 : 0.0;
             Plato::apply_constraints<mNumPressDofsPerNode>(tBcDofs, tBcValues, tJacobian, tResidual, tScale);
             Plato::blas1::fill(0.0, tDeltaPressure);
-            tSolver->solve(*tJacobian, tDeltaPressure, tResidual);
+            if(this->isPressureOperatorUnchanged(*tJacobian)) { mPressureSolver->reuseOperator(); }
+            mPressureSolver->solve(*tJacobian, tDeltaPressure, tResidual);
             Plato::blas1::update(1.0, tDeltaPressure, 1.0, tCurrentPressure);
 
             auto tNormResidual = Plato::blas1::norm(tResidual);
@@ -1812,11 +1909,8 @@ private:
         mTemperatureEssentialBCs.get(tBcDofs, tBcValues);
 
         // solve energy equation (consistent or mass lumped)
-        if( mInputs.isSublist("Linear Solver") == false )
+        if( mTemperatureSolver == nullptr )
         { ANALYZE_THROWERR("Parameter list 'Linear Solver' is not defined.") }
-        auto tParamList = mInputs.sublist("Linear Solver");
-        Plato::SolverFactory tSolverFactory(tParamList);
-        auto tSolver = tSolverFactory.create(mSpatialModel.Mesh->NumNodes(), mMachine, mNumTempDofsPerNode);
 
         Plato::OrdinalType tIteration = 1;
         Plato::Scalar tInitialNormStep = 0.0, tInitialNormResidual = 0.0;
@@ -1834,7 +1928,7 @@ private:
             Plato::Scalar tScale = (tIteration == 1) ? 1.0 : 0.0;
             Plato::apply_constraints<mNumTempDofsPerNode>(tBcDofs, tBcValues, tJacobian, tResidual, tScale);
             Plato::blas1::fill(0.0, tDeltaTemperature);
-            tSolver->solve(*tJacobian, tDeltaTemperature, tResidual);
+            mTemperatureSolver->solve(*tJacobian, tDeltaTemperature, tResidual);
             Plato::blas1::update(1.0, tDeltaTemperature, 1.0, tCurrentTemperature);
 
             // calculate stopping criteria
@@ -1897,13 +1991,10 @@ private:
         Plato::blas1::scale(-1.0, tRHS);
 
         // solve adjoint system of equations
-        if( mInputs.isSublist("Linear Solver") == false )
+        if( mPredictorSolver == nullptr )
         { ANALYZE_THROWERR("Parameter list 'Linear Solver' is not defined.") }
-        auto tParamList = mInputs.sublist("Linear Solver");
-        Plato::SolverFactory tSolverFactory(tParamList);
-        auto tSolver = tSolverFactory.create(mSpatialModel.Mesh->NumNodes(), mMachine, mNumVelDofsPerNode);
         auto tJacobianPredictor = mPredictorResidual.gradientPredictor(aControl, aCurrentPrimal);
-        tSolver->solve(*tJacobianPredictor, tCurrentPredictorAdjoint, tRHS);
+        mPredictorSolver->solve(*tJacobianPredictor, tCurrentPredictorAdjoint, tRHS);
     }
 
     /******************************************************************************//**
@@ -1962,14 +2053,12 @@ private:
         Plato::blas1::fill(0.0, tBcValues);
 
         // solve adjoint system of equations
-        if( mInputs.isSublist("Linear Solver") == false )
+        if( mPressureSolver == nullptr )
         { ANALYZE_THROWERR("Parameter list 'Linear Solver' is not defined.") }
-        auto tParamList = mInputs.sublist("Linear Solver");
-        Plato::SolverFactory tSolverFactory(tParamList);
-        auto tSolver = tSolverFactory.create(mSpatialModel.Mesh->NumNodes(), mMachine, mNumPressDofsPerNode);
         auto tJacPressResWrtCurPress = mPressureResidual.gradientCurrentPress(aControl, aCurrentPrimal);
         Plato::apply_constraints<mNumPressDofsPerNode>(tBcDofs, tBcValues, tJacPressResWrtCurPress, tRightHandSide);
-        tSolver->solve(*tJacPressResWrtCurPress, tCurrentPressAdjoint, tRightHandSide);
+        if(this->isPressureOperatorUnchanged(*tJacPressResWrtCurPress)) { mPressureSolver->reuseOperator(); }
+        mPressureSolver->solve(*tJacPressResWrtCurPress, tCurrentPressAdjoint, tRightHandSide);
     }
 
     /******************************************************************************//**
@@ -2026,14 +2115,11 @@ private:
         Plato::blas1::fill(0.0, tBcValues);
 
         // solve adjoint system of equations
-        if( mInputs.isSublist("Linear Solver") == false )
+        if( mTemperatureSolver == nullptr )
         { ANALYZE_THROWERR("Parameter list 'Linear Solver' is not defined.") }
-        auto tParamList = mInputs.sublist("Linear Solver");
-        Plato::SolverFactory tSolverFactory(tParamList);
-        auto tSolver = tSolverFactory.create(mSpatialModel.Mesh->NumNodes(), mMachine, mNumTempDofsPerNode);
         auto tJacobianCurrentTemp = mTemperatureResidual->gradientCurrentTemp(aControl, aCurrentPrimal);
         Plato::apply_constraints<mNumTempDofsPerNode>(tBcDofs, tBcValues, tJacobianCurrentTemp, tRightHandSide);
-        tSolver->solve(*tJacobianCurrentTemp, tCurrentTempAdjoint, tRightHandSide);
+        mTemperatureSolver->solve(*tJacobianCurrentTemp, tCurrentTempAdjoint, tRightHandSide);
     }
 
     /******************************************************************************//**
@@ -2100,14 +2186,11 @@ private:
         Plato::blas1::fill(0.0, tBcValues);
 
         // solve adjoint system of equations
-        if( mInputs.isSublist("Linear Solver") == false )
+        if( mCorrectorSolver == nullptr )
         { ANALYZE_THROWERR("Parameter list 'Linear Solver' is not defined.") }
-        auto tParamList = mInputs.sublist("Linear Solver");
-        Plato::SolverFactory tSolverFactory(tParamList);
-        auto tSolver = tSolverFactory.create(mSpatialModel.Mesh->NumNodes(), mMachine, mNumVelDofsPerNode);
         auto tJacCorrectorResWrtCurVel = mCorrectorResidual.gradientCurrentVel(aControl, aCurrentPrimalState);
         Plato::set_dofs_values(tBcDofs, tRightHandSide, 0.0);
-        tSolver->solve(*tJacCorrectorResWrtCurVel, tCurrentVelocityAdjoint, tRightHandSide);
+        mCorrectorSolver->solve(*tJacCorrectorResWrtCurVel, tCurrentVelocityAdjoint, tRightHandSide);
     }
 
     /******************************************************************************//**
@@ -86,6 +86,12 @@ namespace Hyperbolic
     RelaxedMicromorphicResidual<EvaluationType, IndicatorFunctionType>::
     checkTimeIntegrator(Teuchos::ParameterList & aIntegratorParams)
     {
+        if (aIntegratorParams.isType<std::string>("Integrator") &&
+            aIntegratorParams.get<std::string>("Integrator") == "Central Difference")
+        {
+            ANALYZE_THROWERR("In RelaxedMicromorphicResidual constructor: Central Difference requires a lumped mass, which is not implemented for micromorphic mechanics")
+        }
+
         if (aIntegratorParams.isType<bool>("A-Form"))
         {
             auto tAForm = aIntegratorParams.get<bool>("A-Form");
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <map>
+#include <vector>
+#include <functional>
+
 #include "Solutions.hpp"
 #include "PlatoMesh.hpp"
 #include "SpatialModel.hpp"
@@ -42,6 +46,8 @@ namespace Parabolic
         Plato::OrdinalType mNumSteps, mNumNewtonSteps;
         Plato::Scalar      mTimeStep, mNewtonResTol, mNewtonIncTol;
 
+        Plato::OrdinalType mNumCheckpoints; /*!< number of stored time steps, zero stores every step */
+
         bool mSaveState;
 
         Criteria mCriteria;
@@ -50,12 +56,16 @@ namespace Parabolic
         Plato::ScalarVector mResidual;
         Plato::ScalarVector mResidualV;
 
-        Plato::ScalarMultiVector mAdjoints_U;
-        Plato::ScalarMultiVector mAdjoints_V;
-
         Plato::ScalarMultiVector mState;
         Plato::ScalarMultiVector mStateDot;
 
+        Plato::ScalarMultiVector mCheckpointStates;          /*!< checkpointed states, one row per checkpoint */
+        Plato::ScalarMultiVector mCheckpointStateDots;       /*!< checkpointed state rates, one row per checkpoint */
+        std::vector<Plato::OrdinalType> mCheckpointSteps;    /*!< step stored in each checkpoint, -1 if none */
+        Plato::ScalarMultiVector mSweepState;                /*!< previous and current state of the reverse sweep */
+        Plato::ScalarMultiVector mSweepStateDot;             /*!< previous and current state rate of the reverse sweep */
+        std::map<std::string, Plato::Scalar> mCriterionValues; /*!< criteria values accumulated by the forward sweep */
+
         Teuchos::RCP<Plato::CrsMatrixType> mJacobianU;
         Teuchos::RCP<Plato::CrsMatrixType> mJacobianV;
 
@@ -230,6 +240,75 @@ namespace Parabolic
          * \return solution database
         **********************************************************************************/
         Plato::Solutions getSolution() const;
+
+        /// @brief function called by the reverse sweep for each time step.  The state of
+        ///   time step aStepIndex is row aSolutionStep of the solution database.
+        using StepFunction = std::function<void(Plato::OrdinalType aStepIndex,
+                                                const Plato::Solutions & aSolution,
+                                                Plato::OrdinalType aSolutionStep)>;
+
+        /******************************************************************************//**
+         * \brief Return true if only checkpoints of the state history are stored
+        **********************************************************************************/
+        bool isCheckpointed() const;
+
+        /******************************************************************************//**
+         * \brief Solve for the state of the next time step
+         * \param [in]     aControl      1D view of control variables
+         * \param [in]     aStatePrev    state of the previous time step
+         * \param [in]     aStateDotPrev state rate of the previous time step
+         * \param [in,out] aState        state, initial guess on input
+         * \param [in,out] aStateDot     state rate, initial guess on input
+        **********************************************************************************/
+        void advance(
+          const Plato::ScalarVector & aControl,
+          const Plato::ScalarVector & aStatePrev,
+          const Plato::ScalarVector & aStateDotPrev,
+          const Plato::ScalarVector & aState,
+          const Plato::ScalarVector & aStateDot
+        );
+
+        /******************************************************************************//**
+         * \brief Recompute the state of time step aStepIndex from checkpoint aSlot.  On
+         *        return, the state is in the second row of the sweep state and the state
+         *        of the previous time step is in the first row.
+        **********************************************************************************/
+        void recompute(
+          const Plato::ScalarVector & aControl,
+                Plato::OrdinalType    aSlot,
+                Plato::OrdinalType    aStepIndex
+        );
+
+        /******************************************************************************//**
+         * \brief Store the state of time step aStepIndex in checkpoint aSlot
+        **********************************************************************************/
+        void storeCheckpoint(
+                Plato::OrdinalType    aSlot,
+                Plato::OrdinalType    aStepIndex,
+          const Plato::ScalarVector & aState,
+          const Plato::ScalarVector & aStateDot
+        );
+
+        /******************************************************************************//**
+         * \brief Call aStepFunction for each time step, from the last to the first
+        **********************************************************************************/
+        void reverseSweep(
+          const Plato::ScalarVector & aControl,
+          const StepFunction        & aStepFunction
+        );
+
+        /******************************************************************************//**
+         * \brief Evaluate criterion gradient wrt control or configuration variables
+         * \param [in] aControl        1D view of control variables
+         * \param [in] aCriterion      criterion to be evaluated
+         * \param [in] aConfigGradient return gradient wrt configuration if true
+        **********************************************************************************/
+        Plato::ScalarVector
+        adjointGradient(
+            const Plato::ScalarVector & aControl,
+                  Criterion             aCriterion,
+                  bool                  aConfigGradient
+        );
     };
 
 } // namespace Parabolic
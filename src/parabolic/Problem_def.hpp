@@ -9,6 +9,7 @@
 #include "AnalyzeOutput.hpp"
 #include "AnalyzeMacros.hpp"
 #include "ApplyConstraints.hpp"
+#include "BinomialCheckpoints.hpp"
 #include "solver/PlatoAbstractSolver.hpp"
 #include "parabolic/ScalarFunctionBaseFactory.hpp"
 #include "geometric/ScalarFunctionBaseFactory.hpp"
@@ -36,10 +37,11 @@ namespace Parabolic
             mNumNewtonSteps(Plato::ParseTools::getSubParam<int>   (aProblemParams, "Newton Iteration", "Maximum Iterations",  1  )),
             mNewtonIncTol  (Plato::ParseTools::getSubParam<double>(aProblemParams, "Newton Iteration", "Increment Tolerance", 0.0)),
             mNewtonResTol  (Plato::ParseTools::getSubParam<double>(aProblemParams, "Newton Iteration", "Residual Tolerance",  0.0)),
+            mNumCheckpoints(Plato::ParseTools::getSubParam<int>   (aProblemParams, "Time Integration", "Checkpoints",         0  )),
             mSaveState     (aProblemParams.sublist("Parabolic").isType<Teuchos::Array<std::string>>("Plottable")),
             mResidual      ("MyResidual", mPDEConstraint.size()),
-            mState         ("State",      mNumSteps, mPDEConstraint.size()),
-            mStateDot      ("StateDot",   mNumSteps, mPDEConstraint.size()),
+            mState         ("State",      this->isCheckpointed() ? 2 : mNumSteps, mPDEConstraint.size()),
+            mStateDot      ("StateDot",   this->isCheckpointed() ? 2 : mNumSteps, mPDEConstraint.size()),
             mJacobianU     (Teuchos::null),
             mJacobianV     (Teuchos::null),
             mPDE           (aProblemParams.get<std::string>("PDE Constraint")),
@@ -85,12 +87,6 @@ namespace Parabolic
                         }
                     }
                 }
-                if( mCriteria.size() )
-                {
-                    auto tLength = mPDEConstraint.size();
-                    mAdjoints_U = Plato::ScalarMultiVector("MyAdjoint U", mNumSteps, tLength);
-                    mAdjoints_V = Plato::ScalarMultiVector("MyAdjoint V", mNumSteps, tLength);
-                }
             }
 
             // parse computed fields
@@ -146,6 +142,20 @@ namespace Parabolic
             Plato::SolverFactory tSolverFactory(aProblemParams.sublist("Linear Solver"), LinearSystemType::SYMMETRIC_INDEFINITE);
             mSolver = tSolverFactory.create(aMesh->NumNodes(), aMachine, ElementType::mNumDofsPerNode);
 
+            // the first checkpoint always holds the initial state
+            //
+            if(this->isCheckpointed())
+            {
+                auto tLength = mPDEConstraint.size();
+                mCheckpointStates    = Plato::ScalarMultiVector("Checkpoint States",    mNumCheckpoints, tLength);
+                mCheckpointStateDots = Plato::ScalarMultiVector("Checkpoint StateDots", mNumCheckpoints, tLength);
+                mSweepState          = Plato::ScalarMultiVector("Sweep State",          2, tLength);
+                mSweepStateDot       = Plato::ScalarMultiVector("Sweep StateDot",       2, tLength);
+                mCheckpointSteps.assign(mNumCheckpoints, -1);
+                Plato::ScalarVector tStateInit    = Kokkos::subview(mState,    /*StepIndex=*/0, Kokkos::ALL());
+                Plato::ScalarVector tStateDotInit = Kokkos::subview(mStateDot, /*StepIndex=*/0, Kokkos::ALL());
+                this->storeCheckpoint(/*slot=*/0, /*step=*/0, tStateInit, tStateDotInit);
+            }
         }
 
         /******************************************************************************//**
@@ -232,83 +242,71 @@ namespace Parabolic
             mDataMap.scalarNodeFields["Topology"] = aControl;
             Plato::ScalarVector tStateInit    = Kokkos::subview(mState,    /*StepIndex=*/0, Kokkos::ALL());
             Plato::ScalarVector tStateDotInit = Kokkos::subview(mStateDot, /*StepIndex=*/0, Kokkos::ALL());
+            if(this->isCheckpointed())
+            {
+                Kokkos::deep_copy(tStateInit,    Kokkos::subview(mCheckpointStates,    /*slot=*/0, Kokkos::ALL()));
+                Kokkos::deep_copy(tStateDotInit, Kokkos::subview(mCheckpointStateDots, /*slot=*/0, Kokkos::ALL()));
+                std::fill(mCheckpointSteps.begin()+1, mCheckpointSteps.end(), -1);
+                for(const auto & tPair : mCriteria) { mCriterionValues[tPair.first] = 0.0; }
+            }
             mResidual  = mPDEConstraint.value(tStateInit, tStateDotInit, aControl, mTimeStep);
-            mDataMap.saveState();
-   
-            for(Plato::OrdinalType tStepIndex = 1; tStepIndex < mNumSteps; tStepIndex++) {
-              Plato::ScalarVector tStatePrev    = Kokkos::subview(mState,    tStepIndex-1, Kokkos::ALL());
-              Plato::ScalarVector tStateDotPrev = Kokkos::subview(mStateDot, tStepIndex-1, Kokkos::ALL());
-              Plato::ScalarVector tState        = Kokkos::subview(mState,    tStepIndex,   Kokkos::ALL());
-              Plato::ScalarVector tStateDot     = Kokkos::subview(mStateDot, tStepIndex,   Kokkos::ALL());
-
-              // inner loop for non-linear models
-              for(Plato::OrdinalType tNewtonIndex = 0; tNewtonIndex < mNumNewtonSteps; tNewtonIndex++)
-              {
-                  // -R_{u}
-                  mResidual  = mPDEConstraint.value(tState, tStateDot, aControl, mTimeStep);
-                  Plato::blas1::scale(-1.0, mResidual);
-
-                  // R_{v}
-                  mResidualV = mTrapezoidIntegrator.v_value(tState,    tStatePrev,
-                                                            tStateDot, tStateDotPrev, mTimeStep);
-
-                  // R_{u,v^N}
-                  mJacobianV = mPDEConstraint.gradient_v(tState, tStateDot, aControl, mTimeStep);
-
-                  // -R_{u} += R_{u,v^N} R_{v}
-                  Plato::MatrixTimesVectorPlusVector(mJacobianV, mResidualV, mResidual);
-
-                  // R_{u,u^N}
-                  mJacobianU = mPDEConstraint.gradient_u(tState, tStateDot, aControl, mTimeStep);
-
-                  // R_{v,u^N}
-                  auto tR_vu = mTrapezoidIntegrator.v_grad_u(mTimeStep);
+            mDataMap.saveState(/*StepIndex=*/0, /*Time=*/0.0);
 
-                  // R_{u,u^N} += R_{u,v^N} R_{v,u^N}
-                  Plato::blas1::axpy(-tR_vu, mJacobianV->entries(), mJacobianU->entries());
-
-                  if (mNumNewtonSteps > 1) {
-                      auto tResidualNorm = Plato::blas1::norm(mResidual);
-                      std::cout << " Residual norm: " << tResidualNorm << std::endl;
-                      if (tResidualNorm < mNewtonResTol) {
-                          std::cout << " Residual norm tolerance satisfied." << std::endl;
-                          break;
-                      }
-                  }
-
-                  Plato::OrdinalType tScale = (tNewtonIndex == 0) ? 1.0 : 0.0;
-                  this->applyStateConstraints(mJacobianU, mResidual, tScale);
-
-                  Plato::ScalarVector tDeltaD("increment", tState.extent(0));
-                  Plato::blas1::fill(static_cast<Plato::Scalar>(0.0), tDeltaD);
-
-                  // compute displacement increment:
-                  mSolver->solve(*mJacobianU, tDeltaD, mResidual);
-
-                  // compute and add statedot increment: \Delta v = - ( R_{v} + R_{v,u} \Delta u )
-                  Plato::blas1::axpy(tR_vu, tDeltaD, mResidualV);
-
-                  // a_{k+1} = a_{k} + \Delta a
-                  Plato::blas1::axpy(-1.0, mResidualV, tStateDot);
-
-                  // add displacement increment
-                  Plato::blas1::axpy(1.0, tDeltaD, tState);
+            // checkpoints taken by the forward sweep are the first ones used by the reverse sweep
+            std::vector<Plato::OrdinalType> tCheckpointChain;
+            if(this->isCheckpointed())
+            {
+                tCheckpointChain = Plato::binomial_checkpoint_chain(mNumSteps, mNumCheckpoints);
+            }
+            std::size_t tNextCheckpoint = 0;
 
-                  if (mNumNewtonSteps > 1) {
-                      auto tIncrementNorm = Plato::blas1::norm(tDeltaD);
-                      std::cout << " Delta norm: " << tIncrementNorm << std::endl;
-                      if (tIncrementNorm < mNewtonIncTol) {
-                          std::cout << " Solution increment norm tolerance satisfied." << std::endl;
-                          break;
-                      }
-                  }
+            for(Plato::OrdinalType tStepIndex = 1; tStepIndex < mNumSteps; tStepIndex++) {
+              // with checkpointing, only the previous (row 0) and current (row 1) states are stored
+              auto tPrevRow = this->isCheckpointed() ? 0 : tStepIndex-1;
+              auto tRow     = this->isCheckpointed() ? 1 : tStepIndex;
+              Plato::ScalarVector tStatePrev    = Kokkos::subview(mState,    tPrevRow, Kokkos::ALL());
+              Plato::ScalarVector tStateDotPrev = Kokkos::subview(mStateDot, tPrevRow, Kokkos::ALL());
+              Plato::ScalarVector tState        = Kokkos::subview(mState,    tRow,     Kokkos::ALL());
+              Plato::ScalarVector tStateDot     = Kokkos::subview(mStateDot, tRow,     Kokkos::ALL());
+
+              if(this->isCheckpointed())
+              {
+                // start from zero so that recomputed steps reproduce this sweep
+                Kokkos::deep_copy(tState,    0.0);
+                Kokkos::deep_copy(tStateDot, 0.0);
               }
 
+              this->advance(aControl, tStatePrev, tStateDotPrev, tState, tStateDot);
+
               if ( mSaveState )
               {
                 // evaluate at new state
                 mResidual  = mPDEConstraint.value(tState, tStateDot, aControl, mTimeStep);
-                mDataMap.saveState();
+                mDataMap.saveState(tStepIndex, tStepIndex*mTimeStep);
+              }
+
+              if(this->isCheckpointed())
+              {
+                // criteria are sums over the time steps
+                Plato::Solutions tSolution(mPhysics);
+                tSolution.set("State", mState);
+                tSolution.set("StateDot", mStateDot);
+                for(const auto & tPair : mCriteria)
+                {
+                    mCriterionValues[tPair.first] += tPair.second->value(tSolution, aControl, mTimeStep);
+                }
+
+                if(tNextCheckpoint < tCheckpointChain.size() && tCheckpointChain[tNextCheckpoint] == tStepIndex)
+                {
+                    tNextCheckpoint++;
+                    this->storeCheckpoint(tNextCheckpoint, tStepIndex, tState, tStateDot);
+                }
+
+                if(tStepIndex < mNumSteps-1)
+                {
+                    Kokkos::deep_copy(tStatePrev,    tState);
+                    Kokkos::deep_copy(tStateDotPrev, tStateDot);
+                }
               }
             }
 
@@ -332,6 +330,10 @@ namespace Parabolic
         {
             if( mCriteria.count(aName) )
             {
+                if(this->isCheckpointed())
+                {
+                    return mCriterionValues.at(aName);
+                }
                 auto tSolution = this->getSolution();
                 Criterion tCriterion = mCriteria[aName];
                 return tCriterion->value(tSolution, aControl);
@@ -367,6 +369,11 @@ namespace Parabolic
         {
             if( mCriteria.count(aName) )
             {
+                // the state history isn't stored, criteria values are accumulated by the forward sweep
+                if(this->isCheckpointed())
+                {
+                    return mCriterionValues.at(aName);
+                }
                 Criterion tCriterion = mCriteria[aName];
                 return tCriterion->value(aSolution, aControl, mTimeStep);
             }
@@ -468,81 +475,7 @@ namespace Parabolic
                 ANALYZE_THROWERR("OBJECTIVE REQUESTED BUT NOT DEFINED BY USER.");
             }
 
-            Plato::Solutions tSolution(mPhysics);
-            tSolution.set("State", mState);
-            tSolution.set("StateDot", mStateDot);
-
-            // F_{,z}
-            auto t_dFdz = aCriterion->gradient_z(tSolution, aControl, mTimeStep);
-
-            auto tLastStepIndex = mNumSteps - 1;
-            for(Plato::OrdinalType tStepIndex = tLastStepIndex; tStepIndex > 0; tStepIndex--) {
-
-                auto tU = Kokkos::subview(mState, tStepIndex, Kokkos::ALL());
-                auto tV = Kokkos::subview(mStateDot, tStepIndex, Kokkos::ALL());
-
-                Plato::ScalarVector tAdjoint_U = Kokkos::subview(mAdjoints_U, tStepIndex, Kokkos::ALL());
-                Plato::ScalarVector tAdjoint_V = Kokkos::subview(mAdjoints_V, tStepIndex, Kokkos::ALL());
-
-                // F_{,u^k}
-                auto t_dFdu = aCriterion->gradient_u(tSolution, aControl, tStepIndex, mTimeStep);
-                // F_{,v^k}
-                auto t_dFdv = aCriterion->gradient_v(tSolution, aControl, tStepIndex, mTimeStep);
-
-                if(tStepIndex != tLastStepIndex) { // the last step doesn't have a contribution from k+1
-
-                    // L_{v}^{k+1}
-                    Plato::ScalarVector tAdjoint_V_next = Kokkos::subview(mAdjoints_V, tStepIndex+1, Kokkos::ALL());
-
-                    // R_{v,u^k}^{k+1}
-                    auto tR_vu_prev = mTrapezoidIntegrator.v_grad_u_prev(mTimeStep);
-
-                    // F_{,u^k} += L_{v}^{k+1} R_{v,u^k}^{k+1}
-                    Plato::blas1::axpy(tR_vu_prev, tAdjoint_V_next, t_dFdu);
-
-
-                    // R_{v,v^k}^{k+1}
-                    auto tR_vv_prev = mTrapezoidIntegrator.v_grad_v_prev(mTimeStep);
-
-                    // F_{,v^k} += L_{v}^{k+1} R_{v,v^k}^{k+1}
-                    Plato::blas1::axpy(tR_vv_prev, tAdjoint_V_next, t_dFdv);
-
-                }
-                Plato::blas1::scale(static_cast<Plato::Scalar>(-1), t_dFdu);
-
-                // R_{v,u^k}
-                auto tR_vu = mTrapezoidIntegrator.v_grad_u(mTimeStep);
-
-                // -F_{,u^k} += R_{v,u^k}^k F_{,v^k}
-                Plato::blas1::axpy(tR_vu, t_dFdv, t_dFdu);
-
-                // R_{u,u^k}
-                mJacobianU = mPDEConstraint.gradient_u_T(tU, tV, aControl, mTimeStep);
-
-                // R_{u,v^k}
-                mJacobianV = mPDEConstraint.gradient_v_T(tU, tV, aControl, mTimeStep);
-
-                // R_{u,u^k} -= R_{v,u^k} R_{u,v^k}
-                Plato::blas1::axpy(-tR_vu, mJacobianV->entries(), mJacobianU->entries());
-
-                this->applyStateConstraints(mJacobianU, t_dFdu, /*scale_constraints_by*/0.0);
-
-                // L_u^k
-                mSolver->solve(*mJacobianU, tAdjoint_U, t_dFdu);
-
-                // L_v^k
-                Plato::MatrixTimesVectorPlusVector(mJacobianV, tAdjoint_U, t_dFdv);
-                Plato::blas1::fill(0.0, tAdjoint_V);
-                Plato::blas1::axpy(-1.0, t_dFdv, tAdjoint_V);
-
-                // R^k_{,z}
-                auto t_dRdz = mPDEConstraint.gradient_z(tU, tV, aControl, mTimeStep);
-
-                // F_{,z} += L_u^k R^k_{,z}
-                Plato::MatrixTimesVectorPlusVector(t_dRdz, tAdjoint_U, t_dFdz);
-            }
-
-            return t_dFdz;
+            return this->adjointGradient(aControl, aCriterion, /*aConfigGradient=*/false);
         }
 
 
@@ -632,32 +565,257 @@ namespace Parabolic
                 ANALYZE_THROWERR("OBJECTIVE REQUESTED BUT NOT DEFINED BY USER.");
             }
 
+            return this->adjointGradient(aControl, aCriterion, /*aConfigGradient=*/true);
+        }
+
+        /******************************************************************************//**
+         * \brief Return solution database.
+         * \return solution database
+        **********************************************************************************/
+        template<typename PhysicsType>
+        Plato::Solutions
+        Problem<PhysicsType>::
+        getSolution() const
+        {
+            Plato::Solutions tSolution(mPhysics, mPDE);
+            tSolution.set("State",    mState,    mPDEConstraint.getDofNames());
+            tSolution.set("StateDot", mStateDot, mPDEConstraint.getDofDotNames());
+            return tSolution;
+        }
+
+        /******************************************************************************//**
+         * \brief Return true if only checkpoints of the state history are stored
+        **********************************************************************************/
+        template<typename PhysicsType>
+        bool
+        Problem<PhysicsType>::
+        isCheckpointed() const
+        {
+            return mNumCheckpoints > 0 && mNumCheckpoints < mNumSteps;
+        }
+
+        /******************************************************************************//**
+         * \brief Solve for the state of the next time step
+        **********************************************************************************/
+        template<typename PhysicsType>
+        void
+        Problem<PhysicsType>::
+        advance(
+          const Plato::ScalarVector & aControl,
+          const Plato::ScalarVector & aStatePrev,
+          const Plato::ScalarVector & aStateDotPrev,
+          const Plato::ScalarVector & aState,
+          const Plato::ScalarVector & aStateDot
+        )
+        {
+            // inner loop for non-linear models
+            for(Plato::OrdinalType tNewtonIndex = 0; tNewtonIndex < mNumNewtonSteps; tNewtonIndex++)
+            {
+                // -R_{u}
+                mResidual  = mPDEConstraint.value(aState, aStateDot, aControl, mTimeStep);
+                Plato::blas1::scale(-1.0, mResidual);
+
+                // R_{v}
+                mResidualV = mTrapezoidIntegrator.v_value(aState,    aStatePrev,
+                                                          aStateDot, aStateDotPrev, mTimeStep);
+
+                // R_{u,v^N}
+                mJacobianV = mPDEConstraint.gradient_v(aState, aStateDot, aControl, mTimeStep);
+
+                // -R_{u} += R_{u,v^N} R_{v}
+                Plato::MatrixTimesVectorPlusVector(mJacobianV, mResidualV, mResidual);
+
+                // R_{u,u^N}
+                mJacobianU = mPDEConstraint.gradient_u(aState, aStateDot, aControl, mTimeStep);
+
+                // R_{v,u^N}
+                auto tR_vu = mTrapezoidIntegrator.v_grad_u(mTimeStep);
+
+                // R_{u,u^N} += R_{u,v^N} R_{v,u^N}
+                Plato::blas1::axpy(-tR_vu, mJacobianV->entries(), mJacobianU->entries());
+
+                if (mNumNewtonSteps > 1) {
+                    auto tResidualNorm = Plato::blas1::norm(mResidual);
+                    std::cout << " Residual norm: " << tResidualNorm << std::endl;
+                    if (tResidualNorm < mNewtonResTol) {
+                        std::cout << " Residual norm tolerance satisfied." << std::endl;
+                        break;
+                    }
+                }
+
+                Plato::OrdinalType tScale = (tNewtonIndex == 0) ? 1.0 : 0.0;
+                this->applyStateConstraints(mJacobianU, mResidual, tScale);
+
+                Plato::ScalarVector tDeltaD("increment", aState.extent(0));
+                Plato::blas1::fill(static_cast<Plato::Scalar>(0.0), tDeltaD);
+
+                // compute displacement increment:
+                mSolver->solve(*mJacobianU, tDeltaD, mResidual);
+
+                // compute and add statedot increment: \Delta v = - ( R_{v} + R_{v,u} \Delta u )
+                Plato::blas1::axpy(tR_vu, tDeltaD, mResidualV);
+
+                // a_{k+1} = a_{k} + \Delta a
+                Plato::blas1::axpy(-1.0, mResidualV, aStateDot);
+
+                // add displacement increment
+                Plato::blas1::axpy(1.0, tDeltaD, aState);
+
+                if (mNumNewtonSteps > 1) {
+                    auto tIncrementNorm = Plato::blas1::norm(tDeltaD);
+                    std::cout << " Delta norm: " << tIncrementNorm << std::endl;
+                    if (tIncrementNorm < mNewtonIncTol) {
+                        std::cout << " Solution increment norm tolerance satisfied." << std::endl;
+                        break;
+                    }
+                }
+            }
+        }
+
+        /******************************************************************************//**
+         * \brief Recompute the state of time step aStepIndex from checkpoint aSlot
+        **********************************************************************************/
+        template<typename PhysicsType>
+        void
+        Problem<PhysicsType>::
+        recompute(
+          const Plato::ScalarVector & aControl,
+                Plato::OrdinalType    aSlot,
+                Plato::OrdinalType    aStepIndex
+        )
+        {
+            Plato::ScalarVector tStatePrev    = Kokkos::subview(mSweepState,    0, Kokkos::ALL());
+            Plato::ScalarVector tStateDotPrev = Kokkos::subview(mSweepStateDot, 0, Kokkos::ALL());
+            Plato::ScalarVector tState        = Kokkos::subview(mSweepState,    1, Kokkos::ALL());
+            Plato::ScalarVector tStateDot     = Kokkos::subview(mSweepStateDot, 1, Kokkos::ALL());
+
+            if(aStepIndex == mCheckpointSteps[aSlot] && aSlot > 0)
+            {
+                // the checkpointed step itself: the previous step isn't stored, so recompute
+                // it from the preceding checkpoint, which stores an earlier step
+                this->recompute(aControl, aSlot-1, aStepIndex-1);
+                Kokkos::deep_copy(tStatePrev,    tState);
+                Kokkos::deep_copy(tStateDotPrev, tStateDot);
+                Kokkos::deep_copy(tState,    Kokkos::subview(mCheckpointStates,    aSlot, Kokkos::ALL()));
+                Kokkos::deep_copy(tStateDot, Kokkos::subview(mCheckpointStateDots, aSlot, Kokkos::ALL()));
+                return;
+            }
+
+            Kokkos::deep_copy(tState,    Kokkos::subview(mCheckpointStates,    aSlot, Kokkos::ALL()));
+            Kokkos::deep_copy(tStateDot, Kokkos::subview(mCheckpointStateDots, aSlot, Kokkos::ALL()));
+            for(Plato::OrdinalType tStepIndex = mCheckpointSteps[aSlot]+1; tStepIndex <= aStepIndex; tStepIndex++)
+            {
+                // same initial guess as the forward sweep
+                Kokkos::deep_copy(tStatePrev,    tState);
+                Kokkos::deep_copy(tStateDotPrev, tStateDot);
+                Kokkos::deep_copy(tState,    0.0);
+                Kokkos::deep_copy(tStateDot, 0.0);
+                this->advance(aControl, tStatePrev, tStateDotPrev, tState, tStateDot);
+            }
+        }
+
+        /******************************************************************************//**
+         * \brief Store the state of time step aStepIndex in checkpoint aSlot
+        **********************************************************************************/
+        template<typename PhysicsType>
+        void
+        Problem<PhysicsType>::
+        storeCheckpoint(
+                Plato::OrdinalType    aSlot,
+                Plato::OrdinalType    aStepIndex,
+          const Plato::ScalarVector & aState,
+          const Plato::ScalarVector & aStateDot
+        )
+        {
+            Kokkos::deep_copy(Kokkos::subview(mCheckpointStates,    aSlot, Kokkos::ALL()), aState);
+            Kokkos::deep_copy(Kokkos::subview(mCheckpointStateDots, aSlot, Kokkos::ALL()), aStateDot);
+            mCheckpointSteps[aSlot] = aStepIndex;
+        }
+
+        /******************************************************************************//**
+         * \brief Call aStepFunction for each time step, from the last to the first
+        **********************************************************************************/
+        template<typename PhysicsType>
+        void
+        Problem<PhysicsType>::
+        reverseSweep(
+          const Plato::ScalarVector & aControl,
+          const StepFunction        & aStepFunction
+        )
+        {
+            if(this->isCheckpointed())
+            {
+                Plato::Solutions tSolution(mPhysics);
+                tSolution.set("State", mSweepState);
+                tSolution.set("StateDot", mSweepStateDot);
+                Plato::binomial_reverse_segment(/*begin=*/0, /*end=*/mNumSteps, /*slot=*/0, mCheckpointSteps,
+                  [&](Plato::OrdinalType aSlot, Plato::OrdinalType aStepIndex)
+                {
+                    this->recompute(aControl, aSlot, aStepIndex);
+                    Plato::ScalarVector tState    = Kokkos::subview(mSweepState,    1, Kokkos::ALL());
+                    Plato::ScalarVector tStateDot = Kokkos::subview(mSweepStateDot, 1, Kokkos::ALL());
+                    this->storeCheckpoint(aSlot+1, aStepIndex, tState, tStateDot);
+                },
+                  [&](Plato::OrdinalType aSlot, Plato::OrdinalType aStepIndex)
+                {
+                    this->recompute(aControl, aSlot, aStepIndex);
+                    aStepFunction(aStepIndex, tSolution, /*row=*/1);
+                });
+                return;
+            }
+
             Plato::Solutions tSolution(mPhysics);
             tSolution.set("State", mState);
             tSolution.set("StateDot", mStateDot);
+            for(Plato::OrdinalType tStepIndex = mNumSteps - 1; tStepIndex > 0; tStepIndex--)
+            {
+                aStepFunction(tStepIndex, tSolution, tStepIndex);
+            }
+        }
 
-            // F_{,x}
-            auto t_dFdx = aCriterion->gradient_x(tSolution, aControl, mTimeStep);
+        /******************************************************************************//**
+         * \brief Evaluate criterion gradient wrt control or configuration variables
+        **********************************************************************************/
+        template<typename PhysicsType>
+        Plato::ScalarVector
+        Problem<PhysicsType>::
+        adjointGradient(
+            const Plato::ScalarVector & aControl,
+                  Criterion             aCriterion,
+                  bool                  aConfigGradient
+        )
+        {
+            auto tLength = mPDEConstraint.size();
+            Plato::ScalarVector tAdjoint_U("adjoint U", tLength);
+            Plato::ScalarVector tAdjoint_V("adjoint V", tLength);
+            Plato::ScalarVector tAdjoint_V_next("adjoint V next", tLength);
+
+            // F_{,z} (or F_{,x}).  With checkpointing, it's summed over the steps of the reverse sweep.
+            Plato::ScalarVector tGradient;
+            if(!this->isCheckpointed())
+            {
+                Plato::Solutions tSolution(mPhysics);
+                tSolution.set("State", mState);
+                tSolution.set("StateDot", mStateDot);
+                tGradient = aConfigGradient ? aCriterion->gradient_x(tSolution, aControl, mTimeStep)
+                                            : aCriterion->gradient_z(tSolution, aControl, mTimeStep);
+            }
 
             auto tLastStepIndex = mNumSteps - 1;
-            for(Plato::OrdinalType tStepIndex = tLastStepIndex; tStepIndex > 0; tStepIndex--) {
-
-                auto tU = Kokkos::subview(mState, tStepIndex, Kokkos::ALL());
-                auto tV = Kokkos::subview(mStateDot, tStepIndex, Kokkos::ALL());
-
-                Plato::ScalarVector tAdjoint_U = Kokkos::subview(mAdjoints_U, tStepIndex, Kokkos::ALL());
-                Plato::ScalarVector tAdjoint_V = Kokkos::subview(mAdjoints_V, tStepIndex, Kokkos::ALL());
+            this->reverseSweep(aControl,
+              [&](Plato::OrdinalType aStepIndex, const Plato::Solutions & aSolution, Plato::OrdinalType aSolutionStep)
+            {
+                auto tStates    = aSolution.get("State");
+                auto tStateDots = aSolution.get("StateDot");
+                Plato::ScalarVector tU = Kokkos::subview(tStates,    aSolutionStep, Kokkos::ALL());
+                Plato::ScalarVector tV = Kokkos::subview(tStateDots, aSolutionStep, Kokkos::ALL());
 
                 // F_{,u^k}
-                auto t_dFdu = aCriterion->gradient_u(tSolution, aControl, tStepIndex, mTimeStep);
+                auto t_dFdu = aCriterion->gradient_u(aSolution, aControl, aSolutionStep, mTimeStep);
                 // F_{,v^k}
-                auto t_dFdv = aCriterion->gradient_v(tSolution, aControl, tStepIndex, mTimeStep);
-
-                if(tStepIndex != tLastStepIndex) { // the last step doesn't have a contribution from k+1
-
-                    // L_{v}^{k+1}
-                    Plato::ScalarVector tAdjoint_V_next = Kokkos::subview(mAdjoints_V, tStepIndex+1, Kokkos::ALL());
+                auto t_dFdv = aCriterion->gradient_v(aSolution, aControl, aSolutionStep, mTimeStep);
 
+                if(aStepIndex != tLastStepIndex) { // the last step doesn't have a contribution from k+1
 
                     // R_{v,u^k}^{k+1}
                     auto tR_vu_prev = mTrapezoidIntegrator.v_grad_u_prev(mTimeStep);
@@ -665,7 +823,6 @@ namespace Parabolic
                     // F_{,u^k} += L_{v}^{k+1} R_{v,u^k}^{k+1}
                     Plato::blas1::axpy(tR_vu_prev, tAdjoint_V_next, t_dFdu);
 
-
                     // R_{v,v^k}^{k+1}
                     auto tR_vv_prev = mTrapezoidIntegrator.v_grad_v_prev(mTimeStep);
 
@@ -681,7 +838,6 @@ namespace Parabolic
                 // -F_{,u^k} += R_{v,u^k}^k F_{,v^k}
                 Plato::blas1::axpy(tR_vu, t_dFdv, t_dFdu);
 
-
                 // R_{u,u^k}
                 mJacobianU = mPDEConstraint.gradient_u_T(tU, tV, aControl, mTimeStep);
 
@@ -701,29 +857,25 @@ namespace Parabolic
                 Plato::blas1::fill(0.0, tAdjoint_V);
                 Plato::blas1::axpy(-1.0, t_dFdv, tAdjoint_V);
 
-                // R^k_{,x}
-                auto t_dRdx = mPDEConstraint.gradient_x(tU, tV, aControl, mTimeStep);
+                if(this->isCheckpointed())
+                {
+                    auto tPartial = aConfigGradient ? aCriterion->gradient_x(aSolution, aControl, mTimeStep)
+                                                    : aCriterion->gradient_z(aSolution, aControl, mTimeStep);
+                    if(tGradient.extent(0) == 0) { tGradient = tPartial; }
+                    else { Plato::blas1::axpy(1.0, tPartial, tGradient); }
+                }
 
-                // F_{,x} += L_u^k R^k_{,x}
-                Plato::MatrixTimesVectorPlusVector(t_dRdx, tAdjoint_U, t_dFdx);
-            }
+                // R^k_{,z} (or R^k_{,x})
+                auto t_dRdz = aConfigGradient ? mPDEConstraint.gradient_x(tU, tV, aControl, mTimeStep)
+                                              : mPDEConstraint.gradient_z(tU, tV, aControl, mTimeStep);
 
-            return t_dFdx;
-        }
+                // F_{,z} += L_u^k R^k_{,z}
+                Plato::MatrixTimesVectorPlusVector(t_dRdz, tAdjoint_U, tGradient);
 
-        /******************************************************************************//**
-         * \brief Return solution database.
-         * \return solution database
-        **********************************************************************************/
-        template<typename PhysicsType>
-        Plato::Solutions
-        Problem<PhysicsType>::
-        getSolution() const
-        {
-            Plato::Solutions tSolution(mPhysics, mPDE);
-            tSolution.set("State",    mState,    mPDEConstraint.getDofNames());
-            tSolution.set("StateDot", mStateDot, mPDEConstraint.getDofDotNames());
-            return tSolution;
+                Kokkos::deep_copy(tAdjoint_V_next, tAdjoint_V);
+            });
+
+            return tGradient;
         }
 } // namespace Parabolic
 
@@ -3,6 +3,9 @@
 #include <memory>
 
 #include "SpatialModel.hpp"
+#include "ParseTools.hpp"
+#include "BlockMatrixCache.hpp"
+#include "ElementColoring.hpp"
 #include "base/WorksetBase.hpp"
 #include "parabolic/EvaluationTypes.hpp"
 #include "parabolic/AbstractVectorFunction.hpp"
@@ -70,6 +73,8 @@ class VectorFunction : public Plato::WorksetBase<typename PhysicsType::ElementTy
 
     const Plato::SpatialModel & mSpatialModel;
 
+    mutable Plato::BlockMatrixCache mMatrixCache; /*!< persistent sparsity graph and recycled matrices */
+
     Plato::DataMap& mDataMap;
 
   public:
@@ -91,8 +96,14 @@ class VectorFunction : public Plato::WorksetBase<typename PhysicsType::ElementTy
     ) :
         Plato::WorksetBase<ElementType>(aSpatialModel.Mesh),
         mSpatialModel (aSpatialModel),
+        mMatrixCache  (aSpatialModel.Mesh),
         mDataMap      (aDataMap)
     {
+        if(Plato::ParseTools::getSubParam<bool>(aParamList, "Assembly", "Colored Assembly", false))
+        {
+            this->setElementColoring(std::make_shared<Plato::ElementColoring>(aSpatialModel.Mesh));
+        }
+
         typename PhysicsType::FunctionFactory tFunctionFactory;
 
         for(const auto& tDomain : mSpatialModel.Domains)
@@ -129,6 +140,7 @@ class VectorFunction : public Plato::WorksetBase<typename PhysicsType::ElementTy
     ******************************************************************************/
     VectorFunction(Plato::Mesh aMesh, Plato::DataMap& aDataMap) :
             Plato::WorksetBase<ElementType>(aMesh),
+            mMatrixCache(aMesh),
             mDataMap(aDataMap)
     {
     }
@@ -288,7 +300,7 @@ class VectorFunction : public Plato::WorksetBase<typename PhysicsType::ElementTy
         //
         auto tMesh = mSpatialModel.Mesh;
         Teuchos::RCP<Plato::CrsMatrixType> tGradientMat =
-                Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumSpatialDims, mNumDofsPerNode>(tMesh);
+                mMatrixCache.matrix<mNumSpatialDims, mNumDofsPerNode>();
 
         for(const auto& tDomain : mSpatialModel.Domains)
         {
@@ -392,7 +404,7 @@ class VectorFunction : public Plato::WorksetBase<typename PhysicsType::ElementTy
         //
         auto tMesh = mSpatialModel.Mesh;
         Teuchos::RCP<Plato::CrsMatrixType> tGradientMat =
-             Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumDofsPerNode, mNumDofsPerNode>( tMesh );
+             mMatrixCache.matrix<mNumDofsPerNode, mNumDofsPerNode>();
 
         for(const auto& tDomain : mSpatialModel.Domains)
         {
@@ -497,7 +509,7 @@ class VectorFunction : public Plato::WorksetBase<typename PhysicsType::ElementTy
         //
         auto tMesh = mSpatialModel.Mesh;
         Teuchos::RCP<Plato::CrsMatrixType> tGradientMat =
-             Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumDofsPerNode, mNumDofsPerNode>( tMesh );
+             mMatrixCache.matrix<mNumDofsPerNode, mNumDofsPerNode>();
 
         for(const auto& tDomain : mSpatialModel.Domains)
         {
@@ -602,7 +614,7 @@ class VectorFunction : public Plato::WorksetBase<typename PhysicsType::ElementTy
         //
         auto tMesh = mSpatialModel.Mesh;
         Teuchos::RCP<Plato::CrsMatrixType> tGradientMat =
-            Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumDofsPerNode, mNumDofsPerNode>( tMesh );
+            mMatrixCache.matrix<mNumDofsPerNode, mNumDofsPerNode>();
 
         for(const auto& tDomain : mSpatialModel.Domains)
         {
@@ -707,7 +719,7 @@ class VectorFunction : public Plato::WorksetBase<typename PhysicsType::ElementTy
         //
         auto tMesh = mSpatialModel.Mesh;
         Teuchos::RCP<Plato::CrsMatrixType> tGradientMat =
-            Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumDofsPerNode, mNumDofsPerNode>( tMesh );
+            mMatrixCache.matrix<mNumDofsPerNode, mNumDofsPerNode>();
 
         for(const auto& tDomain : mSpatialModel.Domains)
         {
@@ -812,7 +824,7 @@ class VectorFunction : public Plato::WorksetBase<typename PhysicsType::ElementTy
         //
         auto tMesh = mSpatialModel.Mesh;
         Teuchos::RCP<Plato::CrsMatrixType> tGradientMat =
-            Plato::CreateBlockMatrix<Plato::CrsMatrixType, mNumControl, mNumDofsPerNode>( tMesh );
+            mMatrixCache.matrix<mNumControl, mNumDofsPerNode>();
 
         for(const auto& tDomain : mSpatialModel.Domains)
         {
@@ -7,13 +7,13 @@
 
 namespace Plato {
 
-AbstractSolver::AbstractSolver() : mSystemMPCs(nullptr), mAlpha(0.0) {}
-AbstractSolver::AbstractSolver(const Teuchos::ParameterList & aSolverParams) : mSystemMPCs(nullptr) {parse(aSolverParams);}
+AbstractSolver::AbstractSolver() : mSystemMPCs(nullptr), mAlpha(0.0), mReuseOperator(false) {}
+AbstractSolver::AbstractSolver(const Teuchos::ParameterList & aSolverParams) : mSystemMPCs(nullptr), mReuseOperator(false) {parse(aSolverParams);}
 
 AbstractSolver::AbstractSolver(
   const Teuchos::ParameterList & aSolverParams,
   std::shared_ptr<Plato::MultipointConstraints> aMPCs
-) : mSystemMPCs(aMPCs) {parse(aSolverParams);}
+) : mSystemMPCs(aMPCs), mReuseOperator(false) {parse(aSolverParams);}
 
 void AbstractSolver::parse(const Teuchos::ParameterList & aSolverParams)
 {
@@ -74,9 +74,11 @@ void AbstractSolver::solve(Plato::CrsMatrix<int> aAf, Plato::ScalarVector aX,
         new Plato::CrsMatrixType(tNumCondensedDofs, tNumCondensedDofs,
                                  tNumDofsPerNode, tNumDofsPerNode));
 
-    Plato::MatrixMatrixMultiply(aA, tTransformMatrix, tCondensedALeft);
-    Plato::MatrixMatrixMultiply(tTransformMatrixTranspose, tCondensedALeft,
-                                tCondensedA);
+    // the transform matrix and the graph of A are fixed, so after the first
+    // solve only the numeric phase of the products is recomputed.
+    mCondensedLeftProduct.multiply(aA, tTransformMatrix, tCondensedALeft);
+    mCondensedProduct.multiply(tTransformMatrixTranspose, tCondensedALeft,
+                               tCondensedA);
 
     // build condensed vector
     Plato::ScalarVector tInnerB = aB;
@@ -106,10 +108,51 @@ void AbstractSolver::solve(Plato::CrsMatrix<int> aAf, Plato::ScalarVector aX,
   } else {
     this->innerSolve(aAf, aX, aB);
   }
+  mReuseOperator = false;
 
   if (mAlpha) {
     shiftDiagonal(aAf, -tOffset);
   }
 }
 
+void AbstractSolver::solve(Plato::CrsMatrix<int> aAf, Plato::ScalarMultiVector aX,
+                           Plato::ScalarMultiVector aB, bool aAdjointFlag) {
+
+  const Plato::OrdinalType tNumVectors = aB.extent(0);
+  if (mSystemMPCs || tNumVectors == 1) {
+    // MPC condensation is applied one right hand side at a time
+    for (Plato::OrdinalType tIndex = 0; tIndex < tNumVectors; tIndex++) {
+      Plato::ScalarVector tX = Kokkos::subview(aX, tIndex, Kokkos::ALL());
+      Plato::ScalarVector tB = Kokkos::subview(aB, tIndex, Kokkos::ALL());
+      if (tIndex > 0) { mReuseOperator = true; }
+      this->solve(aAf, tX, tB, aAdjointFlag);
+    }
+    return;
+  }
+
+  Plato::Scalar tOffset;
+  if (mAlpha != 0.0) {
+    tOffset = mAlpha*diagonalAveAbs(aAf);
+    shiftDiagonal(aAf, tOffset);
+  }
+
+  this->innerSolve(aAf, aX, aB);
+  mReuseOperator = false;
+
+  if (mAlpha) {
+    shiftDiagonal(aAf, -tOffset);
+  }
+}
+
+void AbstractSolver::innerSolve(Plato::CrsMatrix<Plato::OrdinalType> aA,
+                                Plato::ScalarMultiVector aX,
+                                Plato::ScalarMultiVector aB) {
+  for (Plato::OrdinalType tIndex = 0; tIndex < static_cast<Plato::OrdinalType>(aB.extent(0)); tIndex++) {
+    Plato::ScalarVector tX = Kokkos::subview(aX, tIndex, Kokkos::ALL());
+    Plato::ScalarVector tB = Kokkos::subview(aB, tIndex, Kokkos::ALL());
+    if (tIndex > 0) { mReuseOperator = true; }
+    this->innerSolve(aA, tX, tB);
+  }
+}
+
 } // namespace Plato
@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "MultipointConstraints.hpp"
+#include "PlatoMathHelpers.hpp"
 
 namespace Plato {
 
@@ -29,6 +30,13 @@ class AbstractSolver
 
     Plato::Scalar mAlpha;
 
+    /// @brief true if the next solve uses the operator of the previous solve
+    bool mReuseOperator;
+
+    /// @brief persistent spgemm symbolic phases for MPC condensation, A.T and T^T.(A.T)
+    Plato::MatrixMatrixMultiplyCache mCondensedLeftProduct;
+    Plato::MatrixMatrixMultiplyCache mCondensedProduct;
+
     AbstractSolver();
     AbstractSolver(const Teuchos::ParameterList & aSolverParams);
 
@@ -40,6 +48,17 @@ class AbstractSolver
         Plato::ScalarVector   aB
     ) = 0;
 
+    /******************************************************************************//**
+     * \brief Solve for multiple right hand sides, one per row of aB.  The default
+     *        solves one right hand side at a time; solvers that can solve several
+     *        right hand sides at once override this.
+    **********************************************************************************/
+    virtual void innerSolve(
+        Plato::CrsMatrix<Plato::OrdinalType> aA,
+        Plato::ScalarMultiVector aX,
+        Plato::ScalarMultiVector aB
+    );
+
     virtual ~AbstractSolver() = default;
 
   public:
@@ -50,5 +69,22 @@ class AbstractSolver
         Plato::ScalarVector   aX,
         Plato::ScalarVector   aB,
         bool                  aAdjointFlag = false);
+
+    /******************************************************************************//**
+     * \brief Solve aAf aX = aB for multiple right hand sides, one per row of aB.
+    **********************************************************************************/
+    void solve(
+        Plato::CrsMatrix<int>    aAf,
+        Plato::ScalarMultiVector aX,
+        Plato::ScalarMultiVector aB,
+        bool                     aAdjointFlag = false);
+
+    /******************************************************************************//**
+     * \brief Declare that the operator passed to the next solve is unchanged since the
+     *        previous solve, e.g., the adjoint solve of a self-adjoint problem.  Solvers
+     *        that can, skip the factorization or preconditioner setup and reuse the
+     *        previous one.  The declaration applies to the next solve only.
+    **********************************************************************************/
+    void reuseOperator() { mReuseOperator = true; }
 };
 } // end namespace Plato
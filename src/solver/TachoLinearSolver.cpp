@@ -268,12 +268,85 @@ TachoLinearSolver::TachoLinearSolver(const Teuchos::ParameterList &aSolverParams
                                      Plato::AbstractSolver(aSolverParams, aMPCs),
                                      mSolver(constructSolverFromParameterList(aSolverParams, aType))
 {
+    if (aSolverParams.isType<bool>("Check Solution")) {
+        mCheckSolution = aSolverParams.get<bool>("Check Solution");
+    }
 }
 
-void TachoLinearSolver::innerSolve(Plato::CrsMatrix<int> aA,
-                                   Plato::ScalarVector aX,
-                                   Plato::ScalarVector aB)
+bool TachoLinearSolver::isGraphCurrent(const Plato::CrsMatrix<int> & aA) const
+{
+    return mCurrentMatrixHash.has_value()
+        && mBlockRowMap.data()               == aA.rowMap().data()
+        && mBlockRowMap.extent(0)            == aA.rowMap().extent(0)
+        && mBlockColumnIndices.data()        == aA.columnIndices().data()
+        && mBlockColumnIndices.extent(0)     == aA.columnIndices().extent(0)
+        && mNumRowsPerBlock                  == aA.numRowsPerBlock()
+        && mNumColsPerBlock                  == aA.numColsPerBlock();
+}
+
+void TachoLinearSolver::setGraph(const Plato::CrsMatrix<int> & aA, RowMapVectorT aRowBegin, ScalarVectorT aValues)
+{
+    // hold the block graph views so that their addresses can't be reused while cached
+    mBlockRowMap = aA.rowMap();
+    mBlockColumnIndices = aA.columnIndices();
+    mNumRowsPerBlock = aA.numRowsPerBlock();
+    mNumColsPerBlock = aA.numColsPerBlock();
+
+    if (!aA.isBlockMatrix())
+    {
+        mValueIndices = OrdinalVectorT();
+        mValues = ScalarVectorT();
+        return;
+    }
+
+    // entries index of each non-block value (see Plato::getDataAsNonBlock)
+    auto tBlockRowMap = mBlockRowMap;
+    auto tNonBlockRowMap = aRowBegin;
+    auto tNumRowsPerBlock = mNumRowsPerBlock;
+    auto tNumColsPerBlock = mNumColsPerBlock;
+    auto tBlockSize = tNumRowsPerBlock*tNumColsPerBlock;
+    OrdinalVectorT tValueIndices(Kokkos::ViewAllocateWithoutInitializing("non block value indices"), aValues.extent(0));
+    Kokkos::parallel_for(Kokkos::RangePolicy<>(0,aA.numRows()), KOKKOS_LAMBDA(const int & tMatrixRowIndex) {
+        auto tBlockRowIndex = tMatrixRowIndex / tNumRowsPerBlock;
+        auto tLocalRowIndex = tMatrixRowIndex % tNumRowsPerBlock;
+        auto tFrom = tBlockRowMap(tBlockRowIndex);
+        auto tTo   = tBlockRowMap(tBlockRowIndex+1);
+        auto tMatrixRowFrom = tNonBlockRowMap(tMatrixRowIndex);
+        for( auto tColMapIndex=tFrom; tColMapIndex<tTo; ++tColMapIndex )
+        {
+            for( int tBlockColOffset=0; tBlockColOffset<tNumColsPerBlock; ++tBlockColOffset )
+            {
+                tValueIndices(tMatrixRowFrom++) = tColMapIndex*tBlockSize+tLocalRowIndex*tNumColsPerBlock+tBlockColOffset;
+            }
+        }
+    });
+    mValueIndices = tValueIndices;
+    mValues = aValues;
+}
+
+TachoLinearSolver::ScalarVectorT TachoLinearSolver::nonBlockValues(const Plato::CrsMatrix<int> & aA) const
+{
+    if (mValueIndices.extent(0) == 0) {
+        return aA.entries();
+    }
+
+    auto tEntries = aA.entries();
+    auto tValues = mValues;
+    auto tValueIndices = mValueIndices;
+    Kokkos::parallel_for(Kokkos::RangePolicy<>(0,tValueIndices.extent(0)), KOKKOS_LAMBDA(const int & aIndex) {
+        tValues(aIndex) = tEntries(tValueIndices(aIndex));
+    });
+    return tValues;
+}
+
+void TachoLinearSolver::factorize(Plato::CrsMatrix<int> aA)
 {
+    // unchanged graph: the symbolic factorization holds, only the values are refactored
+    if (this->isGraphCurrent(aA)) {
+        mSolver.refactorMatrix(this->nonBlockValues(aA));
+        return;
+    }
+
     using CrsOrdinal = int;
     Plato::CrsMatrix<CrsOrdinal>::RowMapVectorT tRowBegin;
     Plato::CrsMatrix<CrsOrdinal>::OrdinalVectorT tColumns;
@@ -300,11 +373,41 @@ void TachoLinearSolver::innerSolve(Plato::CrsMatrix<int> aA,
     } else {
         mSolver.refactorMatrix(tValues);
     }
+    this->setGraph(aA, tRowBegin, tValues);
+}
+
+void TachoLinearSolver::innerSolve(Plato::CrsMatrix<int> aA,
+                                   Plato::ScalarVector aX,
+                                   Plato::ScalarVector aB)
+{
+    // an unchanged operator keeps its factorization
+    if (!mReuseOperator || !mCurrentMatrixHash.has_value()) {
+        this->factorize(aA);
+    }
 
     tachoSolver<double>::value_type_matrix x(aX.data(), aA.numRows(), 1);
     tachoSolver<double>::value_type_matrix b(aB.data(), aA.numRows(), 1);
     mSolver.MySolve(1, b, x);
-    if (Plato::has_nan<CrsOrdinal>(aX)) {
+    if (mCheckSolution && Plato::has_nan<int>(aX)) {
+        throw std::runtime_error("Tacho solution vector contains nan.");
+    }
+}
+
+void TachoLinearSolver::innerSolve(Plato::CrsMatrix<int> aA,
+                                   Plato::ScalarMultiVector aX,
+                                   Plato::ScalarMultiVector aB)
+{
+    // an unchanged operator keeps its factorization
+    if (!mReuseOperator || !mCurrentMatrixHash.has_value()) {
+        this->factorize(aA);
+    }
+
+    // a row-major (NRHS x N) multivector has the memory layout of a column-major (N x NRHS) matrix
+    const int tNumRHS = aB.extent(0);
+    tachoSolver<double>::value_type_matrix x(aX.data(), aA.numRows(), tNumRHS);
+    tachoSolver<double>::value_type_matrix b(aB.data(), aA.numRows(), tNumRHS);
+    mSolver.MySolve(tNumRHS, b, x);
+    if (mCheckSolution && Plato::has_nan<int>(Plato::ScalarVector(aX.data(), aX.size()))) {
         throw std::runtime_error("Tacho solution vector contains nan.");
     }
 }
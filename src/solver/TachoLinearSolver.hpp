@@ -108,9 +108,38 @@ public:
         Plato::ScalarVector   aX,
         Plato::ScalarVector   aB
     ) override;
+
+    void innerSolve(
+        Plato::CrsMatrix<int>    aA,
+        Plato::ScalarMultiVector aX,
+        Plato::ScalarMultiVector aB
+    ) override;
 private:
+    using RowMapVectorT  = Plato::CrsMatrix<int>::RowMapVectorT;
+    using OrdinalVectorT = Plato::CrsMatrix<int>::OrdinalVectorT;
+    using ScalarVectorT  = Plato::CrsMatrix<int>::ScalarVectorT;
+
+    void factorize(Plato::CrsMatrix<int> aA);
+
+    /// @brief true if @a aA has the block graph the current symbolic factorization was built from
+    bool isGraphCurrent(const Plato::CrsMatrix<int> & aA) const;
+
+    /// @brief cache the block graph of @a aA and the entries index of each non-block value
+    void setGraph(const Plato::CrsMatrix<int> & aA, RowMapVectorT aRowBegin, ScalarVectorT aValues);
+
+    /// @brief return the values of @a aA in the non-block layout of the cached graph
+    ScalarVectorT nonBlockValues(const Plato::CrsMatrix<int> & aA) const;
+
     tachoSolver<Plato::Scalar> mSolver;
     boost::optional<std::size_t> mCurrentMatrixHash;
+
+    RowMapVectorT  mBlockRowMap;        /*!< block graph the factorization was built from */
+    OrdinalVectorT mBlockColumnIndices; /*!< block graph the factorization was built from */
+    int mNumRowsPerBlock = 0;
+    int mNumColsPerBlock = 0;
+    OrdinalVectorT mValueIndices;       /*!< entries index of each non-block value (empty if not a block matrix) */
+    ScalarVectorT  mValues;             /*!< non-block values passed to the numeric factorization */
+    bool mCheckSolution = true;         /*!< scan the solution for nan after each solve */
 };
 
 } // namespace tacho
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <BelosTpetraAdapter.hpp>
 #include <BelosSolverFactory.hpp>
 #include <Ifpack2_Factory.hpp>
+#include <Ifpack2_Details_CanChangeMatrix.hpp>
 #include <MueLu.hpp>
 #include <MueLu_CreateTpetraPreconditioner.hpp>
 #include "PlatoUtilities.hpp"
@@ -48,12 +49,173 @@ TpetraSystem::TpetraSystem(
 
 /******************************************************************************//**
  * \brief Convert from Plato::CrsMatrix<Plato::OrdinalType> to Tpetra_Matrix
+
+   If the map is not distributed, the point graph is built on device and kept
+   until the block graph of the input matrix changes.  Subsequent conversions
+   only copy the matrix entries into the point layout on device.
 **********************************************************************************/
 Teuchos::RCP<Tpetra_Matrix>
 TpetraSystem::fromMatrix(Plato::CrsMatrix<Plato::OrdinalType> aInMatrix) const
 {
   Teuchos::TimeMonitor LocalTimer(*mMatrixConversionTimer);
 
+  if(mMap->isDistributed())
+  {
+    return this->insertMatrix(aInMatrix);
+  }
+
+  const Plato::OrdinalType tNumRowsPerBlock = aInMatrix.numRowsPerBlock();
+  const Plato::OrdinalType tNumColsPerBlock = aInMatrix.numColsPerBlock();
+  const Plato::OrdinalType tNumBlockRows = aInMatrix.rowMap().extent(0) - 1;
+  size_t tCrsMatrixGlobalNumRows = tNumBlockRows * tNumRowsPerBlock;
+  if(tCrsMatrixGlobalNumRows != mMap->getGlobalNumElements())
+    throw std::domain_error("Input Plato::CrsMatrix size does not match TpetraSystem map.\n");
+
+  if(!this->isGraphCurrent(aInMatrix))
+  {
+    this->buildGraph(aInMatrix);
+  }
+
+  using ValuesT = typename Tpetra_Matrix::local_matrix_device_type::values_type;
+  using ExecT   = typename Tpetra_Matrix::execution_space;
+
+  // the entries are copied, not aliased: the input matrix may be recycled and
+  // reassembled while the returned matrix is still in use (see reuseOperator)
+  auto tEntries = aInMatrix.entries();
+  ValuesT tValues("values", tEntries.extent(0));
+  if(tNumRowsPerBlock == 1 && tNumColsPerBlock == 1 && mGraphIsSorted)
+  {
+    Kokkos::deep_copy(tValues, tEntries);
+  }
+  else
+  {
+    auto tRowMap = aInMatrix.rowMap();
+    auto tPermutation = mGraphBlockPermutation;
+    auto tRowPointers = mGraph->getLocalGraphDevice().row_map;
+    const Plato::OrdinalType tBlockSize = tNumRowsPerBlock*tNumColsPerBlock;
+    Kokkos::parallel_for("TpetraSystem::fromMatrix", Kokkos::RangePolicy<ExecT>(0, tCrsMatrixGlobalNumRows),
+    KOKKOS_LAMBDA(const Plato::OrdinalType & aRow)
+    {
+      auto tBlockRow = aRow / tNumRowsPerBlock;
+      auto tLocalRow = aRow % tNumRowsPerBlock;
+      auto tOffset = tRowPointers(aRow);
+      for(auto tSlot = tRowMap(tBlockRow); tSlot < tRowMap(tBlockRow+1); tSlot++)
+      {
+        auto tBlockEntry = tPermutation(tSlot);
+        for(Plato::OrdinalType tLocalCol = 0; tLocalCol < tNumColsPerBlock; tLocalCol++)
+        {
+          tValues(tOffset++) = tEntries(tBlockEntry*tBlockSize + tLocalRow*tNumColsPerBlock + tLocalCol);
+        }
+      }
+    });
+  }
+
+  auto tRetVal = Teuchos::rcp(new Tpetra_Matrix(mGraph, tValues));
+  tRetVal->fillComplete();
+
+  return tRetVal;
+}
+
+/******************************************************************************//**
+ * \brief Return true if the cached point graph was built from the block graph of aInMatrix
+**********************************************************************************/
+bool
+TpetraSystem::isGraphCurrent(const Plato::CrsMatrix<Plato::OrdinalType> & aInMatrix) const
+{
+  return !mGraph.is_null()
+      && mGraphRowMap.data() == aInMatrix.rowMap().data()
+      && mGraphRowMap.extent(0) == aInMatrix.rowMap().extent(0)
+      && mGraphColumnIndices.data() == aInMatrix.columnIndices().data()
+      && mGraphColumnIndices.extent(0) == aInMatrix.columnIndices().extent(0)
+      && mGraphRowsPerBlock == aInMatrix.numRowsPerBlock()
+      && mGraphColsPerBlock == aInMatrix.numColsPerBlock();
+}
+
+/******************************************************************************//**
+ * \brief Build and fill-complete the point graph of aInMatrix on device
+**********************************************************************************/
+void
+TpetraSystem::buildGraph(const Plato::CrsMatrix<Plato::OrdinalType> & aInMatrix) const
+{
+  using RowPointersT   = typename Tpetra_Graph::local_graph_device_type::row_map_type::non_const_type;
+  using ColumnIndicesT = typename Tpetra_Graph::local_graph_device_type::entries_type::non_const_type;
+  using ExecT          = typename Tpetra_Graph::execution_space;
+
+  auto tRowMap = aInMatrix.rowMap();
+  auto tColumnIndices = aInMatrix.columnIndices();
+  const Plato::OrdinalType tNumRowsPerBlock = aInMatrix.numRowsPerBlock();
+  const Plato::OrdinalType tNumColsPerBlock = aInMatrix.numColsPerBlock();
+  const Plato::OrdinalType tNumBlockRows = tRowMap.extent(0) - 1;
+  const Plato::OrdinalType tNumRows = tNumBlockRows * tNumRowsPerBlock;
+
+  // sort the block columns of each block row; Tpetra expects sorted local column indices
+  Plato::OrdinalVector tPermutation("block permutation", tColumnIndices.extent(0));
+  Plato::OrdinalType tNumUnsorted = 0;
+  Kokkos::parallel_reduce("TpetraSystem::buildGraph sort", Kokkos::RangePolicy<ExecT>(0, tNumBlockRows),
+  KOKKOS_LAMBDA(const Plato::OrdinalType & aBlockRow, Plato::OrdinalType & aUnsorted)
+  {
+    auto tFrom = tRowMap(aBlockRow);
+    auto tTo = tRowMap(aBlockRow+1);
+    for(auto tSlot = tFrom; tSlot < tTo; tSlot++)
+    {
+      auto tEntry = tSlot;
+      auto tInsert = tSlot;
+      while(tInsert > tFrom && tColumnIndices(tPermutation(tInsert-1)) > tColumnIndices(tEntry))
+      {
+        tPermutation(tInsert) = tPermutation(tInsert-1);
+        tInsert--;
+      }
+      tPermutation(tInsert) = tEntry;
+      if(tInsert != tSlot) { aUnsorted++; }
+    }
+  }, tNumUnsorted);
+
+  RowPointersT tRowPointers("row pointers", tNumRows+1);
+  Kokkos::parallel_scan("TpetraSystem::buildGraph row pointers", Kokkos::RangePolicy<ExecT>(0, tNumRows),
+  KOKKOS_LAMBDA(const Plato::OrdinalType & aRow, size_t & aOffset, const bool & aIsFinal)
+  {
+    auto tBlockRow = aRow / tNumRowsPerBlock;
+    if(aIsFinal) { tRowPointers(aRow) = aOffset; }
+    aOffset += (tRowMap(tBlockRow+1) - tRowMap(tBlockRow)) * tNumColsPerBlock;
+    if(aIsFinal && aRow == tNumRows-1) { tRowPointers(tNumRows) = aOffset; }
+  });
+
+  ColumnIndicesT tPointColumnIndices("column indices", tColumnIndices.extent(0)*tNumRowsPerBlock*tNumColsPerBlock);
+  Kokkos::parallel_for("TpetraSystem::buildGraph column indices", Kokkos::RangePolicy<ExecT>(0, tNumRows),
+  KOKKOS_LAMBDA(const Plato::OrdinalType & aRow)
+  {
+    auto tBlockRow = aRow / tNumRowsPerBlock;
+    auto tOffset = tRowPointers(aRow);
+    for(auto tSlot = tRowMap(tBlockRow); tSlot < tRowMap(tBlockRow+1); tSlot++)
+    {
+      auto tBlockCol = tColumnIndices(tPermutation(tSlot));
+      for(Plato::OrdinalType tLocalCol = 0; tLocalCol < tNumColsPerBlock; tLocalCol++)
+      {
+        tPointColumnIndices(tOffset++) = tBlockCol*tNumColsPerBlock + tLocalCol;
+      }
+    }
+  });
+
+  // the map is not distributed, so local and global column indices coincide
+  auto tGraph = Teuchos::rcp(new Tpetra_Graph(mMap, mMap, tRowPointers, tPointColumnIndices));
+  tGraph->fillComplete(mMap, mMap);
+
+  mGraph = tGraph;
+  mGraphRowMap = tRowMap;
+  mGraphColumnIndices = tColumnIndices;
+  mGraphRowsPerBlock = tNumRowsPerBlock;
+  mGraphColsPerBlock = tNumColsPerBlock;
+  mGraphBlockPermutation = tPermutation;
+  mGraphIsSorted = (tNumUnsorted == 0);
+}
+
+/******************************************************************************//**
+ * \brief Convert from Plato::CrsMatrix<Plato::OrdinalType> to Tpetra_Matrix by
+ *        global row insertion
+**********************************************************************************/
+Teuchos::RCP<Tpetra_Matrix>
+TpetraSystem::insertMatrix(const Plato::CrsMatrix<Plato::OrdinalType> & aInMatrix) const
+{
   Plato::OrdinalType tMaxColSize = 0;
   {
     auto tRowMap = aInMatrix.rowMap();
@@ -133,6 +295,51 @@ TpetraSystem::fromVector(const Plato::ScalarVector tInVector) const
   return tOutVector;
 }
 
+/******************************************************************************//**
+ * \brief Convert from ScalarMultiVector (one vector per row) to Tpetra_MultiVector
+**********************************************************************************/
+Teuchos::RCP<Tpetra_MultiVector>
+TpetraSystem::fromMultiVector(const Plato::ScalarMultiVector tInVector) const
+{
+  Teuchos::TimeMonitor LocalTimer(*mVectorConversionTimer);
+  const size_t tNumVectors = tInVector.extent(0);
+  auto tOutVector = Teuchos::rcp(new Tpetra_MultiVector(mMap, tNumVectors));
+  if(tInVector.extent(1) != tOutVector->getLocalLength())
+    throw std::domain_error("ScalarMultiVector size does not match TpetraSystem map\n");
+
+  auto tOutVectorDeviceView2D = tOutVector->getLocalView<Plato::DeviceType>(Tpetra::Access::ReadWrite);
+  for(size_t tVectorIndex = 0; tVectorIndex < tNumVectors; tVectorIndex++)
+  {
+    auto tOutVectorDeviceView1D = Kokkos::subview(tOutVectorDeviceView2D, Kokkos::ALL(), tVectorIndex);
+    auto tInVector1D = Kokkos::subview(tInVector, tVectorIndex, Kokkos::ALL());
+    Kokkos::deep_copy(tOutVectorDeviceView1D, tInVector1D);
+  }
+
+  return tOutVector;
+}
+
+/******************************************************************************//**
+ * \brief Convert from Tpetra_MultiVector to ScalarMultiVector (one vector per row)
+**********************************************************************************/
+void 
+TpetraSystem::toMultiVector(Plato::ScalarMultiVector& tOutVector, const Teuchos::RCP<Tpetra_MultiVector> tInVector) const
+{
+    Teuchos::TimeMonitor LocalTimer(*mVectorConversionTimer);
+    if(tInVector->getLocalLength() != mMap->getLocalNumElements())
+      throw std::domain_error("Tpetra_MultiVector map does not match TpetraSystem map.");
+
+    if(tOutVector.extent(1) != mMap->getLocalNumElements() || tOutVector.extent(0) != tInVector->getNumVectors())
+      throw std::range_error("ScalarMultiVector does not match TpetraSystem map.");
+
+    auto tInVectorDeviceView2D = tInVector->getLocalView<Plato::DeviceType>(Tpetra::Access::ReadOnly);
+    for(size_t tVectorIndex = 0; tVectorIndex < tInVector->getNumVectors(); tVectorIndex++)
+    {
+      auto tInVectorDeviceView1D = Kokkos::subview(tInVectorDeviceView2D, Kokkos::ALL(), tVectorIndex);
+      auto tOutVector1D = Kokkos::subview(tOutVector, tVectorIndex, Kokkos::ALL());
+      Kokkos::deep_copy(tOutVector1D, tInVectorDeviceView1D);
+    }
+}
+
 /******************************************************************************//**
  * \brief Convert from Tpetra_MultiVector to ScalarVector
 **********************************************************************************/
@@ -183,10 +390,10 @@ TpetraLinearSolver::TpetraLinearSolver(
 }
 
 template<class TpetraMatrixType>
-Teuchos::RCP<Tpetra::Operator<typename TpetraMatrixType::scalar_type,
-                              typename TpetraMatrixType::local_ordinal_type,
-                              typename TpetraMatrixType::global_ordinal_type,
-                              typename TpetraMatrixType::node_type> >
+Teuchos::RCP<Ifpack2::Preconditioner<typename TpetraMatrixType::scalar_type,
+                                     typename TpetraMatrixType::local_ordinal_type,
+                                     typename TpetraMatrixType::global_ordinal_type,
+                                     typename TpetraMatrixType::node_type> >
 createIFpack2Preconditioner (const Teuchos::RCP<const TpetraMatrixType>& A,
                       const std::string& precondType,
                       const Teuchos::ParameterList& plist)
@@ -313,9 +520,37 @@ TpetraLinearSolver::setupPreconditionerOptions ()
 
   if(mSolverParams.isType<Teuchos::ParameterList>("Preconditioner Options"))
     mPreconditionerOptions = mSolverParams.get<Teuchos::ParameterList>("Preconditioner Options");
-  
+
+  std::string tPreconditionerReuse = "none";
+  if (mSolverParams.isType<std::string>("Preconditioner Reuse"))
+    tPreconditionerReuse = Plato::tolower(mSolverParams.get<std::string>("Preconditioner Reuse"));
+
+  if (tPreconditionerReuse == "none")
+    mPreconditionerReuse = Plato::PreconditionerReuse::NONE;
+  else if (tPreconditionerReuse == "symbolic")
+    mPreconditionerReuse = Plato::PreconditionerReuse::SYMBOLIC;
+  else if (tPreconditionerReuse == "fixed")
+    mPreconditionerReuse = Plato::PreconditionerReuse::FIXED;
+  else if (tPreconditionerReuse == "iterations")
+    mPreconditionerReuse = Plato::PreconditionerReuse::ITERATIONS;
+  else
+  {
+    std::string tInvalidReuse = "Preconditioner Reuse '" + tPreconditionerReuse
+                              + "' is not a valid option. Valid options: ('none', 'symbolic', 'fixed', 'iterations')\n";
+    throw std::invalid_argument(tInvalidReuse);
+  }
+
+  if (mSolverParams.isType<int>("Preconditioner Reuse Count"))
+    mPreconditionerReuseCount = mSolverParams.get<int>("Preconditioner Reuse Count");
+  if (mSolverParams.isType<int>("Preconditioner Reuse Iteration Limit"))
+    mPreconditionerReuseIterationLimit = mSolverParams.get<int>("Preconditioner Reuse Iteration Limit");
+
   if (mPreconditionerPackage != "muelu") return;
 
+  // keep the prolongator (aggregates and tentative P) when the values are refreshed
+  if (mPreconditionerReuse == Plato::PreconditionerReuse::SYMBOLIC)
+    this->addDefaultToParameterList(mPreconditionerOptions, "reuse: type", std::string("tP"));
+
   bool tUseSmoothedAggregation = true;
   if(mSolverParams.isType<bool>("Use Smoothed Aggregation"))
     tUseSmoothedAggregation = mSolverParams.get<bool>("Use Smoothed Aggregation");
@@ -387,6 +622,81 @@ TpetraLinearSolver::belosSolve (Teuchos::RCP<const OP> A, Teuchos::RCP<MV> X, Te
   }
 }
 
+void
+TpetraLinearSolver::createPreconditioner(Teuchos::RCP<Tpetra_Matrix> aA)
+{
+  mIfpack2Preconditioner = Teuchos::null;
+  mMueLuPreconditioner = Teuchos::null;
+  if(mPreconditionerPackage == "ifpack2")
+  {
+    mIfpack2Preconditioner = createIFpack2Preconditioner<Tpetra_Matrix> (aA, mPreconditionerType, mPreconditionerOptions);
+    mPreconditioner = mIfpack2Preconditioner;
+  }
+  else if(mPreconditionerPackage == "muelu")
+  {
+    mMueLuPreconditioner = MueLu::CreateTpetraPreconditioner(static_cast<Teuchos::RCP<Tpetra_Operator>>(aA), mPreconditionerOptions);
+    mPreconditioner = mMueLuPreconditioner;
+  }
+  else
+  {
+    std::string tInvalid_solver = "Preconditioner Package " + mPreconditionerPackage 
+                                + " is not currently a valid option. Valid options: ('ifpack2', 'muelu')\n";
+    throw std::invalid_argument(tInvalid_solver);
+  }
+  mPreconditionerNumRows = aA->getGlobalNumRows();
+  mNumPreconditionerUses = 1;
+}
+
+bool
+TpetraLinearSolver::updatePreconditioner(Teuchos::RCP<Tpetra_Matrix> aA)
+{
+  bool tRebuild = mPreconditioner.is_null() || aA->getGlobalNumRows() != mPreconditionerNumRows;
+  if (!tRebuild)
+  {
+    switch (mPreconditionerReuse)
+    {
+      case Plato::PreconditionerReuse::NONE:
+        tRebuild = true;
+        break;
+      case Plato::PreconditionerReuse::SYMBOLIC:
+        if (!mMueLuPreconditioner.is_null())
+        {
+          MueLu::ReuseTpetraPreconditioner(aA, *mMueLuPreconditioner);
+        }
+        else
+        {
+          using RowMatrix = Tpetra::RowMatrix<Plato::Scalar, int, Plato::OrdinalType>;
+          auto tCanChangeMatrix = Teuchos::rcp_dynamic_cast<Ifpack2::Details::CanChangeMatrix<RowMatrix>>(mIfpack2Preconditioner);
+          if (tCanChangeMatrix.is_null())
+          {
+            tRebuild = true;
+            break;
+          }
+          tCanChangeMatrix->setMatrix(aA);
+          if (!mIfpack2Preconditioner->isInitialized())
+            mIfpack2Preconditioner->initialize();
+          mIfpack2Preconditioner->compute();
+        }
+        break;
+      case Plato::PreconditionerReuse::FIXED:
+        tRebuild = mNumPreconditionerUses >= mPreconditionerReuseCount;
+        break;
+      case Plato::PreconditionerReuse::ITERATIONS:
+        tRebuild = mNumIterations >= mPreconditionerReuseIterationLimit;
+        break;
+    }
+  }
+
+  if (tRebuild)
+  {
+    this->createPreconditioner(aA);
+    return false;
+  }
+
+  mNumPreconditionerUses++;
+  return mPreconditionerReuse != Plato::PreconditionerReuse::SYMBOLIC;
+}
+
 /******************************************************************************//**
  * \brief Solve the linear system
 **********************************************************************************/
@@ -402,27 +712,11 @@ TpetraLinearSolver::innerSolve(
   mSolverStartTime = mPreLinearSolveTimer->wallTime();
   const double tAnalyzeElapsedTime = mSolverStartTime - mSolverEndTime;
 
-  Teuchos::RCP<Tpetra_Matrix> A = mSystem->fromMatrix(aA);
+  Teuchos::RCP<Tpetra_Matrix> A = this->getMatrix(aA);
   Teuchos::RCP<Tpetra_MultiVector> X = mSystem->fromVector(aX);
   Teuchos::RCP<Tpetra_MultiVector> B = mSystem->fromVector(aB);
 
-  Teuchos::RCP<Tpetra_Operator> M;
-
-  mPreconditionerSetupTimer->start();
-  if(mPreconditionerPackage == "ifpack2")
-    M = createIFpack2Preconditioner<Tpetra_Matrix> (A, mPreconditionerType, mPreconditionerOptions);
-  else if(mPreconditionerPackage == "muelu")
-    M = MueLu::CreateTpetraPreconditioner(static_cast<Teuchos::RCP<Tpetra_Operator>>(A), mPreconditionerOptions);
-  else
-  {
-    std::string tInvalid_solver = "Preconditioner Package " + mPreconditionerPackage 
-                                + " is not currently a valid option. Valid options: ('ifpack2', 'muelu')\n";
-    throw std::invalid_argument(tInvalid_solver);
-  }
-  mPreconditionerSetupTimer->stop();
-  mPreconditionerSetupTimer->incrementNumCalls(); 
-
-  belosSolve<Tpetra_MultiVector, Tpetra_Operator> (A, X, B, M);
+  this->solveSystem(A, X, B);
 
   mSystem->toVector(aX,X);
 
@@ -434,4 +728,89 @@ TpetraLinearSolver::innerSolve(
   mPreLinearSolveTimer->start();
 }
 
+/******************************************************************************//**
+ * \brief Solve the linear system for multiple right hand sides with one block solve
+**********************************************************************************/
+void
+TpetraLinearSolver::innerSolve(
+    Plato::CrsMatrix<Plato::OrdinalType> aA,
+    Plato::ScalarMultiVector aX,
+    Plato::ScalarMultiVector aB
+)
+{
+  mPreLinearSolveTimer->stop(); 
+  mPreLinearSolveTimer->incrementNumCalls();
+  mSolverStartTime = mPreLinearSolveTimer->wallTime();
+  const double tAnalyzeElapsedTime = mSolverStartTime - mSolverEndTime;
+
+  Teuchos::RCP<Tpetra_Matrix> A = this->getMatrix(aA);
+  Teuchos::RCP<Tpetra_MultiVector> X = mSystem->fromMultiVector(aX);
+  Teuchos::RCP<Tpetra_MultiVector> B = mSystem->fromMultiVector(aB);
+
+  this->solveSystem(A, X, B);
+
+  mSystem->toMultiVector(aX,X);
+
+  mSolverEndTime = mPreLinearSolveTimer->wallTime();
+  const double tTpetraElapsedTime = mSolverEndTime - mSolverStartTime;
+  if (mDisplayIterations > 0)
+    printf("Pre Lin. Solve %5.1f second(s) || Tpetra Lin. Solve (%d rhs) %5.1f second(s), %4d iteration(s), %7.1e achieved tolerance\n",
+           tAnalyzeElapsedTime, static_cast<int>(aX.extent(0)), tTpetraElapsedTime, mNumIterations, mAchievedTolerance);
+  mPreLinearSolveTimer->start();
+}
+
+Teuchos::RCP<Tpetra_Matrix>
+TpetraLinearSolver::getMatrix(Plato::CrsMatrix<Plato::OrdinalType> aA)
+{
+  bool tReuse = mReuseOperator && !mMatrix.is_null()
+             && mMatrix->getGlobalNumRows() == static_cast<size_t>(aA.numRows());
+  if (!tReuse)
+  {
+    mMatrix = mSystem->fromMatrix(aA);
+  }
+  return mMatrix;
+}
+
+void
+TpetraLinearSolver::solveSystem(
+    Teuchos::RCP<Tpetra_Matrix>      aA,
+    Teuchos::RCP<Tpetra_MultiVector> aX,
+    Teuchos::RCP<Tpetra_MultiVector> aB
+)
+{
+  // an unchanged operator keeps its exact preconditioner
+  bool tIsLagged = false;
+  if (!mReuseOperator || mPreconditioner.is_null() || aA->getGlobalNumRows() != mPreconditionerNumRows)
+  {
+    mPreconditionerSetupTimer->start();
+    tIsLagged = this->updatePreconditioner(aA);
+    mPreconditionerSetupTimer->stop();
+    mPreconditionerSetupTimer->incrementNumCalls(); 
+  }
+
+  if (tIsLagged)
+  {
+    Tpetra_MultiVector tInitialX(*aX, Teuchos::Copy);
+    try
+    {
+      belosSolve<Tpetra_MultiVector, Tpetra_Operator> (aA, aX, aB, mPreconditioner);
+    }
+    catch (const std::exception &)
+    {
+      // a lagged preconditioner can be too weak for the current matrix. retry with a fresh one.
+      mPreconditionerSetupTimer->start();
+      this->createPreconditioner(aA);
+      mPreconditionerSetupTimer->stop();
+      mPreconditionerSetupTimer->incrementNumCalls(); 
+
+      Tpetra::deep_copy(*aX, tInitialX);
+      belosSolve<Tpetra_MultiVector, Tpetra_Operator> (aA, aX, aB, mPreconditioner);
+    }
+  }
+  else
+  {
+    belosSolve<Tpetra_MultiVector, Tpetra_Operator> (aA, aX, aB, mPreconditioner);
+  }
+}
+
 } // end namespace Plato
@@ -10,7 +10,10 @@
 #include <Teuchos_Time.hpp>
 #include <Tpetra_Core.hpp>
 #include <Tpetra_MultiVector.hpp>
+#include <Tpetra_CrsGraph.hpp>
 #include <Tpetra_CrsMatrix.hpp>
+#include <Ifpack2_Preconditioner.hpp>
+#include <MueLu_TpetraOperator.hpp>
 
 namespace Plato {
 
@@ -18,13 +21,20 @@ namespace Plato {
   using Tpetra_MultiVector = Tpetra::MultiVector<Plato::Scalar, int, Plato::OrdinalType>;
   using Tpetra_Vector = Tpetra::Vector<Plato::Scalar, int, Plato::OrdinalType>;
   using Tpetra_Matrix = Tpetra::CrsMatrix<Plato::Scalar, int, Plato::OrdinalType>;
+  using Tpetra_Graph = Tpetra::CrsGraph<int, Plato::OrdinalType>;
   using Tpetra_Operator = Tpetra::Operator<Plato::Scalar, int, Plato::OrdinalType>;
+  using Ifpack2_Preconditioner = Ifpack2::Preconditioner<Plato::Scalar, int, Plato::OrdinalType>;
+  using MueLu_Preconditioner = MueLu::TpetraOperator<Plato::Scalar, int, Plato::OrdinalType>;
 
 /******************************************************************************//**
  * \brief Abstract system interface
 
    This class contains the node and dof map information and permits persistence
    of this information between solutions.
+
+   The map spans the global dofs of the full mesh.  The mesh isn't decomposed:
+   on more than one rank, every rank loads the full mesh and assembles the full
+   system, and only the linear solve is distributed.
 **********************************************************************************/
 class TpetraSystem
 {
@@ -34,6 +44,18 @@ class TpetraSystem
   Teuchos::RCP<Teuchos::Time> mMatrixConversionTimer;
   Teuchos::RCP<Teuchos::Time> mVectorConversionTimer;
 
+  /// @brief fill-complete point graph of the last converted block matrix, and the block
+  ///        graph it was built from.  The point graph is rebuilt only if the block graph changes.
+  mutable Teuchos::RCP<const Tpetra_Graph> mGraph;
+  mutable Plato::CrsMatrixType::RowMapVectorT mGraphRowMap;
+  mutable Plato::CrsMatrixType::OrdinalVectorT mGraphColumnIndices;
+  mutable Plato::OrdinalType mGraphRowsPerBlock = 0;
+  mutable Plato::OrdinalType mGraphColsPerBlock = 0;
+  /// @brief block entry of each sorted block slot, i.e., the block column order of the point graph
+  mutable Plato::OrdinalVector mGraphBlockPermutation;
+  /// @brief true if the block column indices are sorted, i.e., the permutation is the identity
+  mutable bool mGraphIsSorted = false;
+
   public:
     TpetraSystem(
         int            aNumNodes,
@@ -59,16 +81,57 @@ class TpetraSystem
     void
     toVector(Plato::ScalarVector& tOutVector, const Teuchos::RCP<Tpetra_MultiVector> tInVector) const;
 
+    /******************************************************************************//**
+     * \brief Convert from ScalarMultiVector (one vector per row) to Tpetra_MultiVector
+    **********************************************************************************/
+    Teuchos::RCP<Tpetra_MultiVector>
+    fromMultiVector(const Plato::ScalarMultiVector tInVector) const;
+
+    /******************************************************************************//**
+     * \brief Convert from Tpetra_MultiVector to ScalarMultiVector (one vector per row)
+    **********************************************************************************/
+    void
+    toMultiVector(Plato::ScalarMultiVector& tOutVector, const Teuchos::RCP<Tpetra_MultiVector> tInVector) const;
+
     /******************************************************************************//**
      * \brief get TpetraSystem map 
     **********************************************************************************/
     Teuchos::RCP<Tpetra_Map> getMap() const {return mMap;}
 
   private:
+    /******************************************************************************//**
+     * \brief Return true if the cached point graph was built from the block graph of aInMatrix
+    **********************************************************************************/
+    bool
+    isGraphCurrent(const Plato::CrsMatrix<Plato::OrdinalType> & aInMatrix) const;
+
+    /******************************************************************************//**
+     * \brief Build and fill-complete the point graph of aInMatrix on device
+    **********************************************************************************/
+    void
+    buildGraph(const Plato::CrsMatrix<Plato::OrdinalType> & aInMatrix) const;
+
+    /******************************************************************************//**
+     * \brief Convert from Plato::CrsMatrix<int> to Tpetra_Matrix by global row insertion.
+     *        Used if the map is distributed.
+    **********************************************************************************/
+    Teuchos::RCP<Tpetra_Matrix>
+    insertMatrix(const Plato::CrsMatrix<Plato::OrdinalType> & aInMatrix) const;
+
       void checkInputMatrixSize(const Plato::CrsMatrix<Plato::OrdinalType> aInMatrix,
                Kokkos::View<Plato::OrdinalType*, MemSpace>::HostMirror aRowMap) const;
 };
 
+/******************************************************************************//**
+ * \brief Preconditioner reuse policy
+ *
+ * NONE:      build a new preconditioner for every solve
+ * SYMBOLIC:  keep the symbolic setup (e.g., AMG aggregates) and refresh the numeric values every solve
+ * FIXED:     reuse the preconditioner unchanged for a fixed number of solves
+ * ITERATIONS: reuse the preconditioner unchanged while the iteration count stays below a limit
+**********************************************************************************/
+enum class PreconditionerReuse { NONE, SYMBOLIC, FIXED, ITERATIONS };
+
 /******************************************************************************//**
  * \brief Concrete TpetraLinearSolver
 **********************************************************************************/
@@ -97,6 +160,17 @@ class TpetraLinearSolver : public AbstractSolver
 
     int mNumIterations = 1000; /*!< maximum linear solver iterations */
     Plato::Scalar mTolerance = 1e-14; /*!< linear solver tolerance */
+
+    Plato::PreconditionerReuse mPreconditionerReuse = Plato::PreconditionerReuse::NONE;
+    int mPreconditionerReuseCount = 10;          /*!< max solves per preconditioner (FIXED) */
+    int mPreconditionerReuseIterationLimit = 50; /*!< rebuild once a solve needs more iterations (ITERATIONS) */
+
+    Teuchos::RCP<Tpetra_Operator>        mPreconditioner;        /*!< current preconditioner */
+    Teuchos::RCP<Ifpack2_Preconditioner> mIfpack2Preconditioner; /*!< current preconditioner if built by ifpack2 */
+    Teuchos::RCP<MueLu_Preconditioner>   mMueLuPreconditioner;   /*!< current preconditioner if built by muelu */
+    int    mNumPreconditionerUses = 0;   /*!< number of solves with the current preconditioner */
+    size_t mPreconditionerNumRows = 0;   /*!< global number of rows of the matrix the preconditioner was built for */
+    Teuchos::RCP<Tpetra_Matrix> mMatrix; /*!< matrix of the previous solve */
     
   public:
     TpetraLinearSolver(
@@ -119,7 +193,33 @@ class TpetraLinearSolver : public AbstractSolver
         Plato::ScalarVector   aB
     ) override;
 
+    /******************************************************************************//**
+     * @brief Solve the linear system for multiple right hand sides with one block solve
+    **********************************************************************************/
+    void
+    innerSolve(
+        Plato::CrsMatrix<Plato::OrdinalType> aA,
+        Plato::ScalarMultiVector aX,
+        Plato::ScalarMultiVector aB
+    ) override;
+
   private:
+    /******************************************************************************//**
+     * \brief Return the Tpetra matrix for aA.  The matrix of the previous solve is
+     *        returned if the operator is declared unchanged.
+    **********************************************************************************/
+    Teuchos::RCP<Tpetra_Matrix>
+    getMatrix(Plato::CrsMatrix<Plato::OrdinalType> aA);
+
+    /******************************************************************************//**
+     * \brief Update the preconditioner and solve
+    **********************************************************************************/
+    void
+    solveSystem(
+        Teuchos::RCP<Tpetra_Matrix>      aA,
+        Teuchos::RCP<Tpetra_MultiVector> aX,
+        Teuchos::RCP<Tpetra_MultiVector> aB);
+
     /******************************************************************************//**
      * \brief Setup the Belos solver and solve
     **********************************************************************************/
@@ -139,6 +239,19 @@ class TpetraLinearSolver : public AbstractSolver
     void
     setupPreconditionerOptions();
 
+    /******************************************************************************//**
+     * @brief Build a new preconditioner for aA
+    ********************************************************************* ************/
+    void
+    createPreconditioner(Teuchos::RCP<Tpetra_Matrix> aA);
+
+    /******************************************************************************//**
+     * @brief Return a preconditioner for aA according to the reuse policy
+     * @return true if the returned preconditioner was built for a different matrix
+    ********************************************************************* ************/
+    bool
+    updatePreconditioner(Teuchos::RCP<Tpetra_Matrix> aA);
+
     /******************************************************************************//**
      * @brief Add to parameter list if not set by user
     ********************************************************************* ************/
@@ -2,10 +2,16 @@
 #include "AnalyzeAppIntxTests.hpp"
 
 #include <Analyze_App.hpp>
+#include <BamG.hpp>
+
+#include <fstream>
 
 std::shared_ptr<Plato::MPMD_App> createApp(std::string inputFile, std::string appFile);
 void objectiveFiniteDifferenceTest(std::shared_ptr<Plato::MPMD_App> aApp, Plato::Scalar& val1, Plato::Scalar& val2, Plato::Scalar tol);
 void objectiveFiniteDifferenceTest(std::string inputFile, std::string appFile, Plato::Scalar& val1, Plato::Scalar& val2, Plato::Scalar tol);
+std::shared_ptr<Plato::MPMD_App> createSolutionCacheApp();
+void writeSolutionCacheInput(std::string inputFile, Plato::Scalar appliedDisplacement);
+std::vector<Plato::Scalar> computeSolutionCacheGradient(std::shared_ptr<Plato::MPMD_App> aApp, std::string valueOp, std::string gradientOp);
 
 TEUCHOS_UNIT_TEST( AnalyzeAppTests, Reinitialize )
 { 
@@ -377,6 +383,137 @@ TEUCHOS_UNIT_TEST( AnalyzeAppTests, Displacement )
   TEST_FLOATING_EQUALITY(val1, val2, tol);
 }
 
+TEUCHOS_UNIT_TEST( AnalyzeAppTests, SolutionCacheValueThenGradient )
+{ 
+  /*
+   * A criterion value followed by its gradient at the same controls
+   * performs one forward solve.
+   */
+  auto tApp = createSolutionCacheApp();
+
+  std::vector<int> localIDs;
+  tApp->exportDataMap(Plato::data::layout_t::SCALAR_FIELD, localIDs);
+
+  FauxSharedField fauxControlIn(localIDs.size());
+  std::vector<Plato::Scalar> stdControlIn(localIDs.size(),0.5);
+  fauxControlIn.setData(stdControlIn);
+  tApp->importDataT("Topology", fauxControlIn);
+
+  tApp->compute("Compute Objective Value");
+  TEST_EQUALITY(tApp->getNumSolutions(), 1);
+
+  tApp->compute("Compute Objective Gradient");
+  TEST_EQUALITY(tApp->getNumSolutions(), 1);
+
+  // re-importing the same controls keeps the solution
+  tApp->importDataT("Topology", fauxControlIn);
+  tApp->compute("Compute Objective Value");
+  tApp->compute("Compute Objective Gradient");
+  TEST_EQUALITY(tApp->getNumSolutions(), 1);
+}
+
+TEUCHOS_UNIT_TEST( AnalyzeAppTests, SolutionCacheTopologyChange )
+{ 
+  /*
+   * Changing the controls forces a new forward solve and gradient.  The
+   * SIMP penalty is cubic, so doubling a uniform density scales the energy
+   * gradient by four.
+   */
+  auto tApp = createSolutionCacheApp();
+
+  std::vector<int> localIDs;
+  tApp->exportDataMap(Plato::data::layout_t::SCALAR_FIELD, localIDs);
+
+  FauxSharedField fauxControlIn(localIDs.size());
+  std::vector<Plato::Scalar> stdControlIn(localIDs.size(),0.5);
+  fauxControlIn.setData(stdControlIn);
+  tApp->importDataT("Topology", fauxControlIn);
+
+  auto stdGradOne = computeSolutionCacheGradient(tApp, "Compute Objective Value", "Compute Objective Gradient");
+  TEST_EQUALITY(tApp->getNumSolutions(), 1);
+
+  std::fill(stdControlIn.begin(), stdControlIn.end(), 1.0);
+  fauxControlIn.setData(stdControlIn);
+  tApp->importDataT("Topology", fauxControlIn);
+
+  auto stdGradTwo = computeSolutionCacheGradient(tApp, "Compute Objective Value", "Compute Objective Gradient");
+  TEST_EQUALITY(tApp->getNumSolutions(), 2);
+
+  for(int i=0; i<localIDs.size(); i++)
+  {
+    if( fabs(stdGradOne[i]) > 1e-16 )
+      TEST_FLOATING_EQUALITY(4.0*stdGradOne[i], stdGradTwo[i], 1e-6);
+  }
+}
+
+TEUCHOS_UNIT_TEST( AnalyzeAppTests, SolutionCacheParameterUpdate )
+{ 
+  /*
+   * Updating a parameter of the problem definition invalidates the cached
+   * solution and gradient.  Doubling the applied displacement scales the
+   * energy gradient by four.
+   */
+  auto tApp = createSolutionCacheApp();
+
+  std::vector<int> localIDs;
+  tApp->exportDataMap(Plato::data::layout_t::SCALAR_FIELD, localIDs);
+
+  FauxSharedField fauxControlIn(localIDs.size());
+  std::vector<Plato::Scalar> stdControlIn(localIDs.size(),0.5);
+  fauxControlIn.setData(stdControlIn);
+  tApp->importDataT("Topology", fauxControlIn);
+
+  auto stdGradOne = computeSolutionCacheGradient(tApp, "Compute Objective Value", "Compute Objective Gradient");
+  TEST_EQUALITY(tApp->getNumSolutions(), 1);
+
+  FauxParameter fauxParamIn("Applied Displacement", "Compute Objective Value", 2.0e-3);
+  tApp->importDataT("Applied Displacement", fauxParamIn);
+
+  auto stdGradTwo = computeSolutionCacheGradient(tApp, "Compute Objective Value", "Compute Objective Gradient");
+  TEST_EQUALITY(tApp->getNumSolutions(), 2);
+
+  for(int i=0; i<localIDs.size(); i++)
+  {
+    if( fabs(stdGradOne[i]) > 1e-16 )
+      TEST_FLOATING_EQUALITY(4.0*stdGradOne[i], stdGradTwo[i], 1e-6);
+  }
+}
+
+TEUCHOS_UNIT_TEST( AnalyzeAppTests, SolutionCacheProblemDefinitionSwitch )
+{ 
+  /*
+   * Switching problem definitions invalidates the cached solution and
+   * gradient.  The second definition doubles the applied displacement.
+   */
+  auto tApp = createSolutionCacheApp();
+
+  std::vector<int> localIDs;
+  tApp->exportDataMap(Plato::data::layout_t::SCALAR_FIELD, localIDs);
+
+  FauxSharedField fauxControlIn(localIDs.size());
+  std::vector<Plato::Scalar> stdControlIn(localIDs.size(),0.5);
+  fauxControlIn.setData(stdControlIn);
+  tApp->importDataT("Topology", fauxControlIn);
+
+  auto stdGradOne = computeSolutionCacheGradient(tApp, "Compute Objective Value", "Compute Objective Gradient");
+  TEST_EQUALITY(tApp->getNumSolutions(), 1);
+
+  auto stdGradTwo = computeSolutionCacheGradient(tApp, "Compute Objective Value 2", "Compute Objective Gradient 2");
+  TEST_EQUALITY(tApp->getNumSolutions(), 2);
+
+  auto stdGradThree = computeSolutionCacheGradient(tApp, "Compute Objective Value", "Compute Objective Gradient");
+  TEST_EQUALITY(tApp->getNumSolutions(), 3);
+
+  for(int i=0; i<localIDs.size(); i++)
+  {
+    if( fabs(stdGradOne[i]) > 1e-16 )
+    {
+      TEST_FLOATING_EQUALITY(4.0*stdGradOne[i], stdGradTwo[i], 1e-6);
+      TEST_FLOATING_EQUALITY(stdGradOne[i], stdGradThree[i], 1e-12);
+    }
+  }
+}
+
 void objectiveFiniteDifferenceTest(std::string inputFile, std::string appFile, Plato::Scalar& val1, Plato::Scalar& val2, Plato::Scalar tol)
 {
   auto tApp = createApp(inputFile, appFile);
@@ -404,6 +541,140 @@ std::shared_ptr<Plato::MPMD_App> createApp(std::string inputFile, std::string ap
   return tApp;
 }
 
+std::shared_ptr<Plato::MPMD_App> createSolutionCacheApp()
+{
+  BamG::MeshSpec tSpec;
+  tSpec.meshType = "TET4";
+  tSpec.fileName = "SolutionCache_mesh.exo";
+  tSpec.numX = 2;
+  tSpec.numY = 2;
+  tSpec.numZ = 2;
+  BamG::generate(tSpec);
+
+  writeSolutionCacheInput("SolutionCache_input.xml", 1.0e-3);
+  writeSolutionCacheInput("SolutionCache_input_2.xml", 2.0e-3);
+
+  std::ofstream tOutfile;
+  tOutfile.open("SolutionCache_appfile.xml");
+  tOutfile << "<?xml version=\"1.0\"?>" << std::endl;
+  for(std::string tSuffix : {"", " 2"})
+  {
+    std::string tDefinition = tSuffix.empty() ? "" : "  <ProblemDefinition>SolutionCache_input_2.xml</ProblemDefinition>\n";
+    tOutfile << "<Operation>\n"
+             << "  <Function>ComputeCriterionValue</Function>\n"
+             << "  <Name>Compute Objective Value" << tSuffix << "</Name>\n"
+             << tDefinition
+             << "  <Criterion>Internal Energy</Criterion>\n"
+             << "  <Output>\n"
+             << "    <Argument>Value</Argument>\n"
+             << "    <ArgumentName>Objective Value</ArgumentName>\n"
+             << "  </Output>\n";
+    if(tSuffix.empty())
+    {
+      tOutfile << "  <Parameter>\n"
+               << "    <ArgumentName>Applied Displacement</ArgumentName>\n"
+               << "    <Target>[Essential Boundary Conditions]:[Applied X Displacement Boundary Condition]:Value</Target>\n"
+               << "    <InitialValue>1.0e-3</InitialValue>\n"
+               << "  </Parameter>\n";
+    }
+    tOutfile << "</Operation>\n"
+             << "<Operation>\n"
+             << "  <Function>ComputeCriterionGradient</Function>\n"
+             << "  <Name>Compute Objective Gradient" << tSuffix << "</Name>\n"
+             << tDefinition
+             << "  <Criterion>Internal Energy</Criterion>\n"
+             << "  <Output>\n"
+             << "    <Argument>Gradient</Argument>\n"
+             << "    <ArgumentName>Objective Gradient</ArgumentName>\n"
+             << "  </Output>\n"
+             << "</Operation>\n";
+  }
+  tOutfile.close();
+
+  return createApp("SolutionCache_input.xml", "SolutionCache_appfile.xml");
+}
+
+void writeSolutionCacheInput(std::string inputFile, Plato::Scalar appliedDisplacement)
+{
+  std::ofstream tOutfile;
+  tOutfile.open(inputFile);
+  tOutfile <<
+    "<ParameterList name='Plato Problem'>                                                     \n"
+    "  <Parameter name='Input Mesh' type='string' value='SolutionCache_mesh.exo'/>            \n"
+    "  <ParameterList name='Spatial Model'>                                                   \n"
+    "    <ParameterList name='Domains'>                                                       \n"
+    "      <ParameterList name='Design Volume'>                                               \n"
+    "        <Parameter name='Element Block' type='string' value='body'/>                     \n"
+    "        <Parameter name='Material Model' type='string' value='Unobtainium'/>             \n"
+    "      </ParameterList>                                                                   \n"
+    "    </ParameterList>                                                                     \n"
+    "  </ParameterList>                                                                       \n"
+    "  <Parameter name='Physics'          type='string'  value='Mechanical'/>                 \n"
+    "  <Parameter name='PDE Constraint'   type='string'  value='Elliptic'/>                   \n"
+    "  <ParameterList name='Material Models'>                                                 \n"
+    "    <ParameterList name='Unobtainium'>                                                   \n"
+    "      <ParameterList name='Isotropic Linear Elastic'>                                    \n"
+    "        <Parameter  name='Poissons Ratio' type='double' value='0.3'/>                    \n"
+    "        <Parameter  name='Youngs Modulus' type='double' value='1.0e6'/>                  \n"
+    "      </ParameterList>                                                                   \n"
+    "    </ParameterList>                                                                     \n"
+    "  </ParameterList>                                                                       \n"
+    "  <ParameterList name='Elliptic'>                                                        \n"
+    "    <ParameterList name='Penalty Function'>                                              \n"
+    "      <Parameter name='Type' type='string' value='SIMP'/>                                \n"
+    "      <Parameter name='Exponent' type='double' value='3.0'/>                             \n"
+    "      <Parameter name='Minimum Value' type='double' value='0.0'/>                        \n"
+    "    </ParameterList>                                                                     \n"
+    "  </ParameterList>                                                                       \n"
+    "  <ParameterList name='Criteria'>                                                        \n"
+    "    <ParameterList name='Internal Energy'>                                               \n"
+    "      <Parameter name='Type' type='string' value='Scalar Function'/>                     \n"
+    "      <Parameter name='Scalar Function Type' type='string' value='Internal Elastic Energy'/>  \n"
+    "    </ParameterList>                                                                     \n"
+    "  </ParameterList>                                                                       \n"
+    "  <ParameterList  name='Essential Boundary Conditions'>                                  \n"
+    "    <ParameterList  name='X Fixed Displacement Boundary Condition'>                      \n"
+    "      <Parameter  name='Type'     type='string' value='Zero Value'/>                     \n"
+    "      <Parameter  name='Index'    type='int'    value='0'/>                              \n"
+    "      <Parameter  name='Sides'    type='string' value='x-'/>                             \n"
+    "    </ParameterList>                                                                     \n"
+    "    <ParameterList  name='Y Fixed Displacement Boundary Condition'>                      \n"
+    "      <Parameter  name='Type'     type='string' value='Zero Value'/>                     \n"
+    "      <Parameter  name='Index'    type='int'    value='1'/>                              \n"
+    "      <Parameter  name='Sides'    type='string' value='y-'/>                             \n"
+    "    </ParameterList>                                                                     \n"
+    "    <ParameterList  name='Z Fixed Displacement Boundary Condition'>                      \n"
+    "      <Parameter  name='Type'     type='string' value='Zero Value'/>                     \n"
+    "      <Parameter  name='Index'    type='int'    value='2'/>                              \n"
+    "      <Parameter  name='Sides'    type='string' value='z-'/>                             \n"
+    "    </ParameterList>                                                                     \n"
+    "    <ParameterList  name='Applied X Displacement Boundary Condition'>                    \n"
+    "      <Parameter  name='Type'     type='string' value='Fixed Value'/>                    \n"
+    "      <Parameter  name='Index'    type='int'    value='0'/>                              \n"
+    "      <Parameter  name='Sides'    type='string' value='x+'/>                             \n"
+    "      <Parameter  name='Value'    type='double' value='" << appliedDisplacement << "'/>  \n"
+    "    </ParameterList>                                                                     \n"
+    "  </ParameterList>                                                                       \n"
+    "</ParameterList>                                                                         \n";
+  tOutfile.close();
+}
+
+std::vector<Plato::Scalar> computeSolutionCacheGradient(std::shared_ptr<Plato::MPMD_App> aApp, std::string valueOp, std::string gradientOp)
+{
+  std::vector<int> localIDs;
+  aApp->exportDataMap(Plato::data::layout_t::SCALAR_FIELD, localIDs);
+
+  aApp->compute(valueOp);
+  aApp->compute(gradientOp);
+
+  FauxSharedField fauxObjGradOut(localIDs.size(),0.0);
+  aApp->exportDataT("Objective Gradient", fauxObjGradOut);
+
+  std::vector<Plato::Scalar> stdObjGradOut(localIDs.size());
+  fauxObjGradOut.getData(stdObjGradOut);
+  return stdObjGradOut;
+}
+
 void objectiveFiniteDifferenceTest(std::shared_ptr<Plato::MPMD_App> aApp, Plato::Scalar& val1, Plato::Scalar& val2, Plato::Scalar tol)
 {
 
@@ -3930,6 +3930,388 @@ TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, StatesStruct)
     }
 }
 
+TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, PrimalHistory_MemoryRoundTrip)
+{
+    constexpr Plato::OrdinalType tNumNodes = 50;
+    constexpr Plato::OrdinalType tNumSteps = 3;
+    constexpr Plato::Scalar tTolerance = 1e-6;
+
+    // step fields: smooth velocity with exact zeros and a pressure with large and negative values
+    std::vector<std::vector<Plato::Fluids::PrimalHistoryField>> tSteps;
+    for(Plato::OrdinalType tStep = 0; tStep < tNumSteps; tStep++)
+    {
+        Plato::ScalarVector tVelocity("velocity", 2*tNumNodes);
+        Plato::ScalarVector tPressure("pressure", tNumNodes);
+        Kokkos::parallel_for("fill", Kokkos::RangePolicy<>(0, tNumNodes), KOKKOS_LAMBDA(const Plato::OrdinalType & aNode)
+        {
+            tVelocity(2*aNode)   = aNode % 10 == 0 ? 0.0 : sin(0.1*aNode) + 0.01*tStep;
+            tVelocity(2*aNode+1) = cos(0.1*aNode) / (1.0 + tStep);
+            tPressure(aNode)     = 1e4*(aNode - 25.0) / (3.0 + tStep);
+        });
+        tSteps.push_back({{"Velocity", tVelocity, 2}, {"Pressure", tPressure, 1}});
+    }
+
+    Plato::FieldTags tFieldTags;
+    tFieldTags.set("Velocity", "current velocity");
+    tFieldTags.set("Pressure", "current pressure");
+
+    std::vector<Plato::Fluids::PrimalHistoryCompression> tCompressions =
+        { Plato::Fluids::PrimalHistoryCompression::NONE,
+          Plato::Fluids::PrimalHistoryCompression::LOSSLESS,
+          Plato::Fluids::PrimalHistoryCompression::BOUNDED };
+    for(auto tCompression : tCompressions)
+    {
+        // the budget holds about one step, the remaining steps are spilled to file
+        Plato::Fluids::MemoryPrimalHistory tHistory(tCompression, tTolerance, 3*tNumNodes*sizeof(Plato::Scalar), "primal_history_test");
+        for(Plato::OrdinalType tStep = 0; tStep < tNumSteps; tStep++)
+        {
+            tHistory.write(tStep, tSteps[tStep]);
+        }
+        tHistory.finalize();
+        TEST_EQUALITY(tNumSteps, tHistory.numSteps());
+        TEST_ASSERT(tHistory.spillBytes() > 0);
+        TEST_ASSERT(tHistory.memoryBytes() <= 3*tNumNodes*sizeof(Plato::Scalar));
+
+        // read in reverse order, as the adjoint sweep does
+        auto tExact = tCompression != Plato::Fluids::PrimalHistoryCompression::BOUNDED;
+        for(Plato::OrdinalType tStep = tNumSteps - 1; tStep >= 0; tStep--)
+        {
+            Plato::Primal tPrimal;
+            tHistory.read(tStep, tFieldTags, tPrimal);
+            for(const auto & tField : tSteps[tStep])
+            {
+                auto tTag = tField.mName == "Velocity" ? "current velocity" : "current pressure";
+                auto tGold = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tField.mData);
+                auto tRead = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tPrimal.vector(tTag));
+                TEST_EQUALITY(tGold.extent(0), tRead.extent(0));
+                for(Plato::OrdinalType tIndex = 0; tIndex < tGold.extent(0); tIndex++)
+                {
+                    if(tExact)
+                    {
+                        TEST_EQUALITY(tGold(tIndex), tRead(tIndex));
+                    }
+                    else
+                    {
+                        TEST_ASSERT(std::abs(tGold(tIndex) - tRead(tIndex)) <= tTolerance);
+                    }
+                }
+            }
+        }
+
+        // the spill file is removed when the history is cleared
+        tHistory.clear();
+        TEST_EQUALITY(0, tHistory.numSteps());
+        TEST_ASSERT(!std::ifstream("primal_history_test").good());
+    }
+
+    // bounded records held in memory take fewer bytes than the raw fields
+    Plato::Fluids::MemoryPrimalHistory tHistory(Plato::Fluids::PrimalHistoryCompression::BOUNDED, 1e-3, 1 << 20, "primal_history_test");
+    for(Plato::OrdinalType tStep = 0; tStep < tNumSteps; tStep++)
+    {
+        tHistory.write(tStep, tSteps[tStep]);
+    }
+    TEST_EQUALITY(0, tHistory.spillBytes());
+    TEST_ASSERT(tHistory.memoryBytes() < tNumSteps*3*tNumNodes*sizeof(Plato::Scalar));
+}
+
+TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, IsothermalFlowOnChannel_Re100_MemoryPrimalHistory)
+{
+    // set xml file inputs
+    Teuchos::RCP<Teuchos::ParameterList> tInputs =
+        Teuchos::getParametersFromXmlString(
+            "<ParameterList name='Plato Problem'>"
+            "  <ParameterList name='Criteria'>"
+            "    <ParameterList name='Volume Criterion'>"
+            "      <Parameter name='Type' type='string' value='Scalar Function'/> "
+            "      <Parameter  name='Domains' type='Array(string)' value='{body}'/>"
+            "      <Parameter name='Scalar Function Type' type='string' value='Volume'/>"
+            "    </ParameterList>"
+            "  </ParameterList>"
+            "  <ParameterList name='Hyperbolic'>"
+            "    <Parameter name='Heat Transfer' type='string' value='None'/>"     
+            "    <Parameter name='Scenario' type='string' value='Density-Based Topology Optimization'/>"
+            "    <ParameterList  name='Momentum Conservation'>"
+            "      <Parameter  name='Stabilization Constant' type='double' value='1'/>"
+            "    </ParameterList>"
+            "  </ParameterList>"
+            "  <ParameterList name='Spatial Model'>"
+            "    <ParameterList name='Domains'>"
+            "      <ParameterList name='Design Volume'>"
+            "        <Parameter name='Element Block' type='string' value='body'/>"
+            "        <Parameter name='Material Model' type='string' value='water'/>"
+            "      </ParameterList>"
+            "    </ParameterList>"
+            "  </ParameterList>"
+            "  <ParameterList name='Material Models'>"
+            "    <ParameterList name='water'>"
+            "      <Parameter  name='Reynolds Number'  type='double'  value='1e2'/>"
+            "      <Parameter  name='Impermeability Number'  type='double'  value='1'/>"
+            "    </ParameterList>"
+            "  </ParameterList>"
+            "  <ParameterList  name='Velocity Essential Boundary Conditions'>"
+            "    <ParameterList  name='X-Dir Inlet Velocity'>"
+            "      <Parameter  name='Type'     type='string' value='Fixed Value'/>"
+            "      <Parameter  name='Value'    type='double' value='1'/>"
+            "      <Parameter  name='Index'    type='int'    value='0'/>"
+            "      <Parameter  name='Sides'    type='string' value='x-'/>"
+            "    </ParameterList>"
+            "    <ParameterList  name='Y-Dir Inlet Velocity'>"
+            "      <Parameter  name='Type'     type='string' value='Fixed Value'/>"
+            "      <Parameter  name='Value'    type='double' value='0'/>"
+            "      <Parameter  name='Index'    type='int'    value='1'/>"
+            "      <Parameter  name='Sides'    type='string' value='x-'/>"
+            "    </ParameterList>"
+            "    <ParameterList  name='X-Dir No-Slip on Y+'>"
+            "      <Parameter  name='Type'     type='string' value='Zero Value'/>"
+            "      <Parameter  name='Index'    type='int'    value='0'/>"
+            "      <Parameter  name='Sides'    type='string' value='y+'/>"
+            "    </ParameterList>"
+            "    <ParameterList  name='Y-Dir No-Slip on Y+'>"
+            "      <Parameter  name='Type'     type='string' value='Zero Value'/>"
+            "      <Parameter  name='Index'    type='int'    value='1'/>"
+            "      <Parameter  name='Sides'    type='string' value='y+'/>"
+            "    </ParameterList>"
+            "    <ParameterList  name='X-Dir No-Slip on Y-'>"
+            "      <Parameter  name='Type'     type='string' value='Zero Value'/>"
+            "      <Parameter  name='Index'    type='int'    value='0'/>"
+            "      <Parameter  name='Sides'    type='string' value='y-'/>"
+            "    </ParameterList>"
+            "    <ParameterList  name='Y-Dir No-Slip on Y-'>"
+            "      <Parameter  name='Type'     type='string' value='Zero Value'/>"
+            "      <Parameter  name='Index'    type='int'    value='1'/>"
+            "      <Parameter  name='Sides'    type='string' value='y-'/>"
+            "    </ParameterList>"
+            "  </ParameterList>"
+            "  <ParameterList  name='Pressure Essential Boundary Conditions'>"
+            "    <ParameterList  name='Outlet Pressure'>"
+            "      <Parameter  name='Type'     type='string' value='Zero Value'/>"
+            "      <Parameter  name='Index'    type='int'    value='0'/>"
+            "      <Parameter  name='Sides'    type='string' value='x+'/>"
+            "    </ParameterList>"
+            "  </ParameterList>"
+            "  <ParameterList  name='Time Integration'>"
+            "    <Parameter name='Safety Factor' type='double' value='0.7'/>"
+            "  </ParameterList>"
+            "  <ParameterList  name='Linear Solver'>"
+            "    <Parameter name='Solver Stack' type='string' value='Epetra'/>"
+            "    <Parameter name='Display Diagnostics' type='bool' value='false'/>"
+            "  </ParameterList>"
+            "  <ParameterList  name='Convergence'>"
+            "    <Parameter name='Output Frequency' type='int' value='1'/>"
+            "    <Parameter name='Steady State Iterations' type='int' value='5'/>"
+            "    <Parameter name='Steady State Tolerance' type='double' value='1e-3'/>"
+            "  </ParameterList>"
+            "</ParameterList>"
+            );
+
+    // build mesh, spatial domain, and spatial model
+    auto tMesh = Plato::TestHelpers::get_box_mesh("TRI3", 10);
+    Plato::SpatialDomain tDomain(tMesh, "box");
+    tDomain.cellOrdinals("body");
+
+    // create communicator
+    MPI_Comm tMyComm;
+    MPI_Comm_dup(MPI_COMM_WORLD, &tMyComm);
+    Plato::Comm::Machine tMachine(tMyComm);
+
+    constexpr auto tSpaceDim = 2;
+    const auto tNumVerts = tMesh->NumNodes();
+    auto tControls = Plato::ScalarVector("Controls", tNumVerts);
+    Plato::blas1::fill(0.5, tControls);
+
+    // gold: exodus primal history
+    Plato::Fluids::QuasiImplicit<Plato::IncompressibleFluids<tSpaceDim>> tGoldProblem(tMesh, *tInputs, tMachine);
+    auto tGoldSolution = tGoldProblem.solution(tControls);
+    auto tGoldValue = tGoldProblem.criterionValue(tControls, "Volume Criterion");
+    auto tGoldGrad = tGoldProblem.criterionGradient(tControls, "Volume Criterion");
+
+    // in-memory primal history, lossless compression, every field spilled to file
+    auto & tHistoryParams = tInputs->sublist("Primal History");
+    tHistoryParams.set<std::string>("Type", "Memory");
+    tHistoryParams.set<std::string>("Compression", "Lossless");
+    tHistoryParams.set<Plato::Scalar>("Memory Budget (MB)", 0.0);
+    Plato::Fluids::QuasiImplicit<Plato::IncompressibleFluids<tSpaceDim>> tProblem(tMesh, *tInputs, tMachine);
+    auto tSolution = tProblem.solution(tControls);
+    auto tValue = tProblem.criterionValue(tControls, "Volume Criterion");
+    auto tGrad = tProblem.criterionGradient(tControls, "Volume Criterion");
+
+    TEST_ASSERT(std::abs(tGoldValue - tValue) <= 1e-12 * (1.0 + std::abs(tGoldValue)));
+    auto tHostGoldGrad = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tGoldGrad);
+    auto tHostGrad = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tGrad);
+    TEST_EQUALITY(tHostGoldGrad.extent(0), tHostGrad.extent(0));
+    for(Plato::OrdinalType tIndex = 0; tIndex < tHostGoldGrad.extent(0); tIndex++)
+    {
+        TEST_ASSERT(std::abs(tHostGoldGrad(tIndex) - tHostGrad(tIndex)) <= 1e-12 * (1.0 + std::abs(tHostGoldGrad(tIndex))));
+    }
+}
+
+namespace
+{
+
+void test_fluid_solutions_match
+(const Plato::Solutions & aSolution,
+ const Plato::Solutions & aGoldSolution,
+ Teuchos::FancyOStream  & out,
+ bool                   & success)
+{
+    std::vector<std::string> tNames = {"velocity", "pressure"};
+    for(const auto & tName : tNames)
+    {
+        auto tHostValues = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), aSolution.get(tName));
+        auto tHostGold = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), aGoldSolution.get(tName));
+        TEST_EQUALITY(tHostGold.extent(0), tHostValues.extent(0));
+        TEST_EQUALITY(tHostGold.extent(1), tHostValues.extent(1));
+        for(Plato::OrdinalType tStep = 0; tStep < tHostGold.extent(0); tStep++)
+        {
+            for(Plato::OrdinalType tDof = 0; tDof < tHostGold.extent(1); tDof++)
+            {
+                TEST_ASSERT(std::abs(tHostGold(tStep, tDof) - tHostValues(tStep, tDof)) <= 1e-8 * (1.0 + std::abs(tHostGold(tStep, tDof))));
+            }
+        }
+    }
+}
+
+}
+
+TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, IsothermalFlowOnChannel_Re100_PressureSolverReuse)
+{
+    // set xml file inputs
+    Teuchos::RCP<Teuchos::ParameterList> tInputs =
+        Teuchos::getParametersFromXmlString(
+            "<ParameterList name='Plato Problem'>"
+            "  <ParameterList name='Hyperbolic'>"
+            "    <Parameter name='Heat Transfer' type='string' value='None'/>"     
+            "    <Parameter name='Scenario' type='string' value='Density-Based Topology Optimization'/>"
+            "    <ParameterList  name='Momentum Conservation'>"
+            "      <Parameter  name='Stabilization Constant' type='double' value='1'/>"
+            "    </ParameterList>"
+            "  </ParameterList>"
+            "  <ParameterList name='Spatial Model'>"
+            "    <ParameterList name='Domains'>"
+            "      <ParameterList name='Design Volume'>"
+            "        <Parameter name='Element Block' type='string' value='body'/>"
+            "        <Parameter name='Material Model' type='string' value='water'/>"
+            "      </ParameterList>"
+            "    </ParameterList>"
+            "  </ParameterList>"
+            "  <ParameterList name='Material Models'>"
+            "    <ParameterList name='water'>"
+            "      <Parameter  name='Reynolds Number'  type='double'  value='1e2'/>"
+            "      <Parameter  name='Impermeability Number'  type='double'  value='1'/>"
+            "    </ParameterList>"
+            "  </ParameterList>"
+            "  <ParameterList  name='Velocity Essential Boundary Conditions'>"
+            "    <ParameterList  name='X-Dir Inlet Velocity'>"
+            "      <Parameter  name='Type'     type='string' value='Fixed Value'/>"
+            "      <Parameter  name='Value'    type='double' value='1'/>"
+            "      <Parameter  name='Index'    type='int'    value='0'/>"
+            "      <Parameter  name='Sides'    type='string' value='x-'/>"
+            "    </ParameterList>"
+            "    <ParameterList  name='Y-Dir Inlet Velocity'>"
+            "      <Parameter  name='Type'     type='string' value='Fixed Value'/>"
+            "      <Parameter  name='Value'    type='double' value='0'/>"
+            "      <Parameter  name='Index'    type='int'    value='1'/>"
+            "      <Parameter  name='Sides'    type='string' value='x-'/>"
+            "    </ParameterList>"
+            "    <ParameterList  name='X-Dir No-Slip on Y+'>"
+            "      <Parameter  name='Type'     type='string' value='Zero Value'/>"
+            "      <Parameter  name='Index'    type='int'    value='0'/>"
+            "      <Parameter  name='Sides'    type='string' value='y+'/>"
+            "    </ParameterList>"
+            "    <ParameterList  name='Y-Dir No-Slip on Y+'>"
+            "      <Parameter  name='Type'     type='string' value='Zero Value'/>"
+            "      <Parameter  name='Index'    type='int'    value='1'/>"
+            "      <Parameter  name='Sides'    type='string' value='y+'/>"
+            "    </ParameterList>"
+            "    <ParameterList  name='X-Dir No-Slip on Y-'>"
+            "      <Parameter  name='Type'     type='string' value='Zero Value'/>"
+            "      <Parameter  name='Index'    type='int'    value='0'/>"
+            "      <Parameter  name='Sides'    type='string' value='y-'/>"
+            "    </ParameterList>"
+            "    <ParameterList  name='Y-Dir No-Slip on Y-'>"
+            "      <Parameter  name='Type'     type='string' value='Zero Value'/>"
+            "      <Parameter  name='Index'    type='int'    value='1'/>"
+            "      <Parameter  name='Sides'    type='string' value='y-'/>"
+            "    </ParameterList>"
+            "  </ParameterList>"
+            "  <ParameterList  name='Pressure Essential Boundary Conditions'>"
+            "    <ParameterList  name='Outlet Pressure'>"
+            "      <Parameter  name='Type'     type='string' value='Zero Value'/>"
+            "      <Parameter  name='Index'    type='int'    value='0'/>"
+            "      <Parameter  name='Sides'    type='string' value='x+'/>"
+            "    </ParameterList>"
+            "  </ParameterList>"
+            "  <ParameterList  name='Time Integration'>"
+            "    <Parameter name='Safety Factor' type='double' value='0.7'/>"
+            "  </ParameterList>"
+            "  <ParameterList  name='Linear Solver'>"
+            "    <Parameter name='Solver Stack' type='string' value='Epetra'/>"
+            "    <Parameter name='Display Diagnostics' type='bool' value='false'/>"
+            "  </ParameterList>"
+            "  <ParameterList  name='Convergence'>"
+            "    <Parameter name='Output Frequency' type='int' value='1'/>"
+            "    <Parameter name='Steady State Iterations' type='int' value='5'/>"
+            "    <Parameter name='Steady State Tolerance' type='double' value='1e-3'/>"
+            "  </ParameterList>"
+            "</ParameterList>"
+            );
+
+    // build mesh and communicator
+    auto tMesh = Plato::TestHelpers::get_box_mesh("TRI3", 10);
+    MPI_Comm tMyComm;
+    MPI_Comm_dup(MPI_COMM_WORLD, &tMyComm);
+    Plato::Comm::Machine tMachine(tMyComm);
+
+    constexpr auto tSpaceDim = 2;
+    using ProblemT = Plato::Fluids::QuasiImplicit<Plato::IncompressibleFluids<tSpaceDim>>;
+    const auto tNumVerts = tMesh->NumNodes();
+    auto tControls = Plato::ScalarVector("Controls", tNumVerts);
+    Plato::blas1::fill(0.5, tControls);
+
+    // the pressure operator only depends on the configuration, so it is set up once by the first solve
+    ProblemT tProblem(tMesh, *tInputs, tMachine);
+    TEST_EQUALITY(0, tProblem.getNumPressureOperatorSetups());
+    tProblem.solution(tControls);
+    TEST_EQUALITY(1, tProblem.getNumPressureOperatorSetups());
+
+    // same controls: no new setup, same solution as a fresh solver
+    auto tSecondSolution = tProblem.solution(tControls);
+    TEST_EQUALITY(1, tProblem.getNumPressureOperatorSetups());
+    {
+        ProblemT tGoldProblem(tMesh, *tInputs, tMachine);
+        auto tGoldSolution = tGoldProblem.solution(tControls);
+        test_fluid_solutions_match(tSecondSolution, tGoldSolution, out, success);
+    }
+
+    // changed controls: the pressure operator is unchanged and is reused, while the
+    // control dependent predictor and corrector operators are set up each time step
+    Plato::blas1::fill(0.75, tControls);
+    auto tThirdSolution = tProblem.solution(tControls);
+    TEST_EQUALITY(1, tProblem.getNumPressureOperatorSetups());
+    {
+        ProblemT tGoldProblem(tMesh, *tInputs, tMachine);
+        auto tGoldSolution = tGoldProblem.solution(tControls);
+        test_fluid_solutions_match(tThirdSolution, tGoldSolution, out, success);
+    }
+
+    // changed configuration: the pressure operator changes, thus it is set up again
+    auto tHostCoords = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tMesh->Coordinates());
+    for(Plato::OrdinalType tNode = 0; tNode < tNumVerts; tNode++)
+    {
+        tHostCoords(tNode * tSpaceDim) *= 2.0;
+    }
+    Plato::ScalarVector tCoords("coordinates", tHostCoords.extent(0));
+    Kokkos::deep_copy(tCoords, tHostCoords);
+    tMesh->SetCoordinates(tCoords);
+    auto tFourthSolution = tProblem.solution(tControls);
+    TEST_EQUALITY(2, tProblem.getNumPressureOperatorSetups());
+    {
+        ProblemT tGoldProblem(tMesh, *tInputs, tMachine);
+        auto tGoldSolution = tGoldProblem.solution(tControls);
+        test_fluid_solutions_match(tFourthSolution, tGoldSolution, out, success);
+    }
+}
+
 TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, CleanTrash)
 {
     auto tSysMsg = std::system("rm -rf cfd_solver_diagnostics.txt solution_history");
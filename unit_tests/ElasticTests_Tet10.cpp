@@ -817,6 +817,50 @@ TEUCHOS_UNIT_TEST( Tet10, ElastostaticResidual3D_NaturalBC )
   }
 } 
 
+/******************************************************************************/
+/*! 
+  \brief Test boundary workset cells, i.e., the sorted parent cells of a side
+         set and the map from mesh cells to boundary workset rows.
+*/
+/******************************************************************************/
+TEUCHOS_UNIT_TEST( Tet10, BoundaryWorksetCells )
+{
+  constexpr int meshWidth=2;
+  auto tMesh = Plato::TestHelpers::get_box_mesh("TET10", meshWidth);
+  Plato::SpatialModel tSpatialModel(tMesh);
+
+  auto tCells = tSpatialModel.sideSetCells({"x+", "x+"});
+  auto tCellsHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tCells);
+  auto tElementOrds = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tMesh->GetSideSetElements("x+"));
+  TEST_ASSERT(tCellsHost.extent(0) > 0);
+  TEST_ASSERT(tCellsHost.extent(0) <= tElementOrds.extent(0));
+  TEST_ASSERT(tCellsHost.extent(0) < Plato::OrdinalType(tMesh->NumElements()));
+  for(Plato::OrdinalType i=1; i<Plato::OrdinalType(tCellsHost.extent(0)); i++)
+  {
+    TEST_ASSERT(tCellsHost(i-1) < tCellsHost(i));
+  }
+
+  // every side set face maps to the workset row holding its parent cell
+  auto tNumFaces = tElementOrds.extent(0);
+  Plato::OrdinalVector tRows("rows", tNumFaces);
+  Plato::OrdinalVector tIdentity("identity", tNumFaces);
+  Plato::OrdinalVector tWholeMesh;
+  auto tElementOrdsDevice = tMesh->GetSideSetElements("x+");
+  Kokkos::parallel_for(Kokkos::RangePolicy<>(0, tNumFaces), KOKKOS_LAMBDA(const Plato::OrdinalType & aOrdinal)
+  {
+    tRows(aOrdinal) = Plato::workset_cell_ordinal(tCells, tElementOrdsDevice(aOrdinal));
+    tIdentity(aOrdinal) = Plato::workset_cell_ordinal(tWholeMesh, tElementOrdsDevice(aOrdinal));
+  });
+  auto tRowsHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tRows);
+  auto tIdentityHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tIdentity);
+  for(Plato::OrdinalType i=0; i<Plato::OrdinalType(tNumFaces); i++)
+  {
+    TEST_EQUALITY(tCellsHost(tRowsHost(i)), tElementOrds(i));
+    TEST_EQUALITY(tIdentityHost(i), tElementOrds(i));
+  }
+  TEST_EQUALITY(tSpatialModel.boundaryWorksetCells().extent(0), 0);
+}
+
 /******************************************************************************/
 /*! 
   \brief Test natural BCs in ElastostaticResidual in 3D.
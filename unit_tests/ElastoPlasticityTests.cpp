@@ -4727,4 +4727,349 @@ TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, ElastoPlasticity_TestWeightedSumCriteri
     if(false){ std::cout << std::to_string(tSysMsg) << "\n"; }
 }
 
+TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, ElastoPlasticity_AdaptiveTimeStepping_CutbackAndGradientZ_2D)
+{
+    // 1. DEFINE PROBLEM: THE NOMINAL SINGLE STEP LOADS THE BODY TEN TIMES PAST YIELD,
+    //    NEWTON-RAPHSON CANNOT CONVERGE IT WITHIN THREE ITERATIONS
+    constexpr Plato::OrdinalType tSpaceDim = 2;
+    constexpr Plato::OrdinalType tMeshWidth = 2;
+    auto tMesh = Plato::TestHelpers::get_box_mesh("TRI3", tMeshWidth);
+
+    Teuchos::RCP<Teuchos::ParameterList> tParamList =
+    Teuchos::getParametersFromXmlString(
+      "<ParameterList name='Plato Problem'>                                                     \n"
+      "  <ParameterList name='Spatial Model'>                                                   \n"
+      "    <ParameterList name='Domains'>                                                       \n"
+      "      <ParameterList name='Design Volume'>                                               \n"
+      "        <Parameter name='Element Block' type='string' value='body'/>                     \n"
+      "        <Parameter name='Material Model' type='string' value='Unobtainium'/>             \n"
+      "      </ParameterList>                                                                   \n"
+      "    </ParameterList>                                                                     \n"
+      "  </ParameterList>                                                                       \n"
+      "  <Parameter name='Physics'          type='string'  value='Plasticity'/>                 \n"
+      "  <Parameter name='PDE Constraint'   type='string'  value='Elliptic'/>                   \n"
+      "    <ParameterList name='Linear Solver'>                                                 \n"
+      "      <Parameter name='Solver Package' type='string' value='amesos2'/>                   \n"
+      "    </ParameterList>                                                                     \n"
+      "  <ParameterList name='Material Models'>                                                 \n"
+      "    <ParameterList name='Unobtainium'>                                                   \n"
+      "      <ParameterList name='Isotropic Linear Elastic'>                                      \n"
+      "        <Parameter  name='Density' type='double' value='1000'/>                            \n"
+      "        <Parameter  name='Poissons Ratio' type='double' value='0.3'/>                      \n"
+      "        <Parameter  name='Youngs Modulus' type='double' value='1.0e6'/>                    \n"
+      "      </ParameterList>                                                                     \n"
+      "      <ParameterList name='Plasticity Model'>                                                \n"
+      "        <ParameterList name='J2 Plasticity'>                                                 \n"
+      "          <Parameter  name='Hardening Modulus Isotropic' type='double' value='1.0e5'/>       \n"
+      "          <Parameter  name='Hardening Modulus Kinematic' type='double' value='1.0e-8'/>       \n"
+      "          <Parameter  name='Initial Yield Stress' type='double' value='1.0e3'/>              \n"
+      "          <Parameter  name='Elastic Properties Penalty Exponent' type='double' value='2'/>   \n"
+      "          <Parameter  name='Elastic Properties Minimum Ersatz' type='double' value='1e-9'/>  \n"
+      "          <Parameter  name='Plastic Properties Penalty Exponent' type='double' value='1.5'/> \n"
+      "          <Parameter  name='Plastic Properties Minimum Ersatz' type='double' value='1e-4'/>  \n"
+      "        </ParameterList>                                                                     \n"
+      "      </ParameterList>                                                                       \n"
+      "    </ParameterList>                                                                       \n"
+      "  </ParameterList>                                                                       \n"
+      "  <ParameterList name='Elliptic'>                                                        \n"
+      "    <ParameterList name='Penalty Function'>                                              \n"
+      "      <Parameter name='Type' type='string' value='SIMP'/>                                \n"
+      "      <Parameter name='Exponent' type='double' value='2.0'/>                             \n"
+      "      <Parameter name='Minimum Value' type='double' value='1.0e-9'/>                     \n"
+      "    </ParameterList>                                                                     \n"
+      "  </ParameterList>                                                                       \n"
+      "  <ParameterList name='Criteria'>                                                        \n"
+      "    <ParameterList name='Plastic Work'>                                                  \n"
+      "      <Parameter name='Type'                 type='string' value='Scalar Function'/>     \n"
+      "      <Parameter name='Scalar Function Type' type='string' value='Elastic Work'/>        \n"
+      "      <Parameter name='Multiplier'           type='double' value='-1.0'/>                \n"
+      "      <Parameter name='Exponent'             type='double' value='2.0'/>                 \n"
+      "      <Parameter name='Minimum Value'        type='double' value='1.0e-9'/>              \n"
+      "    </ParameterList>                                                                     \n"
+      "  </ParameterList>                                                                       \n"
+      "  <ParameterList name='Time Stepping'>                                                   \n"
+      "    <Parameter name='Initial Num. Pseudo Time Steps' type='int' value='1'/>              \n"
+      "    <Parameter name='Maximum Num. Pseudo Time Steps' type='int' value='64'/>             \n"
+      "    <Parameter name='Expansion Multiplier' type='double' value='2.0'/>                   \n"
+      "    <Parameter name='Adaptive Time Stepping' type='bool' value='true'/>                  \n"
+      "    <Parameter name='Easy Convergence Iterations' type='int' value='3'/>                 \n"
+      "  </ParameterList>                                                                       \n"
+      "  <ParameterList name='Newton-Raphson'>                                                  \n"
+      "    <Parameter name='Stop Measure' type='string' value='residual'/>                      \n"
+      "    <Parameter name='Maximum Number Iterations' type='int' value='3'/>                   \n"
+      "  </ParameterList>                                                                       \n"
+      "   <ParameterList  name='Essential Boundary Conditions'>                                 \n"
+      "     <ParameterList  name='X Fixed Displacement Boundary Condition'>                     \n"
+      "       <Parameter  name='Type'     type='string' value='Zero Value'/>                    \n"
+      "       <Parameter  name='Index'    type='int'    value='0'/>                             \n"
+      "       <Parameter  name='Sides'    type='string' value='x-'/>                         \n"
+      "     </ParameterList>                                                                    \n"
+      "     <ParameterList  name='Y Fixed Displacement Boundary Condition'>                     \n"
+      "       <Parameter  name='Type'     type='string' value='Zero Value'/>                    \n"
+      "       <Parameter  name='Index'    type='int'    value='1'/>                             \n"
+      "       <Parameter  name='Sides'    type='string' value='x-'/>                         \n"
+      "     </ParameterList>                                                                    \n"
+      "     <ParameterList  name='Applied Displacement Boundary Condition'>                     \n"
+      "       <Parameter  name='Type'     type='string' value='Time Dependent'/>                \n"
+      "       <Parameter  name='Index'    type='int'    value='0'/>                             \n"
+      "       <Parameter  name='Sides'    type='string' value='x+'/>                         \n"
+      "       <Parameter  name='Function' type='string' value='0.01*t'/>                        \n"
+      "     </ParameterList>                                                                    \n"
+      "   </ParameterList>                                                                      \n"
+      "</ParameterList>                                                                         \n"
+    );
+
+    MPI_Comm myComm;
+    MPI_Comm_dup(MPI_COMM_WORLD, &myComm);
+    Plato::Comm::Machine tMachine(myComm);
+
+    using PhysicsT = Plato::InfinitesimalStrainPlasticity<tSpaceDim>;
+    Plato::PlasticityProblem<PhysicsT> tPlasticityProblem(tMesh, *tParamList, tMachine);
+    tPlasticityProblem.readEssentialBoundaryConditions(*tParamList);
+
+    // 2. SOLVE FORWARD PROBLEM
+    const Plato::OrdinalType tNumVerts = tMesh->NumNodes();
+    Plato::ScalarVector tControls("Controls", tNumVerts);
+    Plato::blas1::fill(0.5, tControls);
+    auto tSolution = tPlasticityProblem.solution(tControls);
+    std::string tCriterionName("Plastic Work");
+    TEST_NOTHROW(tPlasticityProblem.criterionValue(tControls, tSolution, tCriterionName));
+
+    // 3. TEST STEP SEQUENCE: CUTBACK, RESUME AND REGROWTH
+    const auto & tTimeData = tPlasticityProblem.getTimeData();
+    const auto & tTimes = tTimeData.mTimeHistory;
+    TEST_ASSERT(tTimeData.mNumTimeSteps > static_cast<Plato::OrdinalType>(1));
+    TEST_EQUALITY(static_cast<Plato::OrdinalType>(tTimes.size()), tTimeData.mNumTimeSteps);
+    TEST_EQUALITY(static_cast<Plato::OrdinalType>(tSolution.get("State").extent(0)), tTimeData.mNumTimeSteps);
+    TEST_FLOATING_EQUALITY(tTimes.back(), tTimeData.mEndTime, 1e-12);
+
+    // the failing nominal step is cut back by powers of the expansion multiplier
+    const Plato::Scalar tFirstStepSize = tTimes.front() - tTimeData.mStartTime;
+    TEST_ASSERT(tFirstStepSize < tTimeData.mEndTime);
+    const Plato::Scalar tNumCutbacks = std::log2(tTimeData.mEndTime / tFirstStepSize);
+    TEST_FLOATING_EQUALITY(tNumCutbacks, std::round(tNumCutbacks), 1e-12);
+
+    // each step starts at the end time of the last accepted step, at least one step grows back
+    bool tStepGrew = false;
+    Plato::Scalar tPreviousStepSize = tFirstStepSize;
+    for(Plato::OrdinalType tIndex = 1; tIndex < tTimeData.mNumTimeSteps; tIndex++)
+    {
+        const Plato::Scalar tStepSize = tTimes[tIndex] - tTimes[tIndex - 1];
+        TEST_ASSERT(tStepSize >= tTimeData.mEndTime / static_cast<Plato::Scalar>(tTimeData.mMaxNumTimeSteps) * (1.0 - 1e-12));
+        TEST_ASSERT(tStepSize <= tTimeData.mEndTime * (1.0 + 1e-12));
+        tStepGrew = tStepGrew || (tStepSize > tPreviousStepSize * (1.0 + 1e-12));
+        tPreviousStepSize = tStepSize;
+    }
+    TEST_ASSERT(tStepGrew);
+
+    // the first accepted step restarts from the initial state, it matches a uniform solve with the cut back step size
+    Teuchos::ParameterList tUniformParamList(*tParamList);
+    const auto tNumUniformSteps = static_cast<Plato::OrdinalType>(std::round(tTimeData.mEndTime / tFirstStepSize));
+    tUniformParamList.sublist("Time Stepping").set<bool>("Adaptive Time Stepping", false);
+    tUniformParamList.sublist("Time Stepping").set<int>("Initial Num. Pseudo Time Steps", tNumUniformSteps);
+    tUniformParamList.sublist("Time Stepping").set<int>("Maximum Num. Pseudo Time Steps", tNumUniformSteps);
+    tUniformParamList.sublist("Newton-Raphson").set<int>("Maximum Number Iterations", 20);
+    Plato::PlasticityProblem<PhysicsT> tUniformProblem(tMesh, tUniformParamList, tMachine);
+    tUniformProblem.readEssentialBoundaryConditions(tUniformParamList);
+    auto tUniformSolution = tUniformProblem.solution(tControls);
+
+    auto tAdaptiveState = Kokkos::subview(tSolution.get("State"), 0, Kokkos::ALL());
+    auto tHostAdaptiveState = Kokkos::create_mirror(tAdaptiveState);
+    Kokkos::deep_copy(tHostAdaptiveState, tAdaptiveState);
+    auto tUniformState = Kokkos::subview(tUniformSolution.get("State"), 0, Kokkos::ALL());
+    auto tHostUniformState = Kokkos::create_mirror(tUniformState);
+    Kokkos::deep_copy(tHostUniformState, tUniformState);
+    TEST_EQUALITY(tHostAdaptiveState.extent(0), tHostUniformState.extent(0));
+    for(Plato::OrdinalType tIndex = 0; tIndex < tHostAdaptiveState.extent(0); tIndex++)
+    {
+        const Plato::Scalar tMagnitude = std::max(std::abs(tHostAdaptiveState(tIndex)), std::abs(tHostUniformState(tIndex)));
+        TEST_ASSERT(std::abs(tHostAdaptiveState(tIndex) - tHostUniformState(tIndex)) <= 1e-8 * tMagnitude + 1e-12);
+    }
+
+    // 4. TEST CRITERION GRADIENT ON THE VARIABLE STEP HISTORY
+    auto tApproxError = Plato::test_criterion_grad_wrt_control(tPlasticityProblem, tMesh, tCriterionName);
+    TEST_ASSERT(tPlasticityProblem.getTimeData().mNumTimeSteps > static_cast<Plato::OrdinalType>(1));
+    constexpr Plato::Scalar tUpperBound = 1e-6;
+    TEST_ASSERT(tApproxError < tUpperBound);
+    auto tSysMsg = std::system("rm -f plato_analyze_newton_raphson_diagnostics.txt");
+    if(false){ std::cout << std::to_string(tSysMsg) << "\n"; }
+}
+
+
+TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, ElastoPlasticity_CheckpointedAdjoint_2D)
+{
+    // 1. DEFINE PROBLEM: SIX PLASTIC PSEUDO TIME STEPS
+    constexpr Plato::OrdinalType tSpaceDim = 2;
+    constexpr Plato::OrdinalType tMeshWidth = 2;
+    auto tMesh = Plato::TestHelpers::get_box_mesh("TRI3", tMeshWidth);
+
+    Teuchos::RCP<Teuchos::ParameterList> tParamList =
+    Teuchos::getParametersFromXmlString(
+      "<ParameterList name='Plato Problem'>                                                     \n"
+      "  <ParameterList name='Spatial Model'>                                                   \n"
+      "    <ParameterList name='Domains'>                                                       \n"
+      "      <ParameterList name='Design Volume'>                                               \n"
+      "        <Parameter name='Element Block' type='string' value='body'/>                     \n"
+      "        <Parameter name='Material Model' type='string' value='Unobtainium'/>             \n"
+      "      </ParameterList>                                                                   \n"
+      "    </ParameterList>                                                                     \n"
+      "  </ParameterList>                                                                       \n"
+      "  <Parameter name='Physics'          type='string'  value='Plasticity'/>                 \n"
+      "  <Parameter name='PDE Constraint'   type='string'  value='Elliptic'/>                   \n"
+      "    <ParameterList name='Linear Solver'>                                                 \n"
+      "      <Parameter name='Solver Package' type='string' value='amesos2'/>                   \n"
+      "    </ParameterList>                                                                     \n"
+      "  <ParameterList name='Material Models'>                                                 \n"
+      "    <ParameterList name='Unobtainium'>                                                   \n"
+      "      <ParameterList name='Isotropic Linear Elastic'>                                      \n"
+      "        <Parameter  name='Density' type='double' value='1000'/>                            \n"
+      "        <Parameter  name='Poissons Ratio' type='double' value='0.3'/>                      \n"
+      "        <Parameter  name='Youngs Modulus' type='double' value='1.0e6'/>                    \n"
+      "      </ParameterList>                                                                     \n"
+      "      <ParameterList name='Plasticity Model'>                                                \n"
+      "        <ParameterList name='J2 Plasticity'>                                                 \n"
+      "          <Parameter  name='Hardening Modulus Isotropic' type='double' value='1.0e5'/>       \n"
+      "          <Parameter  name='Hardening Modulus Kinematic' type='double' value='1.0e-8'/>       \n"
+      "          <Parameter  name='Initial Yield Stress' type='double' value='1.0e3'/>              \n"
+      "          <Parameter  name='Elastic Properties Penalty Exponent' type='double' value='2'/>   \n"
+      "          <Parameter  name='Elastic Properties Minimum Ersatz' type='double' value='1e-9'/>  \n"
+      "          <Parameter  name='Plastic Properties Penalty Exponent' type='double' value='1.5'/> \n"
+      "          <Parameter  name='Plastic Properties Minimum Ersatz' type='double' value='1e-4'/>  \n"
+      "        </ParameterList>                                                                     \n"
+      "      </ParameterList>                                                                       \n"
+      "    </ParameterList>                                                                       \n"
+      "  </ParameterList>                                                                       \n"
+      "  <ParameterList name='Elliptic'>                                                        \n"
+      "    <ParameterList name='Penalty Function'>                                              \n"
+      "      <Parameter name='Type' type='string' value='SIMP'/>                                \n"
+      "      <Parameter name='Exponent' type='double' value='2.0'/>                             \n"
+      "      <Parameter name='Minimum Value' type='double' value='1.0e-9'/>                     \n"
+      "    </ParameterList>                                                                     \n"
+      "  </ParameterList>                                                                       \n"
+      "  <ParameterList name='Criteria'>                                                        \n"
+      "    <ParameterList name='Plastic Work'>                                                  \n"
+      "      <Parameter name='Type'                 type='string' value='Scalar Function'/>     \n"
+      "      <Parameter name='Scalar Function Type' type='string' value='Elastic Work'/>        \n"
+      "      <Parameter name='Multiplier'           type='double' value='-1.0'/>                \n"
+      "      <Parameter name='Exponent'             type='double' value='2.0'/>                 \n"
+      "      <Parameter name='Minimum Value'        type='double' value='1.0e-9'/>              \n"
+      "    </ParameterList>                                                                     \n"
+      "  </ParameterList>                                                                       \n"
+      "  <ParameterList name='Time Stepping'>                                                   \n"
+      "    <Parameter name='Initial Num. Pseudo Time Steps' type='int' value='6'/>              \n"
+      "    <Parameter name='Maximum Num. Pseudo Time Steps' type='int' value='6'/>              \n"
+      "  </ParameterList>                                                                       \n"
+      "  <ParameterList name='Newton-Raphson'>                                                  \n"
+      "    <Parameter name='Stop Measure' type='string' value='residual'/>                      \n"
+      "    <Parameter name='Maximum Number Iterations' type='int' value='20'/>                  \n"
+      "  </ParameterList>                                                                       \n"
+      "   <ParameterList  name='Essential Boundary Conditions'>                                 \n"
+      "     <ParameterList  name='X Fixed Displacement Boundary Condition'>                     \n"
+      "       <Parameter  name='Type'     type='string' value='Zero Value'/>                    \n"
+      "       <Parameter  name='Index'    type='int'    value='0'/>                             \n"
+      "       <Parameter  name='Sides'    type='string' value='x-'/>                         \n"
+      "     </ParameterList>                                                                    \n"
+      "     <ParameterList  name='Y Fixed Displacement Boundary Condition'>                     \n"
+      "       <Parameter  name='Type'     type='string' value='Zero Value'/>                    \n"
+      "       <Parameter  name='Index'    type='int'    value='1'/>                             \n"
+      "       <Parameter  name='Sides'    type='string' value='x-'/>                         \n"
+      "     </ParameterList>                                                                    \n"
+      "     <ParameterList  name='Applied Displacement Boundary Condition'>                     \n"
+      "       <Parameter  name='Type'     type='string' value='Time Dependent'/>                \n"
+      "       <Parameter  name='Index'    type='int'    value='0'/>                             \n"
+      "       <Parameter  name='Sides'    type='string' value='x+'/>                         \n"
+      "       <Parameter  name='Function' type='string' value='0.01*t'/>                        \n"
+      "     </ParameterList>                                                                    \n"
+      "   </ParameterList>                                                                      \n"
+      "</ParameterList>                                                                         \n"
+    );
+
+    MPI_Comm myComm;
+    MPI_Comm_dup(MPI_COMM_WORLD, &myComm);
+    Plato::Comm::Machine tMachine(myComm);
+
+    // 2. SOLVE WITH THE FULL STATE HISTORY
+    using PhysicsT = Plato::InfinitesimalStrainPlasticity<tSpaceDim>;
+    const Plato::OrdinalType tNumVerts = tMesh->NumNodes();
+    Plato::ScalarVector tControls("Controls", tNumVerts);
+    Plato::blas1::fill(0.5, tControls);
+    std::string tCriterionName("Plastic Work");
+
+    Plato::PlasticityProblem<PhysicsT> tFullProblem(tMesh, *tParamList, tMachine);
+    tFullProblem.readEssentialBoundaryConditions(*tParamList);
+    auto tFullSolution = tFullProblem.solution(tControls);
+    auto tFullValue = tFullProblem.criterionValue(tControls, tFullSolution, tCriterionName);
+    auto tFullGradZ = tFullProblem.criterionGradient(tControls, tFullSolution, tCriterionName);
+    auto tFullGradX = tFullProblem.criterionGradientX(tControls, tFullSolution, tCriterionName);
+    const Plato::OrdinalType tNumSteps = tFullSolution.get("State").extent(0);
+    TEST_EQUALITY(tNumSteps, 6);
+
+    auto tHostFullState = Kokkos::create_mirror(tFullSolution.get("State"));
+    Kokkos::deep_copy(tHostFullState, tFullSolution.get("State"));
+    auto tHostFullGradZ = Kokkos::create_mirror(tFullGradZ);
+    Kokkos::deep_copy(tHostFullGradZ, tFullGradZ);
+    auto tHostFullGradX = Kokkos::create_mirror(tFullGradX);
+    Kokkos::deep_copy(tHostFullGradX, tFullGradX);
+
+    // 3. TEST CHECKPOINTED SOLVES: THE SAME VALUE, LAST STATE AND GRADIENTS
+    for(int tNumCheckpoints : {1, 3})
+    {
+        Teuchos::ParameterList tCheckpointParamList(*tParamList);
+        tCheckpointParamList.sublist("Time Stepping").set<int>("Checkpoints", tNumCheckpoints);
+        Plato::PlasticityProblem<PhysicsT> tProblem(tMesh, tCheckpointParamList, tMachine);
+        tProblem.readEssentialBoundaryConditions(tCheckpointParamList);
+        auto tSolution = tProblem.solution(tControls);
+
+        auto tValue = tProblem.criterionValue(tControls, tSolution, tCriterionName);
+        TEST_FLOATING_EQUALITY(tValue, tFullValue, 1e-10);
+
+        // only the last two time steps are stored
+        auto tState = tSolution.get("State");
+        TEST_EQUALITY(tState.extent(0), 2);
+        auto tHostState = Kokkos::create_mirror(tState);
+        Kokkos::deep_copy(tHostState, tState);
+        for(Plato::OrdinalType tIndex = 0; tIndex < tHostState.extent(1); tIndex++)
+        {
+            const Plato::Scalar tMagnitude = std::abs(tHostFullState(tNumSteps-1, tIndex));
+            TEST_ASSERT(std::abs(tHostState(1, tIndex) - tHostFullState(tNumSteps-1, tIndex)) <= 1e-10 * tMagnitude + 1e-14);
+        }
+
+        auto tGradZ = tProblem.criterionGradient(tControls, tSolution, tCriterionName);
+        auto tHostGradZ = Kokkos::create_mirror(tGradZ);
+        Kokkos::deep_copy(tHostGradZ, tGradZ);
+        Plato::Scalar tMaxGradZ = 0.0;
+        for(Plato::OrdinalType tIndex = 0; tIndex < tHostFullGradZ.extent(0); tIndex++)
+        {
+            tMaxGradZ = std::max(tMaxGradZ, std::abs(tHostFullGradZ(tIndex)));
+        }
+        for(Plato::OrdinalType tIndex = 0; tIndex < tHostFullGradZ.extent(0); tIndex++)
+        {
+            TEST_ASSERT(std::abs(tHostGradZ(tIndex) - tHostFullGradZ(tIndex)) <= 1e-8 * tMaxGradZ);
+        }
+
+        auto tGradX = tProblem.criterionGradientX(tControls, tSolution, tCriterionName);
+        auto tHostGradX = Kokkos::create_mirror(tGradX);
+        Kokkos::deep_copy(tHostGradX, tGradX);
+        Plato::Scalar tMaxGradX = 0.0;
+        for(Plato::OrdinalType tIndex = 0; tIndex < tHostFullGradX.extent(0); tIndex++)
+        {
+            tMaxGradX = std::max(tMaxGradX, std::abs(tHostFullGradX(tIndex)));
+        }
+        for(Plato::OrdinalType tIndex = 0; tIndex < tHostFullGradX.extent(0); tIndex++)
+        {
+            TEST_ASSERT(std::abs(tHostGradX(tIndex) - tHostFullGradX(tIndex)) <= 1e-8 * tMaxGradX);
+        }
+    }
+
+    // 4. CHECKPOINTS ARE REJECTED WITH ADAPTIVE TIME STEPPING
+    Teuchos::ParameterList tAdaptiveParamList(*tParamList);
+    tAdaptiveParamList.sublist("Time Stepping").set<int>("Checkpoints", 3);
+    tAdaptiveParamList.sublist("Time Stepping").set<bool>("Adaptive Time Stepping", true);
+    tAdaptiveParamList.sublist("Time Stepping").set<double>("Expansion Multiplier", 2.0);
+    TEST_THROW(Plato::PlasticityProblem<PhysicsT> tAdaptiveProblem(tMesh, tAdaptiveParamList, tMachine), std::runtime_error);
+
+    auto tSysMsg = std::system("rm -f plato_analyze_newton_raphson_diagnostics.txt");
+    if(false){ std::cout << std::to_string(tSysMsg) << "\n"; }
+}
+
 }
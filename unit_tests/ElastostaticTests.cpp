@@ -456,6 +456,199 @@ TEUCHOS_UNIT_TEST( ElastostaticTests, Residual3D )
 
 }
 
+/******************************************************************************/
+/*! 
+  \brief Evaluate the elastostatic residual and its jacobians in cell batches
+         and compare against the unbatched evaluation.
+*/
+/******************************************************************************/
+TEUCHOS_UNIT_TEST( ElastostaticTests, CellBatchedAssembly3D )
+{
+  // create test mesh
+  //
+  constexpr int meshWidth=2;
+  constexpr int spaceDim = Plato::Tet4::mNumSpatialDims;
+  auto tMesh = Plato::TestHelpers::get_box_mesh("TET4", meshWidth);
+
+  // create database
+  //
+  Plato::Database tDatabase;
+  Plato::ScalarVector z("controls", tMesh->NumNodes());
+  Kokkos::deep_copy(z, 0.9);
+  tDatabase.vector("controls",z);
+
+  std::vector<Plato::Scalar> u_host( spaceDim*tMesh->NumNodes() );
+  Plato::Scalar disp = 0.0, dval = 0.0001;
+  for( auto& val : u_host ) val = (disp += dval);
+  Kokkos::View<Plato::Scalar*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+    u_host_view(u_host.data(),u_host.size());
+  auto u = Kokkos::create_mirror_view_and_copy( Kokkos::DefaultExecutionSpace(), u_host_view);
+  tDatabase.vector("states",u);
+
+  // create input
+  //
+  Teuchos::RCP<Teuchos::ParameterList> tParamList =
+    Teuchos::getParametersFromXmlString(
+    "<ParameterList name='Plato Problem'>                                             \n"
+    "  <ParameterList name='Spatial Model'>                                           \n"
+    "    <ParameterList name='Domains'>                                               \n"
+    "      <ParameterList name='Design Volume'>                                       \n"
+    "        <Parameter name='Element Block' type='string' value='body'/>             \n"
+    "        <Parameter name='Material Model' type='string' value='Unobtainium'/>     \n"
+    "      </ParameterList>                                                           \n"
+    "    </ParameterList>                                                             \n"
+    "  </ParameterList>                                                               \n"
+    "  <Parameter name='PDE Constraint' type='string' value='Elliptic'/>              \n"
+    "  <ParameterList name='Elliptic'>                                                \n"
+    "    <ParameterList name='Penalty Function'>                                      \n"
+    "      <Parameter name='Exponent' type='double' value='3.0'/>                     \n"
+    "      <Parameter name='Minimum Value' type='double' value='0.0'/>                \n"
+    "      <Parameter name='Type' type='string' value='SIMP'/>                        \n"
+    "    </ParameterList>                                                             \n"
+    "  </ParameterList>                                                               \n"
+    "  <ParameterList name='Material Models'>                                         \n"
+    "    <ParameterList name='Unobtainium'>                                           \n"
+    "      <ParameterList name='Isotropic Linear Elastic'>                            \n"
+    "        <Parameter name='Poissons Ratio' type='double' value='0.3'/>             \n"
+    "        <Parameter name='Youngs Modulus' type='double' value='1.0e6'/>           \n"
+    "      </ParameterList>                                                           \n"
+    "    </ParameterList>                                                             \n"
+    "  </ParameterList>                                                               \n"
+    "</ParameterList>                                                                 \n"
+  );
+
+  Plato::DataMap tDataMap;
+  Plato::SpatialModel tSpatialModel(tMesh, *tParamList, tDataMap);
+  auto tNumDomainCells = tSpatialModel.Domains.front().numCells();
+
+  using VectorFunctionT = Plato::Elliptic::VectorFunction<Plato::Elliptic::Linear::Mechanics<Plato::Tet4>>;
+  auto tTypePDE = tParamList->get<std::string>("PDE Constraint");
+  VectorFunctionT tVectorFunction(tTypePDE, tSpatialModel, tDataMap, *tParamList);
+
+  // batch size chosen so that the last batch is partial
+  Teuchos::ParameterList tBatchedParams(*tParamList);
+  tBatchedParams.sublist("Assembly").set<int>("Cell Batch Size", 5);
+  TEST_ASSERT(tNumDomainCells % 5 != 0);
+  VectorFunctionT tBatchedVectorFunction(tTypePDE, tSpatialModel, tDataMap, tBatchedParams);
+
+  auto tCompare = [&](const Plato::ScalarVector & aGold, const Plato::ScalarVector & aTest)
+  {
+    auto tGold = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), aGold);
+    auto tTest = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), aTest);
+    TEST_EQUALITY(tGold.extent(0), tTest.extent(0));
+    for(Plato::OrdinalType i=0; i<Plato::OrdinalType(tGold.extent(0)); i++)
+    {
+      if(tGold(i) == 0.0) { TEST_ASSERT(fabs(tTest(i)) < 1e-10); }
+      else { TEST_FLOATING_EQUALITY(tTest(i), tGold(i), 1.0e-13); }
+    }
+  };
+
+  tCompare(tVectorFunction.value(tDatabase, 0.), tBatchedVectorFunction.value(tDatabase, 0.));
+  TEST_EQUALITY(tSpatialModel.Domains.front().numCells(), tNumDomainCells);
+
+  tCompare(tVectorFunction.jacobianState(tDatabase, 0.)->entries(),
+           tBatchedVectorFunction.jacobianState(tDatabase, 0.)->entries());
+  tCompare(tVectorFunction.jacobianControl(tDatabase, 0.)->entries(),
+           tBatchedVectorFunction.jacobianControl(tDatabase, 0.)->entries());
+  tCompare(tVectorFunction.jacobianConfig(tDatabase, 0.)->entries(),
+           tBatchedVectorFunction.jacobianConfig(tDatabase, 0.)->entries());
+  TEST_EQUALITY(tSpatialModel.Domains.front().numCells(), tNumDomainCells);
+}
+
+TEUCHOS_UNIT_TEST( ElastostaticTests, PostProcessCellStress3D )
+{
+  // create test mesh
+  //
+  constexpr int meshWidth=2;
+  constexpr int spaceDim = Plato::Tet4::mNumSpatialDims;
+  auto tMesh = Plato::TestHelpers::get_box_mesh("TET4", meshWidth);
+  auto tNumNodes = tMesh->NumNodes();
+
+  // create database, u(x) = 0.001*x
+  //
+  Plato::Database tDatabase;
+  Plato::ScalarVector z("controls", tNumNodes);
+  Kokkos::deep_copy(z, 1.0);
+  tDatabase.vector("controls",z);
+
+  auto tCoords = tMesh->Coordinates();
+  Plato::ScalarVector u("states", spaceDim*tNumNodes);
+  Kokkos::parallel_for("set displacement", Kokkos::RangePolicy<int>(0, tNumNodes),
+  KOKKOS_LAMBDA(int aNodeOrdinal)
+  {
+    u(spaceDim*aNodeOrdinal) = 0.001*tCoords(spaceDim*aNodeOrdinal);
+  });
+  tDatabase.vector("states",u);
+
+  // create input
+  //
+  Teuchos::RCP<Teuchos::ParameterList> tParamList =
+    Teuchos::getParametersFromXmlString(
+    "<ParameterList name='Plato Problem'>                                             \n"
+    "  <ParameterList name='Spatial Model'>                                           \n"
+    "    <ParameterList name='Domains'>                                               \n"
+    "      <ParameterList name='Design Volume'>                                       \n"
+    "        <Parameter name='Element Block' type='string' value='body'/>             \n"
+    "        <Parameter name='Material Model' type='string' value='Unobtainium'/>     \n"
+    "      </ParameterList>                                                           \n"
+    "    </ParameterList>                                                             \n"
+    "  </ParameterList>                                                               \n"
+    "  <Parameter name='PDE Constraint' type='string' value='Elliptic'/>              \n"
+    "  <ParameterList name='Elliptic'>                                                \n"
+    "    <Parameter name='Plottable' type='Array(string)' value='{strain, stress}'/>  \n"
+    "    <ParameterList name='Penalty Function'>                                      \n"
+    "      <Parameter name='Exponent' type='double' value='3.0'/>                     \n"
+    "      <Parameter name='Minimum Value' type='double' value='0.0'/>                \n"
+    "      <Parameter name='Type' type='string' value='SIMP'/>                        \n"
+    "    </ParameterList>                                                             \n"
+    "  </ParameterList>                                                               \n"
+    "  <ParameterList name='Material Models'>                                         \n"
+    "    <ParameterList name='Unobtainium'>                                           \n"
+    "      <ParameterList name='Isotropic Linear Elastic'>                            \n"
+    "        <Parameter name='Poissons Ratio' type='double' value='0.3'/>             \n"
+    "        <Parameter name='Youngs Modulus' type='double' value='1.0e6'/>           \n"
+    "      </ParameterList>                                                           \n"
+    "    </ParameterList>                                                             \n"
+    "  </ParameterList>                                                               \n"
+    "</ParameterList>                                                                 \n"
+  );
+
+  Plato::DataMap tDataMap;
+  Plato::SpatialModel tSpatialModel(tMesh, *tParamList, tDataMap);
+
+  using VectorFunctionT = Plato::Elliptic::VectorFunction<Plato::Elliptic::Linear::Mechanics<Plato::Tet4>>;
+  auto tTypePDE = tParamList->get<std::string>("PDE Constraint");
+  VectorFunctionT tVectorFunction(tTypePDE, tSpatialModel, tDataMap, *tParamList);
+
+  // residual and jacobian evaluations do not compute output quantities
+  tVectorFunction.value(tDatabase, 0.);
+  tVectorFunction.jacobianState(tDatabase, 0.);
+  TEST_EQUALITY(tDataMap.scalarMultiVectors.count("strain"), 0);
+  TEST_EQUALITY(tDataMap.scalarMultiVectors.count("stress"), 0);
+
+  tVectorFunction.postProcess(tDatabase, 0.);
+  TEST_EQUALITY(tDataMap.scalarMultiVectors.count("strain"), 1);
+  TEST_EQUALITY(tDataMap.scalarMultiVectors.count("stress"), 1);
+
+  // uniform strain, e_xx = 0.001
+  auto tStrain = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tDataMap.scalarMultiVectors.at("strain"));
+  auto tStress = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tDataMap.scalarMultiVectors.at("stress"));
+  TEST_EQUALITY(tStress.extent(0), tMesh->NumElements());
+  const Plato::Scalar tLambda = 1.0e6*0.3/((1.0+0.3)*(1.0-2.0*0.3));
+  const Plato::Scalar tMu = 1.0e6/(2.0*(1.0+0.3));
+  for(Plato::OrdinalType tCell = 0; tCell < Plato::OrdinalType(tStress.extent(0)); tCell++)
+  {
+    TEST_FLOATING_EQUALITY(tStrain(tCell,0), 0.001, 1.0e-10);
+    TEST_FLOATING_EQUALITY(tStress(tCell,0), 0.001*(tLambda+2.0*tMu), 1.0e-10);
+    TEST_FLOATING_EQUALITY(tStress(tCell,1), 0.001*tLambda, 1.0e-10);
+    TEST_FLOATING_EQUALITY(tStress(tCell,2), 0.001*tLambda, 1.0e-10);
+    for(Plato::OrdinalType tTerm = 3; tTerm < Plato::OrdinalType(tStress.extent(1)); tTerm++)
+    {
+      TEST_ASSERT(fabs(tStress(tCell,tTerm)) < 1.0e-8);
+    }
+  }
+}
+
 /******************************************************************************/
 /*! 
   \brief Compute value and both gradients (wrt state and control) of 
@@ -1630,3 +1823,236 @@ TEUCHOS_UNIT_TEST( DerivativeTests, Volume3D )
     }
   }
 }
+
+TEUCHOS_UNIT_TEST( DerivativeTests, ElastostaticBatchedCriterionGradients3D )
+{
+    Teuchos::RCP<Teuchos::ParameterList> tParamList =
+    Teuchos::getParametersFromXmlString(
+      "<ParameterList name='Plato Problem'>                                                     \n"
+      "  <ParameterList name='Spatial Model'>                                                   \n"
+      "    <ParameterList name='Domains'>                                                       \n"
+      "      <ParameterList name='Design Volume'>                                               \n"
+      "        <Parameter name='Element Block' type='string' value='body'/>                     \n"
+      "        <Parameter name='Material Model' type='string' value='Unobtainium'/>             \n"
+      "      </ParameterList>                                                                   \n"
+      "    </ParameterList>                                                                     \n"
+      "  </ParameterList>                                                                       \n"
+      "  <Parameter name='Physics'          type='string'  value='Mechanical'/>                 \n"
+      "  <Parameter name='PDE Constraint'   type='string'  value='Elliptic'/>                   \n"
+      "  <ParameterList name='Material Models'>                                                 \n"
+      "    <ParameterList name='Unobtainium'>                                                   \n"
+      "      <ParameterList name='Isotropic Linear Elastic'>                                    \n"
+      "        <Parameter  name='Poissons Ratio' type='double' value='0.3'/>                    \n"
+      "        <Parameter  name='Youngs Modulus' type='double' value='1.0e6'/>                  \n"
+      "      </ParameterList>                                                                   \n"
+      "    </ParameterList>                                                                     \n"
+      "  </ParameterList>                                                                       \n"
+      "  <ParameterList name='Elliptic'>                                                        \n"
+      "    <ParameterList name='Penalty Function'>                                              \n"
+      "      <Parameter name='Type' type='string' value='SIMP'/>                                \n"
+      "      <Parameter name='Exponent' type='double' value='3.0'/>                             \n"
+      "      <Parameter name='Minimum Value' type='double' value='1.0e-8'/>                     \n"
+      "    </ParameterList>                                                                     \n"
+      "  </ParameterList>                                                                       \n"
+      "  <ParameterList name='Criteria'>                                                        \n"
+      "    <ParameterList name='Internal Elastic Energy'>                                       \n"
+      "      <Parameter name='Type' type='string' value='Scalar Function'/>                     \n"
+      "      <Parameter name='Scalar Function Type' type='string' value='Internal Elastic Energy'/>  \n"
+      "    </ParameterList>                                                                     \n"
+      "    <ParameterList name='Stress P-Norm'>                                                 \n"
+      "      <Parameter name='Type' type='string' value='Scalar Function'/>                     \n"
+      "      <Parameter name='Scalar Function Type' type='string' value='Stress P-Norm'/>       \n"
+      "      <Parameter name='Exponent' type='double' value='6.0'/>                             \n"
+      "    </ParameterList>                                                                     \n"
+      "    <ParameterList name='Volume'>                                                        \n"
+      "      <Parameter name='Type' type='string' value='Scalar Function'/>                     \n"
+      "      <Parameter name='Scalar Function Type' type='string' value='Volume'/>              \n"
+      "    </ParameterList>                                                                     \n"
+      "  </ParameterList>                                                                       \n"
+      "  <ParameterList  name='Essential Boundary Conditions'>                                  \n"
+      "    <ParameterList  name='X Fixed Displacement Boundary Condition'>                      \n"
+      "      <Parameter  name='Type'     type='string' value='Zero Value'/>                     \n"
+      "      <Parameter  name='Index'    type='int'    value='0'/>                              \n"
+      "      <Parameter  name='Sides'    type='string' value='x-'/>                             \n"
+      "    </ParameterList>                                                                     \n"
+      "    <ParameterList  name='Y Fixed Displacement Boundary Condition'>                      \n"
+      "      <Parameter  name='Type'     type='string' value='Zero Value'/>                     \n"
+      "      <Parameter  name='Index'    type='int'    value='1'/>                              \n"
+      "      <Parameter  name='Sides'    type='string' value='y-'/>                             \n"
+      "    </ParameterList>                                                                     \n"
+      "    <ParameterList  name='Z Fixed Displacement Boundary Condition'>                      \n"
+      "      <Parameter  name='Type'     type='string' value='Zero Value'/>                     \n"
+      "      <Parameter  name='Index'    type='int'    value='2'/>                              \n"
+      "      <Parameter  name='Sides'    type='string' value='z-'/>                             \n"
+      "    </ParameterList>                                                                     \n"
+      "    <ParameterList  name='Applied X Displacement Boundary Condition'>                    \n"
+      "      <Parameter  name='Type'     type='string' value='Fixed Value'/>                    \n"
+      "      <Parameter  name='Index'    type='int'    value='0'/>                              \n"
+      "      <Parameter  name='Sides'    type='string' value='x+'/>                             \n"
+      "      <Parameter  name='Value'    type='double' value='1.0e-3'/>                         \n"
+      "    </ParameterList>                                                                     \n"
+      "  </ParameterList>                                                                       \n"
+      "</ParameterList>                                                                         \n"
+    );
+
+    constexpr Plato::OrdinalType tMeshWidth = 2;
+    auto tMesh = Plato::TestHelpers::get_box_mesh("TET4", tMeshWidth);
+
+    MPI_Comm myComm;
+    MPI_Comm_dup(MPI_COMM_WORLD, &myComm);
+    Plato::Comm::Machine tMachine(myComm);
+
+    using PhysicsT = Plato::Elliptic::Linear::Mechanics<Plato::Tet4>;
+    Plato::Elliptic::Problem<PhysicsT> tProblem(tMesh, *tParamList, tMachine);
+    tProblem.readEssentialBoundaryConditions(*tParamList);
+
+    Plato::ScalarVector tControls("Controls", tMesh->NumNodes());
+    Plato::blas1::fill(0.5, tControls);
+    auto tSolution = tProblem.solution(tControls);
+
+    // batched gradients must match the gradients computed one criterion at a time
+    std::vector<std::string> tNames = {"Internal Elastic Energy", "Volume", "Stress P-Norm"};
+    auto tGradients  = tProblem.criterionGradients(tControls, tSolution, tNames);
+    auto tGradientsX = tProblem.criterionGradientsX(tControls, tSolution, tNames);
+    TEST_EQUALITY(tGradients.size(), tNames.size());
+    TEST_EQUALITY(tGradientsX.size(), tNames.size());
+
+    constexpr Plato::Scalar tTolerance = 1e-8;
+    for(size_t tIndex = 0; tIndex < tNames.size(); tIndex++)
+    {
+        auto tGold  = tProblem.criterionGradient(tControls, tSolution, tNames[tIndex]);
+        auto tGoldX = tProblem.criterionGradientX(tControls, tSolution, tNames[tIndex]);
+
+        auto tHostGold = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tGold);
+        auto tHostGrad = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tGradients[tIndex]);
+        TEST_EQUALITY(tHostGrad.extent(0), tHostGold.extent(0));
+        for(ordType tDof = 0; tDof < tHostGold.extent(0); tDof++)
+        {
+            TEST_ASSERT(fabs(tHostGrad(tDof) - tHostGold(tDof)) <= tTolerance * (1.0 + fabs(tHostGold(tDof))));
+        }
+
+        auto tHostGoldX = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tGoldX);
+        auto tHostGradX = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tGradientsX[tIndex]);
+        TEST_EQUALITY(tHostGradX.extent(0), tHostGoldX.extent(0));
+        for(ordType tDof = 0; tDof < tHostGoldX.extent(0); tDof++)
+        {
+            TEST_ASSERT(fabs(tHostGradX(tDof) - tHostGoldX(tDof)) <= tTolerance * (1.0 + fabs(tHostGoldX(tDof))));
+        }
+    }
+}
+
+TEUCHOS_UNIT_TEST( DerivativeTests, ElastostaticSelfAdjointOperatorReuse3D )
+{
+    Teuchos::RCP<Teuchos::ParameterList> tParamList =
+    Teuchos::getParametersFromXmlString(
+      "<ParameterList name='Plato Problem'>                                                     \n"
+      "  <ParameterList name='Spatial Model'>                                                   \n"
+      "    <ParameterList name='Domains'>                                                       \n"
+      "      <ParameterList name='Design Volume'>                                               \n"
+      "        <Parameter name='Element Block' type='string' value='body'/>                     \n"
+      "        <Parameter name='Material Model' type='string' value='Unobtainium'/>             \n"
+      "      </ParameterList>                                                                   \n"
+      "    </ParameterList>                                                                     \n"
+      "  </ParameterList>                                                                       \n"
+      "  <Parameter name='Physics'          type='string'  value='Mechanical'/>                 \n"
+      "  <Parameter name='PDE Constraint'   type='string'  value='Elliptic'/>                   \n"
+      "  <ParameterList name='Material Models'>                                                 \n"
+      "    <ParameterList name='Unobtainium'>                                                   \n"
+      "      <ParameterList name='Isotropic Linear Elastic'>                                    \n"
+      "        <Parameter  name='Poissons Ratio' type='double' value='0.3'/>                    \n"
+      "        <Parameter  name='Youngs Modulus' type='double' value='1.0e6'/>                  \n"
+      "      </ParameterList>                                                                   \n"
+      "    </ParameterList>                                                                     \n"
+      "  </ParameterList>                                                                       \n"
+      "  <ParameterList name='Elliptic'>                                                        \n"
+      "    <ParameterList name='Penalty Function'>                                              \n"
+      "      <Parameter name='Type' type='string' value='SIMP'/>                                \n"
+      "      <Parameter name='Exponent' type='double' value='3.0'/>                             \n"
+      "      <Parameter name='Minimum Value' type='double' value='1.0e-8'/>                     \n"
+      "    </ParameterList>                                                                     \n"
+      "  </ParameterList>                                                                       \n"
+      "  <ParameterList name='Criteria'>                                                        \n"
+      "    <ParameterList name='Internal Elastic Energy'>                                       \n"
+      "      <Parameter name='Type' type='string' value='Scalar Function'/>                     \n"
+      "      <Parameter name='Scalar Function Type' type='string' value='Internal Elastic Energy'/>  \n"
+      "    </ParameterList>                                                                     \n"
+      "    <ParameterList name='Stress P-Norm'>                                                 \n"
+      "      <Parameter name='Type' type='string' value='Scalar Function'/>                     \n"
+      "      <Parameter name='Scalar Function Type' type='string' value='Stress P-Norm'/>       \n"
+      "      <Parameter name='Exponent' type='double' value='6.0'/>                             \n"
+      "    </ParameterList>                                                                     \n"
+      "    <ParameterList name='Volume'>                                                        \n"
+      "      <Parameter name='Type' type='string' value='Scalar Function'/>                     \n"
+      "      <Parameter name='Scalar Function Type' type='string' value='Volume'/>              \n"
+      "    </ParameterList>                                                                     \n"
+      "  </ParameterList>                                                                       \n"
+      "  <ParameterList  name='Essential Boundary Conditions'>                                  \n"
+      "    <ParameterList  name='X Fixed Displacement Boundary Condition'>                      \n"
+      "      <Parameter  name='Type'     type='string' value='Zero Value'/>                     \n"
+      "      <Parameter  name='Index'    type='int'    value='0'/>                              \n"
+      "      <Parameter  name='Sides'    type='string' value='x-'/>                             \n"
+      "    </ParameterList>                                                                     \n"
+      "    <ParameterList  name='Y Fixed Displacement Boundary Condition'>                      \n"
+      "      <Parameter  name='Type'     type='string' value='Zero Value'/>                     \n"
+      "      <Parameter  name='Index'    type='int'    value='1'/>                              \n"
+      "      <Parameter  name='Sides'    type='string' value='y-'/>                             \n"
+      "    </ParameterList>                                                                     \n"
+      "    <ParameterList  name='Z Fixed Displacement Boundary Condition'>                      \n"
+      "      <Parameter  name='Type'     type='string' value='Zero Value'/>                     \n"
+      "      <Parameter  name='Index'    type='int'    value='2'/>                              \n"
+      "      <Parameter  name='Sides'    type='string' value='z-'/>                             \n"
+      "    </ParameterList>                                                                     \n"
+      "    <ParameterList  name='Applied X Displacement Boundary Condition'>                    \n"
+      "      <Parameter  name='Type'     type='string' value='Fixed Value'/>                    \n"
+      "      <Parameter  name='Index'    type='int'    value='0'/>                              \n"
+      "      <Parameter  name='Sides'    type='string' value='x+'/>                             \n"
+      "      <Parameter  name='Value'    type='double' value='1.0e-3'/>                         \n"
+      "    </ParameterList>                                                                     \n"
+      "  </ParameterList>                                                                       \n"
+      "</ParameterList>                                                                         \n"
+    );
+
+    constexpr Plato::OrdinalType tMeshWidth = 2;
+    auto tMesh = Plato::TestHelpers::get_box_mesh("TET4", tMeshWidth);
+
+    MPI_Comm myComm;
+    MPI_Comm_dup(MPI_COMM_WORLD, &myComm);
+    Plato::Comm::Machine tMachine(myComm);
+
+    // the second problem reassembles and refactors the adjoint operator
+    using PhysicsT = Plato::Elliptic::Linear::Mechanics<Plato::Tet4>;
+    Plato::Elliptic::Problem<PhysicsT> tReuseProblem(tMesh, *tParamList, tMachine);
+    tParamList->set<bool>("Reuse Forward Operator", false);
+    Plato::Elliptic::Problem<PhysicsT> tGoldProblem(tMesh, *tParamList, tMachine);
+
+    Plato::ScalarVector tControls("Controls", tMesh->NumNodes());
+    Plato::blas1::fill(0.5, tControls);
+    auto tReuseSolution = tReuseProblem.solution(tControls);
+    auto tGoldSolution = tGoldProblem.solution(tControls);
+
+    constexpr Plato::Scalar tTolerance = 1e-8;
+    std::vector<std::string> tNames = {"Internal Elastic Energy", "Stress P-Norm"};
+    for(const auto& tName : tNames)
+    {
+        auto tGrad = tReuseProblem.criterionGradient(tControls, tReuseSolution, tName);
+        auto tGold = tGoldProblem.criterionGradient(tControls, tGoldSolution, tName);
+        auto tHostGrad = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tGrad);
+        auto tHostGold = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tGold);
+        TEST_EQUALITY(tHostGrad.extent(0), tHostGold.extent(0));
+        for(ordType tDof = 0; tDof < tHostGold.extent(0); tDof++)
+        {
+            TEST_ASSERT(fabs(tHostGrad(tDof) - tHostGold(tDof)) <= tTolerance * (1.0 + fabs(tHostGold(tDof))));
+        }
+    }
+
+    // a control change invalidates the forward operator
+    Plato::blas1::fill(0.75, tControls);
+    auto tGrad = tReuseProblem.criterionGradient(tControls, tReuseSolution, "Stress P-Norm");
+    auto tGold = tGoldProblem.criterionGradient(tControls, tGoldSolution, "Stress P-Norm");
+    auto tHostGrad = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tGrad);
+    auto tHostGold = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tGold);
+    for(ordType tDof = 0; tDof < tHostGold.extent(0); tDof++)
+    {
+        TEST_ASSERT(fabs(tHostGrad(tDof) - tHostGold(tDof)) <= tTolerance * (1.0 + fabs(tHostGold(tDof))));
+    }
+}
@@ -32,6 +32,7 @@
 #include "GeneralFluxDivergence.hpp"
 #include "parabolic/VectorFunction.hpp"
 #include "parabolic/PhysicsScalarFunction.hpp"
+#include "parabolic/Problem.hpp"
 
 #include <fenv.h>
 
@@ -856,3 +857,143 @@ TEUCHOS_UNIT_TEST( HeatEquationTests, ComputedField_UniformScalar )
     TEST_FLOATING_EQUALITY(T_Host[iNode], 1.0*xCoords_Host[iNode]*yCoords_Host[iNode], 1e-15);
   }
 }
+
+
+/******************************************************************************/
+/*! 
+  \brief Solve a transient heat problem with every time step stored and with
+   the state history checkpointed.  Criterion values and gradients must match.
+*/
+/******************************************************************************/
+TEUCHOS_UNIT_TEST( HeatEquationTests, CheckpointedAdjoint )
+{
+  auto tInputString = [](int aNumCheckpoints)
+  {
+    std::stringstream tInput;
+    tInput <<
+    "<ParameterList name='Plato Problem'>                                        \n"
+    "  <Parameter name='PDE Constraint' type='string' value='Parabolic'/>        \n"
+    "  <Parameter name='Physics' type='string' value='Thermal'/>                 \n"
+    "  <Parameter name='Self-Adjoint' type='bool' value='false'/>                \n"
+    "  <ParameterList name='Spatial Model'>                                      \n"
+    "    <ParameterList name='Domains'>                                          \n"
+    "      <ParameterList name='Design Volume'>                                  \n"
+    "        <Parameter name='Element Block' type='string' value='body'/>        \n"
+    "        <Parameter name='Material Model' type='string' value='Unobtainium'/>\n"
+    "      </ParameterList>                                                      \n"
+    "    </ParameterList>                                                        \n"
+    "  </ParameterList>                                                          \n"
+    "  <ParameterList name='Parabolic'>                                          \n"
+    "    <ParameterList name='Penalty Function'>                                 \n"
+    "      <Parameter name='Exponent' type='double' value='3.0'/>                \n"
+    "      <Parameter name='Minimum Value' type='double' value='0.0'/>           \n"
+    "      <Parameter name='Type' type='string' value='SIMP'/>                   \n"
+    "    </ParameterList>                                                        \n"
+    "  </ParameterList>                                                          \n"
+    "  <ParameterList name='Criteria'>                                           \n"
+    "    <ParameterList name='Internal Energy'>                                  \n"
+    "      <Parameter name='Type' type='string' value='Scalar Function'/>        \n"
+    "      <Parameter name='Scalar Function Type' type='string' value='Internal Thermal Energy'/>  \n"
+    "      <ParameterList name='Penalty Function'>                               \n"
+    "        <Parameter name='Exponent' type='double' value='3.0'/>              \n"
+    "        <Parameter name='Minimum Value' type='double' value='0.0'/>         \n"
+    "        <Parameter name='Type' type='string' value='SIMP'/>                 \n"
+    "      </ParameterList>                                                      \n"
+    "    </ParameterList>                                                        \n"
+    "  </ParameterList>                                                          \n"
+    "  <ParameterList name='Material Models'>                                    \n"
+    "    <ParameterList name='Unobtainium'>                                      \n"
+    "      <ParameterList name='Thermal Mass'>                                   \n"
+    "        <Parameter name='Mass Density' type='double' value='0.3'/>          \n"
+    "        <Parameter name='Specific Heat' type='double' value='1.0e3'/>       \n"
+    "      </ParameterList>                                                      \n"
+    "      <ParameterList name='Thermal Conduction'>                             \n"
+    "        <Parameter name='Thermal Conductivity' type='double' value='1.0e3'/>\n"
+    "      </ParameterList>                                                      \n"
+    "    </ParameterList>                                                        \n"
+    "  </ParameterList>                                                          \n"
+    "  <ParameterList name='Essential Boundary Conditions'>                      \n"
+    "    <ParameterList name='Cold Side'>                                        \n"
+    "      <Parameter name='Type' type='string' value='Zero Value'/>             \n"
+    "      <Parameter name='Index' type='int' value='0'/>                        \n"
+    "      <Parameter name='Sides' type='string' value='x-'/>                    \n"
+    "    </ParameterList>                                                        \n"
+    "    <ParameterList name='Hot Side'>                                         \n"
+    "      <Parameter name='Type' type='string' value='Fixed Value'/>            \n"
+    "      <Parameter name='Index' type='int' value='0'/>                        \n"
+    "      <Parameter name='Value' type='double' value='10.0'/>                  \n"
+    "      <Parameter name='Sides' type='string' value='x+'/>                    \n"
+    "    </ParameterList>                                                        \n"
+    "  </ParameterList>                                                          \n"
+    "  <ParameterList name='Time Integration'>                                   \n"
+    "    <Parameter name='Number Time Steps' type='int' value='11'/>             \n"
+    "    <Parameter name='Time Step' type='double' value='0.1'/>                 \n"
+    "    <Parameter name='Checkpoints' type='int' value='" << aNumCheckpoints << "'/>  \n"
+    "  </ParameterList>                                                          \n"
+    "</ParameterList>                                                            \n";
+    return tInput.str();
+  };
+
+  constexpr int meshWidth=2;
+  auto tMesh = Plato::TestHelpers::get_box_mesh("TET4", meshWidth);
+
+  MPI_Comm myComm;
+  MPI_Comm_dup(MPI_COMM_WORLD, &myComm);
+  Plato::Comm::Machine tMachine(myComm);
+
+  auto tNumNodes = tMesh->NumNodes();
+  Plato::ScalarVector tControl("Control", tNumNodes);
+  Kokkos::parallel_for(Kokkos::RangePolicy<int>(0,tNumNodes), KOKKOS_LAMBDA(const int & aNodeOrdinal)
+  {
+    tControl(aNodeOrdinal) = 0.5 + 0.5*(aNodeOrdinal % 3)/2.0;
+  });
+
+  using ProblemType = Plato::Parabolic::Problem<Plato::Parabolic::Linear::Thermal<Plato::Tet4>>;
+
+  auto tFullParams = Teuchos::getParametersFromXmlString(tInputString(0));
+  ProblemType tFullProblem(tMesh, *tFullParams, tMachine);
+  auto tFullSolution = tFullProblem.solution(tControl);
+  auto tFullValue     = tFullProblem.criterionValue(tControl, tFullSolution, "Internal Energy");
+  auto tFullGradient  = tFullProblem.criterionGradient(tControl, tFullSolution, "Internal Energy");
+  auto tFullGradientX = tFullProblem.criterionGradientX(tControl, tFullSolution, "Internal Energy");
+
+  // one checkpoint (the initial state) and three checkpoints for 11 time steps.  the
+  // second trial recomputes the checkpoints taken by the forward sweep.
+  for(int tNumCheckpoints : {1, 3})
+  {
+    auto tParams = Teuchos::getParametersFromXmlString(tInputString(tNumCheckpoints));
+    ProblemType tProblem(tMesh, *tParams, tMachine);
+    auto tSolution = tProblem.solution(tControl);
+    auto tValue = tProblem.criterionValue(tControl, tSolution, "Internal Energy");
+    TEST_FLOATING_EQUALITY(tValue, tFullValue, 1e-10);
+
+    // only the last two steps are stored
+    auto tStates = tSolution.get("State");
+    TEST_EQUALITY(tStates.extent(0), 2);
+    auto tFullStates = tFullSolution.get("State");
+    auto tLastState_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Kokkos::subview(tStates, 1, Kokkos::ALL()));
+    auto tFullLastState_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Kokkos::subview(tFullStates, 10, Kokkos::ALL()));
+    for(int iDof=0; iDof<int(tLastState_Host.extent(0)); iDof++){
+      TEST_ASSERT(fabs(tLastState_Host(iDof) - tFullLastState_Host(iDof)) < 1e-10*10.0);
+    }
+
+    for(int tTrial=0; tTrial<2; tTrial++)
+    {
+      auto tGradient = tProblem.criterionGradient(tControl, tSolution, "Internal Energy");
+      auto tGradient_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tGradient);
+      auto tFullGradient_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tFullGradient);
+      TEST_EQUALITY(tGradient_Host.extent(0), tFullGradient_Host.extent(0));
+      for(int iNode=0; iNode<int(tGradient_Host.extent(0)); iNode++){
+        TEST_ASSERT(fabs(tGradient_Host(iNode) - tFullGradient_Host(iNode)) <= 1e-8*fabs(tFullGradient_Host(iNode)) + 1e-10);
+      }
+
+      auto tGradientX = tProblem.criterionGradientX(tControl, tSolution, "Internal Energy");
+      auto tGradientX_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tGradientX);
+      auto tFullGradientX_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tFullGradientX);
+      TEST_EQUALITY(tGradientX_Host.extent(0), tFullGradientX_Host.extent(0));
+      for(int iDof=0; iDof<int(tGradientX_Host.extent(0)); iDof++){
+        TEST_ASSERT(fabs(tGradientX_Host(iDof) - tFullGradientX_Host(iDof)) <= 1e-8*fabs(tFullGradientX_Host(iDof)) + 1e-10);
+      }
+    }
+  }
+}
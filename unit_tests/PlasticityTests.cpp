@@ -2135,3 +2135,48 @@ TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, J2Plasticity_UpdateLocalState2D)
 }
 
 } // namespace AugLagStressTest
+
+#ifdef PLATO_EXPRESSION
+TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, YieldStressExpression_EvaluateAllCells)
+{
+    using PhysicsT = Plato::SimplexPlasticity<3>;
+    using Residual = typename Plato::Evaluation<PhysicsT>::Residual;
+
+    using LocalStateT = typename Residual::LocalStateScalarType;
+    using ControlT    = typename Residual::ControlScalarType;
+    using ResultT     = typename Residual::ResultScalarType;
+
+    Teuchos::RCP<Teuchos::ParameterList> tParamList =
+    Teuchos::getParametersFromXmlString(
+    "<ParameterList name='Plasticity Model'>                                                                                               \n"
+    "  <ParameterList name='Custom Plasticity Model'>                                                                                      \n"
+    "    <Parameter name='Equation' type='string' value='PenalizedHardeningModulusIsotropic * AccumulatedPlasticStrain + PenalizedInitialYieldStress'/> \n"
+    "    <Parameter name='AccumulatedPlasticStrain' type='string' value='Local State Workset'/>                                            \n"
+    "  </ParameterList>                                                                                                                    \n"
+    "</ParameterList>                                                                                                                      \n"
+    );
+
+    // the parameters and the accumulated plastic strain differ for each cell
+    constexpr Plato::OrdinalType tNumCells = 3;
+    Plato::ScalarVectorT<ControlT> tInitialYieldStress("PenalizedInitialYieldStress", tNumCells);
+    Plato::ScalarVectorT<ControlT> tHardeningModulus("PenalizedHardeningModulusIsotropic", tNumCells);
+    Plato::ScalarMultiVectorT<LocalStateT> tLocalState("Local State Workset", tNumCells, 1);
+    Kokkos::parallel_for(Kokkos::RangePolicy<>(0, tNumCells), KOKKOS_LAMBDA(const Plato::OrdinalType & aCellOrdinal)
+    {
+        tInitialYieldStress(aCellOrdinal) = 1.0 + aCellOrdinal;
+        tHardeningModulus(aCellOrdinal)   = 10.0 * (1.0 + aCellOrdinal);
+        tLocalState(aCellOrdinal, 0)      = 0.1 * (1.0 + aCellOrdinal);
+    }, "Unit Test");
+
+    Plato::ScalarMultiVectorT<ResultT> tYieldStress("yield stress", tNumCells, 1);
+    Plato::YieldStressExpression<Residual> tComputeYieldStress(*tParamList);
+    tComputeYieldStress(tYieldStress, tLocalState, tInitialYieldStress, tHardeningModulus);
+
+    constexpr Plato::Scalar tTolerance = 1e-12;
+    std::vector<Plato::Scalar> tGold = {2.0, 6.0, 12.0};
+    auto tHostYieldStress = Kokkos::create_mirror(tYieldStress);
+    Kokkos::deep_copy(tHostYieldStress, tYieldStress);
+    for(Plato::OrdinalType tCellIndex = 0; tCellIndex < tNumCells; tCellIndex++)
+        TEST_FLOATING_EQUALITY(tHostYieldStress(tCellIndex, 0), tGold[tCellIndex], tTolerance);
+}
+#endif
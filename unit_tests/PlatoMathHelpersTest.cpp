@@ -1,5 +1,6 @@
 #include <vector>
 #include <array>
+#include <algorithm>
 
 //#define COMPUTE_GOLD_
 #ifdef COMPUTE_GOLD_
@@ -18,6 +19,10 @@
 #include "Solutions.hpp"
 #include "PlatoMathHelpers.hpp"
 #include "PlatoMathFunctors.hpp"
+#include "BlockMatrixCache.hpp"
+#include "ElementColoring.hpp"
+#include "ExpressionEvaluator.hpp"
+#include "Assembly.hpp"
 #include "elliptic/base/VectorFunction.hpp"
 #include "elliptic/mechanical/linear/Mechanics.hpp"
 #include "elliptic/criterioneval/CriterionEvaluatorScalarFunction.hpp"
@@ -1862,4 +1867,238 @@ TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, PlatoMathHelpers_TransposeSymmetricMatr
                                  tMatrixATT->columnIndices(), tMatrixATT->entries()));
 }
 
+/******************************************************************************/
+/*! 
+  \brief Check that matrices handed out by Plato::BlockMatrixCache share the
+ graph built by Plato::CreateBlockMatrix and that released matrices are
+ recycled with zeroed entries.
+*/
+/******************************************************************************/
+TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, PlatoMathHelpers_BlockMatrixCache)
+{
+  constexpr int tMeshWidth=2;
+  auto tMesh = pth::get_box_mesh("TET4", tMeshWidth);
+
+  auto tReference = Plato::CreateBlockMatrix<Plato::CrsMatrixType, 3, 3>(tMesh);
+
+  Plato::BlockMatrixCache tCache(tMesh);
+  auto tMatrixA = tCache.matrix<3,3>();
+  TEST_ASSERT(pth::is_same(tReference->rowMap(), tMatrixA->rowMap()));
+  TEST_ASSERT(pth::is_same(tReference->columnIndices(), tMatrixA->columnIndices()));
+  TEST_EQUALITY(tReference->entries().extent(0), tMatrixA->entries().extent(0));
+  TEST_EQUALITY(tReference->numRows(), tMatrixA->numRows());
+
+  // a held matrix is never handed out again
+  auto tMatrixB = tCache.matrix<3,3>();
+  TEST_ASSERT(tMatrixA.get() != tMatrixB.get());
+  TEST_ASSERT(tMatrixA->rowMap().data() == tMatrixB->rowMap().data());
+
+  // other block sizes share the same graph
+  auto tMatrixC = tCache.matrix<1,3>();
+  TEST_ASSERT(tMatrixA->columnIndices().data() == tMatrixC->columnIndices().data());
+  TEST_EQUALITY(3*tMatrixC->entries().extent(0), tMatrixA->entries().extent(0));
+
+  // a released matrix is recycled with zeroed entries
+  Plato::blas1::fill(1.0, tMatrixA->entries());
+  auto tRawPointer = tMatrixA.get();
+  tMatrixA = Teuchos::null;
+  auto tMatrixD = tCache.matrix<3,3>();
+  TEST_ASSERT(tMatrixD.get() == tRawPointer);
+  TEST_ASSERT(pth::is_zero(tMatrixD));
+}
+
+/******************************************************************************/
+/*! 
+  \brief Check that the precomputed element-to-CSR scatter table gives the same
+ block matrix entry ordinals as the row search in Plato::BlockMatrixEntryOrdinal.
+*/
+/******************************************************************************/
+TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, PlatoMathHelpers_BlockMatrixScatterMap)
+{
+  constexpr int tMeshWidth=3;
+  constexpr Plato::OrdinalType tNodesPerCell=4;
+  constexpr Plato::OrdinalType tDofsPerNode=3;
+  constexpr Plato::OrdinalType tDofsPerCell=tNodesPerCell*tDofsPerNode;
+  auto tMesh = pth::get_box_mesh("TET4", tMeshWidth);
+
+  Plato::BlockMatrixCache tCache(tMesh);
+  tCache.useScatterMap(true);
+  auto tMatrix = tCache.matrix<tDofsPerNode>();
+  auto tScatterMap = tCache.scatterMap<tNodesPerCell>();
+  TEST_EQUALITY(tScatterMap.extent(0), tMesh->NumElements()*tNodesPerCell*tNodesPerCell);
+
+  Plato::BlockMatrixEntryOrdinal<tNodesPerCell, tDofsPerNode> tSearchOrdinal(tMatrix, tMesh);
+  Plato::BlockMatrixEntryOrdinal<tNodesPerCell, tDofsPerNode> tTableOrdinal(tMatrix, tMesh, tScatterMap);
+
+  Plato::OrdinalType tNumMismatches(0);
+  Kokkos::parallel_reduce(Kokkos::RangePolicy<>(0, tMesh->NumElements()),
+  KOKKOS_LAMBDA(const Plato::OrdinalType & aCellOrdinal, Plato::OrdinalType & aUpdate)
+  {
+    for(Plato::OrdinalType tRow=0; tRow<tDofsPerCell; tRow++)
+    {
+      for(Plato::OrdinalType tCol=0; tCol<tDofsPerCell; tCol++)
+      {
+        auto tExpected = tSearchOrdinal(aCellOrdinal, tRow, tCol);
+        if(tExpected < 0 || tExpected != tTableOrdinal(aCellOrdinal, tRow, tCol)) { aUpdate += 1; }
+      }
+    }
+  }, tNumMismatches);
+  TEST_EQUALITY(tNumMismatches, 0);
+
+  // disabled table falls back to the row search
+  tCache.useScatterMap(false);
+  TEST_EQUALITY(tCache.scatterMap<tNodesPerCell>().extent(0), 0);
+}
+
+TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, PlatoMathHelpers_ElementColoring)
+{
+  constexpr int tMeshWidth=3;
+  constexpr Plato::OrdinalType tNodesPerCell=4;
+  constexpr Plato::OrdinalType tDofsPerNode=2;
+  auto tMesh = pth::get_box_mesh("TET4", tMeshWidth);
+  auto tNumCells = tMesh->NumElements();
+
+  Plato::ElementColoring tColoring(tMesh);
+  TEST_ASSERT(tColoring.numColors() > 0);
+
+  // cells that share a node have different colors
+  const auto & tCellColors = tColoring.cellColors();
+  auto tConnectivity = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tMesh->Connectivity());
+  std::vector<std::vector<Plato::OrdinalType>> tNodeColors(tMesh->NumNodes());
+  for(Plato::OrdinalType tCell=0; tCell<tNumCells; tCell++)
+  {
+    for(Plato::OrdinalType tNode=0; tNode<tNodesPerCell; tNode++)
+    {
+      auto & tColors = tNodeColors[tConnectivity(tCell*tNodesPerCell+tNode)];
+      TEST_ASSERT(std::find(tColors.begin(), tColors.end(), tCellColors[tCell]) == tColors.end());
+      tColors.push_back(tCellColors[tCell]);
+    }
+  }
+
+  // every cell appears once
+  const auto & tCells = tColoring.cells();
+  TEST_EQUALITY(tCells.numColors(), tColoring.numColors());
+  TEST_EQUALITY(tCells.mColorOffsets.back(), tNumCells);
+
+  // colored assembly matches atomic assembly (integer values, so summation order doesn't matter)
+  Plato::VectorEntryOrdinal<3, tDofsPerNode, tNodesPerCell> tEntryOrdinal(tMesh);
+  Plato::ScalarMultiVector tResidualWS("residual workset", tNumCells, tNodesPerCell*tDofsPerNode);
+  Kokkos::parallel_for(Kokkos::RangePolicy<>(0, tNumCells), KOKKOS_LAMBDA(const Plato::OrdinalType & aCellOrdinal)
+  {
+    for(Plato::OrdinalType tDof=0; tDof<tNodesPerCell*tDofsPerNode; tDof++)
+    {
+      tResidualWS(aCellOrdinal, tDof) = aCellOrdinal + tDof;
+    }
+  });
+  Plato::ScalarVector tAtomic("atomic", tMesh->NumNodes()*tDofsPerNode);
+  Plato::ScalarVector tColored("colored", tMesh->NumNodes()*tDofsPerNode);
+  Plato::assemble_residual<tNodesPerCell, tDofsPerNode>(tNumCells, tEntryOrdinal, tResidualWS, tAtomic);
+  Plato::assemble_residual_colored<tNodesPerCell, tDofsPerNode>(tCells, tEntryOrdinal, tResidualWS, tColored);
+  TEST_ASSERT(pth::is_same(tAtomic, tColored));
+}
+
+TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, PlatoMathHelpers_MatrixMatrixMultiplyCache)
+{
+  auto tMatrixA = Teuchos::rcp( new Plato::CrsMatrixType(12, 6, 4, 2) );
+  std::vector<Plato::OrdinalType> tRowMap = { 0, 2, 3, 4 };
+  std::vector<Plato::OrdinalType> tColMap = { 0, 2, 0, 2 };
+  std::vector<Plato::Scalar>      tValuesA = 
+    { 1, 2, 3, 4, 5, 6, 7, 8, 1, 2, 3, 4, 5, 6, 7, 8,
+      1, 2, 3, 4, 5, 6, 7, 8, 1, 2, 3, 4, 5, 6, 7, 8 };
+  pth::set_matrix_data(tMatrixA, tRowMap, tColMap, tValuesA);
+
+  auto tMatrixB = Teuchos::rcp( new Plato::CrsMatrixType(6, 12, 2, 4) );
+  std::vector<Plato::Scalar>      tValuesB = 
+    { 1, 5, 2, 6, 3, 7, 4, 8, 1, 5, 2, 6, 3, 7, 4, 8,
+      1, 5, 2, 6, 3, 7, 4, 8, 1, 5, 2, 6, 3, 7, 4, 8 };
+  pth::set_matrix_data(tMatrixB, tRowMap, tColMap, tValuesB);
+
+  Plato::MatrixMatrixMultiplyCache tCache;
+
+  // first product runs the symbolic phase
+  auto tMatrixAB     = Teuchos::rcp( new Plato::CrsMatrixType(12, 12, 4, 4) );
+  auto tGoldMatrixAB = Teuchos::rcp( new Plato::CrsMatrixType(12, 12, 4, 4) );
+  tCache.multiply                  ( tMatrixA, tMatrixB, tMatrixAB );
+  Plato::MatrixMatrixMultiply      ( tMatrixA, tMatrixB, tGoldMatrixAB );
+  TEST_ASSERT(pth::is_same(tMatrixAB, tGoldMatrixAB));
+
+  // same graph, new values: numeric phase only
+  Plato::blas1::scale(2.0, tMatrixA->entries());
+  auto tMatrixAB2     = Teuchos::rcp( new Plato::CrsMatrixType(12, 12, 4, 4) );
+  auto tGoldMatrixAB2 = Teuchos::rcp( new Plato::CrsMatrixType(12, 12, 4, 4) );
+  tCache.multiply                  ( tMatrixA, tMatrixB, tMatrixAB2 );
+  Plato::MatrixMatrixMultiply      ( tMatrixA, tMatrixB, tGoldMatrixAB2 );
+  TEST_ASSERT(pth::is_same(tMatrixAB2, tGoldMatrixAB2));
+  TEST_ASSERT(tMatrixAB2->rowMap().data() == tMatrixAB->rowMap().data());
+  TEST_ASSERT(tMatrixAB2->entries().data() != tMatrixAB->entries().data());
+
+  // new graph: symbolic phase is redone
+  std::vector<Plato::OrdinalType> tNewColMap = { 0, 1, 0, 2 };
+  pth::set_matrix_data(tMatrixA, tRowMap, tNewColMap, tValuesA);
+  auto tMatrixAB3     = Teuchos::rcp( new Plato::CrsMatrixType(12, 12, 4, 4) );
+  auto tGoldMatrixAB3 = Teuchos::rcp( new Plato::CrsMatrixType(12, 12, 4, 4) );
+  tCache.multiply                  ( tMatrixA, tMatrixB, tMatrixAB3 );
+  Plato::MatrixMatrixMultiply      ( tMatrixA, tMatrixB, tGoldMatrixAB3 );
+  TEST_ASSERT(pth::is_same(tMatrixAB3, tGoldMatrixAB3));
+}
+
+TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, PlatoMathHelpers_ExpressionEvaluatorProgram)
+{
+  constexpr Plato::OrdinalType tNumThreads = 4;
+  constexpr Plato::OrdinalType tNumValues  = 3;
+
+  Plato::ScalarMultiVector tState("x", tNumThreads, tNumValues);
+  Kokkos::parallel_for("fill state", Kokkos::MDRangePolicy<Kokkos::Rank<2>>({0, 0}, {tNumThreads, tNumValues}),
+  KOKKOS_LAMBDA(const Plato::OrdinalType aThread, const Plato::OrdinalType aValue)
+  {
+    tState(aThread, aValue) = 1.0 + aThread + 0.5*aValue;
+  });
+
+  Plato::ExpressionEvaluator<Plato::ScalarMultiVector,
+                             Plato::ScalarMultiVector,
+                             Plato::ScalarVector,
+                             Plato::Scalar> tExpEval;
+
+  // a*x and x*a are evaluated once and sin(2*0.25) is folded into a number:
+  // a, x, a*x, sin(0.5), *, +, 0, /, -
+  tExpEval.parse_expression("a*x + sin(2*0.25)*(x*a) - x/0");
+  TEST_EQUALITY(tExpEval.get_num_instructions(), 9);
+
+  tExpEval.setup_storage(tNumThreads, tNumValues);
+  tExpEval.set_variable("a", 2.0);
+  tExpEval.set_variable("x", tState);
+
+  // all threads at once
+  Plato::ScalarMultiVector tBatchResult("batch result", tNumThreads, tNumValues);
+  tExpEval.evaluate_expression(tBatchResult);
+
+  // one thread at a time
+  Plato::ScalarMultiVector tThreadResult("thread result", tNumThreads, tNumValues);
+  Kokkos::parallel_for("evaluate", Kokkos::RangePolicy<>(0, tNumThreads),
+  KOKKOS_LAMBDA(const Plato::OrdinalType aThread)
+  {
+    tExpEval.evaluate_expression(aThread, tThreadResult);
+  });
+  Kokkos::fence();
+
+  auto tStateHost = Kokkos::create_mirror_view(tState);
+  Kokkos::deep_copy(tStateHost, tState);
+  auto tBatchResultHost = Kokkos::create_mirror_view(tBatchResult);
+  Kokkos::deep_copy(tBatchResultHost, tBatchResult);
+  auto tThreadResultHost = Kokkos::create_mirror_view(tThreadResult);
+  Kokkos::deep_copy(tThreadResultHost, tThreadResult);
+
+  for(Plato::OrdinalType tThread = 0; tThread < tNumThreads; tThread++)
+  {
+    for(Plato::OrdinalType tValue = 0; tValue < tNumValues; tValue++)
+    {
+      auto tGold = 2.0*tStateHost(tThread, tValue)*(1.0 + std::sin(0.5));
+      TEST_FLOATING_EQUALITY(tBatchResultHost(tThread, tValue), tGold, 1e-14);
+      TEST_FLOATING_EQUALITY(tThreadResultHost(tThread, tValue), tGold, 1e-14);
+    }
+  }
+
+  tExpEval.clear_storage();
+}
+
 } // namespace PlatoUnitTests
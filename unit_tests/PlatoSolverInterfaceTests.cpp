@@ -152,7 +152,7 @@ ElasticProblemParameters elastic_2d_parameters(const Plato::Scalar aMeshPhysical
 }
 
 Plato::ScalarVector::HostMirror
-test_elastic_problem_solution(const Plato::Mesh& aMesh, const std::string& aSolverParameters)
+test_elastic_problem_solution(const Plato::Mesh& aMesh, const std::string& aSolverParameters, const int aNumSolves = 1)
 {
     using PhysicsType = ::Plato::Elliptic::Linear::Mechanics<Plato::Tri3>;
     using ElementType = typename PhysicsType::ElementType;
@@ -204,12 +204,15 @@ test_elastic_problem_solution(const Plato::Mesh& aMesh, const std::string& aSolv
     MPI_Comm_dup(MPI_COMM_WORLD, &myComm);
     Plato::Comm::Machine tMachine(myComm);
 
-    Kokkos::deep_copy(tState, 0.0);
     {
         Teuchos::RCP<Teuchos::ParameterList> tSolverParams = Teuchos::getParametersFromXmlString(aSolverParameters);
         Plato::SolverFactory tSolverFactory(*tSolverParams);
         auto tSolver = tSolverFactory.create(aMesh->NumNodes(), tMachine, tNumDofsPerNode);
-        tSolver->solve(*tJacobian, tState, tResidual);
+        for(int tSolveIndex = 0; tSolveIndex < aNumSolves; tSolveIndex++)
+        {
+            Kokkos::deep_copy(tState, 0.0);
+            tSolver->solve(*tJacobian, tState, tResidual);
+        }
     }
     Plato::ScalarVector tStateSolution("state", tNumDofs);
     Kokkos::deep_copy(tStateSolution, tState);
@@ -254,13 +257,14 @@ void test_vs_analytic_2d_solution(
     const double aRelativeTol, 
     const double aSmallTol,
     Teuchos::FancyOStream &aOut, 
-    bool &aSuccess)
+    bool &aSuccess,
+    const int aNumSolves = 1)
 {
     // Use structured binding in C++17:
     Plato::Mesh tMesh;
     BamG::MeshSpec tMeshSpec;
     std::tie(tMesh, tMeshSpec) = Plato::TestHelpers::get_box_mesh_with_spec("TRI3", aMeshWidth);
-    const auto tSolution = test_elastic_problem_solution(tMesh, aSolverParameters);
+    const auto tSolution = test_elastic_problem_solution(tMesh, aSolverParameters, aNumSolves);
     const ElasticProblemParameters tElasticParams = elastic_2d_parameters(tMeshSpec.dimX);
     for(int i = 0; i < tSolution.size(); i++)
     {
@@ -709,6 +713,127 @@ TEUCHOS_UNIT_TEST( SolverInterfaceTests, MatrixConversionTpetra )
 }
 
 
+/******************************************************************************/
+/*!
+  \brief Test matrix conversion with a reused graph
+
+  Convert a 2D elasticity jacobian to a Tpetra_Matrix, change its entries,
+  and convert it again.  Test passes if both conversions share the graph and
+  the second conversion holds the new entries.
+*/
+/******************************************************************************/
+TEUCHOS_UNIT_TEST( SolverInterfaceTests, MatrixConversionTpetra_StaticGraph )
+{
+  // create test mesh
+  //
+  constexpr int meshWidth=2;
+  auto tMesh = Plato::TestHelpers::get_box_mesh("TRI3", meshWidth);
+
+  using ElementType = typename Plato::MechanicsElement<Plato::Tri3>;
+
+  int tNumDofsPerNode = ElementType::mNumDofsPerNode;
+  int tNumNodes = tMesh->NumNodes();
+  int tNumDofs = tNumNodes*tNumDofsPerNode;
+
+  // create mesh based density
+  //
+  Plato::Database tDatabase;
+  Plato::ScalarVector control("density", tNumDofs);
+  Kokkos::deep_copy(control, 1.0);
+  tDatabase.vector("controls",control);
+
+  // create mesh based state
+  //
+  Plato::ScalarVector state("state", tNumDofs);
+  Kokkos::deep_copy(state, 0.0);
+  tDatabase.vector("states",state);
+
+  // create material model
+  //
+  Teuchos::RCP<Teuchos::ParameterList> tParamList =
+    Teuchos::getParametersFromXmlString(
+    "<ParameterList name='Plato Problem'>                                      \n"
+    "  <ParameterList name='Spatial Model'>                                    \n"
+    "    <ParameterList name='Domains'>                                        \n"
+    "      <ParameterList name='Design Volume'>                                \n"
+    "        <Parameter name='Element Block' type='string' value='body'/>      \n"
+    "        <Parameter name='Material Model' type='string' value='Unobtainium'/> \n"
+    "      </ParameterList>                                                    \n"
+    "    </ParameterList>                                                      \n"
+    "  </ParameterList>                                                        \n"
+    "  <Parameter name='PDE Constraint' type='string' value='Elliptic'/>       \n"
+    "  <Parameter name='Self-Adjoint' type='bool' value='true'/>               \n"
+    "  <ParameterList name='Elliptic'>                                         \n"
+    "    <ParameterList name='Penalty Function'>                               \n"
+    "      <Parameter name='Type' type='string' value='SIMP'/>                 \n"
+    "      <Parameter name='Exponent' type='double' value='1.0'/>              \n"
+    "    </ParameterList>                                                      \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList name='Material Models'>                                  \n"
+    "    <ParameterList name='Unobtainium'>                                    \n"
+    "      <ParameterList name='Isotropic Linear Elastic'>                     \n"
+    "        <Parameter  name='Poissons Ratio' type='double' value='0.3'/>     \n"
+    "        <Parameter  name='Youngs Modulus' type='double' value='1.0e11'/>  \n"
+    "      </ParameterList>                                                    \n"
+    "    </ParameterList>                                                      \n"
+    "  </ParameterList>                                                        \n"
+    "</ParameterList>                                                          \n"
+  );
+
+  Plato::DataMap tDataMap;
+
+  Plato::SpatialModel tSpatialModel(tMesh, *tParamList, tDataMap);
+
+  Plato::Elliptic::VectorFunction<::Plato::Elliptic::Linear::Mechanics<Plato::Tri3>>
+    vectorFunction(tParamList->get<std::string>("PDE Constraint"), tSpatialModel, tDataMap, *tParamList);
+
+  // compute and test constraint value
+  //
+  auto jacobian = vectorFunction.jacobianState(tDatabase,/*cycle=*/0.);
+
+  MPI_Comm myComm;
+  MPI_Comm_dup(MPI_COMM_WORLD, &myComm);
+  Plato::Comm::Machine tMachine(myComm);
+
+  Plato::TpetraSystem tSystem(tMesh->NumNodes(), tMachine, tNumDofsPerNode);
+
+  auto tTpetra_Matrix = tSystem.fromMatrix(*jacobian);
+
+  // change the entries only; the converted matrix must share the first graph
+  auto tEntries = jacobian->entries();
+  Kokkos::parallel_for(Kokkos::RangePolicy<>(0, tEntries.extent(0)), KOKKOS_LAMBDA(const Plato::OrdinalType & aOrdinal)
+  {
+    tEntries(aOrdinal) *= 2.0;
+  });
+  auto tScaledTpetra_Matrix = tSystem.fromMatrix(*jacobian);
+  TEST_ASSERT(tScaledTpetra_Matrix->getCrsGraph().get() == tTpetra_Matrix->getCrsGraph().get());
+
+  auto tFullPlato  = Plato::TestHelpers::to_full(jacobian);
+
+  using indices_view_type = Tpetra::CrsMatrix<Plato::Scalar, int, Plato::OrdinalType>::nonconst_global_inds_host_view_type;
+  using values_view_type = Tpetra::CrsMatrix<Plato::Scalar, int, Plato::OrdinalType>::nonconst_values_host_view_type;
+
+  for(int iRow=0; iRow<tFullPlato.size(); iRow++)
+  {
+    size_t tNumEntriesInRow = tScaledTpetra_Matrix->getNumEntriesInGlobalRow(iRow);
+    values_view_type tRowValues("values", tNumEntriesInRow);
+    indices_view_type tColumnIndices("indices", tNumEntriesInRow);
+    tScaledTpetra_Matrix->getGlobalRowCopy(iRow, tColumnIndices, tRowValues, tNumEntriesInRow);
+
+    std::vector<Plato::Scalar> tTpetraRowValues(tFullPlato[iRow].size(), 0.0);
+    for(size_t i = 0; i < tNumEntriesInRow; ++i)
+    {
+      tTpetraRowValues[tColumnIndices[i]] = tRowValues[i];
+    }
+
+    for(int iCol=0; iCol<tFullPlato[iRow].size(); iCol++)
+    {
+        TEST_FLOATING_EQUALITY(tTpetraRowValues[iCol], tFullPlato[iRow][iCol], 1.0e-15);
+    }
+  }
+}
+
+
 /******************************************************************************/
 /*!
   \brief Test matrix conversion mismatch
@@ -1044,6 +1169,37 @@ TEUCHOS_UNIT_TEST( SolverInterfaceTests, TpetraElastic2D )
     test_vs_analytic_2d_solution(tTpetraWithMueLuParameters, tMeshWidth, tRelativeTolForPreconditioner, tSmallTol, out, success);
 }
 
+/******************************************************************************/
+/*!
+  \brief 2D Elastic problem solved repeatedly with each preconditioner reuse
+  policy.  Reused and refreshed preconditioners must give the same solution.
+*/
+/******************************************************************************/
+TEUCHOS_UNIT_TEST( SolverInterfaceTests, TpetraElastic2D_PreconditionerReuse )
+{
+    constexpr int tMeshWidth = 8;
+    constexpr int tNumSolves = 3;
+    constexpr double tRelativeTol = 1e-11;
+    constexpr double tSmallTol = 1e-18;
+    for(const std::string tPackage : {"ifpack2", "MueLu"})
+    {
+      for(const std::string tReuse : {"none", "symbolic", "fixed", "iterations"})
+      {
+        const std::string tTpetraParameters =
+          "<ParameterList name='Linear Solver'>                                                      \n"
+          "  <Parameter name='Solver Stack' type='string' value='Tpetra'/>                           \n"
+          "  <Parameter name='Iterations' type='int' value='500'/>                                   \n"
+          "  <Parameter name='Tolerance' type='double' value='1e-14'/>                               \n"
+          "  <Parameter name='Preconditioner Package' type='string' value='" + tPackage + "'/>       \n"
+          "  <Parameter name='Preconditioner Reuse' type='string' value='" + tReuse + "'/>           \n"
+          "  <Parameter name='Preconditioner Reuse Count' type='int' value='2'/>                     \n"
+          "  <Parameter name='Preconditioner Reuse Iteration Limit' type='int' value='400'/>         \n"
+          "</ParameterList>                                                                          \n";
+        test_vs_analytic_2d_solution(tTpetraParameters, tMeshWidth, tRelativeTol, tSmallTol, out, success, tNumSolves);
+      }
+    }
+}
+
 /******************************************************************************/
 /*!
   \brief Tpetra Linear Solver will accept direct parameterlist input for
@@ -1435,6 +1591,49 @@ TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, TachoSolver_BlockMatrix)
   }
 }
 
+TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, TachoSolver_BlockMatrixRefactor)
+{
+  namespace pth = Plato::TestHelpers;
+
+  constexpr unsigned numRows = 4;
+  auto tMatrixA = Teuchos::rcp( new Plato::CrsMatrixType(numRows, numRows, 2, 2) );
+  std::vector<Plato::OrdinalType> tRowMapA = {0, 2, 4};
+  std::vector<Plato::OrdinalType> tColMapA = {0, 1, 0, 1};
+  std::vector<Plato::Scalar>      tValuesA = {2.0, -1.0, -1.0, 2.0,
+                                              0.0, 0.0, -1.0, 0.0,
+                                              0.0, -1.0, 0.0, 0.0,
+                                              2.0, -1.0, -1.0, 2.0};
+  pth::set_matrix_data(tMatrixA, tRowMapA, tColMapA, tValuesA);
+
+  std::vector<Plato::Scalar> rhs = {1.0, -1.0, 1.0, -1.0};
+  Plato::ScalarVector b("b", numRows);
+  Plato::ScalarVector x("x", numRows);
+  pth::set_view_from_vector(b, rhs);
+
+  const std::string tSolverParams = "<ParameterList name='Linear Solver'>\n"
+                                    "  <Parameter name='Solver Stack' type='string' value='Tacho'/>\n"
+                                    "</ParameterList>\n";
+  auto tSolver = solver(tSolverParams, numRows);
+  tSolver->solve(*tMatrixA, x, b);
+
+  // same graph, new values: only the numeric factorization is redone
+  auto tEntries = tMatrixA->entries();
+  Kokkos::parallel_for(Kokkos::RangePolicy<>(0, tEntries.extent(0)), KOKKOS_LAMBDA(const Plato::OrdinalType & aIndex) {
+      tEntries(aIndex) *= 2.0;
+  });
+  tSolver->solve(*tMatrixA, x, b);
+
+  auto x_host = Kokkos::create_mirror_view(x);
+  Kokkos::deep_copy(x_host, x);
+
+  constexpr std::array<Plato::Scalar, 4> x_gold = {0.2, -0.1, 0.1, -0.2};
+
+  for(unsigned i=0; i<numRows; i++)
+  {
+    TEST_FLOATING_EQUALITY(x_host(i), x_gold[i], 1.0e-12);
+  }
+}
+
 /******************************************************************************/
 /*!
   \brief 2D Elastic problem
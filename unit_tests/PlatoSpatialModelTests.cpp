@@ -15,6 +15,7 @@
 #include "PlatoMask.hpp"
 #include "MechanicsElement.hpp"
 #include "SpatialModel.hpp"
+#include "GeometricFactors.hpp"
 #include "BLAS1.hpp"
 #include "base/WorksetBase.hpp"
 
@@ -359,4 +360,82 @@ TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, FixedBlockWorksetControlGivesOnes)
 
 }
 
+TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, CachedGeometricFactors)
+{
+  // create spatial domain input
+  //
+  Teuchos::RCP<Teuchos::ParameterList> tInputParams =
+    Teuchos::getParametersFromXmlString(
+    "<ParameterList name='Plato Problem'>                                         \n"
+    "  <ParameterList name='Spatial Model'>                                       \n"
+    "    <ParameterList name='Domains'>                                           \n"
+    "      <ParameterList name='Design Volume'>                                   \n"
+    "        <Parameter name='Element Block' type='string' value='body'/>         \n"
+    "        <Parameter name='Material Model' type='string' value='matl'/>        \n"
+    "        <Parameter name='Cache Geometric Factors' type='bool' value='true'/> \n"
+    "      </ParameterList>                                                       \n"
+    "    </ParameterList>                                                         \n"
+    "  </ParameterList>                                                           \n"
+    "</ParameterList>                                                             \n"
+  );
+
+  constexpr int meshWidth=2;
+  auto tMesh = Plato::TestHelpers::get_box_mesh("TET4", meshWidth);
+
+  Plato::DataMap tDataMap;
+  Plato::SpatialModel tSpatialModel(tMesh, *tInputParams, tDataMap);
+  auto & tDomain = tSpatialModel.Domains[0];
+  TEST_ASSERT(tDomain.geometricFactors().enabled());
+
+  using ElementType = Plato::MechanicsElement<Plato::Tet4>;
+  constexpr auto tNodesPerCell = ElementType::mNumNodesPerCell;
+  constexpr auto tSpaceDims = ElementType::mNumSpatialDims;
+  auto tNumCells = tDomain.numCells();
+
+  // compare cached factors to factors computed from the configuration, before and after the coordinates are scaled
+  Plato::WorksetBase<ElementType> tWorksetBase(tMesh);
+  for(Plato::Scalar tScale : {1.0, 2.0})
+  {
+    if(tScale != 1.0)
+    {
+      Plato::ScalarVector tCoords("coordinates", tMesh->Coordinates().extent(0));
+      Kokkos::deep_copy(tCoords, tMesh->Coordinates());
+      Plato::blas1::scale(tScale, tCoords);
+      tMesh->SetCoordinates(tCoords);
+    }
+
+    Plato::ScalarArray3D tConfigWS("config workset", tNumCells, tNodesPerCell, tSpaceDims);
+    tWorksetBase.worksetConfig(tConfigWS);
+
+    Plato::GeometricFactors<ElementType> tGeometricFactors(tDomain, tConfigWS);
+    TEST_ASSERT(tGeometricFactors.isCached());
+
+    Plato::ComputeGradientMatrix<ElementType> tComputeGradient;
+    auto tCubPoints  = ElementType::getCubPoints();
+    auto tCubWeights = ElementType::getCubWeights();
+    Plato::ScalarVector tMaxError("max error", 1);
+    Plato::ScalarVector tTotalVolume("total volume", 1);
+    Kokkos::parallel_for("compare factors", Kokkos::RangePolicy<>(0, tNumCells),
+    KOKKOS_LAMBDA(const Plato::OrdinalType iCellOrdinal)
+    {
+      Plato::Scalar tVolume(0.0), tCachedVolume(0.0);
+      Plato::Matrix<tNodesPerCell, tSpaceDims> tGradient, tCachedGradient;
+      tComputeGradient(iCellOrdinal, tCubPoints(0), tConfigWS, tGradient, tVolume);
+      tGeometricFactors(iCellOrdinal, 0, tCubPoints(0), tConfigWS, tCachedGradient, tCachedVolume);
+
+      Plato::Scalar tError = fabs(tVolume*tCubWeights(0) - tCachedVolume);
+      for(int I=0; I<tNodesPerCell; I++)
+        for(int k=0; k<tSpaceDims; k++)
+          tError = fmax(tError, fabs(tGradient(I,k) - tCachedGradient(I,k)));
+      Kokkos::atomic_max(&tMaxError(0), tError);
+      Kokkos::atomic_add(&tTotalVolume(0), tCachedVolume);
+    });
+
+    auto tMaxErrorHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tMaxError);
+    auto tTotalVolumeHost = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tTotalVolume);
+    TEST_ASSERT(tMaxErrorHost(0) < 1e-12);
+    TEST_FLOATING_EQUALITY(tTotalVolumeHost(0), tScale*tScale*tScale, 1e-12);
+  }
+}
+
 } // namespace PlatoUnitTests
@@ -4,6 +4,7 @@
 
 #include "ParseTools.hpp"
 #include "SpatialModel.hpp"
+#include "AnalyzeOutput.hpp"
 #include "PlatoUtilities.hpp"
 #include "InputDataUtils.hpp"
 #include "util/PlatoTestHelpers.hpp"
@@ -285,4 +286,97 @@ TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, uniformSpatialBasis)
   TEST_FLOATING_EQUALITY( tBasis_Host(1,2,0), 0, DBL_EPSILON);
   TEST_FLOATING_EQUALITY( tBasis_Host(1,1,0), 0, DBL_EPSILON);
 }
+
+/******************************************************************************/
+/*!
+  \brief Parse a state output plan and check which steps and fields are kept.
+*/
+/******************************************************************************/
+TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, stateOutputPlan)
+{
+  Teuchos::RCP<Teuchos::ParameterList> tParamList =
+    Teuchos::getParametersFromXmlString(
+    "<ParameterList name='Plato Problem'>                                        \n"
+    "  <ParameterList name='State Output'>                                       \n"
+    "    <Parameter name='Fields' type='Array(string)' value='{stress}'/>        \n"
+    "    <Parameter name='Stride' type='int' value='2'/>                         \n"
+    "    <Parameter name='Keep Last' type='int' value='2'/>                      \n"
+    "  </ParameterList>                                                          \n"
+    "</ParameterList>                                                            \n"
+  );
+
+  Plato::DataMap tDataMap;
+  tDataMap.mOutputPlan = Plato::parse_state_output_plan(*tParamList, /*aMesh=*/nullptr);
+
+  for(Plato::OrdinalType tStepIndex = 0; tStepIndex < 7; tStepIndex++)
+  {
+    tDataMap.scalarVectors["stress"] = Plato::ScalarVector("stress", 4);
+    tDataMap.scalarVectors["strain"] = Plato::ScalarVector("strain", 4);
+    tDataMap.saveState(tStepIndex, 0.1*tStepIndex);
+    TEST_EQUALITY(0, tDataMap.scalarVectors.size());
+  }
+
+  // steps 0, 2, 4, and 6 are selected, only the last two are kept
+  TEST_EQUALITY(7, tDataMap.numStateSteps());
+  TEST_EQUALITY(2, tDataMap.stateDataMaps.size());
+  TEST_EQUALITY(4, tDataMap.stateStepIndices[0]);
+  TEST_EQUALITY(6, tDataMap.stateStepIndices[1]);
+  TEST_FLOATING_EQUALITY(0.6, tDataMap.stateTimes[1], 1e-14);
+  TEST_EQUALITY(-1, tDataMap.stateIndex(2));
+  TEST_EQUALITY(-1, tDataMap.stateIndex(5));
+  TEST_EQUALITY(1, tDataMap.stateIndex(6));
+
+  auto tState = tDataMap.getState(tDataMap.stateIndex(4));
+  TEST_EQUALITY(1, tState.scalarVectors.count("stress"));
+  TEST_EQUALITY(0, tState.scalarVectors.count("strain"));
+
+  tDataMap.clearStates();
+  TEST_EQUALITY(0, tDataMap.numStateSteps());
+  TEST_EQUALITY(0, tDataMap.stateDataMaps.size());
+}
+
+/******************************************************************************/
+/*!
+  \brief Listed times select the first step that reaches each time, selected
+         states are streamed to the sink instead of being stored.
+*/
+/******************************************************************************/
+TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, stateOutputPlanTimesAndSink)
+{
+  Teuchos::RCP<Teuchos::ParameterList> tParamList =
+    Teuchos::getParametersFromXmlString(
+    "<ParameterList name='Plato Problem'>                                        \n"
+    "  <ParameterList name='State Output'>                                       \n"
+    "    <Parameter name='Times' type='Array(double)' value='{0.5, 0.25}'/>      \n"
+    "  </ParameterList>                                                          \n"
+    "</ParameterList>                                                            \n"
+  );
+
+  Plato::DataMap tDataMap;
+  tDataMap.mOutputPlan = Plato::parse_state_output_plan(*tParamList, /*aMesh=*/nullptr);
+  TEST_EQUALITY(0, tDataMap.mOutputPlan.mStride);
+
+  std::vector<Plato::OrdinalType> tPlotIndices;
+  std::vector<Plato::Scalar> tTimes;
+  tDataMap.mOutputPlan.mSink = [&](Plato::OrdinalType aPlotIndex, Plato::Scalar aTime, const Plato::DataMap & aState)
+  {
+    tPlotIndices.push_back(aPlotIndex);
+    tTimes.push_back(aTime);
+    TEST_EQUALITY(1, aState.scalarVectors.count("stress"));
+  };
+
+  for(Plato::OrdinalType tStepIndex = 0; tStepIndex < 8; tStepIndex++)
+  {
+    tDataMap.scalarVectors["stress"] = Plato::ScalarVector("stress", 4);
+    tDataMap.saveState(tStepIndex, 0.1*tStepIndex);
+  }
+
+  TEST_EQUALITY(0, tDataMap.stateDataMaps.size());
+  TEST_EQUALITY(2, tPlotIndices.size());
+  TEST_EQUALITY(0, tPlotIndices[0]);
+  TEST_EQUALITY(1, tPlotIndices[1]);
+  TEST_FLOATING_EQUALITY(0.3, tTimes[0], 1e-14);
+  TEST_FLOATING_EQUALITY(0.5, tTimes[1], 1e-14);
+}
+
 }
@@ -3749,6 +3749,60 @@ TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, Thermoplasticity_TimeData_Test2)
     TEST_FLOATING_EQUALITY(tTimeData.mCurrentTimeStepSize, 2.5/8.0, tTolerance);
 }
 
+TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, Thermoplasticity_TimeData_VariableStepHistory)
+{
+    Teuchos::RCP<Teuchos::ParameterList> tParamList =
+    Teuchos::getParametersFromXmlString(
+      "<ParameterList name='Plato Problem'>                                                     \n"
+      "  <ParameterList name='Time Stepping'>                                                   \n"
+      "    <Parameter name='Initial Num. Pseudo Time Steps' type='int' value='4'/>              \n"
+      "    <Parameter name='Maximum Num. Pseudo Time Steps' type='int' value='16'/>             \n"
+      "    <Parameter name='End Time' type='double' value='2.0'/>                               \n"
+      "  </ParameterList>                                                                       \n"
+      "</ParameterList>                                                                         \n"
+    );
+
+    Plato::TimeData tTimeData(*tParamList);
+    constexpr Plato::Scalar tTolerance = 1.0e-7;
+
+    // uniform steps
+    tTimeData.updateTimeData(1);
+    TEST_FLOATING_EQUALITY(tTimeData.mCurrentTime, 1.0, tTolerance);
+    TEST_FLOATING_EQUALITY(tTimeData.getPreviousTime(), 0.5, tTolerance);
+    TEST_FLOATING_EQUALITY(tTimeData.getTime(3), 2.0, tTolerance);
+
+    // second step cut back once, then grown back
+    tTimeData.mTimeHistory = {0.5, 0.75, 1.25, 1.75, 2.0};
+    tTimeData.updateTimeData(0);
+    TEST_FLOATING_EQUALITY(tTimeData.mCurrentTime, 0.5, tTolerance);
+    TEST_FLOATING_EQUALITY(tTimeData.mCurrentTimeStepSize, 0.5, tTolerance);
+    TEST_FLOATING_EQUALITY(tTimeData.getPreviousTime(), 0.0, tTolerance);
+
+    tTimeData.updateTimeData(1);
+    TEST_ASSERT(!tTimeData.atFinalTimeStep());
+    TEST_FLOATING_EQUALITY(tTimeData.mCurrentTime, 0.75, tTolerance);
+    TEST_FLOATING_EQUALITY(tTimeData.mCurrentTimeStepSize, 0.25, tTolerance);
+    TEST_FLOATING_EQUALITY(tTimeData.getPreviousTime(), 0.5, tTolerance);
+
+    // copies, e.g. the ones used by the adjoint solver, see the same history
+    Plato::TimeData tCopy(tTimeData);
+    tCopy.updateTimeData(4);
+    TEST_ASSERT(tCopy.atFinalTimeStep());
+    TEST_FLOATING_EQUALITY(tCopy.mCurrentTimeStepSize, 0.25, tTolerance);
+    TEST_FLOATING_EQUALITY(tCopy.getPreviousTime(), 1.75, tTolerance);
+
+    // past the last step
+    tCopy.updateTimeData(5);
+    TEST_FLOATING_EQUALITY(tCopy.mCurrentTime, 2.0, tTolerance);
+
+    // restart with uniform steps
+    tTimeData.increaseNumTimeSteps();
+    TEST_ASSERT(tTimeData.mTimeHistory.empty());
+    TEST_EQUALITY(tTimeData.mNumTimeSteps, 8);
+    tTimeData.updateTimeData(1);
+    TEST_FLOATING_EQUALITY(tTimeData.mCurrentTime, 0.5, tTolerance);
+}
+
 TEUCHOS_UNIT_TEST(PlatoAnalyzeUnitTests, CleanUpFiles)
 {
     const int tTrash = std::system("rm -f plato_analyze_newton_raphson_diagnostics.txt");
@@ -24,6 +24,7 @@
 #include "elliptic/criterioneval/CriterionEvaluatorScalarFunction.hpp"
 #include "geometric/GeometryScalarFunction.hpp"
 #include "ApplyConstraints.hpp"
+#include "BLAS1.hpp"
 #include "elliptic/Problem.hpp"
 #include "elliptic/thermal/Thermal.hpp"
 
@@ -557,3 +558,125 @@ TEUCHOS_UNIT_TEST( DerivativeTests, FluxPNorm3D )
     }
   }
 }
+
+/******************************************************************************/
+/*! 
+  \brief Check the gradient of InternalThermalEnergy with a temperature dependent
+         conductivity against a finite difference.  The jacobian isn't symmetric
+         and the newton solve takes several steps, so the forward operator isn't
+         reused for the adjoint solve.
+*/
+/******************************************************************************/
+TEUCHOS_UNIT_TEST( DerivativeTests, TemperatureDependentInternalThermalEnergyGradient3D )
+{ 
+  // create input
+  //
+  Teuchos::RCP<Teuchos::ParameterList> tParamList =
+    Teuchos::getParametersFromXmlString(
+    "<ParameterList name='Plato Problem'>                                          \n"
+    "  <ParameterList name='Spatial Model'>                                        \n"
+    "    <ParameterList name='Domains'>                                            \n"
+    "      <ParameterList name='Design Volume'>                                    \n"
+    "        <Parameter name='Element Block' type='string' value='body'/>          \n"
+    "        <Parameter name='Material Model' type='string' value='Unobtainium'/>  \n"
+    "      </ParameterList>                                                        \n"
+    "    </ParameterList>                                                          \n"
+    "  </ParameterList>                                                            \n"
+    "  <Parameter name='Physics' type='string' value='Thermal'/>                   \n"
+    "  <Parameter name='PDE Constraint' type='string' value='Elliptic'/>           \n"
+    "  <ParameterList name='Elliptic'>                                             \n"
+    "    <ParameterList name='Penalty Function'>                                   \n"
+    "      <Parameter name='Exponent' type='double' value='3.0'/>                  \n"
+    "      <Parameter name='Minimum Value' type='double' value='1.0e-8'/>          \n"
+    "      <Parameter name='Type' type='string' value='SIMP'/>                     \n"
+    "    </ParameterList>                                                          \n"
+    "  </ParameterList>                                                            \n"
+    "  <ParameterList name='Newton Iteration'>                                     \n"
+    "    <Parameter name='Maximum Iterations' type='int' value='10'/>              \n"
+    "    <Parameter name='Residual Tolerance' type='double' value='1.0e-10'/>      \n"
+    "  </ParameterList>                                                            \n"
+    "  <ParameterList name='Criteria'>                                             \n"
+    "    <ParameterList name='Internal Thermal Energy'>                            \n"
+    "      <Parameter name='Type' type='string' value='Scalar Function'/>          \n"
+    "      <Parameter name='Scalar Function Type' type='string' value='Internal Thermal Energy'/>  \n"
+    "      <ParameterList name='Penalty Function'>                                 \n"
+    "        <Parameter name='Exponent' type='double' value='3.0'/>                \n"
+    "        <Parameter name='Minimum Value' type='double' value='1.0e-8'/>        \n"
+    "        <Parameter name='Type' type='string' value='SIMP'/>                   \n"
+    "      </ParameterList>                                                        \n"
+    "    </ParameterList>                                                          \n"
+    "  </ParameterList>                                                            \n"
+    "  <ParameterList name='Material Models'>                                      \n"
+    "    <ParameterList name='Unobtainium'>                                        \n"
+    "      <ParameterList name='Thermal Conduction'>                               \n"
+    "        <Parameter name='Temperature Dependent' type='bool' value='true'/>    \n"
+    "        <ParameterList name='Thermal Conductivity'>                           \n"
+    "          <Parameter name='c011' type='double' value='100.0'/>                \n"
+    "          <Parameter name='c111' type='double' value='80.0'/>                 \n"
+    "        </ParameterList>                                                      \n"
+    "      </ParameterList>                                                        \n"
+    "    </ParameterList>                                                          \n"
+    "  </ParameterList>                                                            \n"
+    "  <ParameterList  name='Essential Boundary Conditions'>                       \n"
+    "    <ParameterList  name='Cold Side'>                                         \n"
+    "      <Parameter  name='Type'     type='string' value='Zero Value'/>          \n"
+    "      <Parameter  name='Index'    type='int'    value='0'/>                   \n"
+    "      <Parameter  name='Sides'    type='string' value='x-'/>                  \n"
+    "    </ParameterList>                                                          \n"
+    "    <ParameterList  name='Hot Side'>                                          \n"
+    "      <Parameter  name='Type'     type='string' value='Fixed Value'/>         \n"
+    "      <Parameter  name='Index'    type='int'    value='0'/>                   \n"
+    "      <Parameter  name='Sides'    type='string' value='x+'/>                  \n"
+    "      <Parameter  name='Value'    type='double' value='2.0'/>                 \n"
+    "    </ParameterList>                                                          \n"
+    "  </ParameterList>                                                            \n"
+    "</ParameterList>                                                              \n"
+  );
+
+  constexpr int meshWidth=2;
+  auto tMesh = Plato::TestHelpers::get_box_mesh("TET4", meshWidth);
+
+  MPI_Comm myComm;
+  MPI_Comm_dup(MPI_COMM_WORLD, &myComm);
+  Plato::Comm::Machine tMachine(myComm);
+
+  using PhysicsT = Plato::Elliptic::Linear::Thermal<Plato::Tet4>;
+  Plato::Elliptic::Problem<PhysicsT> tProblem(tMesh, *tParamList, tMachine);
+
+  auto tNumVerts = tMesh->NumNodes();
+  Plato::ScalarVector tControls("Controls", tNumVerts);
+  auto tControls_Host = Kokkos::create_mirror_view( tControls );
+  for(int iNode=0; iNode<int(tNumVerts); iNode++){
+    tControls_Host(iNode) = 0.5 + 0.1*(iNode % 4);
+  }
+  Kokkos::deep_copy( tControls, tControls_Host );
+
+  // the newton solve takes more than one step
+  auto tSolution = tProblem.solution(tControls);
+  auto tGradient = tProblem.criterionGradient(tControls, tSolution, "Internal Thermal Energy");
+  auto tGradient_Host = Kokkos::create_mirror_view( tGradient );
+  Kokkos::deep_copy( tGradient_Host, tGradient );
+
+  Plato::ScalarVector tStep("Step", tNumVerts);
+  auto tStep_Host = Kokkos::create_mirror_view( tStep );
+  Plato::Scalar tDirectional = 0.0;
+  for(int iNode=0; iNode<int(tNumVerts); iNode++){
+    tStep_Host(iNode) = 1.0e-4*(1.0 + (iNode % 3));
+    tDirectional += tStep_Host(iNode)*tGradient_Host(iNode);
+  }
+  Kokkos::deep_copy( tStep, tStep_Host );
+
+  Plato::ScalarVector tControlsPlus("Controls", tNumVerts);
+  Kokkos::deep_copy( tControlsPlus, tControls );
+  Plato::blas1::axpy(1.0, tStep, tControlsPlus);
+  auto tSolutionPlus = tProblem.solution(tControlsPlus);
+  auto tValuePlus = tProblem.criterionValue(tControlsPlus, tSolutionPlus, "Internal Thermal Energy");
+
+  Plato::ScalarVector tControlsMinus("Controls", tNumVerts);
+  Kokkos::deep_copy( tControlsMinus, tControls );
+  Plato::blas1::axpy(-1.0, tStep, tControlsMinus);
+  auto tSolutionMinus = tProblem.solution(tControlsMinus);
+  auto tValueMinus = tProblem.criterionValue(tControlsMinus, tSolutionMinus, "Internal Thermal Energy");
+
+  TEST_FLOATING_EQUALITY( tDirectional, (tValuePlus - tValueMinus)/2.0, 1e-5);
+}
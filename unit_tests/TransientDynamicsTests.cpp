@@ -19,6 +19,7 @@
 #include "solver/ParallelComm.hpp"
 
 #include "Tet4.hpp"
+#include "Tet10.hpp"
 #include "Solutions.hpp"
 #include "GradientMatrix.hpp"
 #include "SmallStrain.hpp"
@@ -2561,3 +2562,648 @@ TEUCHOS_UNIT_TEST( TransientMechanicsFormulationTests, UFormAndAFormEquivalenceW
   }
 
 }
+
+TEUCHOS_UNIT_TEST( TransientMechanicsFormulationTests, LinearOperatorReuseWithTimeDependentEssentialBCs )
+{
+  // create comm
+  //
+  MPI_Comm myComm;
+  MPI_Comm_dup(MPI_COMM_WORLD, &myComm);
+  Plato::Comm::Machine tMachine(myComm);
+
+  // create test mesh
+  //
+  constexpr int cMeshWidth=2;
+  auto tMesh = Plato::TestHelpers::get_box_mesh("TET4", cMeshWidth);
+
+  // create input
+  //
+  Teuchos::RCP<Teuchos::ParameterList> tInputParams =
+    Teuchos::getParametersFromXmlString(
+    "<ParameterList name='Plato Problem'>                                      \n"
+    "  <Parameter name='PDE Constraint' type='string' value='Hyperbolic'/>     \n"
+    "  <Parameter name='Physics' type='string' value='Mechanical'/>            \n"
+    "  <Parameter name='Self-Adjoint' type='bool' value='false'/>              \n"
+    "  <ParameterList name='Hyperbolic'>                                       \n"
+    "    <ParameterList name='Penalty Function'>                               \n"
+    "      <Parameter name='Exponent' type='double' value='1.0'/>              \n"
+    "      <Parameter name='Minimum Value' type='double' value='0.0'/>         \n"
+    "      <Parameter name='Type' type='string' value='SIMP'/>                 \n"
+    "    </ParameterList>                                                      \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList name='Spatial Model'>                                     \n"
+    "    <ParameterList name='Domains'>                                         \n"
+    "      <ParameterList name='Design Volume'>                                 \n"
+    "        <Parameter name='Element Block' type='string' value='body'/>       \n"
+    "        <Parameter name='Material Model' type='string' value='Alyoominium'/>\n"
+    "      </ParameterList>                                                     \n"
+    "    </ParameterList>                                                       \n"
+    "  </ParameterList>                                                         \n"
+    "  <ParameterList name='Criteria'>                                         \n"
+    "    <ParameterList name='Internal Energy'>                                \n"
+    "      <Parameter name='Type' type='string' value='Scalar Function'/>      \n"
+    "      <Parameter name='Scalar Function Type' type='string' value='Internal Elastic Energy'/> \n"
+    "      <ParameterList name='Penalty Function'>                             \n"
+    "        <Parameter name='Type' type='string' value='SIMP'/>               \n"
+    "        <Parameter name='Exponent' type='double' value='1.0'/>            \n"
+    "        <Parameter name='Minimum Value' type='double' value='0.0'/>       \n"
+    "      </ParameterList>                                                    \n"
+    "    </ParameterList>                                                      \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList name='Material Models'>                                  \n"
+    "    <ParameterList name='Alyoominium'>                                    \n"
+    "      <ParameterList name='Isotropic Linear Elastic'>                       \n"
+    "        <Parameter name='Mass Density' type='double' value='2.7'/>          \n"
+    "        <Parameter  name='Poissons Ratio' type='double' value='0.36'/>      \n"
+    "        <Parameter  name='Youngs Modulus' type='double' value='68.0e10'/>   \n"
+    "      </ParameterList>                                                      \n"
+    "    </ParameterList>                                                        \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList name='Time Integration'>                                 \n"
+    "    <Parameter name='Newmark Gamma' type='double' value='0.5'/>           \n"
+    "    <Parameter name='Newmark Beta' type='double' value='0.25'/>           \n"
+    "    <Parameter name='Number Time Steps' type='int' value='10'/>            \n"
+    "    <Parameter name='Time Step' type='double' value='1.0e-7'/>            \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList  name='State Essential Boundary Conditions'>                     \n"
+    "    <ParameterList  name='x+ Applied Displacement'>            \n"
+    "      <Parameter name='Type'   type='string'        value='Time Dependent'/>     \n"
+    "      <Parameter name='Index'  type='int'           value='0'/>     \n"
+    "      <Parameter name='Sides'  type='string'        value='x+'/>          \n"
+    "      <Parameter name='Function' type='string' value='w=2e-6; p=0.01; pi=3.14159264; p*sin(pi*t/w)'/> \n"
+    "    </ParameterList>                                                      \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList  name='State Dot Dot Essential Boundary Conditions'>                     \n"
+    "    <ParameterList  name='x+ Applied Acceleration'>            \n"
+    "      <Parameter name='Type'   type='string'        value='Time Dependent'/>     \n"
+    "      <Parameter name='Index'  type='int'           value='0'/>     \n"
+    "      <Parameter name='Sides'  type='string'        value='x+'/>          \n"
+    "      <Parameter name='Function' type='string' value='w=2e-6; p=0.01; pi=3.14159264; -p*(pi*pi/w/w)*sin(pi*t/w)'/> \n"
+    "    </ParameterList>                                                      \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList name='Linear Solver'>                              \n"
+    "    <Parameter name='Solver Stack' type='string' value='Epetra'/>        \n"
+    "    <Parameter name='Display Iterations' type='int' value='0'/>     \n"
+    "    <Parameter name='Iterations' type='int' value='50'/>            \n"
+    "    <Parameter name='Tolerance' type='double' value='1e-14'/>       \n"
+    "  </ParameterList>                                                  \n"
+    "</ParameterList>                                                          \n"
+  );
+
+  auto tNumVerts = tMesh->NumNodes();
+  Plato::ScalarVector tControl("Control", tNumVerts);
+  Plato::blas1::fill(1.0, tControl);
+
+  /*****************************************************
+   Test that the linear fast path, which assembles the
+   effective operator once, reproduces the full solve
+   for both formulations and repeated solutions, and
+   that the adjoint solves, which reuse the operator,
+   reproduce the criterion gradients wrt z and x
+   *****************************************************/
+
+  for(bool tAForm : {false, true})
+  {
+    Teuchos::ParameterList tParams(*tInputParams);
+    tParams.sublist("Time Integration").set("A-Form", tAForm);
+
+    auto tProblemFull =
+      std::make_unique<Plato::Hyperbolic::Problem<Plato::Hyperbolic::Mechanics<Plato::Tet4>>>
+      (tMesh, tParams, tMachine);
+
+    tParams.sublist("Time Integration").set("Linear", true);
+    auto tProblemLinear =
+      std::make_unique<Plato::Hyperbolic::Problem<Plato::Hyperbolic::Mechanics<Plato::Tet4>>>
+      (tMesh, tParams, tMachine);
+
+    auto tSolutionFull = tProblemFull->solution(tControl);
+    tProblemLinear->solution(tControl);
+    auto tSolutionLinear = tProblemLinear->solution(tControl);
+
+    for(std::string tName : {"State", "StateDot", "StateDotDot"})
+    {
+      auto tStatesFull = tSolutionFull.get(tName);
+      auto tStatesLinear = tSolutionLinear.get(tName);
+
+      auto tStatesFull_Host = Kokkos::create_mirror_view( tStatesFull );
+      Kokkos::deep_copy( tStatesFull_Host, tStatesFull );
+      auto tStatesLinear_Host = Kokkos::create_mirror_view( tStatesLinear );
+      Kokkos::deep_copy( tStatesLinear_Host, tStatesLinear );
+
+      for(int iStep=0; iStep<int(tStatesFull_Host.extent(0)); iStep++){
+        for(int iDof=0; iDof<int(tStatesFull_Host.extent(1)); iDof++){
+          TEST_FLOATING_EQUALITY(
+            tStatesLinear_Host(iStep, iDof),
+            tStatesFull_Host(iStep, iDof), 1e-8);
+        }
+      }
+    }
+
+    auto tGradientZFull   = tProblemFull->criterionGradient(tControl, tSolutionFull, "Internal Energy");
+    auto tGradientZLinear = tProblemLinear->criterionGradient(tControl, tSolutionLinear, "Internal Energy");
+    auto tGradientXFull   = tProblemFull->criterionGradientX(tControl, tSolutionFull, "Internal Energy");
+    auto tGradientXLinear = tProblemLinear->criterionGradientX(tControl, tSolutionLinear, "Internal Energy");
+
+    for(auto tGradients : {std::make_pair(tGradientZFull, tGradientZLinear), std::make_pair(tGradientXFull, tGradientXLinear)})
+    {
+      auto tGradientFull_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tGradients.first);
+      auto tGradientLinear_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tGradients.second);
+      TEST_EQUALITY(tGradientFull_Host.extent(0), tGradientLinear_Host.extent(0));
+
+      Plato::Scalar tMaxEntry = 0.0;
+      for(int iDof=0; iDof<int(tGradientFull_Host.extent(0)); iDof++){
+        tMaxEntry = std::max(tMaxEntry, std::abs(tGradientFull_Host(iDof)));
+      }
+      TEST_ASSERT(tMaxEntry > 0.0);
+      for(int iDof=0; iDof<int(tGradientFull_Host.extent(0)); iDof++){
+        TEST_ASSERT(std::abs(tGradientLinear_Host(iDof) - tGradientFull_Host(iDof)) <= 1e-8*tMaxEntry);
+      }
+    }
+  }
+}
+
+TEUCHOS_UNIT_TEST( TransientMechanicsIntegratorTests, CentralDifference )
+{
+  Teuchos::RCP<Teuchos::ParameterList> tIntegratorParams =
+    Teuchos::getParametersFromXmlString(
+    "<ParameterList name='Time Integration'>                                   \n"
+    "  <Parameter name='Integrator' type='string' value='Central Difference'/> \n"
+    "  <Parameter name='Number Time Steps' type='int' value='10'/>             \n"
+    "</ParameterList>                                                          \n"
+  );
+
+  Plato::Scalar tMaxEigenvalue = 4.0;
+  Plato::CentralDifferenceIntegrator tIntegrator(*tIntegratorParams, tMaxEigenvalue);
+
+  TEST_ASSERT(tIntegrator.isExplicit());
+  TEST_ASSERT(tIntegrator.isConditionallyStable());
+
+  // critical time step, 2/omega_max, times the default scale
+  TEST_FLOATING_EQUALITY(tIntegrator.getTimeStep(), 0.5*2.0/tMaxEigenvalue, 1.0e-15);
+
+  Plato::Scalar tTimeStep = 0.1;
+  TEST_FLOATING_EQUALITY(tIntegrator.v_grad_a(tTimeStep), -0.5*tTimeStep, 1.0e-15);
+  TEST_ASSERT(tIntegrator.u_grad_a(tTimeStep) == 0.0);
+  TEST_FLOATING_EQUALITY(tIntegrator.v_grad_a_prev(tTimeStep), -0.5*tTimeStep, 1.0e-15);
+  TEST_FLOATING_EQUALITY(tIntegrator.u_grad_v_prev(tTimeStep), -tTimeStep, 1.0e-15);
+  TEST_FLOATING_EQUALITY(tIntegrator.u_grad_a_prev(tTimeStep), -0.5*tTimeStep*tTimeStep, 1.0e-15);
+
+  // a time step can't be given to a conditionally stable integrator
+  tIntegratorParams->set("Time Step", 1.0e-7);
+  TEST_THROW(Plato::CentralDifferenceIntegrator(*tIntegratorParams, tMaxEigenvalue), std::runtime_error);
+}
+
+TEUCHOS_UNIT_TEST( TransientMechanicsProblemTests, CentralDifference )
+{
+  // create test mesh
+  //
+  constexpr int cMeshWidth=2;
+  auto tMesh = Plato::TestHelpers::get_box_mesh("TET4", cMeshWidth);
+
+  // create input for explicit transient mechanics problem
+  //
+  Teuchos::RCP<Teuchos::ParameterList> tInputParams =
+    Teuchos::getParametersFromXmlString(
+    "<ParameterList name='Plato Problem'>                                      \n"
+    "  <Parameter name='PDE Constraint' type='string' value='Hyperbolic'/>     \n"
+    "  <Parameter name='Physics' type='string' value='Mechanical'/>            \n"
+    "  <Parameter name='Self-Adjoint' type='bool' value='false'/>              \n"
+    "  <ParameterList name='Hyperbolic'>                                       \n"
+    "    <ParameterList name='Penalty Function'>                               \n"
+    "      <Parameter name='Exponent' type='double' value='3.0'/>              \n"
+    "      <Parameter name='Minimum Value' type='double' value='0.0'/>         \n"
+    "      <Parameter name='Type' type='string' value='SIMP'/>                 \n"
+    "    </ParameterList>                                                      \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList name='Spatial Model'>                                     \n"
+    "    <ParameterList name='Domains'>                                         \n"
+    "      <ParameterList name='Design Volume'>                                 \n"
+    "        <Parameter name='Element Block' type='string' value='body'/>       \n"
+    "        <Parameter name='Material Model' type='string' value='Alyoominium'/>\n"
+    "      </ParameterList>                                                     \n"
+    "    </ParameterList>                                                       \n"
+    "  </ParameterList>                                                         \n"
+    "  <ParameterList name='Criteria'>                                         \n"
+    "    <ParameterList name='Internal Energy'>                                \n"
+    "      <Parameter name='Type' type='string' value='Scalar Function'/>      \n"
+    "      <Parameter name='Scalar Function Type' type='string' value='Internal Elastic Energy'/> \n"
+    "      <ParameterList name='Penalty Function'>                             \n"
+    "        <Parameter name='Type' type='string' value='SIMP'/>               \n"
+    "        <Parameter name='Exponent' type='double' value='3.0'/>            \n"
+    "        <Parameter name='Minimum Value' type='double' value='0.0'/>       \n"
+    "      </ParameterList>                                                    \n"
+    "    </ParameterList>                                                      \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList name='Material Models'>                                  \n"
+    "    <ParameterList name='Alyoominium'>                                    \n"
+    "      <ParameterList name='Isotropic Linear Elastic'>                       \n"
+    "        <Parameter name='Mass Density' type='double' value='2.7'/>          \n"
+    "        <Parameter  name='Poissons Ratio' type='double' value='0.36'/>      \n"
+    "        <Parameter  name='Youngs Modulus' type='double' value='68.0e10'/>   \n"
+    "      </ParameterList>                                                      \n"
+    "    </ParameterList>                                                        \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList name='Time Integration'>                                 \n"
+    "    <Parameter name='Integrator' type='string' value='Central Difference'/> \n"
+    "    <Parameter name='Number Time Steps' type='int' value='10'/>            \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList  name='Natural Boundary Conditions'>                     \n"
+    "    <ParameterList  name='Traction Vector Boundary Condition'>            \n"
+    "      <Parameter name='Type'   type='string'        value='Uniform'/>     \n"
+    "      <Parameter name='Values' type='Array(double)' value='{1e3, 0, 0}'/> \n"
+    "      <Parameter name='Sides'  type='string'        value='x+'/>          \n"
+    "    </ParameterList>                                                      \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList  name='State Dot Dot Essential Boundary Conditions'>     \n"
+    "    <ParameterList  name='x- Fixed'>                                      \n"
+    "      <Parameter name='Type'   type='string' value='Zero Value'/>         \n"
+    "      <Parameter name='Index'  type='int'    value='0'/>                  \n"
+    "      <Parameter name='Sides'  type='string' value='x-'/>                 \n"
+    "    </ParameterList>                                                      \n"
+    "  </ParameterList>                                                        \n"
+    "</ParameterList>                                                          \n"
+  );
+
+  MPI_Comm myComm;
+  MPI_Comm_dup(MPI_COMM_WORLD, &myComm);
+  Plato::Comm::Machine tMachine(myComm);
+
+  // no 'Linear Solver' is needed
+  //
+  Plato::Hyperbolic::Problem<Plato::Hyperbolic::Mechanics<Plato::Tet4>>
+  tProblem(tMesh, *tInputParams, tMachine);
+
+  auto tNumVerts = tMesh->NumNodes();
+  Plato::ScalarVector tControl("Control", tNumVerts);
+  Plato::blas1::fill(0.9, tControl);
+
+  /*****************************************************
+   Test HRZ lumping equals row sum lumping for Tet4
+   *****************************************************/
+
+  auto tSolution = tProblem.solution(tControl);
+  auto tDisplacements = tSolution.get("State");
+  auto tDisplacements_Host = Kokkos::create_mirror_view( tDisplacements );
+  Kokkos::deep_copy( tDisplacements_Host, tDisplacements );
+
+  Teuchos::ParameterList tParamsHRZ(*tInputParams);
+  tParamsHRZ.sublist("Time Integration").set("Mass Lumping", std::string("HRZ"));
+  Plato::Hyperbolic::Problem<Plato::Hyperbolic::Mechanics<Plato::Tet4>>
+  tProblemHRZ(tMesh, tParamsHRZ, tMachine);
+
+  auto tDisplacementsHRZ = tProblemHRZ.solution(tControl).get("State");
+  auto tDisplacementsHRZ_Host = Kokkos::create_mirror_view( tDisplacementsHRZ );
+  Kokkos::deep_copy( tDisplacementsHRZ_Host, tDisplacementsHRZ );
+
+  auto tLastStep = tDisplacements_Host.extent(0) - 1;
+  Plato::Scalar tMaxDisplacement = 0.0;
+  for(int iDof=0; iDof<int(tDisplacements_Host.extent(1)); iDof++){
+    tMaxDisplacement = std::max(tMaxDisplacement, fabs(tDisplacements_Host(tLastStep, iDof)));
+    TEST_ASSERT(fabs(tDisplacementsHRZ_Host(tLastStep, iDof) - tDisplacements_Host(tLastStep, iDof)) < 1e-12*tMaxDisplacement + 1e-30);
+  }
+  TEST_ASSERT(tMaxDisplacement > 0.0);
+
+  // the explicit newmark a-form lumps the assembled operator, which can't be HRZ lumped
+  Teuchos::ParameterList tParamsNewmarkHRZ(tParamsHRZ);
+  tParamsNewmarkHRZ.sublist("Time Integration").set("Integrator", std::string("Newmark"));
+  tParamsNewmarkHRZ.sublist("Time Integration").set("A-Form", true);
+  tParamsNewmarkHRZ.sublist("Time Integration").set("Newmark Beta", 0.0);
+  tParamsNewmarkHRZ.sublist("Time Integration").set("Time Step", 1.0e-7);
+  TEST_THROW(Plato::Hyperbolic::Problem<Plato::Hyperbolic::Mechanics<Plato::Tet4>>
+    (tMesh, tParamsNewmarkHRZ, tMachine), std::runtime_error);
+
+  /*****************************************************
+   Test the discrete adjoint with a finite difference
+   *****************************************************/
+
+  auto tGradient = tProblem.criterionGradient(tControl, "Internal Energy");
+  auto tGradient_Host = Kokkos::create_mirror_view( tGradient );
+  Kokkos::deep_copy( tGradient_Host, tGradient );
+
+  Plato::ScalarVector tStep("Step", tNumVerts);
+  auto tStep_Host = Kokkos::create_mirror_view( tStep );
+  Plato::Scalar tDirectional = 0.0;
+  for(int iNode=0; iNode<int(tNumVerts); iNode++){
+    tStep_Host(iNode) = 1.0e-4*(1.0 + (iNode % 3));
+    tDirectional += tStep_Host(iNode)*tGradient_Host(iNode);
+  }
+  Kokkos::deep_copy( tStep, tStep_Host );
+
+  Plato::ScalarVector tControlPlus("Control", tNumVerts);
+  Kokkos::deep_copy( tControlPlus, tControl );
+  Plato::blas1::axpy(1.0, tStep, tControlPlus);
+  tProblem.solution(tControlPlus);
+  auto tValuePlus = tProblem.criterionValue(tControlPlus, "Internal Energy");
+
+  Plato::ScalarVector tControlMinus("Control", tNumVerts);
+  Kokkos::deep_copy( tControlMinus, tControl );
+  Plato::blas1::axpy(-1.0, tStep, tControlMinus);
+  tProblem.solution(tControlMinus);
+  auto tValueMinus = tProblem.criterionValue(tControlMinus, "Internal Energy");
+
+  TEST_FLOATING_EQUALITY( tDirectional, (tValuePlus - tValueMinus)/2.0, 1e-5);
+}
+
+TEUCHOS_UNIT_TEST( TransientMechanicsResidualTests, LumpedMassHRZ_Tet10 )
+{
+  // create input for the residual of the central difference integrator
+  //
+  Teuchos::RCP<Teuchos::ParameterList> tInputParams =
+    Teuchos::getParametersFromXmlString(
+    "<ParameterList name='Plato Problem'>                                       \n"
+    "  <Parameter name='PDE Constraint' type='string' value='Hyperbolic'/>      \n"
+    "  <Parameter name='Self-Adjoint' type='bool' value='false'/>               \n"
+    "  <ParameterList name='Hyperbolic'>                                        \n"
+    "    <ParameterList name='Penalty Function'>                                \n"
+    "      <Parameter name='Exponent' type='double' value='1.0'/>               \n"
+    "      <Parameter name='Minimum Value' type='double' value='0.0'/>          \n"
+    "      <Parameter name='Type' type='string' value='SIMP'/>                  \n"
+    "    </ParameterList>                                                       \n"
+    "  </ParameterList>                                                         \n"
+    "  <ParameterList name='Spatial Model'>                                     \n"
+    "    <ParameterList name='Domains'>                                         \n"
+    "      <ParameterList name='Design Volume'>                                 \n"
+    "        <Parameter name='Element Block' type='string' value='body'/>       \n"
+    "        <Parameter name='Material Model' type='string' value='6061-T6 Aluminum'/>\n"
+    "      </ParameterList>                                                     \n"
+    "    </ParameterList>                                                       \n"
+    "  </ParameterList>                                                         \n"
+    "  <ParameterList name='Material Models'>                                   \n"
+    "    <ParameterList name='6061-T6 Aluminum'>                                \n"
+    "      <ParameterList name='Isotropic Linear Elastic'>                      \n"
+    "        <Parameter name='Mass Density' type='double' value='2.7'/>         \n"
+    "        <Parameter  name='Poissons Ratio' type='double' value='0.36'/>     \n"
+    "        <Parameter  name='Youngs Modulus' type='double' value='68.0e10'/>  \n"
+    "      </ParameterList>                                                     \n"
+    "    </ParameterList>                                                       \n"
+    "  </ParameterList>                                                         \n"
+    "  <ParameterList name='Time Integration'>                                  \n"
+    "    <Parameter name='Integrator' type='string' value='Central Difference'/>\n"
+    "    <Parameter name='Mass Lumping' type='string' value='HRZ'/>             \n"
+    "    <Parameter name='Number Time Steps' type='int' value='2'/>             \n"
+    "  </ParameterList>                                                         \n"
+    "</ParameterList>                                                           \n"
+  );
+
+  // create test mesh
+  //
+  constexpr int cMeshWidth=1;
+  constexpr int cSpaceDim=3;
+  auto tMesh = Plato::TestHelpers::get_box_mesh("TET10", cMeshWidth);
+
+  auto tNumVerts = tMesh->NumNodes();
+  auto tNumDofs = cSpaceDim*tNumVerts;
+  Plato::ScalarVector tControl("Control", tNumVerts);
+  Plato::blas1::fill(1.0, tControl);
+
+  Plato::ScalarVector tU("Displacement", tNumDofs);
+  Plato::ScalarVector tV("Velocity", tNumDofs);
+  Plato::ScalarVector tA("Acceleration", tNumDofs);
+  Plato::Scalar tTimeStep = 1.0e-7;
+
+  // the lumped mass is the (diagonal) gradient of the residual wrt the acceleration
+  //
+  Plato::DataMap tDataMap;
+  Plato::SpatialModel tSpatialModel(tMesh, *tInputParams, tDataMap);
+  Plato::Hyperbolic::VectorFunction<::Plato::Hyperbolic::Mechanics<Plato::Tet10>>
+    tVectorFunctionHRZ(tSpatialModel, tDataMap, *tInputParams, tInputParams->get<std::string>("PDE Constraint"));
+  auto tLumpedHRZ = Plato::Solve::LumpedDiagonal<cSpaceDim>(tVectorFunctionHRZ.gradient_a(tU, tV, tA, tControl, tTimeStep));
+  auto tLumpedHRZ_Host = Kokkos::create_mirror_view( tLumpedHRZ );
+  Kokkos::deep_copy( tLumpedHRZ_Host, tLumpedHRZ );
+
+  tInputParams->sublist("Time Integration").set("Mass Lumping", std::string("Row Sum"));
+  Plato::Hyperbolic::VectorFunction<::Plato::Hyperbolic::Mechanics<Plato::Tet10>>
+    tVectorFunctionRowSum(tSpatialModel, tDataMap, *tInputParams, tInputParams->get<std::string>("PDE Constraint"));
+  auto tLumpedRowSum = Plato::Solve::LumpedDiagonal<cSpaceDim>(tVectorFunctionRowSum.gradient_a(tU, tV, tA, tControl, tTimeStep));
+  auto tLumpedRowSum_Host = Kokkos::create_mirror_view( tLumpedRowSum );
+  Kokkos::deep_copy( tLumpedRowSum_Host, tLumpedRowSum );
+
+  // HRZ: element mass distributed in proportion to the diagonal of the element mass
+  //
+  constexpr int cNumNodesPerCell = Plato::Tet10::mNumNodesPerCell;
+  auto tCubPoints = Plato::Tet10::getCubPoints();
+  auto tCubWeights = Plato::Tet10::getCubWeights();
+  Plato::Array<cNumNodesPerCell> tFractions(0.0);
+  Plato::Scalar tFractionsTotal = 0.0;
+  for(int iGp=0; iGp<int(tCubWeights.size()); iGp++){
+    auto tBasisValues = Plato::Tet10::basisValues(tCubPoints(iGp));
+    for(int iNode=0; iNode<cNumNodesPerCell; iNode++){
+      tFractions(iNode) += tCubWeights(iGp)*tBasisValues(iNode)*tBasisValues(iNode);
+      tFractionsTotal += tCubWeights(iGp)*tBasisValues(iNode)*tBasisValues(iNode);
+    }
+  }
+
+  auto tCoords = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tMesh->Coordinates());
+  auto tCells2Nodes = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tMesh->Connectivity());
+  Plato::Scalar tDensity = 2.7;
+  std::vector<Plato::Scalar> tLumpedGold(tNumDofs, 0.0);
+  for(int iCell=0; iCell<int(tMesh->NumElements()); iCell++){
+    Plato::Scalar tEdges[cSpaceDim][cSpaceDim];
+    auto tOrigin = tCells2Nodes(iCell*cNumNodesPerCell);
+    for(int iEdge=0; iEdge<cSpaceDim; iEdge++){
+      auto tVertex = tCells2Nodes(iCell*cNumNodesPerCell + iEdge + 1);
+      for(int iDim=0; iDim<cSpaceDim; iDim++){
+        tEdges[iEdge][iDim] = tCoords(tVertex*cSpaceDim + iDim) - tCoords(tOrigin*cSpaceDim + iDim);
+      }
+    }
+    Plato::Scalar tVolume = fabs(
+        tEdges[0][0]*(tEdges[1][1]*tEdges[2][2] - tEdges[1][2]*tEdges[2][1])
+      - tEdges[0][1]*(tEdges[1][0]*tEdges[2][2] - tEdges[1][2]*tEdges[2][0])
+      + tEdges[0][2]*(tEdges[1][0]*tEdges[2][1] - tEdges[1][1]*tEdges[2][0]))/6.0;
+    for(int iNode=0; iNode<cNumNodesPerCell; iNode++){
+      auto tNode = tCells2Nodes(iCell*cNumNodesPerCell + iNode);
+      for(int iDim=0; iDim<cSpaceDim; iDim++){
+        tLumpedGold[tNode*cSpaceDim + iDim] += tDensity*tVolume*tFractions(iNode)/tFractionsTotal;
+      }
+    }
+  }
+
+  Plato::Scalar tTotalHRZ = 0.0, tTotalRowSum = 0.0;
+  bool tRowSumHasNonPositive = false;
+  for(int iDof=0; iDof<int(tNumDofs); iDof++){
+    TEST_FLOATING_EQUALITY(tLumpedHRZ_Host(iDof), tLumpedGold[iDof], 1.0e-12);
+    TEST_ASSERT(tLumpedHRZ_Host(iDof) > 0.0);
+    tRowSumHasNonPositive = tRowSumHasNonPositive || (tLumpedRowSum_Host(iDof) <= 0.0);
+    tTotalHRZ += tLumpedHRZ_Host(iDof);
+    tTotalRowSum += tLumpedRowSum_Host(iDof);
+  }
+
+  // both preserve the mass of the unit cube, but the row sum of Tet10 isn't positive at the vertices
+  TEST_FLOATING_EQUALITY(tTotalHRZ, cSpaceDim*tDensity, 1.0e-12);
+  TEST_FLOATING_EQUALITY(tTotalRowSum, cSpaceDim*tDensity, 1.0e-12);
+  TEST_ASSERT(tRowSumHasNonPositive);
+}
+
+TEUCHOS_UNIT_TEST( TransientMechanicsProblemTests, CheckpointedAdjoint )
+{
+  // create comm
+  //
+  MPI_Comm myComm;
+  MPI_Comm_dup(MPI_COMM_WORLD, &myComm);
+  Plato::Comm::Machine tMachine(myComm);
+
+  // create test mesh
+  //
+  constexpr int cMeshWidth=2;
+  auto tMesh = Plato::TestHelpers::get_box_mesh("TET4", cMeshWidth);
+
+  // create input.  the 'Time Integration' sublist is set below.
+  //
+  Teuchos::RCP<Teuchos::ParameterList> tInputParams =
+    Teuchos::getParametersFromXmlString(
+    "<ParameterList name='Plato Problem'>                                      \n"
+    "  <Parameter name='PDE Constraint' type='string' value='Hyperbolic'/>     \n"
+    "  <Parameter name='Physics' type='string' value='Mechanical'/>            \n"
+    "  <Parameter name='Self-Adjoint' type='bool' value='false'/>              \n"
+    "  <ParameterList name='Hyperbolic'>                                       \n"
+    "    <ParameterList name='Penalty Function'>                               \n"
+    "      <Parameter name='Exponent' type='double' value='3.0'/>              \n"
+    "      <Parameter name='Minimum Value' type='double' value='0.0'/>         \n"
+    "      <Parameter name='Type' type='string' value='SIMP'/>                 \n"
+    "    </ParameterList>                                                      \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList name='Spatial Model'>                                     \n"
+    "    <ParameterList name='Domains'>                                         \n"
+    "      <ParameterList name='Design Volume'>                                 \n"
+    "        <Parameter name='Element Block' type='string' value='body'/>       \n"
+    "        <Parameter name='Material Model' type='string' value='Alyoominium'/>\n"
+    "      </ParameterList>                                                     \n"
+    "    </ParameterList>                                                       \n"
+    "  </ParameterList>                                                         \n"
+    "  <ParameterList name='Criteria'>                                         \n"
+    "    <ParameterList name='Internal Energy'>                                \n"
+    "      <Parameter name='Type' type='string' value='Scalar Function'/>      \n"
+    "      <Parameter name='Scalar Function Type' type='string' value='Internal Elastic Energy'/> \n"
+    "      <ParameterList name='Penalty Function'>                             \n"
+    "        <Parameter name='Type' type='string' value='SIMP'/>               \n"
+    "        <Parameter name='Exponent' type='double' value='3.0'/>            \n"
+    "        <Parameter name='Minimum Value' type='double' value='0.0'/>       \n"
+    "      </ParameterList>                                                    \n"
+    "    </ParameterList>                                                      \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList name='Material Models'>                                  \n"
+    "    <ParameterList name='Alyoominium'>                                    \n"
+    "      <ParameterList name='Isotropic Linear Elastic'>                       \n"
+    "        <Parameter name='Mass Density' type='double' value='2.7'/>          \n"
+    "        <Parameter  name='Poissons Ratio' type='double' value='0.36'/>      \n"
+    "        <Parameter  name='Youngs Modulus' type='double' value='68.0e10'/>   \n"
+    "      </ParameterList>                                                      \n"
+    "    </ParameterList>                                                        \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList  name='Natural Boundary Conditions'>                     \n"
+    "    <ParameterList  name='Traction Vector Boundary Condition'>            \n"
+    "      <Parameter name='Type'   type='string'        value='Uniform'/>     \n"
+    "      <Parameter name='Values' type='Array(double)' value='{1e3, 0, 0}'/> \n"
+    "      <Parameter name='Sides'  type='string'        value='x+'/>          \n"
+    "    </ParameterList>                                                      \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList  name='State Essential Boundary Conditions'>             \n"
+    "    <ParameterList  name='x- Fixed'>                                      \n"
+    "      <Parameter name='Type'   type='string' value='Zero Value'/>         \n"
+    "      <Parameter name='Index'  type='int'    value='0'/>                  \n"
+    "      <Parameter name='Sides'  type='string' value='x-'/>                 \n"
+    "    </ParameterList>                                                      \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList  name='State Dot Dot Essential Boundary Conditions'>     \n"
+    "    <ParameterList  name='x- Fixed'>                                      \n"
+    "      <Parameter name='Type'   type='string' value='Zero Value'/>         \n"
+    "      <Parameter name='Index'  type='int'    value='0'/>                  \n"
+    "      <Parameter name='Sides'  type='string' value='x-'/>                 \n"
+    "    </ParameterList>                                                      \n"
+    "  </ParameterList>                                                        \n"
+    "  <ParameterList name='Linear Solver'>                              \n"
+    "    <Parameter name='Solver Stack' type='string' value='Epetra'/>        \n"
+    "    <Parameter name='Display Iterations' type='int' value='0'/>     \n"
+    "    <Parameter name='Iterations' type='int' value='50'/>            \n"
+    "    <Parameter name='Tolerance' type='double' value='1e-14'/>       \n"
+    "  </ParameterList>                                                  \n"
+    "</ParameterList>                                                          \n"
+  );
+
+  // newmark u-form, linear newmark a-form, which reuses the operator across the
+  // recomputed and adjoint steps, and central difference
+  //
+  Teuchos::ParameterList tUForm("Time Integration");
+  tUForm.set("Newmark Gamma", 0.5);
+  tUForm.set("Newmark Beta", 0.25);
+  tUForm.set("Number Time Steps", 11);
+  tUForm.set("Time Step", 1.0e-7);
+
+  Teuchos::ParameterList tLinearAForm(tUForm);
+  tLinearAForm.set("A-Form", true);
+  tLinearAForm.set("Linear", true);
+
+  Teuchos::ParameterList tCentralDifference("Time Integration");
+  tCentralDifference.set("Integrator", std::string("Central Difference"));
+  tCentralDifference.set("Number Time Steps", 11);
+
+  auto tNumVerts = tMesh->NumNodes();
+  Plato::ScalarVector tControl("Control", tNumVerts);
+  Plato::blas1::fill(0.9, tControl);
+
+  using ProblemType = Plato::Hyperbolic::Problem<Plato::Hyperbolic::Mechanics<Plato::Tet4>>;
+
+  for(const auto & tIntegratorParams : {tUForm, tLinearAForm, tCentralDifference})
+  {
+    Teuchos::ParameterList tParams(*tInputParams);
+    tParams.sublist("Time Integration") = tIntegratorParams;
+
+    ProblemType tFullProblem(tMesh, tParams, tMachine);
+    auto tFullSolution = tFullProblem.solution(tControl);
+    auto tFullValue = tFullProblem.criterionValue(tControl, tFullSolution, "Internal Energy");
+    auto tFullGradient = tFullProblem.criterionGradient(tControl, tFullSolution, "Internal Energy");
+    auto tFullGradientX = tFullProblem.criterionGradientX(tControl, tFullSolution, "Internal Energy");
+    auto tFullStates = tFullSolution.get("State");
+    auto tFullStates_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tFullStates);
+    auto tLastStep = tFullStates_Host.extent(0) - 1;
+
+    // one checkpoint (the initial state) and three checkpoints for 11 time steps.  the
+    // second trial recomputes the checkpoints taken by the forward sweep.
+    for(int tNumCheckpoints : {1, 3})
+    {
+      tParams.sublist("Time Integration").set("Checkpoints", tNumCheckpoints);
+      ProblemType tProblem(tMesh, tParams, tMachine);
+      auto tSolution = tProblem.solution(tControl);
+      auto tValue = tProblem.criterionValue(tControl, tSolution, "Internal Energy");
+      TEST_FLOATING_EQUALITY(tValue, tFullValue, 1e-10);
+
+      // only the last two steps are stored
+      auto tStates = tSolution.get("State");
+      TEST_EQUALITY(tStates.extent(0), 2);
+      auto tStates_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tStates);
+      Plato::Scalar tMaxState = 0.0;
+      for(int iDof=0; iDof<int(tStates_Host.extent(1)); iDof++){
+        tMaxState = std::max(tMaxState, std::abs(tFullStates_Host(tLastStep, iDof)));
+      }
+      TEST_ASSERT(tMaxState > 0.0);
+      for(int iDof=0; iDof<int(tStates_Host.extent(1)); iDof++){
+        TEST_ASSERT(std::abs(tStates_Host(1, iDof) - tFullStates_Host(tLastStep, iDof)) <= 1e-10*tMaxState);
+      }
+
+      auto tGradient = tProblem.criterionGradient(tControl, tSolution, "Internal Energy");
+      auto tGradientX = tProblem.criterionGradientX(tControl, tSolution, "Internal Energy");
+      for(auto tGradients : {std::make_pair(tFullGradient, tGradient), std::make_pair(tFullGradientX, tGradientX)})
+      {
+        auto tFull_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tGradients.first);
+        auto tCheckpointed_Host = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), tGradients.second);
+        TEST_EQUALITY(tFull_Host.extent(0), tCheckpointed_Host.extent(0));
+
+        Plato::Scalar tMaxEntry = 0.0;
+        for(int iDof=0; iDof<int(tFull_Host.extent(0)); iDof++){
+          tMaxEntry = std::max(tMaxEntry, std::abs(tFull_Host(iDof)));
+        }
+        TEST_ASSERT(tMaxEntry > 0.0);
+        for(int iDof=0; iDof<int(tFull_Host.extent(0)); iDof++){
+          TEST_ASSERT(std::abs(tCheckpointed_Host(iDof) - tFull_Host(iDof)) <= 1e-8*tMaxEntry);
+        }
+      }
+    }
+  }
+
+  // the stress p-norm isn't a sum over the time steps
+  Teuchos::ParameterList tPNormParams(*tInputParams);
+  tPNormParams.sublist("Time Integration") = tUForm;
+  tPNormParams.sublist("Time Integration").set("Checkpoints", 3);
+  tPNormParams.sublist("Criteria").sublist("Internal Energy").set("Scalar Function Type", std::string("Stress P-Norm"));
+  TEST_THROW(ProblemType(tMesh, tPNormParams, tMachine), std::runtime_error);
+}